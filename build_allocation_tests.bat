@@ -0,0 +1,54 @@
+@ECHO OFF
+
+REM PUT THE COMPILER IN THE PATH IF IT ISN'T ALREADY.
+WHERE cl.exe
+REM IF %ERRORLEVEL% NEQ 0 CALL "C:\Program Files (x86)\Microsoft Visual Studio\2019\Community\VC\Auxiliary\Build\vcvarsall.bat" x64
+CALL "C:\Program Files (x86)\Microsoft Visual Studio\2019\Community\VC\Auxiliary\Build\vcvarsall.bat" x64
+WHERE cl.exe
+
+REM READ THE BUILD MODE COMMAND LINE ARGUMENT.
+REM Either "debug" or "release" (no quotes).
+REM If not specified, will default to debug.
+SET build_mode=%1
+
+REM DEFINE COMPILER OPTIONS.
+REM The library is built separately from the normal library with allocation tracking enabled.
+SET COMMON_COMPILER_OPTIONS=/EHsc /WX /W4 /TP /std:c++latest /DALLOCATION_TRACKING_ENABLED
+SET DEBUG_COMPILER_OPTIONS=%COMMON_COMPILER_OPTIONS% /Z7 /Od /MTd
+SET RELEASE_COMPILER_OPTIONS=%COMMON_COMPILER_OPTIONS% /O2 /MT
+
+REM DEFINE FILES TO COMPILE/LINK.
+SET LIBRARY_COMPILATION_FILE="..\Renderer3DLibrary.project"
+SET TEST_COMPILATION_FILE="..\Renderer3DTests.project"
+SET MAIN_CODE_DIR="..\code"
+SET TEST_CODE_DIR="..\testing"
+SET LIBRARIES=user32.lib gdi32.lib opengl32.lib glu32.lib Renderer3DLibraryAllocationTracking.lib
+
+REM CREATE THE COMMAND LINE OPTIONS FOR THE FILES TO COMPILE/LINK.
+SET INCLUDE_DIRS=/I %MAIN_CODE_DIR% /I %MAIN_CODE_DIR%\ThirdParty /I %TEST_CODE_DIR%
+SET LIBRARY_FILES_AND_DIRS=%LIBRARY_COMPILATION_FILE% %INCLUDE_DIRS% /c /FoRenderer3DLibraryAllocationTracking.obj
+SET TEST_FILES_DIRS_AND_LIBS=%TEST_COMPILATION_FILE% %INCLUDE_DIRS% /FeRenderer3DAllocationTests.exe /link %LIBRARIES%
+
+REM MOVE INTO THE BUILD DIRECTORY.
+IF NOT EXIST "build" MKDIR "build"
+PUSHD "build"
+
+    REM BUILD THE LIBRARY AND TESTS BASED ON THE BUILD MODE.
+    IF "%build_mode%"=="release" (
+        cl.exe %RELEASE_COMPILER_OPTIONS% %LIBRARY_FILES_AND_DIRS%
+        lib.exe Renderer3DLibraryAllocationTracking.obj
+        cl.exe %RELEASE_COMPILER_OPTIONS% %TEST_FILES_DIRS_AND_LIBS%
+    ) ELSE (
+        cl.exe %DEBUG_COMPILER_OPTIONS% %LIBRARY_FILES_AND_DIRS%
+        lib.exe Renderer3DLibraryAllocationTracking.obj
+        cl.exe %DEBUG_COMPILER_OPTIONS% %TEST_FILES_DIRS_AND_LIBS%
+    )
+
+    REM RUN THE ALLOCATION TESTS.
+    Renderer3DAllocationTests.exe "[AllocationTracker]"
+
+POPD
+
+ECHO Done
+
+@ECHO ON
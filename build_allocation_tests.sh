@@ -0,0 +1,48 @@
+#!/bin/sh
+
+# BUILDS AND RUNS THE ALLOCATION TESTS WITH HEAP ALLOCATION TRACKING ENABLED.
+# The library is built separately from the normal library with ALLOCATION_TRACKING_ENABLED,
+# so that the tests can verify rendering frames after warming up doesn't allocate memory.
+# This doesn't depend on Windows, so it can be used on Linux build servers.
+
+# STOP ON ANY ERRORS.
+set -e
+
+# READ THE BUILD MODE COMMAND LINE ARGUMENT.
+# Either "debug" or "release" (no quotes).
+# If not specified, will default to debug.
+build_mode=$1
+
+# DEFINE COMPILER OPTIONS.
+# POSIX signal handling is disabled in the tests since the bundled version of Catch doesn't compile with it on newer C libraries.
+COMPILER=${CXX:-g++}
+COMMON_COMPILER_OPTIONS="-std=c++20 -pthread -DALLOCATION_TRACKING_ENABLED"
+DEBUG_COMPILER_OPTIONS="$COMMON_COMPILER_OPTIONS -g -O0"
+RELEASE_COMPILER_OPTIONS="$COMMON_COMPILER_OPTIONS -O2 -DNDEBUG"
+if [ "$build_mode" = "release" ]; then
+    COMPILER_OPTIONS=$RELEASE_COMPILER_OPTIONS
+else
+    COMPILER_OPTIONS=$DEBUG_COMPILER_OPTIONS
+fi
+TEST_COMPILER_OPTIONS="$COMPILER_OPTIONS -DCATCH_CONFIG_NO_POSIX_SIGNALS"
+
+# DEFINE FILES TO COMPILE/LINK.
+MAIN_CODE_DIR="../code"
+TEST_CODE_DIR="../testing"
+INCLUDE_DIRS="-I $MAIN_CODE_DIR -I $MAIN_CODE_DIR/ThirdParty -I $TEST_CODE_DIR"
+
+# MOVE INTO THE BUILD DIRECTORY.
+mkdir -p build
+cd build
+
+# BUILD THE LIBRARY WITH ALLOCATION TRACKING.
+$COMPILER $COMPILER_OPTIONS $INCLUDE_DIRS -x c++ -c ../Renderer3DLibrary.project -o Renderer3DLibraryAllocationTracking.o
+ar rcs libRenderer3DLibraryAllocationTracking.a Renderer3DLibraryAllocationTracking.o
+
+# BUILD THE TESTS.
+$COMPILER $TEST_COMPILER_OPTIONS $INCLUDE_DIRS -x c++ ../Renderer3DTests.project -x none -L . -lRenderer3DLibraryAllocationTracking -o Renderer3DAllocationTests
+
+# RUN THE ALLOCATION TESTS.
+./Renderer3DAllocationTests "[AllocationTracker]"
+
+echo Done
@@ -0,0 +1,46 @@
+#!/bin/sh
+
+# BUILDS THE PERFORMANCE BENCHMARKS (AND THE PORTABLE PARTS OF THE LIBRARY THEY USE).
+# Benchmarks should normally be built in release mode to measure meaningful performance.
+
+# STOP ON ANY ERRORS.
+set -e
+
+# READ THE BUILD MODE COMMAND LINE ARGUMENT.
+# Either "debug" or "release" (no quotes).
+# If not specified, will default to release.
+build_mode=$1
+
+# DEFINE COMPILER OPTIONS.
+COMPILER=${CXX:-g++}
+COMMON_COMPILER_OPTIONS="-std=c++20 -pthread"
+DEBUG_COMPILER_OPTIONS="$COMMON_COMPILER_OPTIONS -g -O0"
+RELEASE_COMPILER_OPTIONS="$COMMON_COMPILER_OPTIONS -O2 -DNDEBUG"
+if [ "$build_mode" = "debug" ]; then
+    COMPILER_OPTIONS=$DEBUG_COMPILER_OPTIONS
+else
+    COMPILER_OPTIONS=$RELEASE_COMPILER_OPTIONS
+fi
+
+# DEFINE FILES TO COMPILE/LINK.
+MAIN_CODE_DIR="../code"
+INCLUDE_DIRS="-I $MAIN_CODE_DIR -I $MAIN_CODE_DIR/ThirdParty"
+
+# MOVE INTO THE BUILD DIRECTORY.
+mkdir -p build
+cd build
+
+# BUILD THE LIBRARY.
+$COMPILER $COMPILER_OPTIONS $INCLUDE_DIRS -x c++ -c ../Renderer3DLibrary.project -o Renderer3DLibrary.o
+ar rcs libRenderer3DLibrary.a Renderer3DLibrary.o
+
+# BUILD THE BENCHMARKS.
+$COMPILER $COMPILER_OPTIONS $INCLUDE_DIRS -x c++ ../RasterizerBenchmark.project -x none -L . -lRenderer3DLibrary -o RasterizerBenchmark
+$COMPILER $COMPILER_OPTIONS $INCLUDE_DIRS -x c++ ../RayTracerBenchmark.project -x none -L . -lRenderer3DLibrary -o RayTracerBenchmark
+
+# BUILD THE MATH BENCHMARKS WITH AND WITHOUT SIMD.
+# These don't link the library so that SIMD can be disabled for just the scalar version.
+$COMPILER $COMPILER_OPTIONS $INCLUDE_DIRS -x c++ ../MathBenchmark.project -o MathBenchmark
+$COMPILER $COMPILER_OPTIONS -DMATH_SIMD_DISABLED $INCLUDE_DIRS -x c++ ../MathBenchmark.project -o MathBenchmarkScalar
+
+echo Done
@@ -0,0 +1,44 @@
+#!/bin/sh
+
+# BUILDS AND RUNS THE GOLDEN IMAGE TESTS (AND THE PORTABLE PARTS OF THE LIBRARY THEY USE).
+# Rendered images are compared against the reference images in testing/GoldenImages.
+# This doesn't depend on Windows, so it can be used on Linux build servers.
+
+# STOP ON ANY ERRORS.
+set -e
+
+# READ THE BUILD MODE COMMAND LINE ARGUMENT.
+# Either "debug" or "release" (no quotes).
+# If not specified, will default to debug.
+build_mode=$1
+
+# DEFINE COMPILER OPTIONS.
+COMPILER=${CXX:-g++}
+COMMON_COMPILER_OPTIONS="-std=c++20 -pthread"
+DEBUG_COMPILER_OPTIONS="$COMMON_COMPILER_OPTIONS -g -O0"
+RELEASE_COMPILER_OPTIONS="$COMMON_COMPILER_OPTIONS -O2 -DNDEBUG"
+if [ "$build_mode" = "release" ]; then
+    COMPILER_OPTIONS=$RELEASE_COMPILER_OPTIONS
+else
+    COMPILER_OPTIONS=$DEBUG_COMPILER_OPTIONS
+fi
+
+# DEFINE FILES TO COMPILE/LINK.
+MAIN_CODE_DIR="../code"
+INCLUDE_DIRS="-I $MAIN_CODE_DIR -I $MAIN_CODE_DIR/ThirdParty"
+
+# MOVE INTO THE BUILD DIRECTORY.
+mkdir -p build
+cd build
+
+# BUILD THE LIBRARY.
+$COMPILER $COMPILER_OPTIONS $INCLUDE_DIRS -x c++ -c ../Renderer3DLibrary.project -o Renderer3DLibrary.o
+ar rcs libRenderer3DLibrary.a Renderer3DLibrary.o
+
+# BUILD THE PROGRAM.
+$COMPILER $COMPILER_OPTIONS $INCLUDE_DIRS -x c++ ../GoldenImageTests.project -x none -L . -lRenderer3DLibrary -o GoldenImageTests
+
+# RUN THE TESTS.
+./GoldenImageTests --references ../testing/GoldenImages
+
+echo Done
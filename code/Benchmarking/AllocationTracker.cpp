@@ -0,0 +1,194 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "Benchmarking/AllocationTracker.h"
+
+namespace BENCHMARKING
+{
+    /// The number of allocations by all threads.
+    static std::atomic<uint64_t> process_allocation_count = 0;
+    /// The total size in bytes of allocations by all threads.
+    static std::atomic<uint64_t> process_allocated_byte_count = 0;
+    /// The allocations by the current thread.
+    /// This is trivially constructible and destructible, so it's safe to use from operator new at any point in a thread's lifetime.
+    static thread_local AllocationCounts current_thread_allocation_counts;
+
+    /// Subtracts earlier counts to get the allocations made since then.
+    /// @param[in]  earlier_counts - The counts to subtract.
+    /// @return The difference in counts.
+    AllocationCounts AllocationCounts::operator-(const AllocationCounts& earlier_counts) const
+    {
+        AllocationCounts difference;
+        difference.AllocationCount = AllocationCount - earlier_counts.AllocationCount;
+        difference.AllocatedByteCount = AllocatedByteCount - earlier_counts.AllocatedByteCount;
+        return difference;
+    }
+
+    /// Checks if allocations are being tracked.
+    /// This is determined when building the library, since that's where operator new is replaced.
+    /// @return True if the library was built with ALLOCATION_TRACKING_ENABLED; false otherwise.
+    bool AllocationTracker::IsEnabled()
+    {
+#if defined(ALLOCATION_TRACKING_ENABLED)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /// Gets counts of allocations by all threads since the program started.
+    /// @return The allocation counts.
+    AllocationCounts AllocationTracker::GetProcessCounts()
+    {
+        AllocationCounts process_counts;
+        process_counts.AllocationCount = process_allocation_count.load(std::memory_order_relaxed);
+        process_counts.AllocatedByteCount = process_allocated_byte_count.load(std::memory_order_relaxed);
+        return process_counts;
+    }
+
+    /// Gets counts of allocations by the current thread since it started.
+    /// @return The allocation counts.
+    AllocationCounts AllocationTracker::GetCurrentThreadCounts()
+    {
+        return current_thread_allocation_counts;
+    }
+
+    /// Records an allocation by the current thread.
+    /// This is normally only called by operator new, but it's exposed for any custom allocators.
+    /// @param[in]  size_in_bytes - The size of the allocation.
+    void AllocationTracker::RecordAllocation(const std::size_t size_in_bytes)
+    {
+        process_allocation_count.fetch_add(1, std::memory_order_relaxed);
+        process_allocated_byte_count.fetch_add(size_in_bytes, std::memory_order_relaxed);
+        ++current_thread_allocation_counts.AllocationCount;
+        current_thread_allocation_counts.AllocatedByteCount += size_in_bytes;
+    }
+}
+
+#if defined(ALLOCATION_TRACKING_ENABLED)
+
+/// Allocates memory, following the standard behavior of operator new for failures.
+/// @param[in]  size_in_bytes - The size of memory to allocate.
+/// @param[in]  alignment_in_bytes - The alignment of the memory, or 0 for the default alignment.
+/// @return The allocated memory.
+/// @throws std::bad_alloc - Thrown if memory couldn't be allocated.
+static void* AllocateTrackedMemory(std::size_t size_in_bytes, const std::size_t alignment_in_bytes)
+{
+    // RECORD THE ALLOCATION.
+    BENCHMARKING::AllocationTracker::RecordAllocation(size_in_bytes);
+
+    // ALLOCATE THE MEMORY.
+    // Zero-size allocations must still return unique pointers.
+    size_in_bytes = (0 == size_in_bytes) ? 1 : size_in_bytes;
+    while (true)
+    {
+        void* memory = nullptr;
+        if (0 == alignment_in_bytes)
+        {
+            memory = std::malloc(size_in_bytes);
+        }
+        else
+        {
+#if _WIN32
+            memory = _aligned_malloc(size_in_bytes, alignment_in_bytes);
+#else
+            // The size must be a multiple of the alignment for aligned_alloc.
+            std::size_t aligned_size_in_bytes = ((size_in_bytes + alignment_in_bytes - 1) / alignment_in_bytes) * alignment_in_bytes;
+            memory = std::aligned_alloc(alignment_in_bytes, aligned_size_in_bytes);
+#endif
+        }
+        if (memory)
+        {
+            return memory;
+        }
+
+        // GIVE ANY NEW HANDLER A CHANCE TO FREE MEMORY.
+        std::new_handler new_handler = std::get_new_handler();
+        if (!new_handler)
+        {
+            throw std::bad_alloc();
+        }
+        new_handler();
+    }
+}
+
+/// Frees memory allocated with AllocateTrackedMemory().
+/// @param[in]  memory - The memory to free.
+/// @param[in]  alignment_in_bytes - The alignment the memory was allocated with, or 0 for the default alignment.
+static void FreeTrackedMemory(void* const memory, const std::size_t alignment_in_bytes)
+{
+#if _WIN32
+    if (0 != alignment_in_bytes)
+    {
+        _aligned_free(memory);
+        return;
+    }
+#else
+    (void)alignment_in_bytes;
+#endif
+    std::free(memory);
+}
+
+// REPLACEMENT GLOBAL ALLOCATION FUNCTIONS.
+// The standard library's default nothrow versions call these, so they don't need replacing.
+void* operator new(std::size_t size_in_bytes)
+{
+    return AllocateTrackedMemory(size_in_bytes, 0);
+}
+
+void* operator new[](std::size_t size_in_bytes)
+{
+    return AllocateTrackedMemory(size_in_bytes, 0);
+}
+
+void* operator new(std::size_t size_in_bytes, std::align_val_t alignment)
+{
+    return AllocateTrackedMemory(size_in_bytes, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size_in_bytes, std::align_val_t alignment)
+{
+    return AllocateTrackedMemory(size_in_bytes, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept
+{
+    FreeTrackedMemory(memory, 0);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    FreeTrackedMemory(memory, 0);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    FreeTrackedMemory(memory, 0);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    FreeTrackedMemory(memory, 0);
+}
+
+void operator delete(void* memory, std::align_val_t alignment) noexcept
+{
+    FreeTrackedMemory(memory, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* memory, std::align_val_t alignment) noexcept
+{
+    FreeTrackedMemory(memory, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t alignment) noexcept
+{
+    FreeTrackedMemory(memory, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t alignment) noexcept
+{
+    FreeTrackedMemory(memory, static_cast<std::size_t>(alignment));
+}
+
+#endif
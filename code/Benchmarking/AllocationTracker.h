@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace BENCHMARKING
+{
+    /// Counts of heap allocations.
+    struct AllocationCounts
+    {
+        /// The number of allocations.
+        uint64_t AllocationCount = 0;
+        /// The total size of all allocations in bytes.
+        uint64_t AllocatedByteCount = 0;
+
+        AllocationCounts operator-(const AllocationCounts& earlier_counts) const;
+    };
+
+    /// Counts heap allocations made through operator new, allowing allocations in hot paths
+    /// (like rendering a frame) to be found and eliminated.
+    ///
+    /// Tracking is opt-in since it requires replacing the global operator new and delete
+    /// for the entire program.  They're only replaced if ALLOCATION_TRACKING_ENABLED is
+    /// defined when building the library; otherwise, all counts remain zero.  Code using
+    /// the library doesn't need the define, since IsEnabled() reports how the library was built.  Allocations
+    /// made directly with malloc (like by some C library functions) aren't counted.
+    ///
+    /// Counts only increase, so allocations during some span of execution are found by
+    /// subtracting counts from before the span from counts after the span.  Counts are kept
+    /// both for the entire process and for each thread, since the same code may allocate
+    /// on multiple threads at once.
+    class AllocationTracker
+    {
+    public:
+        // AVAILABILITY.
+        static bool IsEnabled();
+
+        // COUNTS.
+        static AllocationCounts GetProcessCounts();
+        static AllocationCounts GetCurrentThreadCounts();
+
+        // RECORDING.
+        static void RecordAllocation(const std::size_t size_in_bytes);
+    };
+}
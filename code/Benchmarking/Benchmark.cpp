@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include "Benchmarking/Benchmark.h"
+
+namespace BENCHMARKING
+{
+    /// Runs code repeatedly, measuring the time of each run.
+    /// @param[in]  warm_up_run_count - The number of runs before any are measured.
+    /// @param[in]  measured_run_count - The number of runs to measure.
+    /// @param[in]  run - The code to measure.
+    /// @param[in]  prepare_for_run - Any code to run before each run, outside of the measured time.
+    /// @param[in,out]  hardware_counters - Any hardware counters to measure each measured run with.
+    ///     Counts are added to any existing totals.
+    /// @return Statistics about the measured run times.
+    TimingStatistics Benchmark::Run(
+        const std::size_t warm_up_run_count,
+        const std::size_t measured_run_count,
+        const std::function<void()>& run,
+        const std::function<void()>& prepare_for_run,
+        HardwareCounters* const hardware_counters)
+    {
+        // WARM UP.
+        for (std::size_t run_index = 0; run_index < warm_up_run_count; ++run_index)
+        {
+            if (prepare_for_run)
+            {
+                prepare_for_run();
+            }
+            run();
+        }
+
+        // MEASURE EACH RUN.
+        std::vector<double> run_times_in_nanoseconds;
+        run_times_in_nanoseconds.reserve(measured_run_count);
+        for (std::size_t run_index = 0; run_index < measured_run_count; ++run_index)
+        {
+            if (prepare_for_run)
+            {
+                prepare_for_run();
+            }
+
+            // Counters are started outside of the timed span so that they don't affect run times.
+            if (hardware_counters)
+            {
+                hardware_counters->Start();
+            }
+            auto run_start_time = std::chrono::steady_clock::now();
+            run();
+            std::chrono::duration<double, std::nano> run_time = std::chrono::steady_clock::now() - run_start_time;
+            if (hardware_counters)
+            {
+                hardware_counters->Stop();
+            }
+            run_times_in_nanoseconds.push_back(run_time.count());
+        }
+
+        return ComputeStatistics(std::move(run_times_in_nanoseconds));
+    }
+
+    /// Computes statistics about run times.
+    /// @param[in]  run_times_in_nanoseconds - The time of each run.
+    /// @return Statistics about the run times; all zero if there were no runs.
+    TimingStatistics Benchmark::ComputeStatistics(std::vector<double> run_times_in_nanoseconds)
+    {
+        // HANDLE THE CASE OF NO RUNS.
+        TimingStatistics statistics;
+        statistics.RunCount = run_times_in_nanoseconds.size();
+        if (run_times_in_nanoseconds.empty())
+        {
+            return statistics;
+        }
+
+        // COMPUTE ORDER-BASED STATISTICS.
+        // The median of an even number of runs is the mean of the middle two.
+        std::sort(run_times_in_nanoseconds.begin(), run_times_in_nanoseconds.end());
+        statistics.MinimumTimeInNanoseconds = run_times_in_nanoseconds.front();
+        statistics.MaximumTimeInNanoseconds = run_times_in_nanoseconds.back();
+        std::size_t middle_index = statistics.RunCount / 2;
+        bool even_run_count = (0 == statistics.RunCount % 2);
+        statistics.MedianTimeInNanoseconds = even_run_count ?
+            (run_times_in_nanoseconds[middle_index - 1] + run_times_in_nanoseconds[middle_index]) / 2.0 :
+            run_times_in_nanoseconds[middle_index];
+
+        // COMPUTE THE MEAN AND STANDARD DEVIATION.
+        // The sample standard deviation is used since runs are a sample of possible runs.
+        double total_time_in_nanoseconds = std::accumulate(run_times_in_nanoseconds.cbegin(), run_times_in_nanoseconds.cend(), 0.0);
+        statistics.MeanTimeInNanoseconds = total_time_in_nanoseconds / static_cast<double>(statistics.RunCount);
+        if (statistics.RunCount > 1)
+        {
+            double sum_of_squared_differences = 0.0;
+            for (double run_time_in_nanoseconds : run_times_in_nanoseconds)
+            {
+                double difference_from_mean = run_time_in_nanoseconds - statistics.MeanTimeInNanoseconds;
+                sum_of_squared_differences += difference_from_mean * difference_from_mean;
+            }
+            statistics.StandardDeviationInNanoseconds = std::sqrt(sum_of_squared_differences / static_cast<double>(statistics.RunCount - 1));
+        }
+
+        return statistics;
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "Benchmarking/HardwareCounters.h"
+
+/// Holds code for measuring performance.
+namespace BENCHMARKING
+{
+    /// Statistics about the times of repeated runs of a benchmark.
+    struct TimingStatistics
+    {
+        /// The number of measured runs (excluding any warm-up runs).
+        std::size_t RunCount = 0;
+        /// The fastest run time.
+        double MinimumTimeInNanoseconds = 0.0;
+        /// The median run time, which is less affected by outliers (like from
+        /// other processes being scheduled) than the mean.
+        double MedianTimeInNanoseconds = 0.0;
+        /// The mean run time.
+        double MeanTimeInNanoseconds = 0.0;
+        /// The sample standard deviation of run times.
+        double StandardDeviationInNanoseconds = 0.0;
+        /// The slowest run time.
+        double MaximumTimeInNanoseconds = 0.0;
+    };
+
+    /// Runs code repeatedly to measure how long it takes.
+    ///
+    /// Warm-up runs happen first without being measured, allowing caches to be filled,
+    /// memory to be paged in, and processors to ramp up their clock speeds, so that
+    /// measured runs reflect steady-state performance.  Any preparation for each run
+    /// (like clearing buffers) can be done outside of the measured time.
+    ///
+    /// Hardware counters may optionally be measured around each measured run (but not
+    /// warm-up runs or preparation), accumulating totals across all measured runs.
+    class Benchmark
+    {
+    public:
+        static TimingStatistics Run(
+            const std::size_t warm_up_run_count,
+            const std::size_t measured_run_count,
+            const std::function<void()>& run,
+            const std::function<void()>& prepare_for_run = nullptr,
+            HardwareCounters* const hardware_counters = nullptr);
+
+        static TimingStatistics ComputeStatistics(std::vector<double> run_times_in_nanoseconds);
+    };
+}
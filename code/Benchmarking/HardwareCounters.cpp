@@ -0,0 +1,280 @@
+#if __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include <iomanip>
+#include <utility>
+#include "Benchmarking/HardwareCounters.h"
+
+namespace BENCHMARKING
+{
+    /// Gets the number of instructions retired per processor cycle.
+    /// @return The instructions per cycle, if both counters were measured over a non-zero number of cycles; null otherwise.
+    std::optional<double> HardwareCounterValues::InstructionsPerCycle() const
+    {
+        bool instructions_per_cycle_measured = CycleCount && InstructionCount && (*CycleCount > 0.0);
+        if (!instructions_per_cycle_measured)
+        {
+            return std::nullopt;
+        }
+
+        return *InstructionCount / *CycleCount;
+    }
+
+    /// Divides all counter values (like to get values per run from totals across runs).
+    /// @param[in]  divisor - The value to divide by.
+    /// @return The divided counter values, with the same counters present.
+    HardwareCounterValues HardwareCounterValues::DividedBy(const double divisor) const
+    {
+        auto divide = [divisor](const std::optional<double>& value) -> std::optional<double>
+        {
+            return value ? std::optional<double>(*value / divisor) : std::nullopt;
+        };
+
+        HardwareCounterValues divided_values;
+        divided_values.CycleCount = divide(CycleCount);
+        divided_values.InstructionCount = divide(InstructionCount);
+        divided_values.L1DataCacheMissCount = divide(L1DataCacheMissCount);
+        divided_values.LastLevelCacheMissCount = divide(LastLevelCacheMissCount);
+        divided_values.BranchMispredictionCount = divide(BranchMispredictionCount);
+        return divided_values;
+    }
+
+    /// Constructor.  Attempts to open all counters, leaving any that fail unavailable.
+    HardwareCounters::HardwareCounters()
+    {
+        FileDescriptors.fill(-1);
+
+#if __linux__
+        // DEFINE THE EVENT FOR EACH COUNTER.
+        constexpr uint64_t L1_DATA_CACHE_READ_MISSES =
+            PERF_COUNT_HW_CACHE_L1D |
+            (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const std::array<std::pair<uint32_t, uint64_t>, COUNTER_COUNT> EVENT_TYPES_AND_CONFIGS =
+        {
+            std::pair<uint32_t, uint64_t>(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES),
+            std::pair<uint32_t, uint64_t>(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS),
+            std::pair<uint32_t, uint64_t>(PERF_TYPE_HW_CACHE, L1_DATA_CACHE_READ_MISSES),
+            std::pair<uint32_t, uint64_t>(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES),
+            std::pair<uint32_t, uint64_t>(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES),
+        };
+
+        // OPEN EACH COUNTER.
+        // Counters are opened independently (rather than as a group) so that any subset
+        // supported by the processor can be used.  Excluding the kernel allows counting
+        // with the default kernel.perf_event_paranoid setting.
+        for (std::size_t counter_index = 0; counter_index < COUNTER_COUNT; ++counter_index)
+        {
+            perf_event_attr event_attributes = {};
+            event_attributes.size = sizeof(event_attributes);
+            event_attributes.type = EVENT_TYPES_AND_CONFIGS[counter_index].first;
+            event_attributes.config = EVENT_TYPES_AND_CONFIGS[counter_index].second;
+            event_attributes.disabled = 1;
+            event_attributes.exclude_kernel = 1;
+            event_attributes.exclude_hv = 1;
+            event_attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            constexpr pid_t CALLING_THREAD = 0;
+            constexpr int ANY_CPU = -1;
+            constexpr int NO_GROUP = -1;
+            constexpr unsigned long NO_FLAGS = 0;
+            long file_descriptor = syscall(SYS_perf_event_open, &event_attributes, CALLING_THREAD, ANY_CPU, NO_GROUP, NO_FLAGS);
+            FileDescriptors[counter_index] = static_cast<int>(file_descriptor);
+        }
+#endif
+    }
+
+    /// Destructor to close any open counters.
+    HardwareCounters::~HardwareCounters()
+    {
+#if __linux__
+        for (int file_descriptor : FileDescriptors)
+        {
+            if (file_descriptor >= 0)
+            {
+                close(file_descriptor);
+            }
+        }
+#endif
+    }
+
+    /// Checks if any counters can be measured.
+    /// @return True if at least one counter is available; false otherwise.
+    bool HardwareCounters::IsAvailable() const
+    {
+        for (int file_descriptor : FileDescriptors)
+        {
+            if (file_descriptor >= 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Starts counting a span of execution on the calling thread.
+    void HardwareCounters::Start()
+    {
+#if __linux__
+        for (int file_descriptor : FileDescriptors)
+        {
+            if (file_descriptor >= 0)
+            {
+                ioctl(file_descriptor, PERF_EVENT_IOC_RESET, 0);
+                ioctl(file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /// Stops counting the current span, adding its counts to the totals.
+    void HardwareCounters::Stop()
+    {
+#if __linux__
+        // STOP ALL COUNTERS BEFORE READING ANY.
+        // This avoids counting the reads themselves.
+        for (int file_descriptor : FileDescriptors)
+        {
+            if (file_descriptor >= 0)
+            {
+                ioctl(file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+
+        // ADD THE COUNT FOR THE SPAN TO EACH TOTAL.
+        for (std::size_t counter_index = 0; counter_index < COUNTER_COUNT; ++counter_index)
+        {
+            int file_descriptor = FileDescriptors[counter_index];
+            if (file_descriptor < 0)
+            {
+                continue;
+            }
+
+            /// The data read from a counter based on the requested read format.
+            struct CounterReading
+            {
+                /// The raw count.
+                uint64_t Count = 0;
+                /// The time the counter was enabled.
+                uint64_t TimeEnabled = 0;
+                /// The time the counter was actually counting, which is less than the
+                /// time enabled if the counter was multiplexed with other counters.
+                uint64_t TimeRunning = 0;
+            };
+            CounterReading reading;
+            ssize_t read_size_in_bytes = read(file_descriptor, &reading, sizeof(reading));
+            bool counter_read = (static_cast<ssize_t>(sizeof(reading)) == read_size_in_bytes);
+            if (!counter_read || 0 == reading.TimeRunning)
+            {
+                continue;
+            }
+
+            double scale_for_multiplexing = static_cast<double>(reading.TimeEnabled) / static_cast<double>(reading.TimeRunning);
+            TotalCounts[counter_index] += static_cast<double>(reading.Count) * scale_for_multiplexing;
+        }
+#endif
+    }
+
+    /// Resets all totals to zero.
+    void HardwareCounters::Reset()
+    {
+        TotalCounts.fill(0.0);
+    }
+
+    /// Gets the totals of all available counters across all spans since the last reset.
+    /// @return The total counter values.
+    HardwareCounterValues HardwareCounters::GetTotals() const
+    {
+        auto get_total = [this](const Counter counter) -> std::optional<double>
+        {
+            std::size_t counter_index = static_cast<std::size_t>(counter);
+            bool counter_available = (FileDescriptors[counter_index] >= 0);
+            return counter_available ? std::optional<double>(TotalCounts[counter_index]) : std::nullopt;
+        };
+
+        HardwareCounterValues totals;
+        totals.CycleCount = get_total(Counter::CYCLES);
+        totals.InstructionCount = get_total(Counter::INSTRUCTIONS);
+        totals.L1DataCacheMissCount = get_total(Counter::L1_DATA_CACHE_MISSES);
+        totals.LastLevelCacheMissCount = get_total(Counter::LAST_LEVEL_CACHE_MISSES);
+        totals.BranchMispredictionCount = get_total(Counter::BRANCH_MISPREDICTIONS);
+        return totals;
+    }
+
+    /// Writes headers for counter columns in a human-readable table.
+    /// @param[in,out]  output - The output to write to.
+    void HardwareCounters::WriteTableHeader(std::ostream& output)
+    {
+        output
+            << std::right
+            << std::setw(10) << "Mcycles"
+            << std::setw(10) << "Minstr"
+            << std::setw(7) << "IPC"
+            << std::setw(10) << "L1D_miss"
+            << std::setw(10) << "LLC_miss"
+            << std::setw(10) << "br_miss";
+    }
+
+    /// Writes counter values as columns in a human-readable table, matching WriteTableHeader().
+    /// Cycles and instructions are in millions, and unavailable counters are written as "n/a".
+    /// @param[in]  values - The counter values to write.
+    /// @param[in,out]  output - The output to write to.
+    void HardwareCounters::WriteTableColumns(const HardwareCounterValues& values, std::ostream& output)
+    {
+        auto write_column = [&output](const int width, const std::optional<double>& value, const double scale, const int precision)
+        {
+            output << std::setw(width);
+            if (value)
+            {
+                output << std::fixed << std::setprecision(precision) << (*value / scale) << std::defaultfloat;
+            }
+            else
+            {
+                output << "n/a";
+            }
+        };
+
+        constexpr double MILLION = 1e6;
+        output << std::right;
+        write_column(10, values.CycleCount, MILLION, 2);
+        write_column(10, values.InstructionCount, MILLION, 2);
+        write_column(7, values.InstructionsPerCycle(), 1.0, 2);
+        write_column(10, values.L1DataCacheMissCount, 1.0, 0);
+        write_column(10, values.LastLevelCacheMissCount, 1.0, 0);
+        write_column(10, values.BranchMispredictionCount, 1.0, 0);
+    }
+
+    /// Writes headers for counter columns in a CSV file, each preceded by a comma.
+    /// @param[in,out]  csv_output - The output to write to.
+    void HardwareCounters::WriteCsvHeader(std::ostream& csv_output)
+    {
+        csv_output << ",cycles,instructions,ipc,l1d_misses,llc_misses,branch_mispredictions";
+    }
+
+    /// Writes counter values as columns in a CSV file, matching WriteCsvHeader().
+    /// Unavailable counters are left empty.
+    /// @param[in]  values - The counter values to write.
+    /// @param[in,out]  csv_output - The output to write to.
+    void HardwareCounters::WriteCsvColumns(const HardwareCounterValues& values, std::ostream& csv_output)
+    {
+        for (const std::optional<double>& value :
+            {
+                values.CycleCount,
+                values.InstructionCount,
+                values.InstructionsPerCycle(),
+                values.L1DataCacheMissCount,
+                values.LastLevelCacheMissCount,
+                values.BranchMispredictionCount
+            })
+        {
+            csv_output << ",";
+            if (value)
+            {
+                csv_output << *value;
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+
+namespace BENCHMARKING
+{
+    /// Values of processor performance counters over some span of execution.
+    /// Each counter is only present if it could be measured on the current system.
+    struct HardwareCounterValues
+    {
+        /// The number of processor cycles.
+        std::optional<double> CycleCount = std::nullopt;
+        /// The number of instructions retired.
+        std::optional<double> InstructionCount = std::nullopt;
+        /// The number of level 1 data cache read misses.
+        std::optional<double> L1DataCacheMissCount = std::nullopt;
+        /// The number of last level cache misses (typically accesses that go to main memory).
+        std::optional<double> LastLevelCacheMissCount = std::nullopt;
+        /// The number of mispredicted branches.
+        std::optional<double> BranchMispredictionCount = std::nullopt;
+
+        std::optional<double> InstructionsPerCycle() const;
+        HardwareCounterValues DividedBy(const double divisor) const;
+    };
+
+    /// Measures processor performance counters (cycles, instructions, cache misses, and
+    /// branch mispredictions) around code, which helps distinguish code that is limited by
+    /// arithmetic from code that is limited by memory access.  A low number of instructions
+    /// per cycle with many cache misses suggests improving data layout, whereas a high number
+    /// of instructions per cycle suggests reducing the amount of work.
+    ///
+    /// Counters are read with perf_event_open on Linux.  They're frequently unavailable
+    /// (on other platforms, in virtual machines and containers, or if kernel.perf_event_paranoid
+    /// doesn't allow access), so any counter that can't be opened is simply not reported.
+    /// Only the calling thread is measured, excluding time in the kernel.
+    ///
+    /// Counting accumulates across all spans between Start() and Stop() until Reset().
+    /// If the processor has fewer counter registers than requested counters, the kernel
+    /// multiplexes them, and values are scaled up to estimate the full span.
+    class HardwareCounters
+    {
+    public:
+        // CONSTRUCTION/DESTRUCTION.
+        explicit HardwareCounters();
+        ~HardwareCounters();
+        HardwareCounters(const HardwareCounters&) = delete;
+        HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+        // AVAILABILITY.
+        bool IsAvailable() const;
+
+        // MEASUREMENT.
+        void Start();
+        void Stop();
+        void Reset();
+        HardwareCounterValues GetTotals() const;
+
+        // REPORTING.
+        static void WriteTableHeader(std::ostream& output);
+        static void WriteTableColumns(const HardwareCounterValues& values, std::ostream& output);
+        static void WriteCsvHeader(std::ostream& csv_output);
+        static void WriteCsvColumns(const HardwareCounterValues& values, std::ostream& csv_output);
+
+    private:
+        /// The counters that are measured, in the order of counter indices.
+        enum class Counter
+        {
+            CYCLES,
+            INSTRUCTIONS,
+            L1_DATA_CACHE_MISSES,
+            LAST_LEVEL_CACHE_MISSES,
+            BRANCH_MISPREDICTIONS,
+            COUNT
+        };
+
+        /// The number of counters measured.
+        static constexpr std::size_t COUNTER_COUNT = static_cast<std::size_t>(Counter::COUNT);
+
+        // MEMBER VARIABLES.
+        /// The file descriptor for each counter, or -1 if the counter is unavailable.
+        std::array<int, COUNTER_COUNT> FileDescriptors = {};
+        /// The total (scaled) value of each counter across all measured spans.
+        std::array<double, COUNTER_COUNT> TotalCounts = {};
+    };
+}
@@ -0,0 +1,467 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include "Benchmarking/Profiler.h"
+
+namespace BENCHMARKING
+{
+    /// Gets the profiler shared across the entire process, which instrumentation macros use.
+    /// @return The shared profiler.
+    Profiler& Profiler::Shared()
+    {
+        static Profiler shared_profiler;
+        return shared_profiler;
+    }
+
+    /// Constructor.
+    /// @param[in]  frame_window_size - The number of recent frames to keep statistics for (at least 1).
+    Profiler::Profiler(const std::size_t frame_window_size) :
+        FrameWindowSize(std::max<std::size_t>(1, frame_window_size))
+    {
+        static std::atomic<uint64_t> next_profiler_id = 0;
+        ProfilerId = next_profiler_id++;
+    }
+
+    /// Begins measuring a zone on the current thread, nested within any zone already open on the thread.
+    /// @param[in]  name - The name of the zone, which should be a string literal.
+    void Profiler::BeginZone(const char* const name)
+    {
+        // GET THE ID FOR THE ZONE WITHIN ITS PARENT.
+        ThreadZoneState& thread_state = CurrentThreadState();
+        std::size_t zone_id = GetInnermostChildZoneId(thread_state, name);
+
+        // START MEASURING THE ZONE.
+        // This is done last to avoid measuring any of the profiler's own work (including adding the open zone).
+        OpenZone& open_zone = thread_state.OpenZones.emplace_back();
+        open_zone.ZoneId = zone_id;
+        open_zone.StartAllocations = AllocationTracker::GetCurrentThreadCounts();
+        open_zone.StartTime = ClockType::now();
+    }
+
+    /// Ends measuring the innermost zone open on the current thread.
+    void Profiler::EndZone()
+    {
+        // STOP MEASURING THE ZONE.
+        // This is done first to avoid measuring any of the profiler's own work.
+        ClockType::time_point zone_end_time = ClockType::now();
+        AllocationCounts zone_end_allocations = AllocationTracker::GetCurrentThreadCounts();
+
+        // GET THE ZONE BEING ENDED.
+        ThreadZoneState& thread_state = CurrentThreadState();
+        if (thread_state.OpenZones.empty())
+        {
+            return;
+        }
+        OpenZone open_zone = thread_state.OpenZones.back();
+        thread_state.OpenZones.pop_back();
+
+        // ADD THE MEASUREMENTS TO THE ZONE FOR THE CURRENT FRAME.
+        std::size_t zone_id = open_zone.ZoneId;
+        std::chrono::duration<double, std::nano> zone_time = zone_end_time - open_zone.StartTime;
+        AllocationCounts zone_allocations = zone_end_allocations - open_zone.StartAllocations;
+        std::lock_guard<std::mutex> lock(thread_state.Mutex);
+        if (zone_id >= thread_state.CurrentFrameTimesByZoneId.size())
+        {
+            thread_state.CurrentFrameTimesByZoneId.resize(zone_id + 1);
+        }
+        FrameZoneTime& frame_zone_time = thread_state.CurrentFrameTimesByZoneId[zone_id];
+        frame_zone_time.TotalTimeInNanoseconds += zone_time.count();
+        ++frame_zone_time.CallCount;
+        frame_zone_time.Allocations.AllocationCount += zone_allocations.AllocationCount;
+        frame_zone_time.Allocations.AllocatedByteCount += zone_allocations.AllocatedByteCount;
+    }
+
+    /// Adds time measured separately to a zone nested within the innermost zone open on the current thread,
+    /// as if the zone had been entered the given number of times.
+    /// @param[in]  name - The name of the zone, which should be a string literal.
+    /// @param[in]  time_in_nanoseconds - The total time spent in the zone.
+    /// @param[in]  call_count - The number of times the zone was entered.
+    void Profiler::AddZoneTime(const char* const name, const double time_in_nanoseconds, const std::size_t call_count)
+    {
+        // GET THE ZONE.
+        ThreadZoneState& thread_state = CurrentThreadState();
+        std::size_t zone_id = GetInnermostChildZoneId(thread_state, name);
+
+        // ADD THE MEASUREMENTS TO THE ZONE FOR THE CURRENT FRAME.
+        std::lock_guard<std::mutex> lock(thread_state.Mutex);
+        if (zone_id >= thread_state.CurrentFrameTimesByZoneId.size())
+        {
+            thread_state.CurrentFrameTimesByZoneId.resize(zone_id + 1);
+        }
+        FrameZoneTime& frame_zone_time = thread_state.CurrentFrameTimesByZoneId[zone_id];
+        frame_zone_time.TotalTimeInNanoseconds += time_in_nanoseconds;
+        frame_zone_time.CallCount += call_count;
+    }
+
+    /// Ends the current frame, adding time measured for each zone during the frame to its statistics.
+    /// Zones not entered during the frame have zero time added.
+    void Profiler::EndFrame()
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+
+        // SUM TIMES FROM ALL THREADS.
+        std::vector<FrameZoneTime> frame_times_by_zone_id(Zones.size());
+        for (const std::shared_ptr<ThreadZoneState>& thread_state : ThreadStates)
+        {
+            std::lock_guard<std::mutex> thread_lock(thread_state->Mutex);
+            std::size_t thread_zone_count = std::min(thread_state->CurrentFrameTimesByZoneId.size(), frame_times_by_zone_id.size());
+            for (std::size_t zone_id = 0; zone_id < thread_zone_count; ++zone_id)
+            {
+                FrameZoneTime& thread_frame_zone_time = thread_state->CurrentFrameTimesByZoneId[zone_id];
+                frame_times_by_zone_id[zone_id].TotalTimeInNanoseconds += thread_frame_zone_time.TotalTimeInNanoseconds;
+                frame_times_by_zone_id[zone_id].CallCount += thread_frame_zone_time.CallCount;
+                frame_times_by_zone_id[zone_id].Allocations.AllocationCount += thread_frame_zone_time.Allocations.AllocationCount;
+                frame_times_by_zone_id[zone_id].Allocations.AllocatedByteCount += thread_frame_zone_time.Allocations.AllocatedByteCount;
+                thread_frame_zone_time = FrameZoneTime();
+            }
+        }
+
+        // FORGET ABOUT ANY THREADS THAT HAVE EXITED.
+        // Their times have already been included above.
+        std::erase_if(ThreadStates, [](const std::shared_ptr<ThreadZoneState>& thread_state) { return 1 == thread_state.use_count(); });
+
+        // ADD THE FRAME TO EACH ZONE.
+        for (std::size_t zone_id = 0; zone_id < Zones.size(); ++zone_id)
+        {
+            std::deque<FrameZoneTime>& recent_frame_times = Zones[zone_id].RecentFrameTimes;
+            recent_frame_times.push_back(frame_times_by_zone_id[zone_id]);
+            while (recent_frame_times.size() > FrameWindowSize)
+            {
+                recent_frame_times.pop_front();
+            }
+        }
+    }
+
+    /// Clears all measurements, including any for the current frame.
+    /// Zones remain known to the profiler, so they'll continue to be reported (with no frames).
+    void Profiler::Clear()
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        for (Zone& zone : Zones)
+        {
+            zone.RecentFrameTimes.clear();
+        }
+        for (const std::shared_ptr<ThreadZoneState>& thread_state : ThreadStates)
+        {
+            std::lock_guard<std::mutex> thread_lock(thread_state->Mutex);
+            std::fill(thread_state->CurrentFrameTimesByZoneId.begin(), thread_state->CurrentFrameTimesByZoneId.end(), FrameZoneTime());
+        }
+    }
+
+    /// Gets statistics for all zones over the most recent frames.
+    /// @return Statistics for each zone, ordered so that each zone is followed by the zones
+    ///     nested within it, with zones at the same level in order by name.
+    std::vector<ZoneStatistics> Profiler::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+
+        // ORGANIZE ZONES INTO A TREE.
+        std::vector<std::size_t> outermost_zone_ids;
+        std::vector<std::vector<std::size_t>> child_zone_ids_by_zone_id(Zones.size());
+        for (std::size_t zone_id = 0; zone_id < Zones.size(); ++zone_id)
+        {
+            std::size_t parent_zone_id = Zones[zone_id].ParentZoneId;
+            std::vector<std::size_t>& sibling_zone_ids = (NO_PARENT_ZONE_ID == parent_zone_id) ?
+                outermost_zone_ids :
+                child_zone_ids_by_zone_id[parent_zone_id];
+            sibling_zone_ids.push_back(zone_id);
+        }
+
+        // VISIT ZONES DEPTH-FIRST.
+        // Zone IDs to visit are kept in reverse order so that the next zone to visit is at the back.
+        auto sort_zone_ids_by_reverse_name = [this](std::vector<std::size_t>& zone_ids)
+        {
+            std::sort(zone_ids.begin(), zone_ids.end(), [this](const std::size_t left_zone_id, const std::size_t right_zone_id)
+            {
+                return Zones[left_zone_id].Name > Zones[right_zone_id].Name;
+            });
+        };
+        std::vector<std::size_t> zone_ids_to_visit = outermost_zone_ids;
+        sort_zone_ids_by_reverse_name(zone_ids_to_visit);
+        std::vector<ZoneStatistics> all_zone_statistics;
+        all_zone_statistics.reserve(Zones.size());
+        while (!zone_ids_to_visit.empty())
+        {
+            // COMPUTE STATISTICS FOR THE CURRENT ZONE.
+            std::size_t zone_id = zone_ids_to_visit.back();
+            zone_ids_to_visit.pop_back();
+            const Zone& zone = Zones[zone_id];
+            ZoneStatistics& zone_statistics = all_zone_statistics.emplace_back();
+            zone_statistics.Path = zone.Path;
+            zone_statistics.Depth = zone.Depth;
+            zone_statistics.FrameCount = zone.RecentFrameTimes.size();
+            if (!zone.RecentFrameTimes.empty())
+            {
+                // COMPUTE THE MEANS.
+                std::vector<double> frame_times_in_nanoseconds;
+                frame_times_in_nanoseconds.reserve(zone.RecentFrameTimes.size());
+                std::size_t total_call_count = 0;
+                AllocationCounts total_allocations;
+                for (const FrameZoneTime& frame_zone_time : zone.RecentFrameTimes)
+                {
+                    frame_times_in_nanoseconds.push_back(frame_zone_time.TotalTimeInNanoseconds);
+                    total_call_count += frame_zone_time.CallCount;
+                    total_allocations.AllocationCount += frame_zone_time.Allocations.AllocationCount;
+                    total_allocations.AllocatedByteCount += frame_zone_time.Allocations.AllocatedByteCount;
+                    zone_statistics.MaximumAllocationCountPerFrame = std::max(zone_statistics.MaximumAllocationCountPerFrame, frame_zone_time.Allocations.AllocationCount);
+                }
+                double frame_count = static_cast<double>(zone_statistics.FrameCount);
+                zone_statistics.MeanCallCountPerFrame = static_cast<double>(total_call_count) / frame_count;
+                zone_statistics.MeanAllocationCountPerFrame = static_cast<double>(total_allocations.AllocationCount) / frame_count;
+                zone_statistics.MeanAllocatedBytesPerFrame = static_cast<double>(total_allocations.AllocatedByteCount) / frame_count;
+                double total_time_in_nanoseconds = 0.0;
+                for (double frame_time_in_nanoseconds : frame_times_in_nanoseconds)
+                {
+                    total_time_in_nanoseconds += frame_time_in_nanoseconds;
+                }
+                zone_statistics.MeanTimeInNanoseconds = total_time_in_nanoseconds / frame_count;
+
+                // COMPUTE THE PERCENTILES.
+                // The nearest-rank method is used so that percentiles are always actual frame times.
+                std::sort(frame_times_in_nanoseconds.begin(), frame_times_in_nanoseconds.end());
+                auto percentile = [&frame_times_in_nanoseconds](const double percentage)
+                {
+                    double rank = std::ceil(percentage / 100.0 * static_cast<double>(frame_times_in_nanoseconds.size()));
+                    std::size_t index = static_cast<std::size_t>(std::max(rank, 1.0)) - 1;
+                    return frame_times_in_nanoseconds[std::min(index, frame_times_in_nanoseconds.size() - 1)];
+                };
+                zone_statistics.Percentile50TimeInNanoseconds = percentile(50.0);
+                zone_statistics.Percentile95TimeInNanoseconds = percentile(95.0);
+                zone_statistics.Percentile99TimeInNanoseconds = percentile(99.0);
+                zone_statistics.MaximumTimeInNanoseconds = frame_times_in_nanoseconds.back();
+            }
+
+            // VISIT NESTED ZONES NEXT.
+            std::vector<std::size_t> child_zone_ids = child_zone_ids_by_zone_id[zone_id];
+            sort_zone_ids_by_reverse_name(child_zone_ids);
+            zone_ids_to_visit.insert(zone_ids_to_visit.end(), child_zone_ids.cbegin(), child_zone_ids.cend());
+        }
+
+        return all_zone_statistics;
+    }
+
+    /// Writes statistics for all zones as CSV, with a header row followed by a row per zone.
+    /// Zone names are written as-is, so they shouldn't contain commas.
+    /// @param[in,out]  csv_output - The output to write to.
+    void Profiler::WriteCsv(std::ostream& csv_output) const
+    {
+        csv_output << "zone,depth,frames,calls_per_frame,mean_ns,p50_ns,p95_ns,p99_ns,max_ns,allocations_per_frame,allocated_bytes_per_frame,max_allocations_per_frame\n";
+        for (const ZoneStatistics& zone_statistics : GetStatistics())
+        {
+            csv_output
+                << zone_statistics.Path << ","
+                << zone_statistics.Depth << ","
+                << zone_statistics.FrameCount << ","
+                << zone_statistics.MeanCallCountPerFrame << ","
+                << zone_statistics.MeanTimeInNanoseconds << ","
+                << zone_statistics.Percentile50TimeInNanoseconds << ","
+                << zone_statistics.Percentile95TimeInNanoseconds << ","
+                << zone_statistics.Percentile99TimeInNanoseconds << ","
+                << zone_statistics.MaximumTimeInNanoseconds << ","
+                << zone_statistics.MeanAllocationCountPerFrame << ","
+                << zone_statistics.MeanAllocatedBytesPerFrame << ","
+                << zone_statistics.MaximumAllocationCountPerFrame << "\n";
+        }
+    }
+
+    /// Gets the state for the current thread, creating it if needed.
+    /// @return The state for the current thread.
+    Profiler::ThreadZoneState& Profiler::CurrentThreadState()
+    {
+        // GET ANY EXISTING STATE FOR THE CURRENT THREAD.
+        // Threads may measure zones with multiple profilers, so states are kept by profiler.
+        thread_local std::unordered_map<uint64_t, std::shared_ptr<ThreadZoneState>> thread_states_by_profiler_id;
+        std::shared_ptr<ThreadZoneState>& thread_state = thread_states_by_profiler_id[ProfilerId];
+
+        // CREATE THE STATE IF IT DOESN'T EXIST.
+        if (!thread_state)
+        {
+            thread_state = std::make_shared<ThreadZoneState>();
+            std::lock_guard<std::mutex> lock(Mutex);
+            ThreadStates.push_back(thread_state);
+        }
+
+        return *thread_state;
+    }
+
+    /// Gets the ID for a zone nested within the innermost zone open on a thread, creating the zone if it doesn't exist.
+    /// @param[in,out]  thread_state - The state for the current thread.
+    /// @param[in]  name - The name of the zone.
+    /// @return The ID of the zone.
+    std::size_t Profiler::GetInnermostChildZoneId(ThreadZoneState& thread_state, const char* const name)
+    {
+        // CHECK FOR A CACHED ID.
+        std::size_t parent_zone_id = thread_state.OpenZones.empty() ? NO_PARENT_ZONE_ID : thread_state.OpenZones.back().ZoneId;
+        std::pair<std::size_t, const char*> zone_key(parent_zone_id, name);
+        auto cached_zone_id = thread_state.ZoneIdsByParentAndName.find(zone_key);
+        if (thread_state.ZoneIdsByParentAndName.cend() != cached_zone_id)
+        {
+            return cached_zone_id->second;
+        }
+
+        // GET THE ID FROM SHARED ZONE DATA.
+        std::size_t zone_id = GetZoneId(parent_zone_id, name);
+        thread_state.ZoneIdsByParentAndName[zone_key] = zone_id;
+        return zone_id;
+    }
+
+    /// Gets the ID for a zone, creating the zone if it doesn't exist.
+    /// @param[in]  parent_zone_id - The ID of the zone enclosing the zone.
+    /// @param[in]  name - The name of the zone.
+    /// @return The ID of the zone.
+    std::size_t Profiler::GetZoneId(const std::size_t parent_zone_id, const char* const name)
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+
+        // GET THE EXISTING ZONE IF ONE EXISTS.
+        // Names are looked up by value here since different pointers may refer to the same name.
+        std::pair<std::size_t, std::string> zone_key(parent_zone_id, name);
+        auto existing_zone_id = ZoneIdsByParentAndName.find(zone_key);
+        if (ZoneIdsByParentAndName.cend() != existing_zone_id)
+        {
+            return existing_zone_id->second;
+        }
+
+        // CREATE THE ZONE.
+        std::size_t zone_id = Zones.size();
+        Zone& zone = Zones.emplace_back();
+        zone.ParentZoneId = parent_zone_id;
+        zone.Name = name;
+        if (NO_PARENT_ZONE_ID == parent_zone_id)
+        {
+            zone.Path = zone.Name;
+        }
+        else
+        {
+            // The parent is accessed by index since adding the zone may have moved it.
+            zone.Path = Zones[parent_zone_id].Path + "/" + zone.Name;
+            zone.Depth = Zones[parent_zone_id].Depth + 1;
+        }
+        ZoneIdsByParentAndName[zone_key] = zone_id;
+        return zone_id;
+    }
+
+    /// Hashes a zone key.
+    /// @param[in]  zone_key - The parent zone ID and name pointer of the zone.
+    /// @return The hash of the key.
+    std::size_t Profiler::ZoneKeyHash::operator()(const std::pair<std::size_t, const char*>& zone_key) const
+    {
+        std::size_t parent_zone_id_hash = std::hash<std::size_t>()(zone_key.first);
+        std::size_t name_hash = std::hash<const char*>()(zone_key.second);
+        // Combined similarly to boost::hash_combine.
+        constexpr std::size_t GOLDEN_RATIO_CONSTANT = 0x9e3779b9;
+        std::size_t combined_hash = parent_zone_id_hash ^ (name_hash + GOLDEN_RATIO_CONSTANT + (parent_zone_id_hash << 6) + (parent_zone_id_hash >> 2));
+        return combined_hash;
+    }
+
+    /// Begins measuring a zone.
+    /// @param[in]  name - The name of the zone, which should be a string literal.
+    /// @param[in,out]  profiler - The profiler to measure the zone with.
+    ProfileZone::ProfileZone(const char* const name, Profiler& profiler) :
+        ZoneProfiler(profiler)
+    {
+        ZoneProfiler.BeginZone(name);
+    }
+
+    /// Ends measuring the zone.
+    ProfileZone::~ProfileZone()
+    {
+        ZoneProfiler.EndZone();
+    }
+
+    /// Constructor.
+    /// @param[in]  stage_names - The names of the stages (at most MAX_STAGE_COUNT), which should be string literals.
+    /// @param[in,out]  profiler - The profiler to add stage times to.
+    ProfileStages::ProfileStages(std::initializer_list<const char*> stage_names, Profiler& profiler) :
+        StagesProfiler(profiler),
+        StageCount(std::min(stage_names.size(), MAX_STAGE_COUNT))
+    {
+        std::copy_n(stage_names.begin(), StageCount, StageNames.begin());
+    }
+
+    /// Adds the estimated total time for each stage that was ended to the profiler.
+    ProfileStages::~ProfileStages()
+    {
+        for (std::size_t stage_index = 0; stage_index < StageCount; ++stage_index)
+        {
+            // SKIP STAGES THAT WERE NEVER REACHED.
+            std::size_t call_count = StageCallCounts[stage_index];
+            if (0 == call_count)
+            {
+                continue;
+            }
+
+            // ESTIMATE THE TOTAL TIME FROM THE TIMED CALLS.
+            // A stage may only have been reached in untimed repetitions, in which case its time is unknown.
+            // Each timed call includes reading the clock once, which is often a noticeable part of small stages.
+            double total_time_in_nanoseconds = 0.0;
+            std::size_t timed_call_count = TimedStageCallCounts[stage_index];
+            if (timed_call_count > 0)
+            {
+                std::chrono::duration<double, std::nano> timed_time = TimedStageTimes[stage_index];
+                double mean_time_in_nanoseconds = timed_time.count() / static_cast<double>(timed_call_count);
+                mean_time_in_nanoseconds = std::max(0.0, mean_time_in_nanoseconds - ClockReadTimeInNanoseconds());
+                total_time_in_nanoseconds = mean_time_in_nanoseconds * static_cast<double>(call_count);
+            }
+            StagesProfiler.AddZoneTime(StageNames[stage_index], total_time_in_nanoseconds, call_count);
+        }
+    }
+
+    /// Starts a repetition of stages, timing it if it's due to be sampled.
+    void ProfileStages::Start()
+    {
+        TimingRepetition = (0 == RepetitionCount % SAMPLING_INTERVAL);
+        ++RepetitionCount;
+        if (TimingRepetition)
+        {
+            LastStageEndTime = ClockType::now();
+        }
+    }
+
+    /// Ends a stage, adding the time since the previous stage ended (or the repetition started) to it if timing.
+    /// @param[in]  stage_index - The index of the stage to end.
+    void ProfileStages::EndStage(const std::size_t stage_index)
+    {
+        if (stage_index >= StageCount)
+        {
+            return;
+        }
+
+        ++StageCallCounts[stage_index];
+        if (TimingRepetition)
+        {
+            ClockType::time_point stage_end_time = ClockType::now();
+            TimedStageTimes[stage_index] += stage_end_time - LastStageEndTime;
+            ++TimedStageCallCounts[stage_index];
+            LastStageEndTime = stage_end_time;
+        }
+    }
+
+    /// Gets the typical time to read the clock, measured the first time this is called.
+    /// @return The time to read the clock once.
+    double ProfileStages::ClockReadTimeInNanoseconds()
+    {
+        static const double clock_read_time_in_nanoseconds = []()
+        {
+            // The fastest of several batches is used since other work on the system only makes reads slower.
+            constexpr std::size_t BATCH_COUNT = 16;
+            constexpr std::size_t READS_PER_BATCH = 256;
+            double fastest_read_time_in_nanoseconds = std::numeric_limits<double>::max();
+            for (std::size_t batch_index = 0; batch_index < BATCH_COUNT; ++batch_index)
+            {
+                ClockType::time_point batch_start_time = ClockType::now();
+                ClockType::time_point last_read_time = batch_start_time;
+                for (std::size_t read_index = 0; read_index < READS_PER_BATCH; ++read_index)
+                {
+                    last_read_time = ClockType::now();
+                }
+                std::chrono::duration<double, std::nano> batch_time = last_read_time - batch_start_time;
+                double read_time_in_nanoseconds = batch_time.count() / static_cast<double>(READS_PER_BATCH);
+                fastest_read_time_in_nanoseconds = std::min(fastest_read_time_in_nanoseconds, read_time_in_nanoseconds);
+            }
+            return fastest_read_time_in_nanoseconds;
+        }();
+        return clock_read_time_in_nanoseconds;
+    }
+}
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Benchmarking/AllocationTracker.h"
+#include "Benchmarking/TraceRecorder.h"
+
+namespace BENCHMARKING
+{
+    /// Rolling statistics about the time spent in a profiled zone per frame.
+    struct ZoneStatistics
+    {
+        /// The names of the zone and all zones enclosing it, separated by slashes.
+        std::string Path = "";
+        /// The number of zones enclosing the zone (0 for outermost zones).
+        std::size_t Depth = 0;
+        /// The number of frames the statistics cover.
+        std::size_t FrameCount = 0;
+        /// The mean number of times the zone was entered per frame.
+        double MeanCallCountPerFrame = 0.0;
+        /// The mean total time in the zone per frame.
+        double MeanTimeInNanoseconds = 0.0;
+        /// The 50th percentile of total time in the zone per frame.
+        double Percentile50TimeInNanoseconds = 0.0;
+        /// The 95th percentile of total time in the zone per frame.
+        double Percentile95TimeInNanoseconds = 0.0;
+        /// The 99th percentile of total time in the zone per frame.
+        double Percentile99TimeInNanoseconds = 0.0;
+        /// The maximum total time in the zone per frame.
+        double MaximumTimeInNanoseconds = 0.0;
+        /// The mean number of heap allocations in the zone per frame (always 0 unless allocations are tracked).
+        double MeanAllocationCountPerFrame = 0.0;
+        /// The mean size of heap allocations in the zone per frame in bytes (always 0 unless allocations are tracked).
+        double MeanAllocatedBytesPerFrame = 0.0;
+        /// The maximum number of heap allocations in the zone per frame (always 0 unless allocations are tracked).
+        uint64_t MaximumAllocationCountPerFrame = 0;
+    };
+
+    /// A hierarchical profiler that measures time spent in named zones (like stages of
+    /// a rendering pipeline) and keeps rolling statistics over the most recent frames.
+    ///
+    /// Zones are normally measured with the PROFILE_ZONE macro, which times the rest of
+    /// the enclosing scope.  Zones entered while another zone is open on the same thread
+    /// are nested within that zone, so the same stage reached through different paths is
+    /// measured separately.  Zones on different threads are independent, so work on
+    /// worker threads appears as outermost zones.
+    ///
+    /// All time in a zone during a frame (across all threads and all times the zone was
+    /// entered) is summed, and ending a frame adds that total to the zone's statistics.
+    /// If the AllocationTracker is enabled, heap allocations made on the thread while in
+    /// the zone are summed the same way.
+    ///
+    /// All methods are safe to call from multiple threads.  Measuring a zone only locks
+    /// data for the current thread, so threads don't contend with each other, although
+    /// entering a zone still costs far more than very small pieces of work (like individual
+    /// triangles).  Such work should instead be measured with the PROFILE_STAGES macros,
+    /// which add time accumulated over many repetitions to a zone at once.
+    class Profiler
+    {
+    public:
+        /// The default number of recent frames to keep statistics for.
+        static constexpr std::size_t DEFAULT_FRAME_WINDOW_SIZE = 120;
+
+        // PROCESS-WIDE PROFILER.
+        static Profiler& Shared();
+
+        // CONSTRUCTION.
+        explicit Profiler(const std::size_t frame_window_size = DEFAULT_FRAME_WINDOW_SIZE);
+
+        // MEASUREMENT.
+        void BeginZone(const char* const name);
+        void EndZone();
+        void AddZoneTime(const char* const name, const double time_in_nanoseconds, const std::size_t call_count);
+        void EndFrame();
+        void Clear();
+
+        // STATISTICS.
+        std::vector<ZoneStatistics> GetStatistics() const;
+        void WriteCsv(std::ostream& csv_output) const;
+
+    private:
+        // TYPE ALIASES.
+        /// The type of clock used for measuring zones.
+        using ClockType = std::chrono::steady_clock;
+
+        /// The ID for the parent of outermost zones.
+        static constexpr std::size_t NO_PARENT_ZONE_ID = std::numeric_limits<std::size_t>::max();
+
+        /// The time spent in (and allocations made by) a zone during a frame.
+        struct FrameZoneTime
+        {
+            /// The total time spent in the zone.
+            double TotalTimeInNanoseconds = 0.0;
+            /// The number of times the zone was entered.
+            std::size_t CallCount = 0;
+            /// The heap allocations made in the zone.
+            AllocationCounts Allocations = {};
+        };
+
+        /// A zone currently open on a thread.
+        struct OpenZone
+        {
+            /// The ID of the zone.
+            std::size_t ZoneId = 0;
+            /// The time the zone was entered.
+            ClockType::time_point StartTime = {};
+            /// The thread's allocation counts when the zone was entered.
+            AllocationCounts StartAllocations = {};
+        };
+
+        /// A zone being measured, identified by its name within its parent zone.
+        struct Zone
+        {
+            /// The ID of the zone enclosing this zone, if any.
+            std::size_t ParentZoneId = NO_PARENT_ZONE_ID;
+            /// The name of the zone.
+            std::string Name = "";
+            /// The names of this zone and all enclosing zones, separated by slashes.
+            std::string Path = "";
+            /// The number of zones enclosing this zone.
+            std::size_t Depth = 0;
+            /// The times for the most recent frames, in order from oldest to newest.
+            std::deque<FrameZoneTime> RecentFrameTimes = {};
+        };
+
+        /// Hashes zone names within parent zones, allowing them to be used as keys.
+        struct ZoneKeyHash
+        {
+            std::size_t operator()(const std::pair<std::size_t, const char*>& zone_key) const;
+        };
+
+        /// Measurements for a single thread.
+        struct ThreadZoneState
+        {
+            /// Protects the frame times, which are read when ending frames on other threads.
+            std::mutex Mutex = {};
+            /// Times for the current frame, indexed by zone ID.
+            std::vector<FrameZoneTime> CurrentFrameTimesByZoneId = {};
+            /// Zone IDs by parent zone ID and name, cached to avoid looking up shared zone data.
+            /// Names are expected to be string literals, so they're identified by pointer.
+            std::unordered_map<std::pair<std::size_t, const char*>, std::size_t, ZoneKeyHash> ZoneIdsByParentAndName = {};
+            /// The zones currently open on the thread, from outermost to innermost.
+            std::vector<OpenZone> OpenZones = {};
+        };
+
+        // HELPER METHODS.
+        ThreadZoneState& CurrentThreadState();
+        std::size_t GetInnermostChildZoneId(ThreadZoneState& thread_state, const char* const name);
+        std::size_t GetZoneId(const std::size_t parent_zone_id, const char* const name);
+
+        // MEMBER VARIABLES.
+        /// A unique ID for this profiler, allowing threads to find their state for it.
+        uint64_t ProfilerId = 0;
+        /// Protects access to all other member variables.
+        mutable std::mutex Mutex = {};
+        /// The number of recent frames to keep statistics for.
+        std::size_t FrameWindowSize = DEFAULT_FRAME_WINDOW_SIZE;
+        /// All zones, indexed by zone ID.
+        std::vector<Zone> Zones = {};
+        /// Zone IDs by parent zone ID and name.
+        std::map<std::pair<std::size_t, std::string>, std::size_t> ZoneIdsByParentAndName = {};
+        /// The state for each thread that has measured zones.
+        /// Threads also hold references to their state, so states only referenced here are for exited threads.
+        std::vector<std::shared_ptr<ThreadZoneState>> ThreadStates = {};
+    };
+
+    /// Measures a zone with a profiler for as long as this object exists.
+    class ProfileZone
+    {
+    public:
+        // CONSTRUCTION/DESTRUCTION.
+        explicit ProfileZone(const char* const name, Profiler& profiler = Profiler::Shared());
+        ~ProfileZone();
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The profiler measuring the zone.
+        Profiler& ZoneProfiler;
+    };
+
+    /// Measures stages of work repeated many times within a zone (like the stages of rendering
+    /// each triangle of an object), adding the total time for each stage to the profiler as a
+    /// zone nested within the current zone once this object is destroyed.
+    ///
+    /// Even reading the clock costs a noticeable fraction of such small stages, so only every
+    /// SAMPLING_INTERVAL-th repetition is timed, and each stage's total time is estimated from
+    /// its mean time in those repetitions (less the time to read the clock).  Call counts are
+    /// still exact.  Stages aren't recorded in traces, and allocations made during stages are
+    /// only attributed to the enclosing zone.
+    class ProfileStages
+    {
+    public:
+        /// The maximum number of stages that can be measured.
+        static constexpr std::size_t MAX_STAGE_COUNT = 8;
+        /// The number of repetitions per timed repetition.
+        static constexpr std::size_t SAMPLING_INTERVAL = 8;
+
+        // CONSTRUCTION/DESTRUCTION.
+        explicit ProfileStages(std::initializer_list<const char*> stage_names, Profiler& profiler = Profiler::Shared());
+        ~ProfileStages();
+        ProfileStages(const ProfileStages&) = delete;
+        ProfileStages& operator=(const ProfileStages&) = delete;
+
+        // MEASUREMENT.
+        void Start();
+        void EndStage(const std::size_t stage_index);
+
+    private:
+        // TYPE ALIASES.
+        /// The type of clock used for measuring stages.
+        using ClockType = std::chrono::steady_clock;
+
+        // HELPER METHODS.
+        static double ClockReadTimeInNanoseconds();
+
+        // MEMBER VARIABLES.
+        /// The profiler to add stage times to.
+        Profiler& StagesProfiler;
+        /// The number of stages being measured.
+        std::size_t StageCount = 0;
+        /// The name of each stage, which should be string literals.
+        std::array<const char*, MAX_STAGE_COUNT> StageNames = {};
+        /// The number of times each stage was ended.
+        std::array<std::size_t, MAX_STAGE_COUNT> StageCallCounts = {};
+        /// The number of times each stage was ended in timed repetitions.
+        std::array<std::size_t, MAX_STAGE_COUNT> TimedStageCallCounts = {};
+        /// The total time spent in each stage in timed repetitions.
+        std::array<ClockType::duration, MAX_STAGE_COUNT> TimedStageTimes = {};
+        /// The number of repetitions started.
+        std::size_t RepetitionCount = 0;
+        /// True if the current repetition is being timed; false otherwise.
+        bool TimingRepetition = false;
+        /// The time the most recent stage ended (or the current repetition started), if timing it.
+        ClockType::time_point LastStageEndTime = {};
+    };
+}
+
+/// Macros for instrumenting code with the shared profiler and trace recorder.
+/// These only measure anything if PROFILING_ENABLED is defined, so instrumented
+/// code has no overhead in normal builds.
+#if defined(PROFILING_ENABLED)
+    #define PROFILE_CONCATENATE_IMPLEMENTATION(first, second) first##second
+    #define PROFILE_CONCATENATE(first, second) PROFILE_CONCATENATE_IMPLEMENTATION(first, second)
+    /// Measures the rest of the enclosing scope as a zone with the given name (a string literal),
+    /// also recording it in any trace being recorded.
+    #define PROFILE_ZONE(name) \
+        BENCHMARKING::ProfileZone PROFILE_CONCATENATE(profile_zone_, __LINE__)(name); \
+        BENCHMARKING::TraceZone PROFILE_CONCATENATE(trace_zone_, __LINE__)(name)
+    /// Ends the current frame, updating statistics for all zones and marking the frame in any trace.
+    #define PROFILE_END_FRAME() \
+        do \
+        { \
+            BENCHMARKING::Profiler::Shared().EndFrame(); \
+            BENCHMARKING::TraceRecorder::Shared().RecordInstantEvent("Frame end"); \
+        } while (false)
+    /// Declares a variable measuring stages with the given names (string literals) repeated within the current zone.
+    /// Stages are identified by index in the order named.
+    #define PROFILE_STAGES(variable, ...) BENCHMARKING::ProfileStages variable({ __VA_ARGS__ })
+    /// Starts a repetition of stages, from which the first stage is measured.
+    #define PROFILE_STAGES_START(variable) variable.Start()
+    /// Ends the stage with the given index, from which the next stage is measured.
+    #define PROFILE_STAGE_END(variable, stage_index) variable.EndStage(stage_index)
+#else
+    #define PROFILE_ZONE(name)
+    #define PROFILE_END_FRAME()
+    #define PROFILE_STAGES(variable, ...)
+    #define PROFILE_STAGES_START(variable)
+    #define PROFILE_STAGE_END(variable, stage_index)
+#endif
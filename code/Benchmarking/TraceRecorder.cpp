@@ -0,0 +1,370 @@
+#include <algorithm>
+#include <iomanip>
+#include <string_view>
+#include <utility>
+#include "Benchmarking/TraceRecorder.h"
+
+namespace BENCHMARKING
+{
+    /// Gets the recorder shared across the entire process, which instrumentation macros use.
+    /// @return The shared recorder.
+    TraceRecorder& TraceRecorder::Shared()
+    {
+        static TraceRecorder shared_trace_recorder;
+        return shared_trace_recorder;
+    }
+
+    /// Starts recording a new session, discarding any previously recorded events.
+    /// @param[in]  max_events_per_thread - The maximum number of events to record on each thread,
+    ///     after which further events on the thread are dropped.
+    void TraceRecorder::Start(const std::size_t max_events_per_thread)
+    {
+        // CREATE THE NEW SESSION.
+        static std::atomic<uint64_t> next_session_id = 1;
+        auto session = std::make_shared<Session>();
+        session->SessionId = next_session_id++;
+        session->StartTime = ClockType::now();
+        session->MaxEventsPerThread = max_events_per_thread;
+
+        // MAKE THE SESSION CURRENT.
+        // Threads still recording into a previous session's buffer keep it alive until they notice the new session.
+        std::lock_guard<std::mutex> lock(Mutex);
+        CurrentSession = session;
+        CurrentSessionId = session->SessionId;
+        Recording = true;
+    }
+
+    /// Stops recording, keeping recorded events so that they can be written.
+    void TraceRecorder::Stop()
+    {
+        Recording = false;
+    }
+
+    /// Checks if events are being recorded.
+    /// @return True if recording; false otherwise.
+    bool TraceRecorder::IsRecording() const
+    {
+        return Recording.load(std::memory_order_relaxed);
+    }
+
+    /// Records the beginning of a span of time on the current thread, if recording.
+    /// @param[in]  name - The name of the span, which should be a string literal.
+    void TraceRecorder::BeginEvent(const char* const name)
+    {
+        if (IsRecording())
+        {
+            RecordEvent(name, EventPhase::BEGIN);
+        }
+    }
+
+    /// Records the end of the most recently begun span of time on the current thread.
+    /// Ends are recorded even if recording has stopped, so that spans begun while recording are complete.
+    /// @param[in]  name - The name of the span, which should match the name it began with.
+    void TraceRecorder::EndEvent(const char* const name)
+    {
+        RecordEvent(name, EventPhase::END);
+    }
+
+    /// Records a single point in time (like the end of a frame), if recording.
+    /// @param[in]  name - The name of the event, which should be a string literal.
+    void TraceRecorder::RecordInstantEvent(const char* const name)
+    {
+        if (IsRecording())
+        {
+            RecordEvent(name, EventPhase::INSTANT);
+        }
+    }
+
+    /// Gets the number of events recorded in the current (or most recent) session.
+    /// @return The number of events recorded across all threads.
+    std::size_t TraceRecorder::GetEventCount() const
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (!CurrentSession)
+        {
+            return 0;
+        }
+
+        std::size_t event_count = 0;
+        for (const auto& [thread_id, thread_buffer] : CurrentSession->ThreadBuffers)
+        {
+            for (const EventChunk* chunk = thread_buffer->FirstChunk; chunk; chunk = chunk->NextChunk.load(std::memory_order_acquire))
+            {
+                event_count += chunk->EventCount.load(std::memory_order_acquire);
+            }
+        }
+        return event_count;
+    }
+
+    /// Gets the number of events dropped for exceeding the per-thread limit in the current (or most recent) session.
+    /// @return The number of events dropped across all threads.
+    std::size_t TraceRecorder::GetDroppedEventCount() const
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (!CurrentSession)
+        {
+            return 0;
+        }
+
+        std::size_t dropped_event_count = 0;
+        for (const auto& [thread_id, thread_buffer] : CurrentSession->ThreadBuffers)
+        {
+            dropped_event_count += thread_buffer->DroppedEventCount.load(std::memory_order_relaxed);
+        }
+        return dropped_event_count;
+    }
+
+    /// Writes events from the current (or most recent) session as Chrome trace event JSON.
+    /// Any events recorded while writing (if still recording) may or may not be included.
+    /// The number of dropped events is included in the trace's metadata.
+    /// @param[in,out]  json_output - The output to write to.
+    void TraceRecorder::WriteChromeTraceJson(std::ostream& json_output) const
+    {
+        // ORDER THREADS BY WHEN THEY FIRST RECORDED EVENTS.
+        std::shared_ptr<Session> session;
+        std::vector<std::shared_ptr<ThreadEventBuffer>> thread_buffers;
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            session = CurrentSession;
+            if (session)
+            {
+                for (const auto& [thread_id, thread_buffer] : session->ThreadBuffers)
+                {
+                    thread_buffers.push_back(thread_buffer);
+                }
+            }
+        }
+        std::sort(
+            thread_buffers.begin(),
+            thread_buffers.end(),
+            [](const std::shared_ptr<ThreadEventBuffer>& left, const std::shared_ptr<ThreadEventBuffer>& right) { return left->ThreadNumber < right->ThreadNumber; });
+
+        // WRITE THE EVENTS.
+        // Names are expected to be simple literals, but quotes and backslashes are escaped to ensure valid JSON.
+        auto write_name = [&json_output](const std::string_view name)
+        {
+            json_output << '"';
+            for (char character : name)
+            {
+                if ('"' == character || '\\' == character)
+                {
+                    json_output << '\\';
+                }
+                json_output << character;
+            }
+            json_output << '"';
+        };
+        // A single process ID is used since all threads are in this process.
+        // Timestamps are written with fixed precision to avoid losing precision to scientific notation.
+        constexpr unsigned int PROCESS_ID = 1;
+        std::ios_base::fmtflags original_format_flags = json_output.flags();
+        std::streamsize original_precision = json_output.precision();
+        json_output << std::fixed << std::setprecision(3);
+        json_output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first_event = true;
+        for (const std::shared_ptr<ThreadEventBuffer>& thread_buffer : thread_buffers)
+        {
+            // NAME THE THREAD.
+            json_output
+                << (first_event ? "\n" : ",\n")
+                << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << PROCESS_ID
+                << ",\"tid\":" << thread_buffer->ThreadNumber
+                << ",\"args\":{\"name\":\"Thread " << thread_buffer->ThreadNumber << "\"}}";
+            first_event = false;
+
+            // WRITE EACH EVENT FOR THE THREAD.
+            for (const EventChunk* chunk = thread_buffer->FirstChunk; chunk; chunk = chunk->NextChunk.load(std::memory_order_acquire))
+            {
+                std::size_t chunk_event_count = chunk->EventCount.load(std::memory_order_acquire);
+                for (std::size_t event_index = 0; event_index < chunk_event_count; ++event_index)
+                {
+                    // Timestamps are in microseconds.
+                    const Event& event = chunk->Events[event_index];
+                    std::chrono::duration<double, std::micro> timestamp = event.Time - session->StartTime;
+                    json_output << ",\n{\"name\":";
+                    write_name(event.Name);
+                    json_output
+                        << ",\"ph\":\"" << static_cast<char>(event.Phase) << "\""
+                        << ",\"pid\":" << PROCESS_ID
+                        << ",\"tid\":" << thread_buffer->ThreadNumber
+                        << ",\"ts\":" << timestamp.count();
+                    if (EventPhase::INSTANT == event.Phase)
+                    {
+                        // Instant events are shown across all threads since they're used for things like frame boundaries.
+                        json_output << ",\"s\":\"g\"";
+                    }
+                    json_output << "}";
+                }
+            }
+        }
+        std::size_t dropped_event_count = 0;
+        for (const std::shared_ptr<ThreadEventBuffer>& thread_buffer : thread_buffers)
+        {
+            dropped_event_count += thread_buffer->DroppedEventCount.load(std::memory_order_relaxed);
+        }
+        json_output << "\n],\"otherData\":{\"dropped_event_count\":" << dropped_event_count << "}}\n";
+        json_output.flags(original_format_flags);
+        json_output.precision(original_precision);
+    }
+
+    /// Records an event on the current thread in the current session.
+    /// @param[in]  name - The name of the event.
+    /// @param[in]  phase - The kind of event.
+    void TraceRecorder::RecordEvent(const char* const name, const EventPhase phase)
+    {
+        // MAKE SURE A SESSION EXISTS TO RECORD INTO.
+        bool session_started = (0 != CurrentSessionId.load(std::memory_order_acquire));
+        if (!session_started)
+        {
+            return;
+        }
+
+        // MAKE SURE THE EVENT FITS WITHIN THE THREAD'S LIMIT.
+        // The time is captured first so that finding the buffer isn't included in measured spans.
+        ClockType::time_point event_time = ClockType::now();
+        ThreadEventBuffer& thread_buffer = CurrentThreadBuffer();
+        bool event_fits = ReserveEventSpace(thread_buffer, phase);
+        if (!event_fits)
+        {
+            thread_buffer.DroppedEventCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // GET A CHUNK WITH SPACE FOR THE EVENT.
+        EventChunk* chunk = thread_buffer.LastChunk;
+        std::size_t chunk_event_count = chunk->EventCount.load(std::memory_order_relaxed);
+        if (EVENTS_PER_CHUNK == chunk_event_count)
+        {
+            EventChunk* new_chunk = new EventChunk();
+            chunk->NextChunk.store(new_chunk, std::memory_order_release);
+            thread_buffer.LastChunk = new_chunk;
+            chunk = new_chunk;
+            chunk_event_count = 0;
+        }
+
+        // ADD THE EVENT.
+        // Updating the count publishes the event to other threads.
+        chunk->Events[chunk_event_count] = Event{ .Name = name, .Time = event_time, .Phase = phase };
+        chunk->EventCount.store(chunk_event_count + 1, std::memory_order_release);
+        ++thread_buffer.EventCount;
+    }
+
+    /// Determines if an event can be recorded within a thread's limit, updating the thread's open spans.
+    /// Space is always kept for ending recorded spans, and spans begun within a dropped span are dropped
+    /// along with it, so that every recorded beginning has a recorded end.
+    /// @param[in,out]  thread_buffer - The buffer for the thread recording the event.
+    /// @param[in]  phase - The kind of event.
+    /// @return True if the event should be recorded; false if it should be dropped.
+    bool TraceRecorder::ReserveEventSpace(ThreadEventBuffer& thread_buffer, const EventPhase phase)
+    {
+        std::size_t reserved_event_count = thread_buffer.EventCount + thread_buffer.OpenSpanCount;
+        switch (phase)
+        {
+            case EventPhase::BEGIN:
+            {
+                // Space is needed for both the beginning and end of the span.
+                constexpr std::size_t SPAN_EVENT_COUNT = 2;
+                bool span_fits = (0 == thread_buffer.OpenDroppedSpanCount) && (reserved_event_count + SPAN_EVENT_COUNT <= thread_buffer.MaxEventCount);
+                if (span_fits)
+                {
+                    ++thread_buffer.OpenSpanCount;
+                }
+                else
+                {
+                    ++thread_buffer.OpenDroppedSpanCount;
+                }
+                return span_fits;
+            }
+            case EventPhase::END:
+            {
+                // Spans are ended in the reverse order they began, so the innermost dropped span ends first.
+                if (thread_buffer.OpenDroppedSpanCount > 0)
+                {
+                    --thread_buffer.OpenDroppedSpanCount;
+                    return false;
+                }
+                if (thread_buffer.OpenSpanCount > 0)
+                {
+                    --thread_buffer.OpenSpanCount;
+                    return true;
+                }
+                // Ends of spans that began in a previous session only fit if there's unreserved space.
+                return reserved_event_count < thread_buffer.MaxEventCount;
+            }
+            case EventPhase::INSTANT:
+            default:
+                return reserved_event_count < thread_buffer.MaxEventCount;
+        }
+    }
+
+    /// Gets the buffer for the current thread in the current session, creating it if needed.
+    /// @return The buffer for the current thread.
+    TraceRecorder::ThreadEventBuffer& TraceRecorder::CurrentThreadBuffer()
+    {
+        // CHECK IF THE CACHED BUFFER IS FOR THE CURRENT SESSION.
+        // Session IDs are unique across all recorders, so a single cached buffer per thread suffices.
+        thread_local uint64_t cached_session_id = 0;
+        thread_local std::shared_ptr<ThreadEventBuffer> cached_thread_buffer = nullptr;
+        uint64_t current_session_id = CurrentSessionId.load(std::memory_order_acquire);
+        if (cached_thread_buffer && current_session_id == cached_session_id)
+        {
+            return *cached_thread_buffer;
+        }
+
+        // GET OR CREATE THE BUFFER IN THE CURRENT SESSION.
+        std::lock_guard<std::mutex> lock(Mutex);
+        std::shared_ptr<ThreadEventBuffer>& thread_buffer = CurrentSession->ThreadBuffers[std::this_thread::get_id()];
+        if (!thread_buffer)
+        {
+            std::size_t thread_number = CurrentSession->ThreadBuffers.size() - 1;
+            thread_buffer = std::make_shared<ThreadEventBuffer>(thread_number, CurrentSession->MaxEventsPerThread);
+        }
+        cached_session_id = CurrentSession->SessionId;
+        cached_thread_buffer = thread_buffer;
+        return *cached_thread_buffer;
+    }
+
+    /// Constructor.
+    /// @param[in]  thread_number - The number identifying the thread within the trace.
+    /// @param[in]  max_event_count - The maximum number of events to record.
+    TraceRecorder::ThreadEventBuffer::ThreadEventBuffer(const std::size_t thread_number, const std::size_t max_event_count) :
+        ThreadNumber(thread_number),
+        FirstChunk(new EventChunk()),
+        LastChunk(FirstChunk),
+        MaxEventCount(max_event_count)
+    {}
+
+    /// Destructor to free all chunks.
+    TraceRecorder::ThreadEventBuffer::~ThreadEventBuffer()
+    {
+        EventChunk* chunk = FirstChunk;
+        while (chunk)
+        {
+            EventChunk* next_chunk = chunk->NextChunk.load(std::memory_order_acquire);
+            delete chunk;
+            chunk = next_chunk;
+        }
+    }
+
+    /// Begins recording a span of time, if recording.
+    /// @param[in]  name - The name of the zone, which should be a string literal.
+    /// @param[in,out]  trace_recorder - The recorder to record with.
+    TraceZone::TraceZone(const char* const name, TraceRecorder& trace_recorder) :
+        ZoneTraceRecorder(trace_recorder)
+    {
+        if (ZoneTraceRecorder.IsRecording())
+        {
+            Name = name;
+            ZoneTraceRecorder.BeginEvent(Name);
+        }
+    }
+
+    /// Ends recording the span of time, if it began while recording.
+    TraceZone::~TraceZone()
+    {
+        if (Name)
+        {
+            ZoneTraceRecorder.EndEvent(Name);
+        }
+    }
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace BENCHMARKING
+{
+    /// Records a timeline of events (like the start and end of profiled zones) on all threads,
+    /// which can be written as Chrome trace event JSON for viewing in Perfetto or chrome://tracing.
+    ///
+    /// Unlike the statistics kept by the Profiler, a timeline shows exactly when each thread
+    /// was working on what, making stalls and load imbalance between threads visible.
+    ///
+    /// Each thread records events into its own buffer without any locking, so recording
+    /// doesn't affect how threads contend with each other.  Only the first event a thread
+    /// records in each recording session takes a lock (to create the thread's buffer).
+    /// Each thread's buffer is limited to a maximum number of events, after which further
+    /// events on the thread are dropped (and counted) so that long recordings don't exhaust
+    /// memory.  Ends of spans already recorded are never dropped, so traces stay balanced.
+    ///
+    /// Event names must be string literals (or otherwise outlive the recording) since only
+    /// pointers to them are stored.
+    class TraceRecorder
+    {
+    public:
+        /// The default maximum number of events recorded per thread in a session.
+        static constexpr std::size_t DEFAULT_MAX_EVENTS_PER_THREAD = 256 * 1024;
+
+        // PROCESS-WIDE RECORDER.
+        static TraceRecorder& Shared();
+
+        // RECORDING CONTROL.
+        void Start(const std::size_t max_events_per_thread = DEFAULT_MAX_EVENTS_PER_THREAD);
+        void Stop();
+        bool IsRecording() const;
+
+        // EVENT RECORDING.
+        void BeginEvent(const char* const name);
+        void EndEvent(const char* const name);
+        void RecordInstantEvent(const char* const name);
+
+        // OUTPUT.
+        std::size_t GetEventCount() const;
+        std::size_t GetDroppedEventCount() const;
+        void WriteChromeTraceJson(std::ostream& json_output) const;
+
+    private:
+        // TYPE ALIASES.
+        /// The type of clock used for event timestamps.
+        using ClockType = std::chrono::steady_clock;
+
+        /// The kinds of events, with values matching Chrome trace event phases.
+        enum class EventPhase : char
+        {
+            /// The start of a span of time.
+            BEGIN = 'B',
+            /// The end of the most recently begun span of time on the same thread.
+            END = 'E',
+            /// A single point in time.
+            INSTANT = 'i'
+        };
+
+        /// A recorded event.
+        struct Event
+        {
+            /// The name of the event.
+            const char* Name = nullptr;
+            /// The time of the event.
+            ClockType::time_point Time = {};
+            /// The kind of event.
+            EventPhase Phase = EventPhase::INSTANT;
+        };
+
+        /// The number of events in each chunk of a thread's buffer.
+        static constexpr std::size_t EVENTS_PER_CHUNK = 4096;
+
+        /// A fixed-size chunk of events in a thread's buffer.
+        /// Only the owning thread writes events, publishing them by updating the count, so
+        /// other threads can read all events up to the count without locking.
+        struct EventChunk
+        {
+            /// The events, of which only the first EventCount are valid.
+            std::array<Event, EVENTS_PER_CHUNK> Events = {};
+            /// The number of valid events.
+            std::atomic<std::size_t> EventCount = 0;
+            /// The next chunk, once this chunk is full.
+            std::atomic<EventChunk*> NextChunk = nullptr;
+        };
+
+        /// The events recorded by a single thread during a recording session.
+        struct ThreadEventBuffer
+        {
+            explicit ThreadEventBuffer(const std::size_t thread_number, const std::size_t max_event_count);
+            ~ThreadEventBuffer();
+            ThreadEventBuffer(const ThreadEventBuffer&) = delete;
+            ThreadEventBuffer& operator=(const ThreadEventBuffer&) = delete;
+
+            /// A number identifying the thread within the trace, in order of first recorded event.
+            std::size_t ThreadNumber = 0;
+            /// The first chunk of events, which owns all following chunks.
+            EventChunk* FirstChunk = nullptr;
+            /// The chunk currently being written to (only accessed by the owning thread).
+            EventChunk* LastChunk = nullptr;
+            /// The maximum number of events to record.
+            std::size_t MaxEventCount = 0;
+            /// The number of events recorded (only accessed by the owning thread).
+            std::size_t EventCount = 0;
+            /// The number of recorded spans not yet ended, which space is kept for (only accessed by the owning thread).
+            std::size_t OpenSpanCount = 0;
+            /// The number of dropped spans not yet ended, whose ends are also dropped (only accessed by the owning thread).
+            std::size_t OpenDroppedSpanCount = 0;
+            /// The number of events dropped for exceeding the maximum.
+            std::atomic<std::size_t> DroppedEventCount = 0;
+        };
+
+        /// A recording from starting until the next start.
+        struct Session
+        {
+            /// A unique ID for the session across all recorders, allowing threads to cache their buffer.
+            uint64_t SessionId = 0;
+            /// The time recording started, which event timestamps are relative to.
+            ClockType::time_point StartTime = {};
+            /// The maximum number of events to record per thread.
+            std::size_t MaxEventsPerThread = DEFAULT_MAX_EVENTS_PER_THREAD;
+            /// The buffer for each thread that has recorded events.
+            std::unordered_map<std::thread::id, std::shared_ptr<ThreadEventBuffer>> ThreadBuffers = {};
+        };
+
+        // HELPER METHODS.
+        void RecordEvent(const char* const name, const EventPhase phase);
+        static bool ReserveEventSpace(ThreadEventBuffer& thread_buffer, const EventPhase phase);
+        ThreadEventBuffer& CurrentThreadBuffer();
+
+        // MEMBER VARIABLES.
+        /// True if events are being recorded; false otherwise.
+        std::atomic<bool> Recording = false;
+        /// The ID of the current session, allowing threads to check if their cached buffer is current.
+        std::atomic<uint64_t> CurrentSessionId = 0;
+        /// Protects access to the current session.
+        mutable std::mutex Mutex = {};
+        /// The current (or most recent) session, if any.
+        std::shared_ptr<Session> CurrentSession = nullptr;
+    };
+
+    /// Records the beginning and end of a span of time for as long as this object exists.
+    class TraceZone
+    {
+    public:
+        // CONSTRUCTION/DESTRUCTION.
+        explicit TraceZone(const char* const name, TraceRecorder& trace_recorder = TraceRecorder::Shared());
+        ~TraceZone();
+        TraceZone(const TraceZone&) = delete;
+        TraceZone& operator=(const TraceZone&) = delete;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The name of the zone, or null if recording wasn't happening when the zone began.
+        const char* Name = nullptr;
+        /// The recorder for the zone.
+        TraceRecorder& ZoneTraceRecorder;
+    };
+}
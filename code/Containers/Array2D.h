@@ -46,6 +46,7 @@ namespace CONTAINERS
         // ELEMENT ACCESS.
         T& operator()(const unsigned int x, const unsigned int y);
         const T& operator()(const unsigned int x, const unsigned int y) const;
+        T* ValuesInRowMajorOrder();
         const T* ValuesInRowMajorOrder() const;
         std::vector<T> ValuesInColumnMajorOrder() const;
 
@@ -222,6 +223,15 @@ namespace CONTAINERS
         return Data.at(element_index);
     }
 
+    /// Gets the modifiable values in the array in row-major order
+    /// (all values for each row before the next row).
+    /// @return The array values in row-major order.
+    template <typename T>
+    T* Array2D<T>::ValuesInRowMajorOrder()
+    {
+        return Data.data();
+    }
+
     /// Gets the values in the array in row-major order
     /// (all values for each row before the next row).
     /// @return The array values in row-major order.
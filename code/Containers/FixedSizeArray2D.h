@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace CONTAINERS
+{
+    /// A 2D array whose dimensions are fixed at compile-time.
+    /// Unlike Array2D, elements are stored inline (without any heap allocation),
+    /// which makes this class suitable for small, frequently created arrays
+    /// (like matrices).  The interface mirrors Array2D to allow easily switching
+    /// between the two.  Elements are aligned to 16 bytes to allow aligned SIMD
+    /// loads of each row of 4 floats.
+    /// @tparam T - The type of data to store in the array.
+    /// @tparam WIDTH - The width (number of columns) in the array.
+    /// @tparam HEIGHT - The height (number of rows) in the array.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    class FixedSizeArray2D
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The total number of elements in the array.
+        static constexpr std::size_t ELEMENT_COUNT = static_cast<std::size_t>(WIDTH) * HEIGHT;
+        /// The alignment of elements in bytes.
+        static constexpr std::size_t ALIGNMENT_IN_BYTES = (alignof(T) > 16) ? alignof(T) : 16;
+
+        // COMPARISON OPERATORS.
+        constexpr bool operator==(const FixedSizeArray2D& rhs) const = default;
+
+        // DIMENSION ACCESS/MODIFICATION.
+        constexpr unsigned int GetWidth() const;
+        constexpr unsigned int GetHeight() const;
+        constexpr void Fill(const T& value);
+
+        // BOUNDS CHECKING.
+        constexpr bool IndicesInRange(const unsigned int x, const unsigned int y) const;
+
+        // ELEMENT ACCESS.
+        constexpr T& operator()(const unsigned int x, const unsigned int y);
+        constexpr const T& operator()(const unsigned int x, const unsigned int y) const;
+        constexpr T* ValuesInRowMajorOrder();
+        constexpr const T* ValuesInRowMajorOrder() const;
+        constexpr std::array<T, ELEMENT_COUNT> ValuesInColumnMajorOrder() const;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The raw data in the array.  Data is stored starting with the top row,
+        /// going down to lower rows.  Within each row, each element is stored
+        /// from left to right.  Elements are value-initialized (zero for numbers) by default.
+        alignas(ALIGNMENT_IN_BYTES) std::array<T, ELEMENT_COUNT> Data = {};
+    };
+
+    /// Gets the width (number of columns) in the array.
+    /// @return The width of the array.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr unsigned int FixedSizeArray2D<T, WIDTH, HEIGHT>::GetWidth() const
+    {
+        return WIDTH;
+    }
+
+    /// Gets the height (number of rows) in the array.
+    /// @return The height of the array.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr unsigned int FixedSizeArray2D<T, WIDTH, HEIGHT>::GetHeight() const
+    {
+        return HEIGHT;
+    }
+
+    /// Fills the array with the specified value.
+    /// @param[in]  value - The value to fill the array with.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr void FixedSizeArray2D<T, WIDTH, HEIGHT>::Fill(const T& value)
+    {
+        Data.fill(value);
+    }
+
+    /// Determines if the provided indices are in range of this array's bounds.
+    /// @param[in]  x - The horizontal coordinate (or column) to check.
+    /// @param[in]  y - The vertical coordinate (or row) to check.
+    /// @return True if both indices are in range; false otherwise.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr bool FixedSizeArray2D<T, WIDTH, HEIGHT>::IndicesInRange(const unsigned int x, const unsigned int y) const
+    {
+        // CHECK IF BOTH INDICES ARE IN BOUNDS.
+        bool x_within_bounds = (x < WIDTH);
+        bool y_within_bounds = (y < HEIGHT);
+        bool indices_within_bounds = (x_within_bounds && y_within_bounds);
+        return indices_within_bounds;
+    }
+
+    /// Retrieves a reference to the element at the specified 2D coordinates.
+    /// Unlike Array2D, no bounds-checking is performed since this class is intended
+    /// for performance-sensitive code where indices are typically constants.
+    /// @param[in]  x - The horizontal coordinate (or column) of the element to retrieve.
+    /// @param[in]  y - The vertical coordinate (or row) of the element to retrieve.
+    /// @return A reference to the element at the specified 2D position.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr T& FixedSizeArray2D<T, WIDTH, HEIGHT>::operator()(const unsigned int x, const unsigned int y)
+    {
+        std::size_t element_index = (static_cast<std::size_t>(y) * WIDTH) + x;
+        return Data[element_index];
+    }
+
+    /// Retrieves a constant reference to the element at the specified 2D coordinates.
+    /// Unlike Array2D, no bounds-checking is performed since this class is intended
+    /// for performance-sensitive code where indices are typically constants.
+    /// @param[in]  x - The horizontal coordinate (or column) of the element to retrieve.
+    /// @param[in]  y - The vertical coordinate (or row) of the element to retrieve.
+    /// @return A constant reference to the element at the specified 2D position.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr const T& FixedSizeArray2D<T, WIDTH, HEIGHT>::operator()(const unsigned int x, const unsigned int y) const
+    {
+        std::size_t element_index = (static_cast<std::size_t>(y) * WIDTH) + x;
+        return Data[element_index];
+    }
+
+    /// Gets the modifiable values in the array in row-major order
+    /// (all values for each row before the next row).
+    /// @return The array values in row-major order.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr T* FixedSizeArray2D<T, WIDTH, HEIGHT>::ValuesInRowMajorOrder()
+    {
+        return Data.data();
+    }
+
+    /// Gets the values in the array in row-major order
+    /// (all values for each row before the next row).
+    /// @return The array values in row-major order.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr const T* FixedSizeArray2D<T, WIDTH, HEIGHT>::ValuesInRowMajorOrder() const
+    {
+        return Data.data();
+    }
+
+    /// Gets a copy of the values in the array in column-major order
+    /// (all values for each column before the next column).
+    /// @return The array values in column-major order.
+    template <typename T, unsigned int WIDTH, unsigned int HEIGHT>
+    constexpr std::array<T, FixedSizeArray2D<T, WIDTH, HEIGHT>::ELEMENT_COUNT> FixedSizeArray2D<T, WIDTH, HEIGHT>::ValuesInColumnMajorOrder() const
+    {
+        std::array<T, ELEMENT_COUNT> values_in_column_major_order = {};
+
+        std::size_t column_major_index = 0;
+        for (unsigned int column_index = 0; column_index < WIDTH; ++column_index)
+        {
+            for (unsigned int row_index = 0; row_index < HEIGHT; ++row_index)
+            {
+                values_in_column_major_order[column_major_index] = (*this)(column_index, row_index);
+                ++column_major_index;
+            }
+        }
+
+        return values_in_column_major_order;
+    }
+}
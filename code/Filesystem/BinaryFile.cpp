@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include "Filesystem/BinaryFile.h"
+
+namespace FILESYSTEM
+{
+    /// Rounds an offset up to the alignment required for sections.
+    /// @param[in]  offset_in_bytes - The offset to align.
+    /// @return The aligned offset.
+    uint64_t BinaryFile::AlignSectionOffset(const uint64_t offset_in_bytes)
+    {
+        uint64_t aligned_offset_in_bytes = (offset_in_bytes + SECTION_ALIGNMENT_IN_BYTES - 1) / SECTION_ALIGNMENT_IN_BYTES * SECTION_ALIGNMENT_IN_BYTES;
+        return aligned_offset_in_bytes;
+    }
+
+    /// Writes sections of data to a file, replacing any existing file.
+    /// The file is first written under a temporary name and then renamed so that
+    /// other processes never see a partially written file.
+    /// @param[in]  filepath - The path of the file to write.
+    /// @param[in]  sections - The sections to write, in order of increasing (non-overlapping) offsets.
+    ///     Any gaps between sections are filled with zeros.
+    /// @return True if the file was written successfully; false otherwise.
+    bool BinaryFile::Write(const std::filesystem::path& filepath, const std::vector<SectionData>& sections)
+    {
+        // OPEN A TEMPORARY FILE.
+        std::filesystem::path temporary_filepath = filepath;
+        temporary_filepath += ".tmp";
+        std::ofstream file(temporary_filepath, std::ios::binary | std::ios::trunc);
+        bool file_opened = file.is_open();
+        if (!file_opened)
+        {
+            return false;
+        }
+
+        // WRITE EACH SECTION.
+        uint64_t current_offset_in_bytes = 0;
+        for (const SectionData& section : sections)
+        {
+            uint64_t padding_size_in_bytes = section.OffsetInBytes - current_offset_in_bytes;
+            std::fill_n(std::ostreambuf_iterator<char>(file), padding_size_in_bytes, '\0');
+            file.write(static_cast<const char*>(section.Data), static_cast<std::streamsize>(section.SizeInBytes));
+            current_offset_in_bytes = section.OffsetInBytes + section.SizeInBytes;
+        }
+
+        file.close();
+        bool file_written = !file.fail();
+        if (!file_written)
+        {
+            std::error_code ignored_error;
+            std::filesystem::remove(temporary_filepath, ignored_error);
+            return false;
+        }
+
+        // REPLACE ANY EXISTING FILE.
+        std::error_code rename_error;
+        std::filesystem::rename(temporary_filepath, filepath, rename_error);
+        if (rename_error)
+        {
+            std::error_code ignored_error;
+            std::filesystem::remove(temporary_filepath, ignored_error);
+            return false;
+        }
+
+        return true;
+    }
+
+    /// Appends a 32-bit unsigned integer to a section being serialized.
+    /// @param[in]  value - The value to append.
+    /// @param[in,out]  section - The section to append to.
+    void BinaryFile::AppendUInt32(const uint32_t value, std::string& section)
+    {
+        section.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    /// Appends a string (a 32-bit length followed by the characters) to a section being serialized.
+    /// @param[in]  text - The UTF-8 text to append.
+    /// @param[in,out]  section - The section to append to.
+    void BinaryFile::AppendString(const std::u8string_view text, std::string& section)
+    {
+        AppendUInt32(static_cast<uint32_t>(text.size()), section);
+        section.append(reinterpret_cast<const char*>(text.data()), text.size());
+    }
+
+    /// Reads a 32-bit unsigned integer from the start of a section.
+    /// @param[in,out]  section - The remaining data in the section.  Updated to start after the value.
+    /// @param[out] value - The value read.
+    /// @return True if the value was read; false if there wasn't enough data.
+    bool BinaryFile::ReadUInt32(std::span<const std::byte>& section, uint32_t& value)
+    {
+        bool value_exists = (section.size() >= sizeof(value));
+        if (!value_exists)
+        {
+            return false;
+        }
+
+        std::memcpy(&value, section.data(), sizeof(value));
+        section = section.subspan(sizeof(value));
+        return true;
+    }
+
+    /// Reads a string (a 32-bit length followed by the characters) from the start of a section.
+    /// @param[in,out]  section - The remaining data in the section.  Updated to start after the string.
+    /// @param[out] text - The UTF-8 text read.
+    /// @return True if the string was read; false if there wasn't enough data.
+    bool BinaryFile::ReadString(std::span<const std::byte>& section, std::u8string& text)
+    {
+        // READ THE LENGTH.
+        uint32_t text_length = 0;
+        bool text_length_read = ReadUInt32(section, text_length);
+        if (!text_length_read)
+        {
+            return false;
+        }
+
+        // READ THE CHARACTERS.
+        bool text_exists = (section.size() >= text_length);
+        if (!text_exists)
+        {
+            return false;
+        }
+        text.assign(reinterpret_cast<const char8_t*>(section.data()), text_length);
+        section = section.subspan(text_length);
+        return true;
+    }
+
+    /// Checks if a section is aligned and entirely within a file.
+    /// Sizes are checked via division to avoid any overflow from corrupted counts.
+    /// @param[in]  file_size_in_bytes - The size of the file.
+    /// @param[in]  offset_in_bytes - The offset of the section from the start of the file.
+    /// @param[in]  element_count - The number of elements in the section.
+    /// @param[in]  element_size_in_bytes - The size of each element in the section.
+    /// @return True if the section is valid; false otherwise.
+    bool BinaryFile::SectionValid(
+        const uint64_t file_size_in_bytes,
+        const uint64_t offset_in_bytes,
+        const uint64_t element_count,
+        const uint64_t element_size_in_bytes)
+    {
+        bool offset_aligned = (0 == offset_in_bytes % SECTION_ALIGNMENT_IN_BYTES);
+        bool offset_in_file = (offset_in_bytes <= file_size_in_bytes);
+        bool elements_in_file = offset_in_file && (element_count <= (file_size_in_bytes - offset_in_bytes) / element_size_in_bytes);
+        return offset_aligned && elements_in_file;
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "Filesystem/MemoryMappedFile.h"
+
+namespace FILESYSTEM
+{
+    /// Helpers shared by binary file formats that consist of a fixed-size header followed
+    /// by sections of data that can be used directly from memory-mapped files.
+    /// Each section starts at an offset aligned to SECTION_ALIGNMENT_IN_BYTES, with zero padding
+    /// between sections.  Variable-length sections can hold strings, which are stored
+    /// as a 32-bit length followed by UTF-8 characters.
+    class BinaryFile
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The alignment of each section in a file.
+        static constexpr uint64_t SECTION_ALIGNMENT_IN_BYTES = 16;
+
+        /// A block of data to be written at a specific offset in a file.
+        struct SectionData
+        {
+            /// The offset of the data from the start of the file.
+            uint64_t OffsetInBytes = 0;
+            /// The data to write.
+            const void* Data = nullptr;
+            /// The size of the data to write.
+            uint64_t SizeInBytes = 0;
+        };
+
+        // LAYOUT.
+        static uint64_t AlignSectionOffset(const uint64_t offset_in_bytes);
+
+        // WRITING.
+        static bool Write(const std::filesystem::path& filepath, const std::vector<SectionData>& sections);
+        static void AppendUInt32(const uint32_t value, std::string& section);
+        static void AppendString(const std::u8string_view text, std::string& section);
+
+        // READING.
+        static bool SectionValid(
+            const uint64_t file_size_in_bytes,
+            const uint64_t offset_in_bytes,
+            const uint64_t element_count,
+            const uint64_t element_size_in_bytes);
+        template <typename Element>
+        static std::optional<std::span<const Element>> GetSection(
+            const MemoryMappedFile& file,
+            const uint64_t offset_in_bytes,
+            const uint64_t element_count);
+        static bool ReadUInt32(std::span<const std::byte>& section, uint32_t& value);
+        static bool ReadString(std::span<const std::byte>& section, std::u8string& text);
+    };
+
+    /// Gets a section of elements within a memory-mapped file, if the section is valid.
+    /// @tparam Element - The type of elements in the section.
+    /// @param[in]  file - The mapped file.
+    /// @param[in]  offset_in_bytes - The offset of the section from the start of the file.
+    /// @param[in]  element_count - The number of elements in the section.
+    /// @return The elements in the section, if aligned and entirely within the file; null otherwise.
+    template <typename Element>
+    std::optional<std::span<const Element>> BinaryFile::GetSection(
+        const MemoryMappedFile& file,
+        const uint64_t offset_in_bytes,
+        const uint64_t element_count)
+    {
+        // Elements are used directly from the mapped file, which requires them to be plain data.
+        static_assert(std::is_trivially_copyable_v<Element>, "Elements must be trivially copyable.");
+
+        bool section_valid = SectionValid(file.SizeInBytes(), offset_in_bytes, element_count, sizeof(Element));
+        if (!section_valid)
+        {
+            return std::nullopt;
+        }
+
+        // Empty sections may be at the end of the file, where no data is mapped.
+        if (0 == element_count)
+        {
+            return std::span<const Element>();
+        }
+
+        return std::span<const Element>(
+            reinterpret_cast<const Element*>(file.Data() + offset_in_bytes),
+            static_cast<std::size_t>(element_count));
+    }
+}
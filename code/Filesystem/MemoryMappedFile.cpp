@@ -0,0 +1,159 @@
+#if _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "Filesystem/MemoryMappedFile.h"
+
+namespace FILESYSTEM
+{
+    /// Attempts to memory-map the specified file for reading.
+    /// @param[in]  filepath - The path of the file to map.
+    /// @return The mapped file, if successfully opened; null otherwise.
+    std::unique_ptr<MemoryMappedFile> MemoryMappedFile::Open(const std::filesystem::path& filepath)
+    {
+        // The constructor is private, so std::make_unique can't be used.
+        std::unique_ptr<MemoryMappedFile> mapped_file(new MemoryMappedFile());
+
+#if _WIN32
+        // OPEN THE FILE.
+        HANDLE file_handle = CreateFileW(
+            filepath.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+            nullptr);
+        bool file_opened = (INVALID_HANDLE_VALUE != file_handle);
+        if (!file_opened)
+        {
+            return nullptr;
+        }
+        mapped_file->FileHandle = file_handle;
+
+        // GET THE SIZE OF THE FILE.
+        LARGE_INTEGER file_size_in_bytes = {};
+        bool file_size_retrieved = GetFileSizeEx(file_handle, &file_size_in_bytes);
+        if (!file_size_retrieved)
+        {
+            return nullptr;
+        }
+
+        // Empty files can't be mapped but are still valid to open.
+        bool file_empty = (0 == file_size_in_bytes.QuadPart);
+        if (file_empty)
+        {
+            return mapped_file;
+        }
+
+        // MAP THE FILE INTO MEMORY.
+        HANDLE file_mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!file_mapping_handle)
+        {
+            return nullptr;
+        }
+        mapped_file->FileMappingHandle = file_mapping_handle;
+
+        void* mapped_data = MapViewOfFile(file_mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        if (!mapped_data)
+        {
+            return nullptr;
+        }
+        mapped_file->MappedData = static_cast<const std::byte*>(mapped_data);
+        mapped_file->MappedSizeInBytes = static_cast<std::size_t>(file_size_in_bytes.QuadPart);
+#else
+        // OPEN THE FILE.
+        int file_descriptor = open(filepath.c_str(), O_RDONLY);
+        bool file_opened = (file_descriptor >= 0);
+        if (!file_opened)
+        {
+            return nullptr;
+        }
+
+        // GET THE SIZE OF THE FILE.
+        struct stat file_status = {};
+        bool file_status_retrieved = (0 == fstat(file_descriptor, &file_status));
+        if (!file_status_retrieved)
+        {
+            close(file_descriptor);
+            return nullptr;
+        }
+
+        // Empty files can't be mapped but are still valid to open.
+        bool file_empty = (0 == file_status.st_size);
+        if (file_empty)
+        {
+            close(file_descriptor);
+            return mapped_file;
+        }
+
+        // MAP THE FILE INTO MEMORY.
+        // The mapping remains valid after the file is closed.
+        std::size_t file_size_in_bytes = static_cast<std::size_t>(file_status.st_size);
+        void* mapped_data = mmap(nullptr, file_size_in_bytes, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        close(file_descriptor);
+        bool file_mapped = (MAP_FAILED != mapped_data);
+        if (!file_mapped)
+        {
+            return nullptr;
+        }
+        mapped_file->MappedData = static_cast<const std::byte*>(mapped_data);
+        mapped_file->MappedSizeInBytes = file_size_in_bytes;
+
+        // The file is typically read from start to end, so this allows more aggressive read-ahead.
+        madvise(mapped_data, file_size_in_bytes, MADV_SEQUENTIAL);
+#endif
+
+        return mapped_file;
+    }
+
+    /// Destructor.  Unmaps the file.
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+#if _WIN32
+        if (MappedData)
+        {
+            UnmapViewOfFile(MappedData);
+        }
+        if (FileMappingHandle)
+        {
+            CloseHandle(FileMappingHandle);
+        }
+        if (FileHandle)
+        {
+            CloseHandle(FileHandle);
+        }
+#else
+        if (MappedData)
+        {
+            munmap(const_cast<std::byte*>(MappedData), MappedSizeInBytes);
+        }
+#endif
+    }
+
+    /// Gets the raw contents of the file.
+    /// @return The file contents.  Null for empty files.
+    const std::byte* MemoryMappedFile::Data() const
+    {
+        return MappedData;
+    }
+
+    /// Gets the size of the file.
+    /// @return The size of the file in bytes.
+    std::size_t MemoryMappedFile::SizeInBytes() const
+    {
+        return MappedSizeInBytes;
+    }
+
+    /// Gets the contents of the file as text.
+    /// @return The file contents as text.
+    std::string_view MemoryMappedFile::Text() const
+    {
+        const char* text = reinterpret_cast<const char*>(MappedData);
+        return std::string_view(text, MappedSizeInBytes);
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+/// Holds code related to accessing files.
+namespace FILESYSTEM
+{
+    /// A read-only view of an entire file's contents mapped directly into memory.
+    /// Memory-mapping lets the operating system page data in from disk on demand
+    /// without first copying it into separately allocated buffers, which makes
+    /// it well-suited for quickly reading large files.  The file remains mapped
+    /// until this object is destroyed.
+    class MemoryMappedFile
+    {
+    public:
+        // CONSTRUCTION/DESTRUCTION.
+        static std::unique_ptr<MemoryMappedFile> Open(const std::filesystem::path& filepath);
+        ~MemoryMappedFile();
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        // DATA ACCESS.
+        const std::byte* Data() const;
+        std::size_t SizeInBytes() const;
+        std::string_view Text() const;
+
+    private:
+        explicit MemoryMappedFile() = default;
+
+        // MEMBER VARIABLES.
+        /// The start of the mapped file contents.  Null for empty files.
+        const std::byte* MappedData = nullptr;
+        /// The size of the mapped file contents.
+        std::size_t MappedSizeInBytes = 0;
+#if _WIN32
+        /// The handle to the open file.
+        void* FileHandle = nullptr;
+        /// The handle to the file mapping object.
+        void* FileMappingHandle = nullptr;
+#endif
+    };
+}
@@ -0,0 +1,179 @@
+#include <utility>
+#include "Graphics/AssetManager.h"
+#include "Graphics/Modeling/WavefrontObjectModel.h"
+
+namespace GRAPHICS
+{
+    /// Constructor.
+    /// @param[in]  thread_count - The number of threads to load assets on.
+    ///     0 uses the number of hardware threads available.
+    /// @param[in,out]  material_library_cache - The cache of material libraries and textures to share
+    ///     assets through.  Must outlive the manager.
+    AssetManager::AssetManager(const unsigned int thread_count, MODELING::MaterialLibraryCache& material_library_cache) :
+        MaterialLibraries(material_library_cache),
+        WorkerThreads(thread_count)
+    {}
+
+    /// Gets the cache of loaded textures.
+    /// @return The texture cache.
+    TextureCache& AssetManager::Textures()
+    {
+        return MaterialLibraries.Textures();
+    }
+
+    /// Starts loading a texture from a .bmp file, unless it's already in the texture cache.
+    /// @param[in]  filepath - The path of the texture to load.
+    /// @return A handle to the texture.
+    AssetHandle<Bitmap> AssetManager::LoadTexture(const std::filesystem::path& filepath)
+    {
+        return Load<Bitmap>(
+            filepath,
+            InFlightTextureLoads,
+            [this](const std::filesystem::path& texture_filepath) { return MaterialLibraries.Textures().Get(texture_filepath); });
+    }
+
+    /// Starts loading all materials from a .mtl file, including any textures,
+    /// unless they're already in the material library cache.
+    /// @param[in]  filepath - The path of the material library to load.
+    /// @return A handle to the materials.
+    AssetHandle<const std::vector<MODELING::WavefrontMaterial>> AssetManager::LoadMaterialLibrary(const std::filesystem::path& filepath)
+    {
+        return Load<const std::vector<MODELING::WavefrontMaterial>>(
+            filepath,
+            InFlightMaterialLibraryLoads,
+            [this](const std::filesystem::path& mtl_filepath) { return MaterialLibraries.Get(mtl_filepath); });
+    }
+
+    /// Starts loading a model from a .obj file, including all materials and textures.
+    /// Materials are loaded in parallel.
+    /// @param[in]  filepath - The path of the model to load.
+    /// @param[in]  binary_mesh_cache_folder_path - The folder to cache geometry in (see WavefrontObjectModel::Load()),
+    ///     or empty to not cache geometry.  Requests for a model while it's still loading share the
+    ///     cache folder of the first request.
+    /// @return A handle to the model.
+    AssetHandle<Object3D> AssetManager::LoadModel(const std::filesystem::path& filepath, const std::filesystem::path& binary_mesh_cache_folder_path)
+    {
+        return Load<Object3D>(
+            filepath,
+            InFlightModelLoads,
+            [this, binary_mesh_cache_folder_path](const std::filesystem::path& obj_filepath) -> std::shared_ptr<Object3D>
+            {
+                bool binary_mesh_cache_write_failed = false;
+                std::optional<Object3D> model = MODELING::WavefrontObjectModel::Load(
+                    obj_filepath,
+                    [this](const std::vector<std::filesystem::path>& mtl_filepaths) { return LoadMaterialLibraries(mtl_filepaths); },
+                    binary_mesh_cache_folder_path,
+                    &binary_mesh_cache_write_failed);
+                if (binary_mesh_cache_write_failed)
+                {
+                    ++BinaryMeshCacheWriteFailures;
+                }
+                if (!model)
+                {
+                    return nullptr;
+                }
+
+                // The world transform is computed before the model is shared with other threads,
+                // so that retrieving it again from multiple threads only reads the cache.
+                model->WorldTransform();
+                return std::make_shared<Object3D>(std::move(*model));
+            });
+    }
+
+    /// Gets the number of models whose geometry couldn't be written to a binary mesh cache.
+    /// The models themselves are still loaded.
+    /// @return The number of failed binary mesh cache writes.
+    uint64_t AssetManager::BinaryMeshCacheWriteFailureCount() const
+    {
+        return BinaryMeshCacheWriteFailures;
+    }
+
+    /// Hashes a filepath.
+    /// @param[in]  filepath - The filepath to hash.
+    /// @return The hash of the filepath.
+    std::size_t AssetManager::FilepathHash::operator()(const std::filesystem::path& filepath) const
+    {
+        return std::filesystem::hash_value(filepath);
+    }
+
+    /// Starts loading an asset, unless it's already being loaded.
+    /// @tparam Asset - The type of asset to load.
+    /// @param[in]  filepath - The path of the asset to load.
+    /// @param[in,out]  in_flight_loads - The loads currently in progress for the type of asset.
+    /// @param[in]  load - The function to load the asset on a worker thread, returning null (or throwing) on failure.
+    /// @return A handle to the asset.
+    template <typename Asset>
+    AssetHandle<Asset> AssetManager::Load(
+        const std::filesystem::path& filepath,
+        InFlightLoads<Asset>& in_flight_loads,
+        const std::function<std::shared_ptr<Asset>(const std::filesystem::path& filepath)>& load)
+    {
+        // NORMALIZE THE FILEPATH.
+        // This allows different ways of referring to the same file to share loads.
+        std::filesystem::path normalized_filepath = std::filesystem::absolute(filepath).lexically_normal();
+
+        std::lock_guard<std::mutex> lock(InFlightLoadsMutex);
+
+        // SHARE ANY EXISTING LOAD.
+        auto in_flight_load = in_flight_loads.find(normalized_filepath);
+        bool asset_being_loaded = (in_flight_loads.cend() != in_flight_load);
+        if (asset_being_loaded)
+        {
+            return AssetHandle<Asset>(in_flight_load->second);
+        }
+
+        // START A NEW LOAD.
+        // The asset is published before the load stops being in-flight, so that any request
+        // in between shares the loaded asset rather than starting a duplicate load.
+        // Any exception (like from running out of memory) is treated as a failed load,
+        // so that the asset is still published and nothing waits on it forever.
+        auto asset_promise = std::make_shared<std::promise<std::shared_ptr<Asset>>>();
+        std::shared_future<std::shared_ptr<Asset>> asset_future = asset_promise->get_future().share();
+        THREADING::TaskHandle<void> loading = WorkerThreads.Submit(
+            [this, normalized_filepath, &in_flight_loads, load, asset_promise]()
+            {
+                std::shared_ptr<Asset> asset = nullptr;
+                try
+                {
+                    asset = load(normalized_filepath);
+                }
+                catch (...)
+                {
+                    asset = nullptr;
+                }
+                asset_promise->set_value(asset);
+
+                std::lock_guard<std::mutex> lock(InFlightLoadsMutex);
+                in_flight_loads.erase(normalized_filepath);
+            });
+        AssetHandle<Asset> asset_handle(loading, asset_future);
+        in_flight_loads.emplace(normalized_filepath, asset_handle);
+        return asset_handle;
+    }
+
+    /// Loads material libraries in parallel.
+    /// This is intended to be called from within a model loading task.
+    /// @param[in]  mtl_filepaths - The paths of the material libraries to load.
+    /// @return The materials from all successfully loaded libraries, in order.
+    std::vector<MODELING::WavefrontMaterial> AssetManager::LoadMaterialLibraries(const std::vector<std::filesystem::path>& mtl_filepaths)
+    {
+        // START LOADING ALL MATERIAL LIBRARIES.
+        std::vector<AssetHandle<const std::vector<MODELING::WavefrontMaterial>>> material_libraries;
+        for (const std::filesystem::path& mtl_filepath : mtl_filepaths)
+        {
+            material_libraries.push_back(LoadMaterialLibrary(mtl_filepath));
+        }
+
+        // COMBINE ALL MATERIALS ONCE LOADED.
+        std::vector<MODELING::WavefrontMaterial> materials;
+        for (const AssetHandle<const std::vector<MODELING::WavefrontMaterial>>& material_library : material_libraries)
+        {
+            std::shared_ptr<const std::vector<MODELING::WavefrontMaterial>> library_materials = material_library.Get();
+            if (library_materials)
+            {
+                materials.insert(materials.end(), library_materials->cbegin(), library_materials->cend());
+            }
+        }
+        return materials;
+    }
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Graphics/Bitmap.h"
+#include "Graphics/Modeling/MaterialLibraryCache.h"
+#include "Graphics/Modeling/WavefrontMaterial.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/TextureCache.h"
+#include "Threading/ThreadPool.h"
+
+namespace GRAPHICS
+{
+    /// A handle to an asset that may still be loading.
+    /// Handles are cheap to copy, and all copies refer to the same asset.
+    ///
+    /// Waiting on an asset whose load hasn't started yet runs the load on the waiting thread,
+    /// so handles are safe to wait on from within other loads.
+    /// @tparam Asset - The type of asset.
+    template <typename Asset>
+    class AssetHandle
+    {
+    public:
+        // CONSTRUCTION.
+        explicit AssetHandle() = default;
+        explicit AssetHandle(const THREADING::TaskHandle<void>& loading, const std::shared_future<std::shared_ptr<Asset>>& future);
+
+        // STATUS.
+        bool IsValid() const;
+        bool IsReady() const;
+
+        // ASSET ACCESS.
+        std::shared_ptr<Asset> Get() const;
+        std::shared_ptr<Asset> GetOr(const std::shared_ptr<Asset>& placeholder) const;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The task loading the asset.
+        THREADING::TaskHandle<void> Loading = THREADING::TaskHandle<void>();
+        /// The future for the asset, which holds null if the asset failed to load.
+        /// This is set before the loading task finishes (and stops being tracked as in-flight).
+        std::shared_future<std::shared_ptr<Asset>> Future = {};
+    };
+
+    /// Loads assets (models, materials, and textures) asynchronously on a pool of worker threads.
+    /// Each load immediately returns a handle, allowing callers to continue (like rendering with
+    /// placeholders) until assets are ready.  Dependencies of assets (like the material libraries
+    /// of a model) are also loaded in parallel, so loading many assets takes about as long
+    /// as the slowest single asset rather than the sum of all assets.
+    ///
+    /// Multiple requests for the same asset while it's still loading share a single load.
+    /// Completed models aren't retained by the manager, so requesting them again after they've
+    /// finished loading will load them again.  Material libraries and textures are retained in a
+    /// MaterialLibraryCache (the process-wide one by default), so each library is only parsed once
+    /// and each texture is only resident once across all models, including models loaded without
+    /// the manager.  The materials (and textures) within a single library are loaded together.
+    ///
+    /// Destroying the manager waits for all loads to finish.
+    class AssetManager
+    {
+    public:
+        // CONSTRUCTION.
+        explicit AssetManager(
+            const unsigned int thread_count = 0,
+            MODELING::MaterialLibraryCache& material_library_cache = MODELING::MaterialLibraryCache::Shared());
+
+        // CACHE ACCESS.
+        TextureCache& Textures();
+
+        // LOADING.
+        AssetHandle<Bitmap> LoadTexture(const std::filesystem::path& filepath);
+        AssetHandle<const std::vector<MODELING::WavefrontMaterial>> LoadMaterialLibrary(const std::filesystem::path& filepath);
+        AssetHandle<Object3D> LoadModel(const std::filesystem::path& filepath, const std::filesystem::path& binary_mesh_cache_folder_path = "");
+
+        // STATISTICS.
+        uint64_t BinaryMeshCacheWriteFailureCount() const;
+
+    private:
+        /// Hashes filepaths to allow them to be used as keys.
+        struct FilepathHash
+        {
+            std::size_t operator()(const std::filesystem::path& filepath) const;
+        };
+
+        /// Loads of a single type of asset that are still in progress, by normalized filepath.
+        template <typename Asset>
+        using InFlightLoads = std::unordered_map<std::filesystem::path, AssetHandle<Asset>, FilepathHash>;
+
+        // HELPER METHODS.
+        template <typename Asset>
+        AssetHandle<Asset> Load(
+            const std::filesystem::path& filepath,
+            InFlightLoads<Asset>& in_flight_loads,
+            const std::function<std::shared_ptr<Asset>(const std::filesystem::path& filepath)>& load);
+        std::vector<MODELING::WavefrontMaterial> LoadMaterialLibraries(const std::vector<std::filesystem::path>& mtl_filepaths);
+
+        // MEMBER VARIABLES.
+        /// Protects access to all in-flight loads.
+        std::mutex InFlightLoadsMutex = {};
+        /// Textures currently being loaded.
+        InFlightLoads<Bitmap> InFlightTextureLoads = {};
+        /// Material libraries currently being loaded.
+        InFlightLoads<const std::vector<MODELING::WavefrontMaterial>> InFlightMaterialLibraryLoads = {};
+        /// Models currently being loaded.
+        InFlightLoads<Object3D> InFlightModelLoads = {};
+        /// Material libraries and textures that have been loaded.
+        MODELING::MaterialLibraryCache& MaterialLibraries;
+        /// The number of models whose geometry couldn't be written to a binary mesh cache.
+        std::atomic<uint64_t> BinaryMeshCacheWriteFailures = 0;
+        /// The threads on which assets are loaded.  Declared last so that it's destroyed first,
+        /// ensuring all loads finish while the rest of the manager is still valid.
+        THREADING::ThreadPool WorkerThreads;
+    };
+
+    /// Constructor.
+    /// @param[in]  loading - The task loading the asset.
+    /// @param[in]  future - The future for the asset.
+    template <typename Asset>
+    AssetHandle<Asset>::AssetHandle(const THREADING::TaskHandle<void>& loading, const std::shared_future<std::shared_ptr<Asset>>& future) :
+        Loading(loading),
+        Future(future)
+    {}
+
+    /// Determines if the handle refers to an asset (rather than being default-constructed).
+    /// @return True if the handle refers to an asset; false otherwise.
+    template <typename Asset>
+    bool AssetHandle<Asset>::IsValid() const
+    {
+        return Future.valid();
+    }
+
+    /// Determines if the asset has finished loading (successfully or not), without blocking.
+    /// @return True if the asset has finished loading; false otherwise.
+    template <typename Asset>
+    bool AssetHandle<Asset>::IsReady() const
+    {
+        bool is_ready = IsValid() && (std::future_status::ready == Future.wait_for(std::chrono::seconds(0)));
+        return is_ready;
+    }
+
+    /// Gets the asset, blocking until it finishes loading.
+    /// If the load hasn't started yet, it's run on the calling thread.
+    /// @return The asset, if successfully loaded; null otherwise.
+    template <typename Asset>
+    std::shared_ptr<Asset> AssetHandle<Asset>::Get() const
+    {
+        if (!IsValid())
+        {
+            return nullptr;
+        }
+
+        Loading.Wait();
+        return Future.get();
+    }
+
+    /// Gets the asset if it's loaded, without blocking.
+    /// @param[in]  placeholder - The asset to return if the asset isn't yet loaded (or failed to load).
+    /// @return The asset, if loaded; the placeholder otherwise.
+    template <typename Asset>
+    std::shared_ptr<Asset> AssetHandle<Asset>::GetOr(const std::shared_ptr<Asset>& placeholder) const
+    {
+        if (!IsReady())
+        {
+            return placeholder;
+        }
+
+        const std::shared_ptr<Asset>& asset = Future.get();
+        return asset ? asset : placeholder;
+    }
+}
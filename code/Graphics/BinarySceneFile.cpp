@@ -0,0 +1,597 @@
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <span>
+#include "Benchmarking/Profiler.h"
+#include "Filesystem/BinaryFile.h"
+#include "Filesystem/MemoryMappedFile.h"
+#include "Graphics/BinarySceneFile.h"
+#include "Graphics/Modeling/WavefrontObjectModel.h"
+#include "Graphics/TransformNode.h"
+
+namespace GRAPHICS
+{
+    /// Checks if a range of elements is entirely within a collection.
+    /// @param[in]  first_index - The index of the first element in the range.
+    /// @param[in]  count - The number of elements in the range.
+    /// @param[in]  collection_size - The number of elements in the collection.
+    /// @return True if the range is within the collection; false otherwise.
+    static bool RangeValid(const uint64_t first_index, const uint64_t count, const uint64_t collection_size)
+    {
+        bool range_valid = (first_index <= collection_size) && (count <= collection_size - first_index);
+        return range_valid;
+    }
+
+    /// Writes a scene to a binary scene file, replacing any existing file.
+    /// @param[in]  scene - The scene to write.
+    /// @param[in]  filepath - The path of the file to write.
+    /// @param[in]  asset_references - Paths of any files that parts of the scene were loaded from.
+    /// @return True if the file was written successfully; false otherwise.
+    bool BinarySceneFile::Write(
+        const Scene& scene,
+        const std::filesystem::path& filepath,
+        const AssetReferences& asset_references)
+    {
+        std::string strings;
+
+        // SERIALIZE ALL TEXTURES.
+        // Each texture is only stored once, no matter how many materials use it.
+        std::vector<TextureRecord> texture_records;
+        std::vector<uint32_t> texture_pixels;
+        std::unordered_map<const Bitmap*, uint32_t> texture_indices;
+        auto add_texture = [&](const Bitmap* const texture)
+        {
+            auto existing_texture = texture_indices.find(texture);
+            if (texture_indices.end() != existing_texture)
+            {
+                return existing_texture->second;
+            }
+
+            TextureRecord texture_record;
+            texture_record.ColorFormat = static_cast<uint32_t>(texture->GetColorFormat());
+            auto texture_filepath = asset_references.TextureFilepaths.find(texture);
+            bool texture_referenced = (asset_references.TextureFilepaths.end() != texture_filepath) && !texture_filepath->second.empty();
+            if (texture_referenced)
+            {
+                texture_record.Filepath = AppendString(texture_filepath->second, strings);
+            }
+            else
+            {
+                texture_record.WidthInPixels = texture->GetWidthInPixels();
+                texture_record.HeightInPixels = texture->GetHeightInPixels();
+                texture_record.FirstPixelIndex = texture_pixels.size();
+                std::size_t pixel_count = static_cast<std::size_t>(texture_record.WidthInPixels) * texture_record.HeightInPixels;
+                texture_pixels.insert(texture_pixels.end(), texture->GetRawData(), texture->GetRawData() + pixel_count);
+            }
+
+            uint32_t texture_index = static_cast<uint32_t>(texture_records.size());
+            texture_records.push_back(texture_record);
+            texture_indices.emplace(texture, texture_index);
+            return texture_index;
+        };
+
+        // SERIALIZE ALL MATERIALS.
+        // Each material is only stored once, no matter how many triangles use it.
+        std::vector<MaterialRecord> material_records;
+        std::vector<Color> vertex_colors;
+        std::vector<MATH::Vector2f> vertex_texture_coordinates;
+        std::unordered_map<const Material*, uint32_t> material_indices;
+        auto store_color = [](const Color& color, float (&components)[4])
+        {
+            components[0] = color.Red;
+            components[1] = color.Green;
+            components[2] = color.Blue;
+            components[3] = color.Alpha;
+        };
+        auto add_material = [&](const Material* const material)
+        {
+            if (!material)
+            {
+                return NO_INDEX;
+            }
+            auto existing_material = material_indices.find(material);
+            if (material_indices.end() != existing_material)
+            {
+                return existing_material->second;
+            }
+
+            MaterialRecord material_record;
+            material_record.Shading = static_cast<uint32_t>(material->Shading);
+            material_record.TextureIndex = material->Texture ? add_texture(material->Texture.get()) : NO_INDEX;
+            material_record.FirstVertexColorIndex = static_cast<uint32_t>(vertex_colors.size());
+            material_record.VertexColorCount = static_cast<uint32_t>(material->VertexColors.size());
+            vertex_colors.insert(vertex_colors.end(), material->VertexColors.cbegin(), material->VertexColors.cend());
+            material_record.FirstVertexTextureCoordinateIndex = static_cast<uint32_t>(vertex_texture_coordinates.size());
+            material_record.VertexTextureCoordinateCount = static_cast<uint32_t>(material->VertexTextureCoordinates.size());
+            vertex_texture_coordinates.insert(vertex_texture_coordinates.end(), material->VertexTextureCoordinates.cbegin(), material->VertexTextureCoordinates.cend());
+            material_record.SpecularPower = material->SpecularPower;
+            material_record.ReflectivityProportion = material->ReflectivityProportion;
+            store_color(material->AmbientColor, material_record.AmbientColor);
+            store_color(material->DiffuseColor, material_record.DiffuseColor);
+            store_color(material->SpecularColor, material_record.SpecularColor);
+            store_color(material->EmissiveColor, material_record.EmissiveColor);
+
+            uint32_t material_index = static_cast<uint32_t>(material_records.size());
+            material_records.push_back(material_record);
+            material_indices.emplace(material, material_index);
+            return material_index;
+        };
+
+        // SERIALIZE ALL TRANSFORM NODES.
+        // Parents are always added before their children so that hierarchies can be rebuilt in a single pass.
+        std::vector<TransformNodeRecord> transform_node_records;
+        std::unordered_map<const TransformNode*, uint32_t> transform_node_indices;
+        auto add_transform_node = [&](const TransformNode* const transform_node)
+        {
+            if (!transform_node)
+            {
+                return NO_INDEX;
+            }
+
+            // FIND ANY ANCESTORS NOT YET ADDED.
+            std::vector<const TransformNode*> nodes_to_add;
+            for (const TransformNode* node = transform_node; node && !transform_node_indices.contains(node); node = node->GetParent())
+            {
+                nodes_to_add.push_back(node);
+            }
+
+            // ADD THE NODES FROM THE TOP OF THE HIERARCHY DOWN.
+            for (auto node = nodes_to_add.crbegin(); nodes_to_add.crend() != node; ++node)
+            {
+                TransformNodeRecord node_record;
+                const TransformNode* parent = (*node)->GetParent();
+                node_record.ParentIndex = parent ? transform_node_indices.at(parent) : NO_INDEX;
+                node_record.LocalTransform = CreateTransformRecord((*node)->GetLocalPosition(), (*node)->GetLocalRotationInRadians(), (*node)->GetLocalScale());
+                transform_node_indices.emplace(*node, static_cast<uint32_t>(transform_node_records.size()));
+                transform_node_records.push_back(node_record);
+            }
+
+            return transform_node_indices.at(transform_node);
+        };
+
+        // SERIALIZE ALL OBJECTS.
+        std::vector<ObjectRecord> object_records;
+        std::vector<TriangleRecord> triangle_records;
+        object_records.reserve(scene.Objects.size());
+        for (std::size_t object_index = 0; object_index < scene.Objects.size(); ++object_index)
+        {
+            const Object3D& object_3D = scene.Objects[object_index];
+            ObjectRecord object_record;
+            object_record.ParentIndex = add_transform_node(object_3D.Parent.get());
+            object_record.Transform = CreateTransformRecord(object_3D.WorldPosition, object_3D.RotationInRadians, object_3D.Scale);
+
+            // REFERENCE THE MESH IF IT CAME FROM A FILE.
+            bool mesh_referenced = (object_index < asset_references.ObjectMeshFilepaths.size()) && !asset_references.ObjectMeshFilepaths[object_index].empty();
+            if (mesh_referenced)
+            {
+                object_record.MeshFilepath = AppendString(asset_references.ObjectMeshFilepaths[object_index], strings);
+                object_records.push_back(object_record);
+                continue;
+            }
+
+            // EMBED THE TRIANGLES.
+            object_record.FirstTriangleIndex = static_cast<uint32_t>(triangle_records.size());
+            object_record.TriangleCount = static_cast<uint32_t>(object_3D.Triangles.size());
+            for (const Triangle& triangle : object_3D.Triangles)
+            {
+                TriangleRecord triangle_record;
+                triangle_record.MaterialIndex = add_material(triangle.Material.get());
+                for (std::size_t vertex_index = 0; vertex_index < Triangle::VERTEX_COUNT; ++vertex_index)
+                {
+                    triangle_record.Vertices[3 * vertex_index + 0] = triangle.Vertices[vertex_index].X;
+                    triangle_record.Vertices[3 * vertex_index + 1] = triangle.Vertices[vertex_index].Y;
+                    triangle_record.Vertices[3 * vertex_index + 2] = triangle.Vertices[vertex_index].Z;
+                }
+                triangle_records.push_back(triangle_record);
+            }
+            object_records.push_back(object_record);
+        }
+
+        // SERIALIZE ALL LIGHTS.
+        std::vector<LightRecord> light_records;
+        if (scene.PointLights)
+        {
+            for (const Light& light : *scene.PointLights)
+            {
+                LightRecord light_record;
+                light_record.Type = static_cast<uint32_t>(light.Type);
+                store_color(light.Color, light_record.Color);
+                light_record.DirectionalLightDirection[0] = light.DirectionalLightDirection.X;
+                light_record.DirectionalLightDirection[1] = light.DirectionalLightDirection.Y;
+                light_record.DirectionalLightDirection[2] = light.DirectionalLightDirection.Z;
+                light_record.PointLightWorldPosition[0] = light.PointLightWorldPosition.X;
+                light_record.PointLightWorldPosition[1] = light.PointLightWorldPosition.Y;
+                light_record.PointLightWorldPosition[2] = light.PointLightWorldPosition.Z;
+                light_records.push_back(light_record);
+            }
+        }
+
+        // DETERMINE WHERE EACH SECTION GOES IN THE FILE.
+        Header header;
+        store_color(scene.BackgroundColor, header.BackgroundColor);
+        header.LightingEnabled = scene.PointLights ? 1 : 0;
+        uint64_t next_section_offset_in_bytes = sizeof(Header);
+        auto place_section = [&next_section_offset_in_bytes](Section& section, const uint64_t count, const uint64_t element_size_in_bytes)
+        {
+            section.OffsetInBytes = FILESYSTEM::BinaryFile::AlignSectionOffset(next_section_offset_in_bytes);
+            section.Count = count;
+            next_section_offset_in_bytes = section.OffsetInBytes + count * element_size_in_bytes;
+        };
+        place_section(header.Strings, strings.size(), sizeof(char));
+        place_section(header.Textures, texture_records.size(), sizeof(TextureRecord));
+        place_section(header.TexturePixels, texture_pixels.size(), sizeof(uint32_t));
+        place_section(header.Materials, material_records.size(), sizeof(MaterialRecord));
+        place_section(header.VertexColors, vertex_colors.size(), sizeof(Color));
+        place_section(header.VertexTextureCoordinates, vertex_texture_coordinates.size(), sizeof(MATH::Vector2f));
+        place_section(header.TransformNodes, transform_node_records.size(), sizeof(TransformNodeRecord));
+        place_section(header.Objects, object_records.size(), sizeof(ObjectRecord));
+        place_section(header.Triangles, triangle_records.size(), sizeof(TriangleRecord));
+        place_section(header.Lights, light_records.size(), sizeof(LightRecord));
+
+        // WRITE THE FILE.
+        bool file_written = FILESYSTEM::BinaryFile::Write(
+            filepath,
+            {
+                { .OffsetInBytes = 0, .Data = &header, .SizeInBytes = sizeof(header) },
+                { .OffsetInBytes = header.Strings.OffsetInBytes, .Data = strings.data(), .SizeInBytes = strings.size() },
+                { .OffsetInBytes = header.Textures.OffsetInBytes, .Data = texture_records.data(), .SizeInBytes = texture_records.size() * sizeof(TextureRecord) },
+                { .OffsetInBytes = header.TexturePixels.OffsetInBytes, .Data = texture_pixels.data(), .SizeInBytes = texture_pixels.size() * sizeof(uint32_t) },
+                { .OffsetInBytes = header.Materials.OffsetInBytes, .Data = material_records.data(), .SizeInBytes = material_records.size() * sizeof(MaterialRecord) },
+                { .OffsetInBytes = header.VertexColors.OffsetInBytes, .Data = vertex_colors.data(), .SizeInBytes = vertex_colors.size() * sizeof(Color) },
+                { .OffsetInBytes = header.VertexTextureCoordinates.OffsetInBytes, .Data = vertex_texture_coordinates.data(), .SizeInBytes = vertex_texture_coordinates.size() * sizeof(MATH::Vector2f) },
+                { .OffsetInBytes = header.TransformNodes.OffsetInBytes, .Data = transform_node_records.data(), .SizeInBytes = transform_node_records.size() * sizeof(TransformNodeRecord) },
+                { .OffsetInBytes = header.Objects.OffsetInBytes, .Data = object_records.data(), .SizeInBytes = object_records.size() * sizeof(ObjectRecord) },
+                { .OffsetInBytes = header.Triangles.OffsetInBytes, .Data = triangle_records.data(), .SizeInBytes = triangle_records.size() * sizeof(TriangleRecord) },
+                { .OffsetInBytes = header.Lights.OffsetInBytes, .Data = light_records.data(), .SizeInBytes = light_records.size() * sizeof(LightRecord) },
+            });
+        return file_written;
+    }
+
+    /// Attempts to load a scene from a binary scene file, including any referenced meshes and textures.
+    /// @param[in]  filepath - The path of the file to load.
+    /// @param[in,out]  texture_cache - The cache to load referenced textures through, if any.
+    ///     If null, referenced textures are loaded directly.
+    /// @return The scene, if the file was valid and all referenced assets were loaded; null otherwise.
+    std::optional<Scene> BinarySceneFile::Load(const std::filesystem::path& filepath, TextureCache* const texture_cache)
+    {
+        PROFILE_ZONE("Load binary scene");
+
+        // MAP THE FILE INTO MEMORY.
+        std::unique_ptr<FILESYSTEM::MemoryMappedFile> mapped_file = FILESYSTEM::MemoryMappedFile::Open(filepath);
+        if (!mapped_file)
+        {
+            return std::nullopt;
+        }
+
+        // READ THE HEADER.
+        bool header_exists = (mapped_file->SizeInBytes() >= sizeof(Header));
+        if (!header_exists)
+        {
+            return std::nullopt;
+        }
+        Header header;
+        std::memcpy(&header, mapped_file->Data(), sizeof(header));
+
+        // VERIFY THE FILE HAS A SUPPORTED FORMAT.
+        bool format_supported = (MAGIC_NUMBER == header.MagicNumber) && (FORMAT_VERSION == header.FormatVersion);
+        if (!format_supported)
+        {
+            return std::nullopt;
+        }
+
+        // GET ALL SECTIONS.
+        auto strings_section = FILESYSTEM::BinaryFile::GetSection<char>(*mapped_file, header.Strings.OffsetInBytes, header.Strings.Count);
+        auto texture_records = FILESYSTEM::BinaryFile::GetSection<TextureRecord>(*mapped_file, header.Textures.OffsetInBytes, header.Textures.Count);
+        auto texture_pixels = FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, header.TexturePixels.OffsetInBytes, header.TexturePixels.Count);
+        auto material_records = FILESYSTEM::BinaryFile::GetSection<MaterialRecord>(*mapped_file, header.Materials.OffsetInBytes, header.Materials.Count);
+        auto vertex_colors = FILESYSTEM::BinaryFile::GetSection<Color>(*mapped_file, header.VertexColors.OffsetInBytes, header.VertexColors.Count);
+        auto vertex_texture_coordinates = FILESYSTEM::BinaryFile::GetSection<MATH::Vector2f>(*mapped_file, header.VertexTextureCoordinates.OffsetInBytes, header.VertexTextureCoordinates.Count);
+        auto transform_node_records = FILESYSTEM::BinaryFile::GetSection<TransformNodeRecord>(*mapped_file, header.TransformNodes.OffsetInBytes, header.TransformNodes.Count);
+        auto object_records = FILESYSTEM::BinaryFile::GetSection<ObjectRecord>(*mapped_file, header.Objects.OffsetInBytes, header.Objects.Count);
+        auto triangle_records = FILESYSTEM::BinaryFile::GetSection<TriangleRecord>(*mapped_file, header.Triangles.OffsetInBytes, header.Triangles.Count);
+        auto light_records = FILESYSTEM::BinaryFile::GetSection<LightRecord>(*mapped_file, header.Lights.OffsetInBytes, header.Lights.Count);
+        bool sections_valid = (
+            strings_section && texture_records && texture_pixels && material_records && vertex_colors &&
+            vertex_texture_coordinates && transform_node_records && object_records && triangle_records && light_records);
+        if (!sections_valid)
+        {
+            return std::nullopt;
+        }
+        std::string_view strings(strings_section->data(), strings_section->size());
+        const std::filesystem::path scene_folder_path = filepath.parent_path();
+
+        // LOAD ALL TEXTURES.
+        std::vector<std::shared_ptr<Bitmap>> textures;
+        textures.reserve(texture_records->size());
+        for (const TextureRecord& texture_record : *texture_records)
+        {
+            // VERIFY THE COLOR FORMAT IS SUPPORTED.
+            bool color_format_valid = (texture_record.ColorFormat <= static_cast<uint32_t>(GRAPHICS::ColorFormat::ARGB));
+            if (!color_format_valid)
+            {
+                return std::nullopt;
+            }
+            GRAPHICS::ColorFormat color_format = static_cast<GRAPHICS::ColorFormat>(texture_record.ColorFormat);
+
+            // LOAD ANY REFERENCED TEXTURE.
+            std::optional<std::filesystem::path> texture_filepath = ReadPath(texture_record.Filepath, strings, scene_folder_path);
+            if (!texture_filepath)
+            {
+                return std::nullopt;
+            }
+            bool texture_referenced = !texture_filepath->empty();
+            if (texture_referenced)
+            {
+                std::shared_ptr<Bitmap> texture = texture_cache ?
+                    texture_cache->Get(*texture_filepath, color_format) :
+                    Bitmap::Load(*texture_filepath, color_format);
+                if (!texture)
+                {
+                    return std::nullopt;
+                }
+                textures.push_back(texture);
+                continue;
+            }
+
+            // COPY ANY EMBEDDED TEXTURE.
+            uint64_t pixel_count = static_cast<uint64_t>(texture_record.WidthInPixels) * texture_record.HeightInPixels;
+            bool pixels_valid = RangeValid(texture_record.FirstPixelIndex, pixel_count, texture_pixels->size());
+            if (!pixels_valid)
+            {
+                return std::nullopt;
+            }
+            auto texture = std::make_shared<Bitmap>(texture_record.WidthInPixels, texture_record.HeightInPixels, color_format);
+            std::copy_n(texture_pixels->data() + texture_record.FirstPixelIndex, pixel_count, texture->GetRawData());
+            textures.push_back(texture);
+        }
+
+        // CREATE ALL MATERIALS.
+        std::vector<std::shared_ptr<Material>> materials;
+        materials.reserve(material_records->size());
+        auto load_color = [](const float (&components)[4])
+        {
+            return Color(components[0], components[1], components[2], components[3]);
+        };
+        for (const MaterialRecord& material_record : *material_records)
+        {
+            // VERIFY ALL REFERENCES ARE VALID.
+            bool shading_valid = (material_record.Shading < static_cast<uint32_t>(ShadingType::COUNT));
+            bool texture_valid = (NO_INDEX == material_record.TextureIndex) || (material_record.TextureIndex < textures.size());
+            bool vertex_colors_valid = RangeValid(material_record.FirstVertexColorIndex, material_record.VertexColorCount, vertex_colors->size());
+            bool vertex_texture_coordinates_valid = RangeValid(
+                material_record.FirstVertexTextureCoordinateIndex,
+                material_record.VertexTextureCoordinateCount,
+                vertex_texture_coordinates->size());
+            bool material_valid = shading_valid && texture_valid && vertex_colors_valid && vertex_texture_coordinates_valid;
+            if (!material_valid)
+            {
+                return std::nullopt;
+            }
+
+            // CREATE THE MATERIAL.
+            auto material = std::make_shared<Material>();
+            material->Shading = static_cast<ShadingType>(material_record.Shading);
+            const Color* first_vertex_color = vertex_colors->data() + material_record.FirstVertexColorIndex;
+            material->VertexColors.assign(first_vertex_color, first_vertex_color + material_record.VertexColorCount);
+            material->AmbientColor = load_color(material_record.AmbientColor);
+            material->DiffuseColor = load_color(material_record.DiffuseColor);
+            material->SpecularColor = load_color(material_record.SpecularColor);
+            material->SpecularPower = material_record.SpecularPower;
+            material->ReflectivityProportion = material_record.ReflectivityProportion;
+            material->EmissiveColor = load_color(material_record.EmissiveColor);
+            if (NO_INDEX != material_record.TextureIndex)
+            {
+                material->Texture = textures[material_record.TextureIndex];
+            }
+            const MATH::Vector2f* first_vertex_texture_coordinate = vertex_texture_coordinates->data() + material_record.FirstVertexTextureCoordinateIndex;
+            material->VertexTextureCoordinates.assign(
+                first_vertex_texture_coordinate,
+                first_vertex_texture_coordinate + material_record.VertexTextureCoordinateCount);
+            materials.push_back(material);
+        }
+
+        // CREATE ALL TRANSFORM NODES.
+        // All nodes are allocated together, and objects share ownership of all of them
+        // (via aliasing pointers) so that ancestors remain alive as long as any object uses them.
+        std::size_t transform_node_count = transform_node_records->size();
+        std::shared_ptr<TransformNode[]> transform_nodes(new TransformNode[transform_node_count]);
+        for (std::size_t node_index = 0; node_index < transform_node_count; ++node_index)
+        {
+            const TransformNodeRecord& node_record = (*transform_node_records)[node_index];
+            TransformNode& node = transform_nodes[node_index];
+            const TransformRecord& local_transform = node_record.LocalTransform;
+            node.SetLocalPosition(MATH::Vector3f(local_transform.Position[0], local_transform.Position[1], local_transform.Position[2]));
+            node.SetLocalRotationInRadians(MATH::Vector3< MATH::Angle<float>::Radians >(
+                MATH::Angle<float>::Radians(local_transform.RotationInRadians[0]),
+                MATH::Angle<float>::Radians(local_transform.RotationInRadians[1]),
+                MATH::Angle<float>::Radians(local_transform.RotationInRadians[2])));
+            node.SetLocalScale(MATH::Vector3f(local_transform.Scale[0], local_transform.Scale[1], local_transform.Scale[2]));
+
+            // Parents always come before children, which also guarantees there are no cycles.
+            if (NO_INDEX != node_record.ParentIndex)
+            {
+                bool parent_valid = (node_record.ParentIndex < node_index);
+                if (!parent_valid)
+                {
+                    return std::nullopt;
+                }
+                node.SetParent(&transform_nodes[node_record.ParentIndex]);
+            }
+        }
+
+        // CREATE ALL OBJECTS.
+        Scene scene;
+        scene.BackgroundColor = load_color(header.BackgroundColor);
+        scene.Objects.reserve(object_records->size());
+        std::map<std::filesystem::path, Object3D> meshes_by_filepath;
+        for (const ObjectRecord& object_record : *object_records)
+        {
+            Object3D object_3D;
+
+            // GET THE TRIANGLES FROM ANY REFERENCED MESH.
+            // Meshes referenced by multiple objects are only loaded once.
+            std::optional<std::filesystem::path> mesh_filepath = ReadPath(object_record.MeshFilepath, strings, scene_folder_path);
+            if (!mesh_filepath)
+            {
+                return std::nullopt;
+            }
+            bool mesh_referenced = !mesh_filepath->empty();
+            if (mesh_referenced)
+            {
+                auto mesh = meshes_by_filepath.find(*mesh_filepath);
+                if (meshes_by_filepath.end() == mesh)
+                {
+                    std::optional<Object3D> loaded_mesh = MODELING::WavefrontObjectModel::Load(*mesh_filepath);
+                    if (!loaded_mesh)
+                    {
+                        return std::nullopt;
+                    }
+                    mesh = meshes_by_filepath.emplace(*mesh_filepath, std::move(*loaded_mesh)).first;
+                }
+                object_3D.Triangles = mesh->second.Triangles;
+            }
+            else
+            {
+                // CREATE ANY EMBEDDED TRIANGLES.
+                bool triangles_valid = RangeValid(object_record.FirstTriangleIndex, object_record.TriangleCount, triangle_records->size());
+                if (!triangles_valid)
+                {
+                    return std::nullopt;
+                }
+                object_3D.Triangles.reserve(object_record.TriangleCount);
+                std::span<const TriangleRecord> object_triangle_records = triangle_records->subspan(object_record.FirstTriangleIndex, object_record.TriangleCount);
+                for (const TriangleRecord& triangle_record : object_triangle_records)
+                {
+                    bool material_valid = (NO_INDEX == triangle_record.MaterialIndex) || (triangle_record.MaterialIndex < materials.size());
+                    if (!material_valid)
+                    {
+                        return std::nullopt;
+                    }
+
+                    Triangle& triangle = object_3D.Triangles.emplace_back();
+                    if (NO_INDEX != triangle_record.MaterialIndex)
+                    {
+                        triangle.Material = materials[triangle_record.MaterialIndex];
+                    }
+                    for (std::size_t vertex_index = 0; vertex_index < Triangle::VERTEX_COUNT; ++vertex_index)
+                    {
+                        triangle.Vertices[vertex_index] = MATH::Vector3f(
+                            triangle_record.Vertices[3 * vertex_index + 0],
+                            triangle_record.Vertices[3 * vertex_index + 1],
+                            triangle_record.Vertices[3 * vertex_index + 2]);
+                    }
+                }
+            }
+
+            // SET THE TRANSFORM.
+            const TransformRecord& transform = object_record.Transform;
+            object_3D.WorldPosition = MATH::Vector3f(transform.Position[0], transform.Position[1], transform.Position[2]);
+            object_3D.RotationInRadians = MATH::Vector3< MATH::Angle<float>::Radians >(
+                MATH::Angle<float>::Radians(transform.RotationInRadians[0]),
+                MATH::Angle<float>::Radians(transform.RotationInRadians[1]),
+                MATH::Angle<float>::Radians(transform.RotationInRadians[2]));
+            object_3D.Scale = MATH::Vector3f(transform.Scale[0], transform.Scale[1], transform.Scale[2]);
+            if (NO_INDEX != object_record.ParentIndex)
+            {
+                bool parent_valid = (object_record.ParentIndex < transform_node_count);
+                if (!parent_valid)
+                {
+                    return std::nullopt;
+                }
+                object_3D.Parent = std::shared_ptr<TransformNode>(transform_nodes, &transform_nodes[object_record.ParentIndex]);
+            }
+
+            scene.Objects.push_back(std::move(object_3D));
+        }
+
+        // CREATE ALL LIGHTS.
+        if (header.LightingEnabled)
+        {
+            std::vector<Light>& lights = scene.PointLights.emplace();
+            lights.reserve(light_records->size());
+            for (const LightRecord& light_record : *light_records)
+            {
+                bool light_type_valid = (light_record.Type <= static_cast<uint32_t>(LightType::POINT));
+                if (!light_type_valid)
+                {
+                    return std::nullopt;
+                }
+
+                Light& light = lights.emplace_back();
+                light.Type = static_cast<LightType>(light_record.Type);
+                light.Color = load_color(light_record.Color);
+                light.DirectionalLightDirection = MATH::Vector3f(
+                    light_record.DirectionalLightDirection[0],
+                    light_record.DirectionalLightDirection[1],
+                    light_record.DirectionalLightDirection[2]);
+                light.PointLightWorldPosition = MATH::Vector3f(
+                    light_record.PointLightWorldPosition[0],
+                    light_record.PointLightWorldPosition[1],
+                    light_record.PointLightWorldPosition[2]);
+            }
+        }
+
+        return scene;
+    }
+
+    /// Appends a path to the strings being serialized.
+    /// @param[in]  path - The path to append.
+    /// @param[in,out]  strings - The strings to append to.
+    /// @return The record for finding the path within the strings.
+    BinarySceneFile::StringRecord BinarySceneFile::AppendString(const std::filesystem::path& path, std::string& strings)
+    {
+        // Generic format (with forward slashes) is used so that files can be loaded on any platform.
+        std::u8string utf8_path = path.generic_u8string();
+        StringRecord string_record
+        {
+            .Offset = static_cast<uint32_t>(strings.size()),
+            .Size = static_cast<uint32_t>(utf8_path.size())
+        };
+        strings.append(reinterpret_cast<const char*>(utf8_path.data()), utf8_path.size());
+        return string_record;
+    }
+
+    /// Reads a path from the strings section.
+    /// @param[in]  string - The record for the path within the strings.
+    /// @param[in]  strings - All strings.
+    /// @param[in]  scene_folder_path - The folder relative paths are relative to.
+    /// @return The path (empty if there is no path), if the record was valid; null otherwise.
+    std::optional<std::filesystem::path> BinarySceneFile::ReadPath(
+        const StringRecord& string,
+        const std::string_view strings,
+        const std::filesystem::path& scene_folder_path)
+    {
+        bool string_valid = RangeValid(string.Offset, string.Size, strings.size());
+        if (!string_valid)
+        {
+            return std::nullopt;
+        }
+        if (0 == string.Size)
+        {
+            return std::filesystem::path();
+        }
+
+        std::u8string_view utf8_path(reinterpret_cast<const char8_t*>(strings.data() + string.Offset), string.Size);
+        std::filesystem::path path(utf8_path);
+        return scene_folder_path / path;
+    }
+
+    /// Creates a record for a transform.
+    /// @param[in]  position - The position.
+    /// @param[in]  rotation_in_radians - The rotation around each axis.
+    /// @param[in]  scale - The scale.
+    /// @return The transform record.
+    BinarySceneFile::TransformRecord BinarySceneFile::CreateTransformRecord(
+        const MATH::Vector3f& position,
+        const MATH::Vector3< MATH::Angle<float>::Radians >& rotation_in_radians,
+        const MATH::Vector3f& scale)
+    {
+        return TransformRecord
+        {
+            .Position = { position.X, position.Y, position.Z },
+            .RotationInRadians = { rotation_in_radians.X.Value, rotation_in_radians.Y.Value, rotation_in_radians.Z.Value },
+            .Scale = { scale.X, scale.Y, scale.Z }
+        };
+    }
+}
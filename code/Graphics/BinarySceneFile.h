@@ -0,0 +1,243 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Graphics/Bitmap.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/Scene.h"
+#include "Graphics/TextureCache.h"
+
+namespace GRAPHICS
+{
+    /// A scene stored in a compact binary format, allowing scenes to be archived and
+    /// quickly reloaded without re-running any code that originally constructed them.
+    ///
+    /// The file format (in native byte order) is a fixed-size header followed by
+    /// sections of fixed-size records, with each section aligned to 16 bytes:
+    /// - Strings (UTF-8 characters for all asset paths, referenced by offset and size).
+    /// - Textures (each either a path to a texture file or a range of embedded pixels).
+    /// - Embedded texture pixels (32-bit packed colors).
+    /// - Materials (referencing textures, vertex colors, and texture coordinates by index).
+    /// - Material vertex colors (4 floats each).
+    /// - Material vertex texture coordinates (2 floats each).
+    /// - Transform nodes (each referencing its parent by index, with parents before children).
+    /// - Objects (each either a path to a mesh file or a range of embedded triangles).
+    /// - Embedded triangles (each referencing a material by index).
+    /// - Lights.
+    /// Since records have fixed sizes, sections are read directly from a memory-mapped file,
+    /// and the only allocations while loading are for the resulting scene itself.
+    /// The version in the header is incremented whenever the format changes,
+    /// and files with other versions are treated as invalid.
+    ///
+    /// Objects and textures don't remember the files they were loaded from, so callers
+    /// may provide paths for them when writing.  Anything without a path is embedded.
+    /// Relative paths are resolved relative to the folder of the scene file when loading.
+    class BinarySceneFile
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The value identifying files in this format ("R3DS" in little-endian order).
+        static constexpr uint32_t MAGIC_NUMBER = 0x53443352;
+        /// The current version of the format.
+        static constexpr uint32_t FORMAT_VERSION = 1;
+
+        /// Paths of files that parts of a scene were loaded from, so that they can be
+        /// referenced rather than embedded in scene files.
+        struct AssetReferences
+        {
+            /// Paths of .obj mesh files for objects, by index of objects within the scene.
+            /// Objects with no (or an empty) path have their triangles embedded.
+            std::vector<std::filesystem::path> ObjectMeshFilepaths = {};
+            /// Paths of texture files, by texture.
+            /// Textures with no (or an empty) path have their pixels embedded.
+            std::unordered_map<const Bitmap*, std::filesystem::path> TextureFilepaths = {};
+        };
+
+        // WRITING.
+        static bool Write(
+            const Scene& scene,
+            const std::filesystem::path& filepath,
+            const AssetReferences& asset_references);
+
+        // LOADING.
+        static std::optional<Scene> Load(
+            const std::filesystem::path& filepath,
+            TextureCache* const texture_cache = nullptr);
+
+    private:
+        /// The location of a section of records within a file.
+        struct Section
+        {
+            /// The offset of the section from the start of the file.
+            uint64_t OffsetInBytes = 0;
+            /// The number of records (or bytes for strings) in the section.
+            uint64_t Count = 0;
+        };
+
+        /// The header at the start of each file.
+        struct Header
+        {
+            /// Should be MAGIC_NUMBER.
+            uint32_t MagicNumber = MAGIC_NUMBER;
+            /// Should be FORMAT_VERSION.
+            uint32_t FormatVersion = FORMAT_VERSION;
+            /// The background color of the scene (red, green, blue, alpha).
+            float BackgroundColor[4] = {};
+            /// 1 if lighting should be computed for the scene (even if no lights exist); 0 otherwise.
+            uint32_t LightingEnabled = 0;
+            /// Unused padding to keep sections aligned.
+            uint32_t Padding = 0;
+            /// The UTF-8 characters of all strings.
+            Section Strings = {};
+            /// The texture records.
+            Section Textures = {};
+            /// The embedded texture pixels.
+            Section TexturePixels = {};
+            /// The material records.
+            Section Materials = {};
+            /// The material vertex colors.
+            Section VertexColors = {};
+            /// The material vertex texture coordinates.
+            Section VertexTextureCoordinates = {};
+            /// The transform node records.
+            Section TransformNodes = {};
+            /// The object records.
+            Section Objects = {};
+            /// The embedded triangle records.
+            Section Triangles = {};
+            /// The light records.
+            Section Lights = {};
+        };
+
+        /// A range of characters in the strings section.
+        struct StringRecord
+        {
+            /// The offset of the first character within the strings section.
+            uint32_t Offset = 0;
+            /// The number of characters.  Zero for no string.
+            uint32_t Size = 0;
+        };
+
+        /// A texture, either referenced by path or embedded.
+        struct TextureRecord
+        {
+            /// The path of the texture file.  Empty for embedded textures.
+            StringRecord Filepath = {};
+            /// The color format of the texture's pixels.
+            uint32_t ColorFormat = 0;
+            /// The width of an embedded texture in pixels.
+            uint32_t WidthInPixels = 0;
+            /// The height of an embedded texture in pixels.
+            uint32_t HeightInPixels = 0;
+            /// Unused padding to keep records aligned.
+            uint32_t Padding = 0;
+            /// The index of the first pixel of an embedded texture within the pixels section.
+            uint64_t FirstPixelIndex = 0;
+        };
+
+        /// A material.
+        struct MaterialRecord
+        {
+            /// The type of shading.
+            uint32_t Shading = 0;
+            /// The index of the texture, if any; NO_INDEX otherwise.
+            uint32_t TextureIndex = 0;
+            /// The index of the first vertex color within the vertex colors section.
+            uint32_t FirstVertexColorIndex = 0;
+            /// The number of vertex colors.
+            uint32_t VertexColorCount = 0;
+            /// The index of the first texture coordinate within the texture coordinates section.
+            uint32_t FirstVertexTextureCoordinateIndex = 0;
+            /// The number of texture coordinates.
+            uint32_t VertexTextureCoordinateCount = 0;
+            /// The specular power.
+            float SpecularPower = 0.0f;
+            /// The reflectivity proportion.
+            float ReflectivityProportion = 0.0f;
+            /// The ambient color (red, green, blue, alpha).
+            float AmbientColor[4] = {};
+            /// The diffuse color (red, green, blue, alpha).
+            float DiffuseColor[4] = {};
+            /// The specular color (red, green, blue, alpha).
+            float SpecularColor[4] = {};
+            /// The emissive color (red, green, blue, alpha).
+            float EmissiveColor[4] = {};
+        };
+
+        /// A local transform (position, rotation in radians, and scale).
+        struct TransformRecord
+        {
+            /// The position (x, y, z).
+            float Position[3] = {};
+            /// The rotation in radians around each axis (x, y, z).
+            float RotationInRadians[3] = {};
+            /// The scale (x, y, z).
+            float Scale[3] = {};
+        };
+
+        /// A transform node.
+        struct TransformNodeRecord
+        {
+            /// The index of the parent node, if any; NO_INDEX otherwise.  Always less than the node's own index.
+            uint32_t ParentIndex = 0;
+            /// The transform relative to the parent.
+            TransformRecord LocalTransform = {};
+        };
+
+        /// An object, with triangles either from a mesh file or embedded.
+        struct ObjectRecord
+        {
+            /// The path of the .obj mesh file.  Empty for embedded triangles.
+            StringRecord MeshFilepath = {};
+            /// The index of the first embedded triangle within the triangles section.
+            uint32_t FirstTriangleIndex = 0;
+            /// The number of embedded triangles.
+            uint32_t TriangleCount = 0;
+            /// The index of the parent transform node, if any; NO_INDEX otherwise.
+            uint32_t ParentIndex = 0;
+            /// The transform of the object.
+            TransformRecord Transform = {};
+        };
+
+        /// A triangle.
+        struct TriangleRecord
+        {
+            /// The index of the material, if any; NO_INDEX otherwise.
+            uint32_t MaterialIndex = 0;
+            /// The vertex positions (x, y, z for each vertex) in counter-clockwise order.
+            float Vertices[9] = {};
+        };
+
+        /// A light.
+        struct LightRecord
+        {
+            /// The type of light.
+            uint32_t Type = 0;
+            /// The color (red, green, blue, alpha).
+            float Color[4] = {};
+            /// The direction for directional lights (x, y, z).
+            float DirectionalLightDirection[3] = {};
+            /// The world position for point lights (x, y, z).
+            float PointLightWorldPosition[3] = {};
+        };
+
+        /// The index stored for references to nothing.
+        static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+        // HELPER METHODS.
+        static StringRecord AppendString(const std::filesystem::path& path, std::string& strings);
+        static std::optional<std::filesystem::path> ReadPath(
+            const StringRecord& string,
+            const std::string_view strings,
+            const std::filesystem::path& scene_folder_path);
+        static TransformRecord CreateTransformRecord(
+            const MATH::Vector3f& position,
+            const MATH::Vector3< MATH::Angle<float>::Radians >& rotation_in_radians,
+            const MATH::Vector3f& scale);
+    };
+}
@@ -1,79 +1,166 @@
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
-#include <Windows.h>
+#include <vector>
+#include "Benchmarking/Profiler.h"
+#include "Filesystem/MemoryMappedFile.h"
 #include "Graphics/Bitmap.h"
+#include "Graphics/ColorConversion.h"
 
 namespace GRAPHICS
 {
-    /// Attempts to load the bitmap from the specified filepath.
+    /// Attempts to load the bitmap from the specified .bmp file.
+    /// Uncompressed 24-bit and 32-bit images in either bottom-up or top-down row order are supported.
+    /// The file is memory-mapped and converted a full row at a time, without relying on
+    /// any platform-specific headers.
     /// @param[in]  filepath - The path to the bitmap file to load.
+    /// @param[in]  color_format - The color format for pixels in the loaded bitmap.
     /// @return The texture, if loaded successfully; null otherwise.
-    std::shared_ptr<Bitmap> Bitmap::Load(const std::filesystem::path& filepath)
+    std::shared_ptr<Bitmap> Bitmap::Load(const std::filesystem::path& filepath, const GRAPHICS::ColorFormat color_format)
     {
-        // OPEN THE FILE.
-        std::ifstream bitmap_file(filepath, std::ios::binary);
-        bool bitmap_file_opened = bitmap_file.is_open();
-        if (!bitmap_file_opened)
+        PROFILE_ZONE("Load bitmap");
+
+        // MAP THE FILE INTO MEMORY.
+        std::unique_ptr<FILESYSTEM::MemoryMappedFile> bitmap_file = FILESYSTEM::MemoryMappedFile::Open(filepath);
+        if (!bitmap_file)
         {
             return nullptr;
         }
+        const uint8_t* file_data = reinterpret_cast<const uint8_t*>(bitmap_file->Data());
+        const std::size_t file_size_in_bytes = bitmap_file->SizeInBytes();
 
         // See https://en.wikipedia.org/wiki/BMP_file_format for the .bmp file format.
         // https://docs.microsoft.com/en-us/windows/win32/gdi/bitmap-storage
+        // All fields are little-endian, which matches the architectures this code supports.
+        auto read_field = [file_data, file_size_in_bytes](const std::size_t offset_in_bytes, auto& field)
+        {
+            bool field_in_file = (offset_in_bytes + sizeof(field) <= file_size_in_bytes);
+            if (field_in_file)
+            {
+                std::memcpy(&field, file_data + offset_in_bytes, sizeof(field));
+            }
+            return field_in_file;
+        };
 
-        // READ IN THE BITMAP FILE HEADER.
-        BITMAPFILEHEADER bitmap_file_header = {};
-        bitmap_file.read(reinterpret_cast<char*>(&bitmap_file_header), sizeof(bitmap_file_header));
-
-        // READ IN THE BITMAP INFO HEADER.
-        // This is assumed to be next based on our specific bitmaps, but it's not fully robust
-        // against all bitmaps.
-        BITMAPINFOHEADER bitmap_info_header = {};
-        bitmap_file.read(reinterpret_cast<char*>(&bitmap_info_header), sizeof(bitmap_info_header));
+        // READ THE BITMAP FILE HEADER.
+        constexpr uint16_t BITMAP_FILE_TYPE = 0x4D42; // "BM"
+        constexpr std::size_t BITMAP_FILE_HEADER_SIZE_IN_BYTES = 14;
+        uint16_t file_type = 0;
+        uint32_t pixel_data_offset_in_bytes = 0;
+        bool file_header_read = read_field(0, file_type) && read_field(10, pixel_data_offset_in_bytes);
+        bool is_bitmap_file = file_header_read && (BITMAP_FILE_TYPE == file_type);
+        if (!is_bitmap_file)
+        {
+            return nullptr;
+        }
 
-        // CREATE THE EMPTY BITMAP.
-        auto bitmap = std::make_shared<Bitmap>(
-            bitmap_info_header.biWidth,
-            bitmap_info_header.biHeight,
-            ColorFormat::RGBA); /// Seems to be RGB based on biCompression == 0
-
-        // FILL IN ALL PIXELS OF THE BITMAP.
-        // When height is non-negative, then this is a bottom-up bitmap - hence why we
-        // start at the last row of pixels.
-        unsigned int current_pixel_x = 0;
-        unsigned int current_pixel_y = bitmap_info_header.biHeight - 1;
-        while (bitmap_file.good())
+        // READ THE BITMAP INFO HEADER.
+        // Later versions of the info header only add fields after these.
+        constexpr std::size_t INFO_HEADER_OFFSET_IN_BYTES = BITMAP_FILE_HEADER_SIZE_IN_BYTES;
+        constexpr uint32_t MIN_INFO_HEADER_SIZE_IN_BYTES = 40;
+        uint32_t info_header_size_in_bytes = 0;
+        int32_t width_in_pixels = 0;
+        int32_t signed_height_in_pixels = 0;
+        uint16_t bits_per_pixel = 0;
+        uint32_t compression_type = 0;
+        bool info_header_read = (
+            read_field(INFO_HEADER_OFFSET_IN_BYTES, info_header_size_in_bytes) &&
+            read_field(INFO_HEADER_OFFSET_IN_BYTES + 4, width_in_pixels) &&
+            read_field(INFO_HEADER_OFFSET_IN_BYTES + 8, signed_height_in_pixels) &&
+            read_field(INFO_HEADER_OFFSET_IN_BYTES + 14, bits_per_pixel) &&
+            read_field(INFO_HEADER_OFFSET_IN_BYTES + 16, compression_type));
+        bool info_header_valid = info_header_read && (info_header_size_in_bytes >= MIN_INFO_HEADER_SIZE_IN_BYTES);
+        if (!info_header_valid)
         {
-            // READ IN THE CURRENT PIXEL'S COLOR COMPONENTS.
-            // See https://docs.microsoft.com/en-us/previous-versions//dd183376(v=vs.85)?redirectedfrom=MSDN
-            // about pixel color component ordering.
-            uint8_t blue = 0;
-            bitmap_file.read(reinterpret_cast<char*>(&blue), sizeof(blue));
+            return nullptr;
+        }
 
-            uint8_t green = 0;
-            bitmap_file.read(reinterpret_cast<char*>(&green), sizeof(green));
+        // VERIFY THE PIXEL FORMAT IS SUPPORTED.
+        // Bit field compression is supported only for the standard 8 bits per component layout,
+        // with color masks either following a basic info header or within a later version of it.
+        constexpr uint32_t UNCOMPRESSED_RGB = 0;
+        constexpr uint32_t BIT_FIELDS = 3;
+        constexpr uint32_t ALPHA_BIT_FIELDS = 6;
+        constexpr uint16_t BITS_PER_BGR_PIXEL = 24;
+        constexpr uint16_t BITS_PER_BGRA_PIXEL = 32;
+        bool has_alpha = false;
+        bool pixel_format_supported = false;
+        if (UNCOMPRESSED_RGB == compression_type)
+        {
+            // For 32-bit pixels, the 4th byte is unused.
+            pixel_format_supported = (BITS_PER_BGR_PIXEL == bits_per_pixel) || (BITS_PER_BGRA_PIXEL == bits_per_pixel);
+        }
+        else if ((BIT_FIELDS == compression_type || ALPHA_BIT_FIELDS == compression_type) && (BITS_PER_BGRA_PIXEL == bits_per_pixel))
+        {
+            constexpr std::size_t COLOR_MASKS_OFFSET_IN_BYTES = INFO_HEADER_OFFSET_IN_BYTES + MIN_INFO_HEADER_SIZE_IN_BYTES;
+            constexpr uint32_t STANDARD_RED_MASK = 0x00FF0000;
+            constexpr uint32_t STANDARD_GREEN_MASK = 0x0000FF00;
+            constexpr uint32_t STANDARD_BLUE_MASK = 0x000000FF;
+            constexpr uint32_t STANDARD_ALPHA_MASK = 0xFF000000;
+            uint32_t red_mask = 0;
+            uint32_t green_mask = 0;
+            uint32_t blue_mask = 0;
+            uint32_t alpha_mask = 0;
+            bool alpha_mask_exists = (ALPHA_BIT_FIELDS == compression_type) || (info_header_size_in_bytes > MIN_INFO_HEADER_SIZE_IN_BYTES);
+            bool color_masks_read = (
+                read_field(COLOR_MASKS_OFFSET_IN_BYTES, red_mask) &&
+                read_field(COLOR_MASKS_OFFSET_IN_BYTES + 4, green_mask) &&
+                read_field(COLOR_MASKS_OFFSET_IN_BYTES + 8, blue_mask) &&
+                (!alpha_mask_exists || read_field(COLOR_MASKS_OFFSET_IN_BYTES + 12, alpha_mask)));
+            bool color_masks_standard = (
+                color_masks_read &&
+                (STANDARD_RED_MASK == red_mask) &&
+                (STANDARD_GREEN_MASK == green_mask) &&
+                (STANDARD_BLUE_MASK == blue_mask) &&
+                (0 == alpha_mask || STANDARD_ALPHA_MASK == alpha_mask));
+            pixel_format_supported = color_masks_standard;
+            has_alpha = (STANDARD_ALPHA_MASK == alpha_mask);
+        }
+        if (!pixel_format_supported)
+        {
+            return nullptr;
+        }
 
-            uint8_t red = 0;
-            bitmap_file.read(reinterpret_cast<char*>(&red), sizeof(red));
+        // VERIFY ALL PIXEL DATA IS WITHIN THE FILE.
+        // Each row is padded to a multiple of 4 bytes.
+        // A negative height indicates a top-down (rather than bottom-up) bitmap.
+        bool is_top_down = (signed_height_in_pixels < 0);
+        uint64_t height_in_pixels = static_cast<uint64_t>(std::llabs(signed_height_in_pixels));
+        bool dimensions_valid = (width_in_pixels > 0) && (height_in_pixels > 0);
+        if (!dimensions_valid)
+        {
+            return nullptr;
+        }
+        constexpr uint64_t ROW_ALIGNMENT_IN_BYTES = 4;
+        uint64_t bytes_per_pixel = bits_per_pixel / 8;
+        uint64_t row_size_in_bytes = (static_cast<uint64_t>(width_in_pixels) * bytes_per_pixel + ROW_ALIGNMENT_IN_BYTES - 1) / ROW_ALIGNMENT_IN_BYTES * ROW_ALIGNMENT_IN_BYTES;
+        bool pixel_data_in_file = (
+            pixel_data_offset_in_bytes <= file_size_in_bytes &&
+            height_in_pixels <= (file_size_in_bytes - pixel_data_offset_in_bytes) / row_size_in_bytes);
+        if (!pixel_data_in_file)
+        {
+            return nullptr;
+        }
 
-            // If reading failed, then the above data isn't valid.
-            if (!bitmap_file.good())
+        // CONVERT ALL ROWS OF PIXELS.
+        // Bottom-up bitmaps store the last row first since (0,0) is the bottom-left corner.
+        auto bitmap = std::make_shared<Bitmap>(
+            static_cast<unsigned int>(width_in_pixels),
+            static_cast<unsigned int>(height_in_pixels),
+            color_format);
+        uint32_t* bitmap_pixels = bitmap->GetRawData();
+        for (uint64_t row_index = 0; row_index < height_in_pixels; ++row_index)
+        {
+            uint64_t file_row_index = is_top_down ? row_index : (height_in_pixels - 1 - row_index);
+            const uint8_t* file_row = file_data + pixel_data_offset_in_bytes + file_row_index * row_size_in_bytes;
+            uint32_t* bitmap_row = bitmap_pixels + row_index * static_cast<uint64_t>(width_in_pixels);
+            if (BITS_PER_BGR_PIXEL == bits_per_pixel)
             {
-                break;
+                ColorConversion::ReformatBgr(file_row, static_cast<std::size_t>(width_in_pixels), color_format, bitmap_row);
             }
-
-            // SET THE COLOR IN THE BITMAP.
-            constexpr uint8_t ALPHA_FOR_FULLY_OPAQUE = 1;
-            Color color(red, green, blue, ALPHA_FOR_FULLY_OPAQUE);
-            bitmap->WritePixel(current_pixel_x, current_pixel_y, color);
-
-            // MOVE TO THE NEXT PIXEL.
-            ++current_pixel_x;
-            bool current_row_filled = (current_pixel_x >= static_cast<unsigned int>(bitmap_info_header.biWidth));
-            if (current_row_filled)
+            else
             {
-                // MOVE TO THE NEXT ROW.
-                current_pixel_x = 0;
-                --current_pixel_y;
+                ColorConversion::ReformatBgra(file_row, static_cast<std::size_t>(width_in_pixels), has_alpha, color_format, bitmap_row);
             }
         }
 
@@ -108,6 +195,21 @@ namespace GRAPHICS
         return HeightInPixels;
     }
 
+    /// Gets the color format of pixels in the bitmap.
+    /// @return The color format of pixels.
+    GRAPHICS::ColorFormat Bitmap::GetColorFormat() const
+    {
+        return ColorFormat;
+    }
+
+    /// Retrieves a pointer to the modifiable raw pixel data of the bitmap.
+    /// Pixels are in row-major order and packed according to the bitmap's color format.
+    /// @return A pointer to the raw pixel data.
+    uint32_t* Bitmap::GetRawData()
+    {
+        return Pixels.ValuesInRowMajorOrder();
+    }
+
     /// Retrieves a pointer to the raw pixel data of the bitmap.
     /// @return A pointer to the raw pixel data.
     const uint32_t* Bitmap::GetRawData() const
@@ -133,6 +235,80 @@ namespace GRAPHICS
         return color;
     }
 
+    /// Converts all pixels in the bitmap to a different color format.
+    /// @param[in]  color_format - The new color format for pixels in the bitmap.
+    void Bitmap::ConvertToColorFormat(const GRAPHICS::ColorFormat color_format)
+    {
+        // CONVERT ALL PIXELS IN-PLACE.
+        std::size_t pixel_count = static_cast<std::size_t>(WidthInPixels) * HeightInPixels;
+        uint32_t* pixels = Pixels.ValuesInRowMajorOrder();
+        ColorConversion::Reformat(pixels, pixel_count, ColorFormat, color_format, pixels);
+
+        // TRACK THE NEW FORMAT.
+        ColorFormat = color_format;
+    }
+
+    /// Saves the bitmap to a .bmp file as uncompressed 32-bit pixels in top-down row order.
+    /// @param[in]  filepath - The path of the .bmp file to write.
+    /// @return True if the file was successfully written; false otherwise.
+    bool Bitmap::Save(const std::filesystem::path& filepath) const
+    {
+        // OPEN THE FILE.
+        std::ofstream bitmap_file(filepath, std::ios::binary);
+        if (!bitmap_file)
+        {
+            return false;
+        }
+
+        // BUILD THE HEADERS.
+        // A negative height indicates a top-down bitmap, which matches the row order here.
+        // 32-bit rows never need padding.
+        constexpr std::size_t BITMAP_FILE_HEADER_SIZE_IN_BYTES = 14;
+        constexpr std::size_t INFO_HEADER_SIZE_IN_BYTES = 40;
+        constexpr uint32_t PIXEL_DATA_OFFSET_IN_BYTES = BITMAP_FILE_HEADER_SIZE_IN_BYTES + INFO_HEADER_SIZE_IN_BYTES;
+        const uint32_t pixel_data_size_in_bytes = WidthInPixels * HeightInPixels * static_cast<uint32_t>(sizeof(uint32_t));
+        std::vector<uint8_t> header_bytes;
+        auto append_field = [&header_bytes](const auto& field)
+        {
+            const uint8_t* field_bytes = reinterpret_cast<const uint8_t*>(&field);
+            header_bytes.insert(header_bytes.end(), field_bytes, field_bytes + sizeof(field));
+        };
+        constexpr uint16_t BITMAP_FILE_TYPE = 0x4D42; // "BM"
+        append_field(BITMAP_FILE_TYPE);
+        append_field(static_cast<uint32_t>(PIXEL_DATA_OFFSET_IN_BYTES + pixel_data_size_in_bytes));
+        append_field(uint32_t(0));
+        append_field(PIXEL_DATA_OFFSET_IN_BYTES);
+        append_field(static_cast<uint32_t>(INFO_HEADER_SIZE_IN_BYTES));
+        append_field(static_cast<int32_t>(WidthInPixels));
+        append_field(-static_cast<int32_t>(HeightInPixels));
+        constexpr uint16_t PLANE_COUNT = 1;
+        constexpr uint16_t BITS_PER_PIXEL = 32;
+        constexpr uint32_t UNCOMPRESSED_RGB = 0;
+        constexpr int32_t PIXELS_PER_METER = 2835;
+        append_field(PLANE_COUNT);
+        append_field(BITS_PER_PIXEL);
+        append_field(UNCOMPRESSED_RGB);
+        append_field(pixel_data_size_in_bytes);
+        append_field(PIXELS_PER_METER);
+        append_field(PIXELS_PER_METER);
+        append_field(uint32_t(0));
+        append_field(uint32_t(0));
+        bitmap_file.write(reinterpret_cast<const char*>(header_bytes.data()), static_cast<std::streamsize>(header_bytes.size()));
+
+        // WRITE ALL ROWS OF PIXELS.
+        // ARGB pixels in little-endian memory are already in the BGRA byte order of .bmp files.
+        std::vector<uint32_t> file_row(WidthInPixels);
+        const uint32_t* pixels = GetRawData();
+        for (unsigned int row_index = 0; row_index < HeightInPixels; ++row_index)
+        {
+            const uint32_t* bitmap_row = pixels + static_cast<std::size_t>(row_index) * WidthInPixels;
+            ColorConversion::Reformat(bitmap_row, WidthInPixels, ColorFormat, GRAPHICS::ColorFormat::ARGB, file_row.data());
+            bitmap_file.write(reinterpret_cast<const char*>(file_row.data()), static_cast<std::streamsize>(file_row.size() * sizeof(uint32_t)));
+        }
+
+        return static_cast<bool>(bitmap_file);
+    }
+
     /// Fills in color of the pixel at the specified coordinates.
     /// @param[in]  x - The horizontal coordinate of the pixel.
     /// @param[in]  y - The vertical coorindate of the pixel.
@@ -176,12 +352,8 @@ namespace GRAPHICS
     void Bitmap::FillPixels(const Color& color)
     {
         // FILL IN ALL PIXELS.
-        for (unsigned int y = 0; y < HeightInPixels; ++y)
-        {
-            for (unsigned int x = 0; x < WidthInPixels; ++x)
-            {
-                WritePixel(x, y, color);
-            }
-        }
+        // The color only needs to be packed once for all pixels.
+        uint32_t packed_color = color.Pack(ColorFormat);
+        Pixels.Fill(packed_color);
     }
 }
@@ -24,7 +24,9 @@ namespace GRAPHICS
     {
     public:
         // CONSTRUCTION/DESTRUCTION.
-        static std::shared_ptr<Bitmap> Load(const std::filesystem::path& filepath);
+        static std::shared_ptr<Bitmap> Load(
+            const std::filesystem::path& filepath,
+            const GRAPHICS::ColorFormat color_format = GRAPHICS::ColorFormat::RGBA);
         explicit Bitmap(
             const unsigned int width_in_pixels,
             const unsigned int height_in_pixels,
@@ -35,9 +37,17 @@ namespace GRAPHICS
         unsigned int GetHeightInPixels() const;
 
         // OTHER ACCESSORS.
+        GRAPHICS::ColorFormat GetColorFormat() const;
+        uint32_t* GetRawData();
         const uint32_t* GetRawData() const;
         GRAPHICS::Color GetPixel(const unsigned int x, const unsigned int y) const;
 
+        // CONVERSION.
+        void ConvertToColorFormat(const GRAPHICS::ColorFormat color_format);
+
+        // SAVING.
+        bool Save(const std::filesystem::path& filepath) const;
+
         // DRAWING.
         void WritePixel(const unsigned int x, const unsigned int y, const uint32_t& color);
         void WritePixel(const unsigned int x, const unsigned int y, const Color& color);
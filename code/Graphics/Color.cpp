@@ -1,3 +1,5 @@
+#include <array>
+#include <cstddef>
 #include "Graphics/Color.h"
 #include "Math/Number.h"
 
@@ -9,6 +11,22 @@ namespace GRAPHICS
     const Color Color::GREEN(0.0f, 1.0f, 0.0f, 1.0f);
     const Color Color::BLUE(0.0f, 0.0f, 1.0f, 1.0f);
 
+    /// Floating-point versions of all possible 8-bit color components, indexed by the 8-bit component.
+    /// Each is scaled from the range [0,255] to [0,1].
+    static constexpr std::array<float, 256> FLOAT_COLOR_COMPONENTS_BY_UINT8_COMPONENT = []()
+    {
+        std::array<float, 256> float_color_components = {};
+        for (std::size_t integral_color_component = 0; integral_color_component < float_color_components.size(); ++integral_color_component)
+        {
+            // CAST THE INTEGRAL COMPONENT TO FLOATING-POINT TO AVOID TRUNCATION.
+            float original_color_component = static_cast<float>(integral_color_component);
+
+            // SCALE THE COLOR COMPONENT FROM RANGE [0,255] to [0,1].
+            float_color_components[integral_color_component] = (original_color_component / Color::MAX_INTEGRAL_COLOR_COMPONENT);
+        }
+        return float_color_components;
+    }();
+
     /// Unpacks a color from a packed color format.
     /// @param[in]  packed_color - The color to unpack.
     /// @param[in]  color_format - The format of data in the packed color.
@@ -249,13 +267,16 @@ namespace GRAPHICS
         return alpha_as_uint8;
     }
 
+    /// Packs the color into a 32-bit integer.
+    /// @param[in]  color_format - The format to pack the color into.
+    /// @return The packed color.
     uint32_t Color::Pack(const ColorFormat color_format) const
     {
         // GET THE COLOR COMPONENTS.
         uint8_t red = GetRedAsUint8();
         uint8_t green = GetGreenAsUint8();
         uint8_t blue = GetBlueAsUint8();
-        uint8_t alpha = GetRedAsUint8();
+        uint8_t alpha = GetAlphaAsUint8();
 
         // PACK ACCORDING TO THE COLOR FORMAT.
         switch (color_format)
@@ -301,12 +322,9 @@ namespace GRAPHICS
     /// @return The floating-point version of the color component.
     float Color::ToFloatColorComponent(const uint8_t color_component_as_uint8) const
     {
-        // CAST THE INTEGRAL COMPONENT TO FLOATING-POINT TO AVOID TRUNCATION.
-        float original_color_component = static_cast<float>(color_component_as_uint8);
-
-        // SCALE THE COLOR COMPONENT FROM RANGE [0,255] to [0,1].
-        float color_component_as_float = (original_color_component / MAX_INTEGRAL_COLOR_COMPONENT);
-
+        // LOOK UP THE PRE-COMPUTED FLOATING-POINT COMPONENT.
+        // This avoids a division for every component of every unpacked color.
+        float color_component_as_float = FLOAT_COLOR_COMPONENTS_BY_UINT8_COMPONENT[color_component_as_uint8];
         return color_component_as_float;
     }
 
@@ -0,0 +1,492 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include "Graphics/ColorConversion.h"
+#include "Math/Simd.h"
+
+namespace GRAPHICS
+{
+    // Batch unpacking writes colors directly as 4 consecutive floats, which requires this layout.
+    static_assert(sizeof(Color) == 4 * sizeof(float), "Color must consist of exactly 4 floats.");
+    static_assert(offsetof(Color, Red) == 0 * sizeof(float), "Color component order changed.");
+    static_assert(offsetof(Color, Blue) == 1 * sizeof(float), "Color component order changed.");
+    static_assert(offsetof(Color, Green) == 2 * sizeof(float), "Color component order changed.");
+    static_assert(offsetof(Color, Alpha) == 3 * sizeof(float), "Color component order changed.");
+
+    /// Packs colors stored as separate component arrays into the specified format.
+    /// @param[in]  reds - The red components of the colors to pack.
+    /// @param[in]  greens - The green components of the colors to pack.
+    /// @param[in]  blues - The blue components of the colors to pack.
+    /// @param[in]  alphas - The alpha components of the colors to pack.
+    /// @param[in]  color_count - The number of colors (elements in each component array).
+    /// @param[in]  color_format - The format to pack the colors into.
+    /// @param[out] packed_colors - The packed colors; must have room for color_count elements.
+    void ColorConversion::Pack(
+        const float* const reds,
+        const float* const greens,
+        const float* const blues,
+        const float* const alphas,
+        const std::size_t color_count,
+        const ColorFormat color_format,
+        uint32_t* const packed_colors)
+    {
+        // GET WHERE EACH COMPONENT GOES IN THE PACKED COLORS.
+        std::optional<ComponentBitShifts> component_bit_shifts = GetComponentBitShifts(color_format);
+        if (!component_bit_shifts)
+        {
+            // Unknown formats are packed the same way as by individual colors.
+            std::fill_n(packed_colors, color_count, Color::BLACK.Pack(color_format));
+            return;
+        }
+
+        std::size_t color_index = 0;
+
+#if MATH_SIMD_SSE2
+        // PACK GROUPS OF 4 COLORS AT A TIME.
+        const __m128 MIN_INTEGRAL_COMPONENTS = _mm_setzero_ps();
+        const __m128 MAX_INTEGRAL_COMPONENTS = _mm_set1_ps(Color::MAX_INTEGRAL_COLOR_COMPONENT);
+        const __m128i RED_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Red);
+        const __m128i GREEN_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Green);
+        const __m128i BLUE_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Blue);
+        const __m128i ALPHA_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Alpha);
+        constexpr std::size_t COLORS_PER_GROUP = 4;
+        for (; color_index + COLORS_PER_GROUP <= color_count; color_index += COLORS_PER_GROUP)
+        {
+            // SCALE THE COMPONENTS FROM [0,1] TO [0,255].
+            // Clamping is done on the scaled components so that out-of-range values
+            // (including NaN, due to how max works) can't overflow into other components.
+            __m128 scaled_reds = _mm_mul_ps(_mm_loadu_ps(reds + color_index), MAX_INTEGRAL_COMPONENTS);
+            __m128 scaled_greens = _mm_mul_ps(_mm_loadu_ps(greens + color_index), MAX_INTEGRAL_COMPONENTS);
+            __m128 scaled_blues = _mm_mul_ps(_mm_loadu_ps(blues + color_index), MAX_INTEGRAL_COMPONENTS);
+            __m128 scaled_alphas = _mm_mul_ps(_mm_loadu_ps(alphas + color_index), MAX_INTEGRAL_COMPONENTS);
+            scaled_reds = _mm_min_ps(_mm_max_ps(scaled_reds, MIN_INTEGRAL_COMPONENTS), MAX_INTEGRAL_COMPONENTS);
+            scaled_greens = _mm_min_ps(_mm_max_ps(scaled_greens, MIN_INTEGRAL_COMPONENTS), MAX_INTEGRAL_COMPONENTS);
+            scaled_blues = _mm_min_ps(_mm_max_ps(scaled_blues, MIN_INTEGRAL_COMPONENTS), MAX_INTEGRAL_COMPONENTS);
+            scaled_alphas = _mm_min_ps(_mm_max_ps(scaled_alphas, MIN_INTEGRAL_COMPONENTS), MAX_INTEGRAL_COMPONENTS);
+
+            // CONVERT THE COMPONENTS TO INTEGERS.
+            // Truncation is used to match the behavior of converting individual colors.
+            __m128i integral_reds = _mm_cvttps_epi32(scaled_reds);
+            __m128i integral_greens = _mm_cvttps_epi32(scaled_greens);
+            __m128i integral_blues = _mm_cvttps_epi32(scaled_blues);
+            __m128i integral_alphas = _mm_cvttps_epi32(scaled_alphas);
+
+            // PACK THE COMPONENTS.
+            __m128i packed_group = _mm_or_si128(
+                _mm_or_si128(_mm_sll_epi32(integral_reds, RED_SHIFT), _mm_sll_epi32(integral_greens, GREEN_SHIFT)),
+                _mm_or_si128(_mm_sll_epi32(integral_blues, BLUE_SHIFT), _mm_sll_epi32(integral_alphas, ALPHA_SHIFT)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(packed_colors + color_index), packed_group);
+        }
+#endif
+
+        // PACK ANY REMAINING COLORS INDIVIDUALLY.
+        for (; color_index < color_count; ++color_index)
+        {
+            Color color(reds[color_index], greens[color_index], blues[color_index], alphas[color_index]);
+            color.Clamp();
+            packed_colors[color_index] = color.Pack(color_format);
+        }
+    }
+
+    /// Packs colors into the specified format.
+    /// @param[in]  colors - The colors to pack.
+    /// @param[in]  color_count - The number of colors to pack.
+    /// @param[in]  color_format - The format to pack the colors into.
+    /// @param[out] packed_colors - The packed colors; must have room for color_count elements.
+    void ColorConversion::Pack(
+        const Color* const colors,
+        const std::size_t color_count,
+        const ColorFormat color_format,
+        uint32_t* const packed_colors)
+    {
+        // PACK THE COLORS IN BLOCKS.
+        // Colors are split into separate component arrays first since that is
+        // the layout that allows packing several colors at once.
+        constexpr std::size_t MAX_COLORS_PER_BLOCK = 64;
+        std::array<float, MAX_COLORS_PER_BLOCK> reds;
+        std::array<float, MAX_COLORS_PER_BLOCK> greens;
+        std::array<float, MAX_COLORS_PER_BLOCK> blues;
+        std::array<float, MAX_COLORS_PER_BLOCK> alphas;
+        for (std::size_t block_start_index = 0; block_start_index < color_count; block_start_index += MAX_COLORS_PER_BLOCK)
+        {
+            // SPLIT THE CURRENT BLOCK'S COLORS INTO COMPONENTS.
+            std::size_t block_color_count = std::min(MAX_COLORS_PER_BLOCK, color_count - block_start_index);
+            for (std::size_t block_color_index = 0; block_color_index < block_color_count; ++block_color_index)
+            {
+                const Color& color = colors[block_start_index + block_color_index];
+                reds[block_color_index] = color.Red;
+                greens[block_color_index] = color.Green;
+                blues[block_color_index] = color.Blue;
+                alphas[block_color_index] = color.Alpha;
+            }
+
+            // PACK THE CURRENT BLOCK.
+            Pack(
+                reds.data(),
+                greens.data(),
+                blues.data(),
+                alphas.data(),
+                block_color_count,
+                color_format,
+                packed_colors + block_start_index);
+        }
+    }
+
+    /// Unpacks colors from the specified format.
+    /// @param[in]  packed_colors - The colors to unpack.
+    /// @param[in]  color_count - The number of colors to unpack.
+    /// @param[in]  color_format - The format of the packed colors.
+    /// @param[out] colors - The unpacked colors; must have room for color_count elements.
+    void ColorConversion::Unpack(
+        const uint32_t* const packed_colors,
+        const std::size_t color_count,
+        const ColorFormat color_format,
+        Color* const colors)
+    {
+        // GET WHERE EACH COMPONENT IS IN THE PACKED COLORS.
+        std::optional<ComponentBitShifts> component_bit_shifts = GetComponentBitShifts(color_format);
+        if (!component_bit_shifts)
+        {
+            // Unknown formats are unpacked the same way as individual colors.
+            std::fill_n(colors, color_count, Color::Unpack(0, color_format));
+            return;
+        }
+
+        std::size_t color_index = 0;
+
+#if MATH_SIMD_SSE2
+        // UNPACK GROUPS OF 4 COLORS AT A TIME.
+        const __m128i COMPONENT_MASK = _mm_set1_epi32(0xFF);
+        const __m128 MAX_INTEGRAL_COMPONENTS = _mm_set1_ps(Color::MAX_INTEGRAL_COLOR_COMPONENT);
+        const __m128i RED_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Red);
+        const __m128i GREEN_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Green);
+        const __m128i BLUE_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Blue);
+        const __m128i ALPHA_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Alpha);
+        constexpr std::size_t COLORS_PER_GROUP = 4;
+        for (; color_index + COLORS_PER_GROUP <= color_count; color_index += COLORS_PER_GROUP)
+        {
+            // EXTRACT THE INTEGRAL COMPONENTS.
+            __m128i packed_group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed_colors + color_index));
+            __m128i integral_reds = _mm_and_si128(_mm_srl_epi32(packed_group, RED_SHIFT), COMPONENT_MASK);
+            __m128i integral_greens = _mm_and_si128(_mm_srl_epi32(packed_group, GREEN_SHIFT), COMPONENT_MASK);
+            __m128i integral_blues = _mm_and_si128(_mm_srl_epi32(packed_group, BLUE_SHIFT), COMPONENT_MASK);
+            __m128i integral_alphas = _mm_and_si128(_mm_srl_epi32(packed_group, ALPHA_SHIFT), COMPONENT_MASK);
+
+            // SCALE THE COMPONENTS FROM [0,255] TO [0,1].
+            // Division (rather than multiplying by a reciprocal) matches individual unpacking exactly.
+            __m128 reds = _mm_div_ps(_mm_cvtepi32_ps(integral_reds), MAX_INTEGRAL_COMPONENTS);
+            __m128 greens = _mm_div_ps(_mm_cvtepi32_ps(integral_greens), MAX_INTEGRAL_COMPONENTS);
+            __m128 blues = _mm_div_ps(_mm_cvtepi32_ps(integral_blues), MAX_INTEGRAL_COMPONENTS);
+            __m128 alphas = _mm_div_ps(_mm_cvtepi32_ps(integral_alphas), MAX_INTEGRAL_COMPONENTS);
+
+            // STORE THE COLORS.
+            // Transposing the components in the order they're declared within colors
+            // results in each row holding a complete color.
+            _MM_TRANSPOSE4_PS(reds, blues, greens, alphas);
+            _mm_storeu_ps(&colors[color_index + 0].Red, reds);
+            _mm_storeu_ps(&colors[color_index + 1].Red, blues);
+            _mm_storeu_ps(&colors[color_index + 2].Red, greens);
+            _mm_storeu_ps(&colors[color_index + 3].Red, alphas);
+        }
+#endif
+
+        // UNPACK ANY REMAINING COLORS INDIVIDUALLY.
+        for (; color_index < color_count; ++color_index)
+        {
+            colors[color_index] = Color::Unpack(packed_colors[color_index], color_format);
+        }
+    }
+
+    /// Converts packed colors from one format to another.
+    /// The source and destination may be the same memory to convert in-place.
+    /// @param[in]  source_colors - The colors to convert.
+    /// @param[in]  color_count - The number of colors to convert.
+    /// @param[in]  source_color_format - The format of the source colors.
+    /// @param[in]  destination_color_format - The format to convert to.
+    /// @param[out] destination_colors - The converted colors; must have room for color_count elements.
+    void ColorConversion::Reformat(
+        const uint32_t* const source_colors,
+        const std::size_t color_count,
+        const ColorFormat source_color_format,
+        const ColorFormat destination_color_format,
+        uint32_t* const destination_colors)
+    {
+        // HANDLE THE CASE OF NO CONVERSION BEING NEEDED.
+        bool formats_same = (source_color_format == destination_color_format);
+        if (formats_same)
+        {
+            std::copy_n(source_colors, color_count, destination_colors);
+            return;
+        }
+
+        // ROTATE COMPONENTS INTO THE DESTINATION FORMAT.
+        constexpr uint32_t NO_ALPHA_MASK = 0;
+        RotateComponents(source_colors, color_count, NO_ALPHA_MASK, source_color_format, destination_color_format, destination_colors);
+    }
+
+    /// Converts colors stored as 3 bytes each (blue, green, red), as in 24-bit .bmp files,
+    /// to packed colors.  All converted colors are fully opaque.
+    /// @param[in]  source_bytes - The bytes of the colors to convert.
+    /// @param[in]  color_count - The number of colors to convert.
+    /// @param[in]  destination_color_format - The format to convert to.
+    /// @param[out] destination_colors - The converted colors; must have room for color_count elements.
+    void ColorConversion::ReformatBgr(
+        const uint8_t* const source_bytes,
+        const std::size_t color_count,
+        const ColorFormat destination_color_format,
+        uint32_t* const destination_colors)
+    {
+        // CONVERT THE COLORS IN BLOCKS.
+        // Colors are first widened to 32-bit ARGB (which is how BGRA bytes are read on
+        // little-endian architectures) since that is the layout that allows converting several colors at once.
+        constexpr std::size_t MAX_COLORS_PER_BLOCK = 64;
+        constexpr std::size_t BYTES_PER_SOURCE_COLOR = 3;
+        std::array<uint32_t, MAX_COLORS_PER_BLOCK> argb_colors;
+        for (std::size_t block_start_index = 0; block_start_index < color_count; block_start_index += MAX_COLORS_PER_BLOCK)
+        {
+            // WIDEN THE CURRENT BLOCK'S COLORS.
+            std::size_t block_color_count = std::min(MAX_COLORS_PER_BLOCK, color_count - block_start_index);
+            const uint8_t* block_source_bytes = source_bytes + block_start_index * BYTES_PER_SOURCE_COLOR;
+            for (std::size_t block_color_index = 0; block_color_index < block_color_count; ++block_color_index)
+            {
+                const uint8_t* source_color = block_source_bytes + block_color_index * BYTES_PER_SOURCE_COLOR;
+                argb_colors[block_color_index] = (
+                    static_cast<uint32_t>(source_color[0]) |
+                    (static_cast<uint32_t>(source_color[1]) << 8) |
+                    (static_cast<uint32_t>(source_color[2]) << 16));
+            }
+
+            // CONVERT THE CURRENT BLOCK.
+            constexpr uint32_t OPAQUE_ALPHA_MASK = 0xFF000000;
+            RotateComponents(argb_colors.data(), block_color_count, OPAQUE_ALPHA_MASK, ColorFormat::ARGB, destination_color_format, destination_colors + block_start_index);
+        }
+    }
+
+    /// Converts colors stored as 4 bytes each (blue, green, red, alpha), as in 32-bit .bmp files,
+    /// to packed colors.
+    /// @param[in]  source_bytes - The bytes of the colors to convert.  Need not be aligned.
+    /// @param[in]  color_count - The number of colors to convert.
+    /// @param[in]  source_has_alpha - True if the 4th byte of each color is alpha;
+    ///     false if it is unused, in which case all converted colors are fully opaque.
+    /// @param[in]  destination_color_format - The format to convert to.
+    /// @param[out] destination_colors - The converted colors; must have room for color_count elements.
+    void ColorConversion::ReformatBgra(
+        const uint8_t* const source_bytes,
+        const std::size_t color_count,
+        const bool source_has_alpha,
+        const ColorFormat destination_color_format,
+        uint32_t* const destination_colors)
+    {
+        // CONVERT THE COLORS IN BLOCKS.
+        // Source bytes are copied first since they may not be aligned for 32-bit access.
+        // On little-endian architectures, BGRA bytes are ARGB when read as 32-bit integers.
+        constexpr std::size_t MAX_COLORS_PER_BLOCK = 64;
+        constexpr std::size_t BYTES_PER_SOURCE_COLOR = 4;
+        constexpr uint32_t OPAQUE_ALPHA_MASK = 0xFF000000;
+        uint32_t source_alpha_mask = source_has_alpha ? 0 : OPAQUE_ALPHA_MASK;
+        std::array<uint32_t, MAX_COLORS_PER_BLOCK> argb_colors;
+        for (std::size_t block_start_index = 0; block_start_index < color_count; block_start_index += MAX_COLORS_PER_BLOCK)
+        {
+            std::size_t block_color_count = std::min(MAX_COLORS_PER_BLOCK, color_count - block_start_index);
+            std::memcpy(argb_colors.data(), source_bytes + block_start_index * BYTES_PER_SOURCE_COLOR, block_color_count * BYTES_PER_SOURCE_COLOR);
+            RotateComponents(argb_colors.data(), block_color_count, source_alpha_mask, ColorFormat::ARGB, destination_color_format, destination_colors + block_start_index);
+        }
+    }
+
+    /// Converts packed colors to separate luma (Y) and chroma (Cb, Cr) components, as used by video formats.
+    /// The conversion uses the common fixed-point approximation of BT.601 with limited ("studio") range,
+    /// so lumas are within [16,235] and chromas are within [16,240].  Alpha is ignored.
+    /// @param[in]  source_colors - The colors to convert.
+    /// @param[in]  color_count - The number of colors to convert.
+    /// @param[in]  source_color_format - The format of the source colors.
+    /// @param[out] lumas - The luma of each color; must have room for color_count elements.
+    /// @param[out] blue_chromas - The blue-difference chroma of each color; must have room for color_count elements.
+    /// @param[out] red_chromas - The red-difference chroma of each color; must have room for color_count elements.
+    void ColorConversion::ConvertToYuv(
+        const uint32_t* const source_colors,
+        const std::size_t color_count,
+        const ColorFormat source_color_format,
+        uint8_t* const lumas,
+        uint8_t* const blue_chromas,
+        uint8_t* const red_chromas)
+    {
+        // GET WHERE EACH COMPONENT IS IN THE PACKED COLORS.
+        std::optional<ComponentBitShifts> component_bit_shifts = GetComponentBitShifts(source_color_format);
+        if (!component_bit_shifts)
+        {
+            // Unknown formats are treated as black, like for other conversions.
+            constexpr uint8_t BLACK_LUMA = 16;
+            constexpr uint8_t NEUTRAL_CHROMA = 128;
+            std::fill_n(lumas, color_count, BLACK_LUMA);
+            std::fill_n(blue_chromas, color_count, NEUTRAL_CHROMA);
+            std::fill_n(red_chromas, color_count, NEUTRAL_CHROMA);
+            return;
+        }
+
+        // DEFINE THE CONVERSION COEFFICIENTS.
+        // Each output is ((red * R + green * G + blue * B + 128) >> 8) + offset.
+        constexpr int LUMA_RED = 66;
+        constexpr int LUMA_GREEN = 129;
+        constexpr int LUMA_BLUE = 25;
+        constexpr int LUMA_OFFSET = 16;
+        constexpr int BLUE_CHROMA_RED = -38;
+        constexpr int BLUE_CHROMA_GREEN = -74;
+        constexpr int BLUE_CHROMA_BLUE = 112;
+        constexpr int RED_CHROMA_RED = 112;
+        constexpr int RED_CHROMA_GREEN = -94;
+        constexpr int RED_CHROMA_BLUE = -18;
+        constexpr int CHROMA_OFFSET = 128;
+        constexpr int ROUNDING = 128;
+        constexpr int FRACTIONAL_BIT_COUNT = 8;
+
+        std::size_t color_index = 0;
+
+#if MATH_SIMD_SSE2
+        // CONVERT GROUPS OF 4 COLORS AT A TIME.
+        // Components are interleaved as 16-bit pairs (red with green, blue with 1) so that
+        // multiply-add instructions compute entire sums (including rounding) in 32-bit lanes.
+        const __m128i COMPONENT_MASK = _mm_set1_epi32(0xFF);
+        const __m128i ONES_IN_HIGH_HALVES = _mm_set1_epi32(1 << 16);
+        const __m128i RED_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Red);
+        const __m128i GREEN_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Green);
+        const __m128i BLUE_SHIFT = _mm_cvtsi32_si128(component_bit_shifts->Blue);
+        const __m128i LUMA_RED_GREEN = _mm_setr_epi16(LUMA_RED, LUMA_GREEN, LUMA_RED, LUMA_GREEN, LUMA_RED, LUMA_GREEN, LUMA_RED, LUMA_GREEN);
+        const __m128i LUMA_BLUE_ROUNDING = _mm_setr_epi16(LUMA_BLUE, ROUNDING, LUMA_BLUE, ROUNDING, LUMA_BLUE, ROUNDING, LUMA_BLUE, ROUNDING);
+        const __m128i BLUE_CHROMA_RED_GREEN = _mm_setr_epi16(
+            BLUE_CHROMA_RED, BLUE_CHROMA_GREEN, BLUE_CHROMA_RED, BLUE_CHROMA_GREEN,
+            BLUE_CHROMA_RED, BLUE_CHROMA_GREEN, BLUE_CHROMA_RED, BLUE_CHROMA_GREEN);
+        const __m128i BLUE_CHROMA_BLUE_ROUNDING = _mm_setr_epi16(
+            BLUE_CHROMA_BLUE, ROUNDING, BLUE_CHROMA_BLUE, ROUNDING,
+            BLUE_CHROMA_BLUE, ROUNDING, BLUE_CHROMA_BLUE, ROUNDING);
+        const __m128i RED_CHROMA_RED_GREEN = _mm_setr_epi16(
+            RED_CHROMA_RED, RED_CHROMA_GREEN, RED_CHROMA_RED, RED_CHROMA_GREEN,
+            RED_CHROMA_RED, RED_CHROMA_GREEN, RED_CHROMA_RED, RED_CHROMA_GREEN);
+        const __m128i RED_CHROMA_BLUE_ROUNDING = _mm_setr_epi16(
+            RED_CHROMA_BLUE, ROUNDING, RED_CHROMA_BLUE, ROUNDING,
+            RED_CHROMA_BLUE, ROUNDING, RED_CHROMA_BLUE, ROUNDING);
+        const __m128i LUMA_OFFSETS = _mm_set1_epi32(LUMA_OFFSET);
+        const __m128i CHROMA_OFFSETS = _mm_set1_epi32(CHROMA_OFFSET);
+        auto store_4_bytes = [](const __m128i& values, uint8_t* const destination)
+        {
+            // All values are already within [0,255], so saturating packs just narrow them.
+            __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(values, values), values);
+            int first_4_bytes = _mm_cvtsi128_si32(bytes);
+            std::memcpy(destination, &first_4_bytes, sizeof(first_4_bytes));
+        };
+        constexpr std::size_t COLORS_PER_GROUP = 4;
+        for (; color_index + COLORS_PER_GROUP <= color_count; color_index += COLORS_PER_GROUP)
+        {
+            // EXTRACT THE COMPONENTS INTO 16-BIT PAIRS.
+            __m128i packed_group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source_colors + color_index));
+            __m128i reds = _mm_and_si128(_mm_srl_epi32(packed_group, RED_SHIFT), COMPONENT_MASK);
+            __m128i greens = _mm_and_si128(_mm_srl_epi32(packed_group, GREEN_SHIFT), COMPONENT_MASK);
+            __m128i blues = _mm_and_si128(_mm_srl_epi32(packed_group, BLUE_SHIFT), COMPONENT_MASK);
+            __m128i red_green_pairs = _mm_or_si128(reds, _mm_slli_epi32(greens, 16));
+            __m128i blue_one_pairs = _mm_or_si128(blues, ONES_IN_HIGH_HALVES);
+
+            // COMPUTE THE LUMAS AND CHROMAS.
+            __m128i group_lumas = _mm_add_epi32(
+                _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(red_green_pairs, LUMA_RED_GREEN), _mm_madd_epi16(blue_one_pairs, LUMA_BLUE_ROUNDING)), FRACTIONAL_BIT_COUNT),
+                LUMA_OFFSETS);
+            __m128i group_blue_chromas = _mm_add_epi32(
+                _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(red_green_pairs, BLUE_CHROMA_RED_GREEN), _mm_madd_epi16(blue_one_pairs, BLUE_CHROMA_BLUE_ROUNDING)), FRACTIONAL_BIT_COUNT),
+                CHROMA_OFFSETS);
+            __m128i group_red_chromas = _mm_add_epi32(
+                _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(red_green_pairs, RED_CHROMA_RED_GREEN), _mm_madd_epi16(blue_one_pairs, RED_CHROMA_BLUE_ROUNDING)), FRACTIONAL_BIT_COUNT),
+                CHROMA_OFFSETS);
+
+            // STORE THE COMPONENTS.
+            store_4_bytes(group_lumas, lumas + color_index);
+            store_4_bytes(group_blue_chromas, blue_chromas + color_index);
+            store_4_bytes(group_red_chromas, red_chromas + color_index);
+        }
+#endif
+
+        // CONVERT ANY REMAINING COLORS INDIVIDUALLY.
+        for (; color_index < color_count; ++color_index)
+        {
+            uint32_t source_color = source_colors[color_index];
+            int red = static_cast<int>((source_color >> component_bit_shifts->Red) & 0xFF);
+            int green = static_cast<int>((source_color >> component_bit_shifts->Green) & 0xFF);
+            int blue = static_cast<int>((source_color >> component_bit_shifts->Blue) & 0xFF);
+            lumas[color_index] = static_cast<uint8_t>(((LUMA_RED * red + LUMA_GREEN * green + LUMA_BLUE * blue + ROUNDING) >> FRACTIONAL_BIT_COUNT) + LUMA_OFFSET);
+            blue_chromas[color_index] = static_cast<uint8_t>(((BLUE_CHROMA_RED * red + BLUE_CHROMA_GREEN * green + BLUE_CHROMA_BLUE * blue + ROUNDING) >> FRACTIONAL_BIT_COUNT) + CHROMA_OFFSET);
+            red_chromas[color_index] = static_cast<uint8_t>(((RED_CHROMA_RED * red + RED_CHROMA_GREEN * green + RED_CHROMA_BLUE * blue + ROUNDING) >> FRACTIONAL_BIT_COUNT) + CHROMA_OFFSET);
+        }
+    }
+
+    /// Gets where each color component is located within packed colors of the specified format.
+    /// @param[in]  color_format - The format of packed colors.
+    /// @return The bit shifts for each component, if the format is supported; null otherwise.
+    std::optional<ColorConversion::ComponentBitShifts> ColorConversion::GetComponentBitShifts(const ColorFormat color_format)
+    {
+        switch (color_format)
+        {
+            case ColorFormat::RGBA:
+                return ComponentBitShifts { .Red = 24, .Green = 16, .Blue = 8, .Alpha = 0 };
+            case ColorFormat::ARGB:
+                return ComponentBitShifts { .Red = 16, .Green = 8, .Blue = 0, .Alpha = 24 };
+            default:
+                return std::nullopt;
+        }
+    }
+
+    /// Converts packed colors to another format by rotating their components, optionally forcing alpha bits on.
+    /// All supported formats only differ in where alpha is, so converting is
+    /// just a matter of rotating all components by a single byte.
+    /// @param[in]  source_colors - The colors to convert.
+    /// @param[in]  color_count - The number of colors to convert.
+    /// @param[in]  source_alpha_mask - Bits to set in each source color before converting.
+    /// @param[in]  source_color_format - The format of the source colors.
+    /// @param[in]  destination_color_format - The format to convert to.
+    /// @param[out] destination_colors - The converted colors; must have room for color_count elements.
+    void ColorConversion::RotateComponents(
+        const uint32_t* const source_colors,
+        const std::size_t color_count,
+        const uint32_t source_alpha_mask,
+        const ColorFormat source_color_format,
+        const ColorFormat destination_color_format,
+        uint32_t* const destination_colors)
+    {
+        // DETERMINE HOW TO ROTATE COMPONENTS TO CONVERT BETWEEN FORMATS.
+        std::optional<ComponentBitShifts> source_bit_shifts = GetComponentBitShifts(source_color_format);
+        std::optional<ComponentBitShifts> destination_bit_shifts = GetComponentBitShifts(destination_color_format);
+        bool formats_supported = (source_bit_shifts && destination_bit_shifts);
+        if (!formats_supported)
+        {
+            std::fill_n(destination_colors, color_count, Color::BLACK.Pack(destination_color_format));
+            return;
+        }
+        constexpr int BITS_PER_PACKED_COLOR = 32;
+        int left_rotation_in_bits = (destination_bit_shifts->Red - source_bit_shifts->Red + BITS_PER_PACKED_COLOR) % BITS_PER_PACKED_COLOR;
+        int right_rotation_in_bits = (BITS_PER_PACKED_COLOR - left_rotation_in_bits) % BITS_PER_PACKED_COLOR;
+
+        std::size_t color_index = 0;
+
+#if MATH_SIMD_SSE2
+        // CONVERT GROUPS OF 4 COLORS AT A TIME.
+        const __m128i ALPHA_MASK = _mm_set1_epi32(static_cast<int>(source_alpha_mask));
+        const __m128i LEFT_ROTATION = _mm_cvtsi32_si128(left_rotation_in_bits);
+        const __m128i RIGHT_ROTATION = _mm_cvtsi32_si128(right_rotation_in_bits);
+        constexpr std::size_t COLORS_PER_GROUP = 4;
+        for (; color_index + COLORS_PER_GROUP <= color_count; color_index += COLORS_PER_GROUP)
+        {
+            __m128i source_group = _mm_or_si128(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(source_colors + color_index)),
+                ALPHA_MASK);
+            __m128i destination_group = _mm_or_si128(
+                _mm_sll_epi32(source_group, LEFT_ROTATION),
+                _mm_srl_epi32(source_group, RIGHT_ROTATION));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination_colors + color_index), destination_group);
+        }
+#endif
+
+        // CONVERT ANY REMAINING COLORS INDIVIDUALLY.
+        for (; color_index < color_count; ++color_index)
+        {
+            uint32_t source_color = source_colors[color_index] | source_alpha_mask;
+            destination_colors[color_index] = (source_color << left_rotation_in_bits) | (source_color >> right_rotation_in_bits);
+        }
+    }
+}
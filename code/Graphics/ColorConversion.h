@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include "Graphics/Color.h"
+#include "Graphics/ColorFormat.h"
+
+namespace GRAPHICS
+{
+    /// Converts many colors at once between floating-point and packed 32-bit formats.
+    /// Converting colors one at a time via Color::Pack() and Color::Unpack() can become
+    /// a noticeable fraction of per-pixel cost, so these batch conversions process
+    /// several colors per instruction (via SSE2) when possible.  Results are identical
+    /// to converting each color individually, except that out-of-range floating-point
+    /// components are clamped to [0,1] rather than wrapping around when packed.
+    class ColorConversion
+    {
+    public:
+        // PACKING.
+        static void Pack(
+            const float* const reds,
+            const float* const greens,
+            const float* const blues,
+            const float* const alphas,
+            const std::size_t color_count,
+            const ColorFormat color_format,
+            uint32_t* const packed_colors);
+        static void Pack(
+            const Color* const colors,
+            const std::size_t color_count,
+            const ColorFormat color_format,
+            uint32_t* const packed_colors);
+
+        // UNPACKING.
+        static void Unpack(
+            const uint32_t* const packed_colors,
+            const std::size_t color_count,
+            const ColorFormat color_format,
+            Color* const colors);
+
+        // REFORMATTING.
+        static void Reformat(
+            const uint32_t* const source_colors,
+            const std::size_t color_count,
+            const ColorFormat source_color_format,
+            const ColorFormat destination_color_format,
+            uint32_t* const destination_colors);
+        static void ReformatBgr(
+            const uint8_t* const source_bytes,
+            const std::size_t color_count,
+            const ColorFormat destination_color_format,
+            uint32_t* const destination_colors);
+        static void ReformatBgra(
+            const uint8_t* const source_bytes,
+            const std::size_t color_count,
+            const bool source_has_alpha,
+            const ColorFormat destination_color_format,
+            uint32_t* const destination_colors);
+
+        // YUV CONVERSION.
+        static void ConvertToYuv(
+            const uint32_t* const source_colors,
+            const std::size_t color_count,
+            const ColorFormat source_color_format,
+            uint8_t* const lumas,
+            uint8_t* const blue_chromas,
+            uint8_t* const red_chromas);
+
+    private:
+        /// The bit positions of each color component within a packed color.
+        struct ComponentBitShifts
+        {
+            /// The number of bits the red component is shifted left by.
+            int Red = 0;
+            /// The number of bits the green component is shifted left by.
+            int Green = 0;
+            /// The number of bits the blue component is shifted left by.
+            int Blue = 0;
+            /// The number of bits the alpha component is shifted left by.
+            int Alpha = 0;
+        };
+
+        // HELPER METHODS.
+        static std::optional<ComponentBitShifts> GetComponentBitShifts(const ColorFormat color_format);
+        static void RotateComponents(
+            const uint32_t* const source_colors,
+            const std::size_t color_count,
+            const uint32_t source_alpha_mask,
+            const ColorFormat source_color_format,
+            const ColorFormat destination_color_format,
+            uint32_t* const destination_colors);
+    };
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace GRAPHICS
+{
+    /// The different ways depth testing can be performed when rasterizing.
+    enum class DepthTestMode
+    {
+        /// No depth testing is performed; later pixels always overwrite earlier pixels.
+        DISABLED = 0,
+        /// Pixels are only written if they're at least as close to the camera as
+        /// what's already in the depth buffer (greater depth values are closer).
+        ENABLED,
+        /// An extra enum to indicate the number of different depth test modes.
+        COUNT
+    };
+}
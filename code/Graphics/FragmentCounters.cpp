@@ -0,0 +1,81 @@
+#include <algorithm>
+#include "Graphics/FragmentCounters.h"
+
+namespace GRAPHICS
+{
+    /// Constructor that starts with all counts at zero.
+    /// @param[in]  width_in_pixels - The width of the render target whose fragments are counted.
+    /// @param[in]  height_in_pixels - The height of the render target whose fragments are counted.
+    FragmentCounters::FragmentCounters(const unsigned int width_in_pixels, const unsigned int height_in_pixels) :
+        TestedFragmentCounts(width_in_pixels, height_in_pixels),
+        DepthPassedFragmentCounts(width_in_pixels, height_in_pixels),
+        ShadedFragmentCounts(width_in_pixels, height_in_pixels)
+    {}
+
+    /// Resets all counts to zero.
+    void FragmentCounters::Clear()
+    {
+        TestedFragmentCounts.Fill(0);
+        DepthPassedFragmentCounts.Fill(0);
+        ShadedFragmentCounts.Fill(0);
+    }
+
+    /// Counts a fragment covering a pixel that reached depth testing.
+    /// When rasterizing without depth testing, fragments should be counted as passing.
+    /// @param[in]  x - The horizontal coordinate of the pixel.
+    /// @param[in]  y - The vertical coordinate of the pixel.
+    /// @param[in]  depth_passed - True if the fragment passed depth testing; false if it was hidden.
+    void FragmentCounters::CountDepthTest(const unsigned int x, const unsigned int y, const bool depth_passed)
+    {
+        // MAKE SURE THE PIXEL COORDINATES ARE VALID.
+        bool pixel_coordinates_valid = TestedFragmentCounts.IndicesInRange(x, y);
+        if (!pixel_coordinates_valid)
+        {
+            return;
+        }
+
+        // COUNT THE FRAGMENT.
+        ++TestedFragmentCounts(x, y);
+        if (depth_passed)
+        {
+            ++DepthPassedFragmentCounts(x, y);
+        }
+    }
+
+    /// Counts a fragment whose color was computed and written to a pixel.
+    /// @param[in]  x - The horizontal coordinate of the pixel.
+    /// @param[in]  y - The vertical coordinate of the pixel.
+    void FragmentCounters::CountShadedFragment(const unsigned int x, const unsigned int y)
+    {
+        // MAKE SURE THE PIXEL COORDINATES ARE VALID.
+        bool pixel_coordinates_valid = ShadedFragmentCounts.IndicesInRange(x, y);
+        if (!pixel_coordinates_valid)
+        {
+            return;
+        }
+
+        // COUNT THE FRAGMENT.
+        ++ShadedFragmentCounts(x, y);
+    }
+
+    /// Gets the counts summed across all pixels.
+    /// @return The total counts.
+    FragmentCounters::Totals FragmentCounters::GetTotals() const
+    {
+        Totals totals;
+        unsigned int width_in_pixels = TestedFragmentCounts.GetWidth();
+        unsigned int height_in_pixels = TestedFragmentCounts.GetHeight();
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                uint32_t tested_fragment_count = TestedFragmentCounts(x, y);
+                totals.TestedFragmentCount += tested_fragment_count;
+                totals.DepthPassedFragmentCount += DepthPassedFragmentCounts(x, y);
+                totals.ShadedFragmentCount += ShadedFragmentCounts(x, y);
+                totals.MaxTestedFragmentCountPerPixel = std::max(totals.MaxTestedFragmentCountPerPixel, tested_fragment_count);
+            }
+        }
+        return totals;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include "Containers/Array2D.h"
+
+namespace GRAPHICS
+{
+    /// Per-pixel counts of fragments processed when rasterizing, for diagnosing overdraw.
+    /// Pixels with many more tested fragments than shaded fragments indicate work wasted
+    /// on hidden geometry, and pixels shaded many times indicate geometry drawn back-to-front.
+    class FragmentCounters
+    {
+    public:
+        /// Counts of fragments across all pixels.
+        struct Totals
+        {
+            /// The number of fragments covered by triangles that reached depth testing.
+            uint64_t TestedFragmentCount = 0;
+            /// The number of fragments that passed depth testing.
+            uint64_t DepthPassedFragmentCount = 0;
+            /// The number of fragments whose colors were computed and written.
+            uint64_t ShadedFragmentCount = 0;
+            /// The maximum number of fragments tested for any single pixel.
+            uint32_t MaxTestedFragmentCountPerPixel = 0;
+        };
+
+        // CONSTRUCTION.
+        explicit FragmentCounters(const unsigned int width_in_pixels, const unsigned int height_in_pixels);
+
+        // COUNTING.
+        void Clear();
+        void CountDepthTest(const unsigned int x, const unsigned int y, const bool depth_passed);
+        void CountShadedFragment(const unsigned int x, const unsigned int y);
+
+        // TOTALS.
+        Totals GetTotals() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The number of fragments covered by triangles that reached depth testing for each pixel.
+        /// Without depth testing, all covered fragments are counted as tested.
+        CONTAINERS::Array2D<uint32_t> TestedFragmentCounts;
+        /// The number of fragments that passed depth testing for each pixel.
+        CONTAINERS::Array2D<uint32_t> DepthPassedFragmentCounts;
+        /// The number of fragments whose colors were computed and written for each pixel.
+        /// Depth testing happens before shading, so this currently matches depth-passed fragments
+        /// when depth testing is enabled, but it's counted separately so pipeline changes are visible.
+        CONTAINERS::Array2D<uint32_t> ShadedFragmentCounts;
+    };
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace GRAPHICS
+{
+    /// The different ways fragments can be counted when rasterizing.
+    enum class FragmentCountingMode
+    {
+        /// No fragments are counted, so rasterization has no extra overhead.
+        DISABLED = 0,
+        /// Fragments are counted per pixel for diagnosing how much work each pixel takes.
+        ENABLED,
+        /// An extra enum to indicate the number of different fragment counting modes.
+        COUNT
+    };
+}
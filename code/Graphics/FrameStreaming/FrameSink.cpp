@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <chrono>
+#include "Graphics/FrameStreaming/FrameSink.h"
+
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// Constructor.  Starts the background writing thread.
+    /// @param[in,out]  encoder - The encoder for converting frames to bytes to write.
+    /// @param[in,out]  output_stream - The stream to write frames to.  Must remain valid until the sink
+    ///     is destroyed.  Should be opened in binary mode.
+    /// @param[in]  buffer_count - The number of frames that may be waiting to be written at once (at least 1).
+    FrameSink::FrameSink(
+        std::unique_ptr<IFrameEncoder>&& encoder,
+        std::ostream& output_stream,
+        const std::size_t buffer_count) :
+        Encoder(std::move(encoder)),
+        OutputStream(&output_stream)
+    {
+        // CREATE THE BUFFERS.
+        // Their pixels are only allocated once frame dimensions are known.
+        std::size_t valid_buffer_count = std::max<std::size_t>(buffer_count, 1);
+        Buffers.resize(valid_buffer_count);
+        for (std::size_t buffer_index = 0; buffer_index < valid_buffer_count; ++buffer_index)
+        {
+            FreeBufferIndices.push_back(buffer_index);
+        }
+
+        // START WRITING.
+        Writer = std::thread(&FrameSink::RunWriter, this);
+    }
+
+    /// Destructor.  Waits for all queued frames to be written.
+    FrameSink::~FrameSink()
+    {
+        Finish();
+
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            Stopping = true;
+        }
+        FrameQueued.notify_all();
+        Writer.join();
+    }
+
+    /// Submits a frame to be written in the background.
+    /// @param[in]  frame - The frame to write, which is copied so that it can be immediately reused.
+    /// @param[in]  wait_for_free_buffer - True to wait for a buffer to be written if all are
+    ///     in use (so no frames are dropped); false to return immediately in that case.
+    /// @return The result of submitting the frame.  Back-pressure is only returned if not waiting.
+    FrameSubmissionResult FrameSink::Submit(const Bitmap& frame, const bool wait_for_free_buffer)
+    {
+        // GET A FREE BUFFER.
+        std::unique_lock<std::mutex> lock(Mutex);
+        if (Failed)
+        {
+            return FrameSubmissionResult::FAILED;
+        }
+        bool consumer_falling_behind = FreeBufferIndices.empty();
+        if (consumer_falling_behind)
+        {
+            ++CurrentStatistics.BackPressureCount;
+            if (!wait_for_free_buffer)
+            {
+                return FrameSubmissionResult::BACK_PRESSURE;
+            }
+
+            auto wait_start_time = std::chrono::steady_clock::now();
+            FrameWritten.wait(lock, [this]() { return Failed || !FreeBufferIndices.empty(); });
+            std::chrono::duration<double, std::milli> wait_time = std::chrono::steady_clock::now() - wait_start_time;
+            CurrentStatistics.BackPressureWaitTimeInMilliseconds += wait_time.count();
+            if (Failed)
+            {
+                return FrameSubmissionResult::FAILED;
+            }
+        }
+        std::size_t buffer_index = FreeBufferIndices.front();
+        FreeBufferIndices.pop_front();
+        lock.unlock();
+
+        // COPY THE FRAME INTO THE BUFFER.
+        // The lock isn't needed since the writer thread never accesses free buffers,
+        // and the buffer is only reallocated if the frame dimensions or format changed.
+        std::unique_ptr<Bitmap>& buffer = Buffers[buffer_index];
+        bool buffer_matches_frame = buffer &&
+            (buffer->GetWidthInPixels() == frame.GetWidthInPixels()) &&
+            (buffer->GetHeightInPixels() == frame.GetHeightInPixels()) &&
+            (buffer->GetColorFormat() == frame.GetColorFormat());
+        if (!buffer_matches_frame)
+        {
+            buffer = std::make_unique<Bitmap>(frame.GetWidthInPixels(), frame.GetHeightInPixels(), frame.GetColorFormat());
+        }
+        std::size_t pixel_count = static_cast<std::size_t>(frame.GetWidthInPixels()) * frame.GetHeightInPixels();
+        std::copy_n(frame.GetRawData(), pixel_count, buffer->GetRawData());
+
+        // QUEUE THE BUFFER TO BE WRITTEN.
+        lock.lock();
+        QueuedBufferIndices.push_back(buffer_index);
+        ++CurrentStatistics.SubmittedFrameCount;
+        lock.unlock();
+        FrameQueued.notify_one();
+        return FrameSubmissionResult::QUEUED;
+    }
+
+    /// Waits for all queued frames to be written and flushes the output stream.
+    /// @return True if all frames so far were successfully written; false otherwise.
+    bool FrameSink::Finish()
+    {
+        // WAIT FOR ALL FRAMES TO BE WRITTEN.
+        std::unique_lock<std::mutex> lock(Mutex);
+        FrameWritten.wait(lock, [this]() { return QueuedBufferIndices.empty() && !Writing; });
+
+        // FLUSH THE OUTPUT.
+        // The writer thread is idle, so the stream can safely be accessed here.
+        OutputStream->flush();
+        if (!*OutputStream)
+        {
+            Failed = true;
+        }
+
+        return !Failed;
+    }
+
+    /// Gets statistics about writing frames.
+    /// @return The current statistics.
+    FrameSink::Statistics FrameSink::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        return CurrentStatistics;
+    }
+
+    /// Encodes and writes queued frames until the sink is stopped.
+    void FrameSink::RunWriter()
+    {
+        // The encoded bytes are reused for all frames to avoid repeated allocations.
+        std::vector<uint8_t> encoded_bytes;
+        while (true)
+        {
+            // WAIT FOR A FRAME TO WRITE.
+            std::unique_lock<std::mutex> lock(Mutex);
+            FrameQueued.wait(lock, [this]() { return Stopping || !QueuedBufferIndices.empty(); });
+            if (QueuedBufferIndices.empty())
+            {
+                return;
+            }
+            std::size_t buffer_index = QueuedBufferIndices.front();
+            QueuedBufferIndices.pop_front();
+            Writing = true;
+            bool already_failed = Failed;
+            lock.unlock();
+
+            // ENCODE AND WRITE THE FRAME.
+            // Frames after a failure are discarded since the stream would likely be corrupt.
+            bool frame_written = false;
+            if (!already_failed)
+            {
+                encoded_bytes.clear();
+                bool frame_encoded = Encoder->Encode(*Buffers[buffer_index], encoded_bytes);
+                if (frame_encoded)
+                {
+                    OutputStream->write(reinterpret_cast<const char*>(encoded_bytes.data()), static_cast<std::streamsize>(encoded_bytes.size()));
+                    frame_written = static_cast<bool>(*OutputStream);
+                }
+            }
+
+            // RETURN THE BUFFER FOR REUSE.
+            lock.lock();
+            FreeBufferIndices.push_back(buffer_index);
+            Writing = false;
+            if (frame_written)
+            {
+                ++CurrentStatistics.WrittenFrameCount;
+                CurrentStatistics.WrittenSizeInBytes += encoded_bytes.size();
+            }
+            else
+            {
+                Failed = true;
+            }
+            lock.unlock();
+            FrameWritten.notify_all();
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+#include "Graphics/Bitmap.h"
+#include "Graphics/FrameStreaming/IFrameEncoder.h"
+
+/// Holds code for streaming rendered frames to other programs (like video encoders) without intermediate files.
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// The result of submitting a frame to a sink.
+    enum class FrameSubmissionResult
+    {
+        /// The frame was copied and will be written in the background.
+        QUEUED = 0,
+        /// All buffers are still waiting to be written because the consumer is falling behind,
+        /// so the frame wasn't queued.  The caller can drop the frame or retry later.
+        BACK_PRESSURE,
+        /// An earlier frame failed to be encoded or written, so no more frames are accepted.
+        FAILED
+    };
+
+    /// Continuously writes rendered frames to an output stream (like a file, pipe, or standard output)
+    /// in a format determined by an encoder.
+    ///
+    /// Frames are copied into a small ring of reused buffers and then encoded and written on
+    /// a background thread, so rendering never waits on I/O unless explicitly requested.
+    /// When all buffers are waiting to be written, the consumer isn't keeping up, which is
+    /// reported as back-pressure when submitting frames and counted in the statistics.
+    ///
+    /// Frames should only be submitted from a single thread at a time.
+    class FrameSink
+    {
+    public:
+        /// Statistics about how well the consumer is keeping up.
+        struct Statistics
+        {
+            /// The number of frames queued to be written.
+            uint64_t SubmittedFrameCount = 0;
+            /// The number of frames successfully written.
+            uint64_t WrittenFrameCount = 0;
+            /// The number of submissions that found all buffers waiting to be written.
+            uint64_t BackPressureCount = 0;
+            /// The total time submissions spent waiting for buffers to be written.
+            double BackPressureWaitTimeInMilliseconds = 0.0;
+            /// The total bytes successfully written.
+            uint64_t WrittenSizeInBytes = 0;
+        };
+
+        // CONSTRUCTION/DESTRUCTION.
+        explicit FrameSink(
+            std::unique_ptr<IFrameEncoder>&& encoder,
+            std::ostream& output_stream,
+            const std::size_t buffer_count = 3);
+        ~FrameSink();
+        FrameSink(const FrameSink&) = delete;
+        FrameSink& operator=(const FrameSink&) = delete;
+
+        // WRITING.
+        FrameSubmissionResult Submit(const Bitmap& frame, const bool wait_for_free_buffer = false);
+        bool Finish();
+
+        // STATISTICS.
+        Statistics GetStatistics() const;
+
+    private:
+        // HELPER METHODS.
+        void RunWriter();
+
+        // MEMBER VARIABLES.
+        /// The encoder for frames, only used on the writer thread.
+        std::unique_ptr<IFrameEncoder> Encoder = nullptr;
+        /// The stream frames are written to, only used on the writer thread (except when finishing).
+        std::ostream* OutputStream = nullptr;
+        /// Protects access to all member variables below.
+        mutable std::mutex Mutex = {};
+        /// Signaled when a frame is queued or the sink is stopping.
+        std::condition_variable FrameQueued = {};
+        /// Signaled when a frame has been written (or failed to be written).
+        std::condition_variable FrameWritten = {};
+        /// The ring of frame buffers, reused for many frames.
+        std::vector<std::unique_ptr<Bitmap>> Buffers = {};
+        /// Indices of buffers available to copy frames into.
+        std::deque<std::size_t> FreeBufferIndices = {};
+        /// Indices of buffers waiting to be written, in the order submitted.
+        std::deque<std::size_t> QueuedBufferIndices = {};
+        /// True while the writer thread is encoding or writing a frame.
+        bool Writing = false;
+        /// True once encoding or writing any frame has failed.
+        bool Failed = false;
+        /// True once the sink is being destroyed.
+        bool Stopping = false;
+        /// Statistics about writing frames.
+        Statistics CurrentStatistics = {};
+        /// The thread that encodes and writes frames.
+        std::thread Writer = {};
+    };
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Graphics/Bitmap.h"
+
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// An interface for converting rendered frames into bytes of a specific streaming format.
+    /// Encoders are only used from a single thread at a time, so they may keep state
+    /// between frames (like whether a stream header has been written yet).
+    class IFrameEncoder
+    {
+    public:
+        /// Defaulted destructor to allow instantiation in unique pointers.
+        virtual ~IFrameEncoder() = default;
+
+        /// Encodes a frame into bytes to be written to the stream.
+        /// @param[in]  frame - The frame to encode.
+        /// @param[in,out]  encoded_bytes - The bytes to write for the frame, which are appended
+        ///     to any existing bytes.  Reused between frames to avoid repeated allocations.
+        /// @return True if the frame was encoded; false if the frame can't be encoded (like
+        ///     if its dimensions differ from earlier frames in formats that require fixed dimensions).
+        virtual bool Encode(const Bitmap& frame, std::vector<uint8_t>& encoded_bytes) = 0;
+    };
+}
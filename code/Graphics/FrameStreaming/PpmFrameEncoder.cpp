@@ -0,0 +1,44 @@
+#include <string>
+#include "Graphics/ColorConversion.h"
+#include "Graphics/FrameStreaming/PpmFrameEncoder.h"
+
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// Encodes a frame as a binary PPM image.
+    /// @param[in]  frame - The frame to encode.
+    /// @param[in,out]  encoded_bytes - The bytes to write for the frame, which are appended to.
+    /// @return True; PPM images can always be encoded.
+    bool PpmFrameEncoder::Encode(const Bitmap& frame, std::vector<uint8_t>& encoded_bytes)
+    {
+        // WRITE THE HEADER.
+        unsigned int width_in_pixels = frame.GetWidthInPixels();
+        unsigned int height_in_pixels = frame.GetHeightInPixels();
+        constexpr unsigned int MAX_COMPONENT_VALUE = 255;
+        std::string header = "P6\n" + std::to_string(width_in_pixels) + " " + std::to_string(height_in_pixels) + "\n" + std::to_string(MAX_COMPONENT_VALUE) + "\n";
+        encoded_bytes.insert(encoded_bytes.end(), header.cbegin(), header.cend());
+
+        // MAKE ROOM FOR THE PIXELS.
+        constexpr std::size_t BYTES_PER_PIXEL = 3;
+        std::size_t start_byte_index = encoded_bytes.size();
+        encoded_bytes.resize(start_byte_index + BYTES_PER_PIXEL * width_in_pixels * height_in_pixels);
+        RgbaRow.resize(width_in_pixels);
+
+        // WRITE EACH ROW OF PIXELS.
+        // Pixels are first converted to RGBA so that each component is at a known position.
+        const uint32_t* frame_pixels = frame.GetRawData();
+        uint8_t* pixel_bytes = encoded_bytes.data() + start_byte_index;
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            ColorConversion::Reformat(frame_pixels + y * width_in_pixels, width_in_pixels, frame.GetColorFormat(), ColorFormat::RGBA, RgbaRow.data());
+            for (uint32_t rgba_color : RgbaRow)
+            {
+                pixel_bytes[0] = static_cast<uint8_t>(rgba_color >> 24);
+                pixel_bytes[1] = static_cast<uint8_t>(rgba_color >> 16);
+                pixel_bytes[2] = static_cast<uint8_t>(rgba_color >> 8);
+                pixel_bytes += BYTES_PER_PIXEL;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Graphics/FrameStreaming/IFrameEncoder.h"
+
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// Encodes frames as a sequence of binary PPM images (https://netpbm.sourceforge.net/doc/ppm.html),
+    /// each with its own header and 3 bytes per pixel (red, green, blue).  Alpha is discarded.
+    /// Since each image describes its own dimensions, the stream can be consumed without any
+    /// extra information (for example, via "ffmpeg -f image2pipe -c:v ppm -i -").
+    class PpmFrameEncoder : public IFrameEncoder
+    {
+    public:
+        // ENCODING.
+        bool Encode(const Bitmap& frame, std::vector<uint8_t>& encoded_bytes) override;
+
+    private:
+        // MEMBER VARIABLES.
+        /// A row of pixels converted to the RGBA color format, reused between rows.
+        std::vector<uint32_t> RgbaRow = {};
+    };
+}
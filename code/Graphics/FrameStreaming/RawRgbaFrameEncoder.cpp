@@ -0,0 +1,39 @@
+#include "Graphics/ColorConversion.h"
+#include "Graphics/FrameStreaming/RawRgbaFrameEncoder.h"
+
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// Encodes a frame as raw RGBA bytes.
+    /// @param[in]  frame - The frame to encode.
+    /// @param[in,out]  encoded_bytes - The bytes to write for the frame, which are appended to.
+    /// @return True; raw frames can always be encoded.
+    bool RawRgbaFrameEncoder::Encode(const Bitmap& frame, std::vector<uint8_t>& encoded_bytes)
+    {
+        // MAKE ROOM FOR THE PIXELS.
+        unsigned int width_in_pixels = frame.GetWidthInPixels();
+        unsigned int height_in_pixels = frame.GetHeightInPixels();
+        constexpr std::size_t BYTES_PER_PIXEL = 4;
+        std::size_t start_byte_index = encoded_bytes.size();
+        encoded_bytes.resize(start_byte_index + BYTES_PER_PIXEL * width_in_pixels * height_in_pixels);
+        RgbaRow.resize(width_in_pixels);
+
+        // WRITE EACH ROW OF PIXELS.
+        // Pixels are first converted to RGBA so that each component is at a known position.
+        const uint32_t* frame_pixels = frame.GetRawData();
+        uint8_t* pixel_bytes = encoded_bytes.data() + start_byte_index;
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            ColorConversion::Reformat(frame_pixels + y * width_in_pixels, width_in_pixels, frame.GetColorFormat(), ColorFormat::RGBA, RgbaRow.data());
+            for (uint32_t rgba_color : RgbaRow)
+            {
+                pixel_bytes[0] = static_cast<uint8_t>(rgba_color >> 24);
+                pixel_bytes[1] = static_cast<uint8_t>(rgba_color >> 16);
+                pixel_bytes[2] = static_cast<uint8_t>(rgba_color >> 8);
+                pixel_bytes[3] = static_cast<uint8_t>(rgba_color);
+                pixel_bytes += BYTES_PER_PIXEL;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Graphics/FrameStreaming/IFrameEncoder.h"
+
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// Encodes frames as raw pixels with 4 bytes per pixel in red, green, blue, alpha order,
+    /// starting from the top-left pixel without any headers or padding.  This is the simplest
+    /// format to consume (for example, via "ffmpeg -f rawvideo -pix_fmt rgba -s <width>x<height> -i -"),
+    /// but consumers must know the frame dimensions in advance.
+    class RawRgbaFrameEncoder : public IFrameEncoder
+    {
+    public:
+        // ENCODING.
+        bool Encode(const Bitmap& frame, std::vector<uint8_t>& encoded_bytes) override;
+
+    private:
+        // MEMBER VARIABLES.
+        /// A row of pixels converted to the RGBA color format, reused between rows.
+        std::vector<uint32_t> RgbaRow = {};
+    };
+}
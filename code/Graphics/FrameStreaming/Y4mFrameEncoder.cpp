@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <string>
+#include "Graphics/ColorConversion.h"
+#include "Graphics/FrameStreaming/Y4mFrameEncoder.h"
+
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// Constructor.
+    /// @param[in]  frames_per_second - The frame rate to indicate in the stream header.
+    Y4mFrameEncoder::Y4mFrameEncoder(const unsigned int frames_per_second) :
+        FramesPerSecond(frames_per_second)
+    {}
+
+    /// Encodes a frame in the YUV4MPEG2 format, preceded by the stream header for the first frame.
+    /// @param[in]  frame - The frame to encode.
+    /// @param[in,out]  encoded_bytes - The bytes to write for the frame, which are appended to.
+    /// @return True if the frame was encoded; false if its dimensions differ from the first frame.
+    bool Y4mFrameEncoder::Encode(const Bitmap& frame, std::vector<uint8_t>& encoded_bytes)
+    {
+        // WRITE THE STREAM HEADER IF THIS IS THE FIRST FRAME.
+        unsigned int width_in_pixels = frame.GetWidthInPixels();
+        unsigned int height_in_pixels = frame.GetHeightInPixels();
+        if (!WidthInPixels || !HeightInPixels)
+        {
+            WidthInPixels = width_in_pixels;
+            HeightInPixels = height_in_pixels;
+            std::string stream_header =
+                "YUV4MPEG2 W" + std::to_string(width_in_pixels) +
+                " H" + std::to_string(height_in_pixels) +
+                " F" + std::to_string(FramesPerSecond) + ":1 Ip A1:1 C420jpeg\n";
+            encoded_bytes.insert(encoded_bytes.end(), stream_header.cbegin(), stream_header.cend());
+        }
+
+        // VERIFY THE FRAME MATCHES THE STREAM DIMENSIONS.
+        bool dimensions_match = (*WidthInPixels == width_in_pixels) && (*HeightInPixels == height_in_pixels);
+        if (!dimensions_match)
+        {
+            return false;
+        }
+
+        // WRITE THE FRAME HEADER.
+        const std::string FRAME_HEADER = "FRAME\n";
+        encoded_bytes.insert(encoded_bytes.end(), FRAME_HEADER.cbegin(), FRAME_HEADER.cend());
+
+        // MAKE ROOM FOR EACH PLANE.
+        // Odd dimensions are rounded up for chroma so that edge pixels still have chroma.
+        std::size_t luma_plane_size_in_bytes = static_cast<std::size_t>(width_in_pixels) * height_in_pixels;
+        unsigned int chroma_width_in_pixels = (width_in_pixels + 1) / 2;
+        unsigned int chroma_height_in_pixels = (height_in_pixels + 1) / 2;
+        std::size_t chroma_plane_size_in_bytes = static_cast<std::size_t>(chroma_width_in_pixels) * chroma_height_in_pixels;
+        std::size_t luma_plane_start_index = encoded_bytes.size();
+        encoded_bytes.resize(luma_plane_start_index + luma_plane_size_in_bytes + 2 * chroma_plane_size_in_bytes);
+        uint8_t* luma_plane = encoded_bytes.data() + luma_plane_start_index;
+        uint8_t* blue_chroma_plane = luma_plane + luma_plane_size_in_bytes;
+        uint8_t* red_chroma_plane = blue_chroma_plane + chroma_plane_size_in_bytes;
+        for (std::size_t row_index = 0; row_index < BlueChromaRows.size(); ++row_index)
+        {
+            BlueChromaRows[row_index].resize(width_in_pixels);
+            RedChromaRows[row_index].resize(width_in_pixels);
+        }
+
+        // CONVERT EACH PAIR OF ROWS.
+        const uint32_t* frame_pixels = frame.GetRawData();
+        for (unsigned int chroma_y = 0; chroma_y < chroma_height_in_pixels; ++chroma_y)
+        {
+            // CONVERT THE FULL-RESOLUTION ROWS.
+            // Lumas are written directly to the plane, while chromas are kept for averaging.
+            // The last row of an odd-height frame is paired with itself.
+            for (unsigned int row_index = 0; row_index < 2; ++row_index)
+            {
+                unsigned int y = std::min(2 * chroma_y + row_index, height_in_pixels - 1);
+                ColorConversion::ConvertToYuv(
+                    frame_pixels + static_cast<std::size_t>(y) * width_in_pixels,
+                    width_in_pixels,
+                    frame.GetColorFormat(),
+                    luma_plane + static_cast<std::size_t>(y) * width_in_pixels,
+                    BlueChromaRows[row_index].data(),
+                    RedChromaRows[row_index].data());
+            }
+
+            // AVERAGE CHROMA OVER EACH 2x2 BLOCK.
+            uint8_t* blue_chroma_row = blue_chroma_plane + static_cast<std::size_t>(chroma_y) * chroma_width_in_pixels;
+            uint8_t* red_chroma_row = red_chroma_plane + static_cast<std::size_t>(chroma_y) * chroma_width_in_pixels;
+            for (unsigned int chroma_x = 0; chroma_x < chroma_width_in_pixels; ++chroma_x)
+            {
+                unsigned int left_x = 2 * chroma_x;
+                unsigned int right_x = std::min(left_x + 1, width_in_pixels - 1);
+                constexpr unsigned int ROUNDING = 2;
+                blue_chroma_row[chroma_x] = static_cast<uint8_t>((
+                    BlueChromaRows[0][left_x] + BlueChromaRows[0][right_x] +
+                    BlueChromaRows[1][left_x] + BlueChromaRows[1][right_x] + ROUNDING) / 4);
+                red_chroma_row[chroma_x] = static_cast<uint8_t>((
+                    RedChromaRows[0][left_x] + RedChromaRows[0][right_x] +
+                    RedChromaRows[1][left_x] + RedChromaRows[1][right_x] + ROUNDING) / 4);
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "Graphics/FrameStreaming/IFrameEncoder.h"
+
+namespace GRAPHICS::FRAME_STREAMING
+{
+    /// Encodes frames as a YUV4MPEG2 stream (https://wiki.multimedia.cx/index.php/YUV4MPEG2),
+    /// which most video encoders accept directly (for example, via "ffmpeg -i - output.mp4").
+    /// Frames are converted to 4:2:0 YUV (BT.601, limited range), with chroma averaged over
+    /// each 2x2 block of pixels.  All frames must have the same dimensions as the first frame,
+    /// since they're only specified once in the stream header.
+    class Y4mFrameEncoder : public IFrameEncoder
+    {
+    public:
+        // CONSTRUCTION.
+        explicit Y4mFrameEncoder(const unsigned int frames_per_second = 30);
+
+        // ENCODING.
+        bool Encode(const Bitmap& frame, std::vector<uint8_t>& encoded_bytes) override;
+
+    private:
+        // MEMBER VARIABLES.
+        /// The frame rate written in the stream header.
+        unsigned int FramesPerSecond = 30;
+        /// The width of all frames, once the stream header has been written.
+        std::optional<unsigned int> WidthInPixels = std::nullopt;
+        /// The height of all frames, once the stream header has been written.
+        std::optional<unsigned int> HeightInPixels = std::nullopt;
+        /// Full-resolution blue-difference chromas for a pair of rows, reused between rows.
+        std::array<std::vector<uint8_t>, 2> BlueChromaRows = {};
+        /// Full-resolution red-difference chromas for a pair of rows, reused between rows.
+        std::array<std::vector<uint8_t>, 2> RedChromaRows = {};
+    };
+}
@@ -1,3 +1,4 @@
+#include "Benchmarking/Profiler.h"
 #include "Graphics/FrameTimer.h"
 
 namespace GRAPHICS
@@ -9,9 +10,11 @@ namespace GRAPHICS
     }
 
     /// Sets the current time as the ending timing measurement for the frame.
+    /// Also ends the frame for any profiling, so that per-zone statistics line up with frames.
     void FrameTimer::EndTimingFrame()
     {
         FrameEndTime = ClockType::now();
+        PROFILE_END_FRAME();
     }
 
     /// Gets some display text regarding frame timing measurements that can be useful for debugging.
@@ -1,3 +1,4 @@
+#include <Windows.h>
 #include "Graphics/Gui/Font.h"
 
 namespace GRAPHICS::GUI
@@ -2,7 +2,6 @@
 
 #include <array>
 #include <memory>
-#include <Windows.h>
 #include "Graphics/Bitmap.h"
 #include "Graphics/Gui/Glyph.h"
 
@@ -2,7 +2,7 @@
 
 #include "Graphics/Bitmap.h"
 #include "Graphics/Color.h"
-#include "MATH/Vector2.h"
+#include "Math/Vector2.h"
 
 namespace GRAPHICS::GUI
 {
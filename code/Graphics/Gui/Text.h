@@ -14,7 +14,7 @@ namespace GRAPHICS::GUI
         /// The string of characters for the text.
         std::string String = "";
         /// The font to use for rendering the text.
-        Font* Font = nullptr;
+        GRAPHICS::GUI::Font* Font = nullptr;
         /// The left, top (x, y) screen position at which the text should be rendered.
         MATH::Vector2f LeftTopPosition = MATH::Vector2f(0.0f, 0.0f);
     };
@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include "Graphics/Heatmap.h"
+
+namespace GRAPHICS
+{
+    /// Creates a heatmap scaled to the largest count.
+    /// @param[in]  counts - The count for each pixel.
+    /// @return The heatmap, with the same dimensions as the counts.
+    Bitmap Heatmap::Create(const CONTAINERS::Array2D<uint32_t>& counts)
+    {
+        const uint32_t* counts_begin = counts.ValuesInRowMajorOrder();
+        const uint32_t* counts_end = counts_begin + (static_cast<std::size_t>(counts.GetWidth()) * counts.GetHeight());
+        uint32_t max_count = (counts_begin == counts_end) ? 0 : *std::max_element(counts_begin, counts_end);
+        return Create(counts, max_count);
+    }
+
+    /// Creates a heatmap with a fixed scale, which allows comparing heatmaps for different frames.
+    /// @param[in]  counts - The count for each pixel.
+    /// @param[in]  max_count - The count shown as the hottest color.  Larger counts are clamped to it.
+    /// @return The heatmap, with the same dimensions as the counts.
+    Bitmap Heatmap::Create(const CONTAINERS::Array2D<uint32_t>& counts, const uint32_t max_count)
+    {
+        Bitmap heatmap(counts.GetWidth(), counts.GetHeight(), ColorFormat::RGBA);
+        for (unsigned int y = 0; y < counts.GetHeight(); ++y)
+        {
+            for (unsigned int x = 0; x < counts.GetWidth(); ++x)
+            {
+                Color color = FalseColor(counts(x, y), max_count);
+                heatmap.WritePixel(x, y, color);
+            }
+        }
+        return heatmap;
+    }
+
+    /// Gets the false color for a count.
+    /// @param[in]  count - The count to get the color for.
+    /// @param[in]  max_count - The count shown as the hottest color.  Larger counts are clamped to it.
+    /// @return Black for a count of zero; otherwise, a color from blue (1) to red (max count).
+    Color Heatmap::FalseColor(const uint32_t count, const uint32_t max_count)
+    {
+        // LEAVE PIXELS WITHOUT ANY COUNT BLACK.
+        if (0 == count)
+        {
+            return Color::BLACK;
+        }
+
+        // COMPUTE HOW HOT THE COUNT IS.
+        // A count of 1 is the coldest so that it's distinguishable from a count of 0.
+        float ratio_toward_max = 1.0f;
+        if (max_count > 1)
+        {
+            uint32_t clamped_count = std::min(count, max_count);
+            ratio_toward_max = static_cast<float>(clamped_count - 1) / static_cast<float>(max_count - 1);
+        }
+
+        // INTERPOLATE BETWEEN THE NEAREST COLORS IN THE PALETTE.
+        static const std::array<Color, 5> PALETTE =
+        {
+            Color::BLUE,
+            Color(0.0f, 1.0f, 1.0f, 1.0f),
+            Color::GREEN,
+            Color(1.0f, 1.0f, 0.0f, 1.0f),
+            Color::RED,
+        };
+        constexpr std::size_t LAST_PALETTE_INDEX = PALETTE.size() - 1;
+        float palette_position = ratio_toward_max * static_cast<float>(LAST_PALETTE_INDEX);
+        std::size_t start_palette_index = std::min(static_cast<std::size_t>(palette_position), LAST_PALETTE_INDEX - 1);
+        float ratio_toward_end = palette_position - static_cast<float>(start_palette_index);
+        Color color = Color::InterpolateRedGreenBlue(PALETTE[start_palette_index], PALETTE[start_palette_index + 1], ratio_toward_end);
+        return color;
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include "Containers/Array2D.h"
+#include "Graphics/Bitmap.h"
+#include "Graphics/Color.h"
+
+namespace GRAPHICS
+{
+    /// Visualizes per-pixel counts (like fragments or intersection tests) as false-color images.
+    /// Pixels with no count are black, and other pixels range from blue (fewest) through
+    /// cyan, green, and yellow to red (most), making expensive regions easy to spot.
+    class Heatmap
+    {
+    public:
+        static Bitmap Create(const CONTAINERS::Array2D<uint32_t>& counts);
+        static Bitmap Create(const CONTAINERS::Array2D<uint32_t>& counts, const uint32_t max_count);
+        static Color FalseColor(const uint32_t count, const uint32_t max_count);
+    };
+}
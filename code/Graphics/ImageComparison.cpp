@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include "Graphics/ImageComparison.h"
+
+namespace GRAPHICS
+{
+    /// Gets the largest difference in any red, green, or blue component between two colors.
+    /// @param[in]  expected_color - The expected color.
+    /// @param[in]  actual_color - The actual color.
+    /// @return The largest component difference (from 0 to 255).
+    static uint8_t MaxColorChannelDifference(const Color& expected_color, const Color& actual_color)
+    {
+        int red_difference = std::abs(static_cast<int>(expected_color.GetRedAsUint8()) - static_cast<int>(actual_color.GetRedAsUint8()));
+        int green_difference = std::abs(static_cast<int>(expected_color.GetGreenAsUint8()) - static_cast<int>(actual_color.GetGreenAsUint8()));
+        int blue_difference = std::abs(static_cast<int>(expected_color.GetBlueAsUint8()) - static_cast<int>(actual_color.GetBlueAsUint8()));
+        int max_difference = std::max({ red_difference, green_difference, blue_difference });
+        return static_cast<uint8_t>(max_difference);
+    }
+
+    /// Compares an image against an expected image.  Only red, green, and blue components are compared.
+    /// @param[in]  expected_image - The expected (reference) image.
+    /// @param[in]  actual_image - The image to compare.
+    /// @param[in]  tolerance - How much the images may differ while still matching.
+    /// @return The result of the comparison.
+    ImageComparisonResult ImageComparison::Compare(
+        const Bitmap& expected_image,
+        const Bitmap& actual_image,
+        const ImageComparisonTolerance& tolerance)
+    {
+        // MAKE SURE THE DIMENSIONS MATCH.
+        ImageComparisonResult result;
+        unsigned int width_in_pixels = expected_image.GetWidthInPixels();
+        unsigned int height_in_pixels = expected_image.GetHeightInPixels();
+        result.DimensionsMatch = (
+            (width_in_pixels == actual_image.GetWidthInPixels()) &&
+            (height_in_pixels == actual_image.GetHeightInPixels()));
+        if (!result.DimensionsMatch)
+        {
+            return result;
+        }
+
+        // COMPARE EACH PIXEL.
+        double sum_of_squared_errors = 0.0;
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                Color expected_color = expected_image.GetPixel(x, y);
+                Color actual_color = actual_image.GetPixel(x, y);
+                uint8_t channel_difference = MaxColorChannelDifference(expected_color, actual_color);
+                result.MaxChannelDifference = std::max(result.MaxChannelDifference, channel_difference);
+                if (channel_difference > tolerance.MaxChannelDifference)
+                {
+                    ++result.MismatchedPixelCount;
+                }
+
+                double red_error = static_cast<double>(expected_color.GetRedAsUint8()) - static_cast<double>(actual_color.GetRedAsUint8());
+                double green_error = static_cast<double>(expected_color.GetGreenAsUint8()) - static_cast<double>(actual_color.GetGreenAsUint8());
+                double blue_error = static_cast<double>(expected_color.GetBlueAsUint8()) - static_cast<double>(actual_color.GetBlueAsUint8());
+                sum_of_squared_errors += (red_error * red_error) + (green_error * green_error) + (blue_error * blue_error);
+            }
+        }
+
+        // COMPUTE THE PEAK SIGNAL-TO-NOISE RATIO.
+        constexpr double COMPONENTS_PER_PIXEL = 3.0;
+        double component_count = COMPONENTS_PER_PIXEL * static_cast<double>(width_in_pixels) * static_cast<double>(height_in_pixels);
+        double mean_squared_error = (component_count > 0.0) ? (sum_of_squared_errors / component_count) : 0.0;
+        if (mean_squared_error > 0.0)
+        {
+            constexpr double MAX_COMPONENT_VALUE = 255.0;
+            result.PeakSignalToNoiseRatioInDecibels = 10.0 * std::log10((MAX_COMPONENT_VALUE * MAX_COMPONENT_VALUE) / mean_squared_error);
+        }
+        else
+        {
+            result.PeakSignalToNoiseRatioInDecibels = std::numeric_limits<double>::infinity();
+        }
+
+        // DETERMINE IF THE IMAGES MATCH WITHIN THE TOLERANCE.
+        double pixel_count = static_cast<double>(width_in_pixels) * static_cast<double>(height_in_pixels);
+        double mismatched_pixel_proportion = (pixel_count > 0.0) ? (static_cast<double>(result.MismatchedPixelCount) / pixel_count) : 0.0;
+        result.Matches = (mismatched_pixel_proportion <= tolerance.MaxMismatchedPixelProportion);
+        return result;
+    }
+
+    /// Creates an image highlighting differences between an image and an expected image.
+    /// Mismatched pixels are red (brighter for larger differences), pixels that differ within
+    /// the tolerance are yellow, and identical pixels are a dim grayscale version of the expected
+    /// image so that differences can be located relative to what was rendered.
+    /// @param[in]  expected_image - The expected (reference) image.
+    /// @param[in]  actual_image - The image to compare.
+    /// @param[in]  tolerance - How much the images may differ while still matching.
+    /// @return The difference image, if the images have the same dimensions; null otherwise.
+    std::optional<Bitmap> ImageComparison::CreateDifferenceImage(
+        const Bitmap& expected_image,
+        const Bitmap& actual_image,
+        const ImageComparisonTolerance& tolerance)
+    {
+        // MAKE SURE THE DIMENSIONS MATCH.
+        unsigned int width_in_pixels = expected_image.GetWidthInPixels();
+        unsigned int height_in_pixels = expected_image.GetHeightInPixels();
+        bool dimensions_match = (
+            (width_in_pixels == actual_image.GetWidthInPixels()) &&
+            (height_in_pixels == actual_image.GetHeightInPixels()));
+        if (!dimensions_match)
+        {
+            return std::nullopt;
+        }
+
+        // COLOR EACH PIXEL BASED ON HOW MUCH IT DIFFERS.
+        Bitmap difference_image(width_in_pixels, height_in_pixels, ColorFormat::RGBA);
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                Color expected_color = expected_image.GetPixel(x, y);
+                Color actual_color = actual_image.GetPixel(x, y);
+                uint8_t channel_difference = MaxColorChannelDifference(expected_color, actual_color);
+                if (channel_difference > tolerance.MaxChannelDifference)
+                {
+                    // Even small mismatches are made bright enough to be clearly visible.
+                    constexpr float MIN_MISMATCH_BRIGHTNESS = 0.5f;
+                    float difference_proportion = static_cast<float>(channel_difference) / Color::MAX_INTEGRAL_COLOR_COMPONENT;
+                    float brightness = MIN_MISMATCH_BRIGHTNESS + ((1.0f - MIN_MISMATCH_BRIGHTNESS) * difference_proportion);
+                    difference_image.WritePixel(x, y, Color(brightness, 0.0f, 0.0f, 1.0f));
+                }
+                else if (channel_difference > 0)
+                {
+                    difference_image.WritePixel(x, y, Color(0.5f, 0.5f, 0.0f, 1.0f));
+                }
+                else
+                {
+                    constexpr float GRAYSCALE_DIMMING = 0.25f;
+                    float luminance = (expected_color.Red + expected_color.Green + expected_color.Blue) / 3.0f;
+                    float dimmed_luminance = GRAYSCALE_DIMMING * luminance;
+                    difference_image.WritePixel(x, y, Color(dimmed_luminance, dimmed_luminance, dimmed_luminance, 1.0f));
+                }
+            }
+        }
+        return difference_image;
+    }
+}
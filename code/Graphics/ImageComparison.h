@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include "Graphics/Bitmap.h"
+
+namespace GRAPHICS
+{
+    /// How much two images may differ while still being considered matching.
+    /// Small differences are expected between render paths (like SIMD versus scalar math
+    /// or different compilers), so exact matches aren't required by default.
+    struct ImageComparisonTolerance
+    {
+        /// The maximum difference in any red, green, or blue component (from 0 to 255)
+        /// for a pixel to be considered matching.
+        uint8_t MaxChannelDifference = 2;
+        /// The maximum proportion of pixels (from 0 to 1) that may not match,
+        /// which allows for pixels along triangle edges being rounded differently.
+        double MaxMismatchedPixelProportion = 0.002;
+    };
+
+    /// The result of comparing an image against an expected image.
+    struct ImageComparisonResult
+    {
+        /// True if the images had the same dimensions; false otherwise.
+        /// No other comparisons are made for images with different dimensions.
+        bool DimensionsMatch = false;
+        /// True if the images matched within the tolerance; false otherwise.
+        bool Matches = false;
+        /// The number of pixels with a component differing by more than the tolerance.
+        unsigned int MismatchedPixelCount = 0;
+        /// The largest difference in any red, green, or blue component (from 0 to 255).
+        uint8_t MaxChannelDifference = 0;
+        /// The peak signal-to-noise ratio (PSNR) of the image relative to the expected image,
+        /// in decibels.  Identical images have an infinite PSNR.
+        double PeakSignalToNoiseRatioInDecibels = 0.0;
+    };
+
+    /// Compares rendered images against expected (reference) images, allowing optimized
+    /// render paths to be verified against known-good output.
+    class ImageComparison
+    {
+    public:
+        static ImageComparisonResult Compare(
+            const Bitmap& expected_image,
+            const Bitmap& actual_image,
+            const ImageComparisonTolerance& tolerance);
+        static std::optional<Bitmap> CreateDifferenceImage(
+            const Bitmap& expected_image,
+            const Bitmap& actual_image,
+            const ImageComparisonTolerance& tolerance);
+    };
+}
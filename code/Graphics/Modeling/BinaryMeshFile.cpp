@@ -0,0 +1,186 @@
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include "Benchmarking/Profiler.h"
+#include "Filesystem/BinaryFile.h"
+#include "Graphics/Modeling/BinaryMeshFile.h"
+
+namespace GRAPHICS::MODELING
+{
+    // Data is used directly from mapped files, which requires these exact layouts.
+    static_assert(sizeof(IndexedMesh::Vertex) == 8 * sizeof(float), "Vertices must consist of exactly 8 floats.");
+    static_assert(std::is_trivially_copyable_v<IndexedMesh::Vertex>, "Vertices must be trivially copyable.");
+
+    /// Writes a mesh to a binary mesh file, replacing any existing file.
+    /// @param[in]  mesh - The mesh to write.
+    /// @param[in]  filepath - The path of the file to write.
+    /// @return True if the file was written successfully; false otherwise.
+    bool BinaryMeshFile::Write(const IndexedMesh& mesh, const std::filesystem::path& filepath)
+    {
+        // SERIALIZE THE MATERIAL FILENAMES.
+        std::string material_filenames_section;
+        for (const std::filesystem::path& material_filename : mesh.MaterialFilenames)
+        {
+            FILESYSTEM::BinaryFile::AppendString(material_filename.u8string(), material_filenames_section);
+        }
+
+        // SERIALIZE THE MATERIAL RANGES.
+        std::string material_ranges_section;
+        for (const IndexedMesh::MaterialRange& material_range : mesh.MaterialRanges)
+        {
+            FILESYSTEM::BinaryFile::AppendUInt32(material_range.FirstIndex, material_ranges_section);
+            FILESYSTEM::BinaryFile::AppendUInt32(material_range.IndexCount, material_ranges_section);
+            std::u8string_view utf8_material_name(
+                reinterpret_cast<const char8_t*>(material_range.MaterialName.data()),
+                material_range.MaterialName.size());
+            FILESYSTEM::BinaryFile::AppendString(utf8_material_name, material_ranges_section);
+        }
+
+        // DETERMINE WHERE EACH SECTION GOES IN THE FILE.
+        Header header;
+        header.VertexCount = mesh.Vertices.size();
+        header.VerticesOffsetInBytes = FILESYSTEM::BinaryFile::AlignSectionOffset(sizeof(Header));
+        uint64_t vertices_size_in_bytes = header.VertexCount * sizeof(IndexedMesh::Vertex);
+
+        header.IndexCount = mesh.Indices.size();
+        header.IndicesOffsetInBytes = FILESYSTEM::BinaryFile::AlignSectionOffset(header.VerticesOffsetInBytes + vertices_size_in_bytes);
+        uint64_t indices_size_in_bytes = header.IndexCount * sizeof(uint32_t);
+
+        header.MaterialFilenameCount = mesh.MaterialFilenames.size();
+        header.MaterialFilenamesOffsetInBytes = FILESYSTEM::BinaryFile::AlignSectionOffset(header.IndicesOffsetInBytes + indices_size_in_bytes);
+        header.MaterialFilenamesSizeInBytes = material_filenames_section.size();
+
+        header.MaterialRangeCount = mesh.MaterialRanges.size();
+        header.MaterialRangesOffsetInBytes = FILESYSTEM::BinaryFile::AlignSectionOffset(header.MaterialFilenamesOffsetInBytes + header.MaterialFilenamesSizeInBytes);
+        header.MaterialRangesSizeInBytes = material_ranges_section.size();
+
+        // WRITE THE FILE.
+        bool file_written = FILESYSTEM::BinaryFile::Write(
+            filepath,
+            {
+                { .OffsetInBytes = 0, .Data = &header, .SizeInBytes = sizeof(header) },
+                { .OffsetInBytes = header.VerticesOffsetInBytes, .Data = mesh.Vertices.data(), .SizeInBytes = vertices_size_in_bytes },
+                { .OffsetInBytes = header.IndicesOffsetInBytes, .Data = mesh.Indices.data(), .SizeInBytes = indices_size_in_bytes },
+                { .OffsetInBytes = header.MaterialFilenamesOffsetInBytes, .Data = material_filenames_section.data(), .SizeInBytes = header.MaterialFilenamesSizeInBytes },
+                { .OffsetInBytes = header.MaterialRangesOffsetInBytes, .Data = material_ranges_section.data(), .SizeInBytes = header.MaterialRangesSizeInBytes },
+            });
+        return file_written;
+    }
+
+    /// Attempts to open a binary mesh file.
+    /// @param[in]  filepath - The path of the file to open.
+    /// @return The mesh file, if successfully opened and valid; null otherwise.
+    std::unique_ptr<BinaryMeshFile> BinaryMeshFile::Open(const std::filesystem::path& filepath)
+    {
+        PROFILE_ZONE("Open binary mesh");
+
+        // MAP THE FILE INTO MEMORY.
+        std::unique_ptr<FILESYSTEM::MemoryMappedFile> mapped_file = FILESYSTEM::MemoryMappedFile::Open(filepath);
+        if (!mapped_file)
+        {
+            return nullptr;
+        }
+
+        // READ THE HEADER.
+        bool header_exists = (mapped_file->SizeInBytes() >= sizeof(Header));
+        if (!header_exists)
+        {
+            return nullptr;
+        }
+        Header header;
+        std::memcpy(&header, mapped_file->Data(), sizeof(header));
+
+        // VERIFY THE FILE HAS A SUPPORTED FORMAT.
+        bool format_supported = (MAGIC_NUMBER == header.MagicNumber) && (FORMAT_VERSION == header.FormatVersion);
+        if (!format_supported)
+        {
+            return nullptr;
+        }
+
+        // GET ALL SECTIONS.
+        auto vertices = FILESYSTEM::BinaryFile::GetSection<IndexedMesh::Vertex>(*mapped_file, header.VerticesOffsetInBytes, header.VertexCount);
+        auto indices = FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, header.IndicesOffsetInBytes, header.IndexCount);
+        auto material_filenames_section = FILESYSTEM::BinaryFile::GetSection<std::byte>(*mapped_file, header.MaterialFilenamesOffsetInBytes, header.MaterialFilenamesSizeInBytes);
+        auto material_ranges_section = FILESYSTEM::BinaryFile::GetSection<std::byte>(*mapped_file, header.MaterialRangesOffsetInBytes, header.MaterialRangesSizeInBytes);
+        bool sections_valid = vertices && indices && material_filenames_section && material_ranges_section;
+        if (!sections_valid)
+        {
+            return nullptr;
+        }
+
+        // REFERENCE THE VERTEX AND INDEX DATA DIRECTLY IN THE MAPPED FILE.
+        std::unique_ptr<BinaryMeshFile> mesh_file(new BinaryMeshFile());
+        mesh_file->MappedVertices = *vertices;
+        mesh_file->MappedIndices = *indices;
+
+        // READ THE MATERIAL FILENAMES.
+        for (uint64_t material_filename_index = 0; material_filename_index < header.MaterialFilenameCount; ++material_filename_index)
+        {
+            std::u8string utf8_material_filename;
+            bool material_filename_read = FILESYSTEM::BinaryFile::ReadString(*material_filenames_section, utf8_material_filename);
+            if (!material_filename_read)
+            {
+                return nullptr;
+            }
+            mesh_file->CopiedMaterialFilenames.emplace_back(utf8_material_filename);
+        }
+
+        // READ THE MATERIAL RANGES.
+        for (uint64_t material_range_index = 0; material_range_index < header.MaterialRangeCount; ++material_range_index)
+        {
+            // READ THE RANGE.
+            IndexedMesh::MaterialRange material_range;
+            std::u8string utf8_material_name;
+            bool material_range_read = (
+                FILESYSTEM::BinaryFile::ReadUInt32(*material_ranges_section, material_range.FirstIndex) &&
+                FILESYSTEM::BinaryFile::ReadUInt32(*material_ranges_section, material_range.IndexCount) &&
+                FILESYSTEM::BinaryFile::ReadString(*material_ranges_section, utf8_material_name));
+            if (!material_range_read)
+            {
+                return nullptr;
+            }
+            material_range.MaterialName.assign(reinterpret_cast<const char*>(utf8_material_name.data()), utf8_material_name.size());
+
+            // MAKE SURE THE RANGE IS WITHIN THE INDICES.
+            bool material_range_valid = (
+                material_range.FirstIndex <= header.IndexCount &&
+                material_range.IndexCount <= header.IndexCount - material_range.FirstIndex);
+            if (!material_range_valid)
+            {
+                return nullptr;
+            }
+            mesh_file->CopiedMaterialRanges.push_back(std::move(material_range));
+        }
+
+        mesh_file->MappedFile = std::move(mapped_file);
+        return mesh_file;
+    }
+
+    /// Gets the unique vertices.
+    /// @return The vertices, which remain valid as long as this file is open.
+    std::span<const IndexedMesh::Vertex> BinaryMeshFile::Vertices() const
+    {
+        return MappedVertices;
+    }
+
+    /// Gets the zero-based vertex indices for each triangle (3 per triangle).
+    /// @return The triangle vertex indices, which remain valid as long as this file is open.
+    std::span<const uint32_t> BinaryMeshFile::Indices() const
+    {
+        return MappedIndices;
+    }
+
+    /// Gets the filenames of any referenced material libraries.
+    /// @return The material filenames.
+    const std::vector<std::filesystem::path>& BinaryMeshFile::MaterialFilenames() const
+    {
+        return CopiedMaterialFilenames;
+    }
+
+    /// Gets the ranges of triangle vertex indices sharing materials.
+    /// @return The material ranges.
+    const std::vector<IndexedMesh::MaterialRange>& BinaryMeshFile::MaterialRanges() const
+    {
+        return CopiedMaterialRanges;
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+#include "Filesystem/MemoryMappedFile.h"
+#include "Graphics/Modeling/IndexedMesh.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// A mesh stored in a simple binary format that can be used directly from
+    /// memory-mapped files, without any parsing or copying of individual elements.
+    /// This is intended as a cache for meshes loaded from slower text formats.
+    ///
+    /// The file format (in native byte order) is a fixed-size header followed by
+    /// sections for each type of data, with each section aligned to 16 bytes:
+    /// - Vertices (position, texture coordinates, and normal; 8 floats each).
+    /// - Triangle vertex indices (zero-based 32-bit unsigned integers).
+    /// - Material library filenames (each a string).
+    /// - Material ranges (each a 32-bit first index, 32-bit index count, and material name string).
+    /// Strings are stored as a 32-bit length followed by UTF-8 characters.
+    /// The version in the header is incremented whenever the format changes,
+    /// and files with other versions are treated as invalid.
+    class BinaryMeshFile
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The value identifying files in this format ("R3DM" in little-endian order).
+        static constexpr uint32_t MAGIC_NUMBER = 0x4D443352;
+        /// The current version of the format.
+        static constexpr uint32_t FORMAT_VERSION = 2;
+
+        // WRITING.
+        static bool Write(const IndexedMesh& mesh, const std::filesystem::path& filepath);
+
+        // READING.
+        static std::unique_ptr<BinaryMeshFile> Open(const std::filesystem::path& filepath);
+
+        // DATA ACCESS.
+        std::span<const IndexedMesh::Vertex> Vertices() const;
+        std::span<const uint32_t> Indices() const;
+        const std::vector<std::filesystem::path>& MaterialFilenames() const;
+        const std::vector<IndexedMesh::MaterialRange>& MaterialRanges() const;
+
+    private:
+        /// The header at the start of each file.
+        struct Header
+        {
+            /// Should be MAGIC_NUMBER.
+            uint32_t MagicNumber = MAGIC_NUMBER;
+            /// Should be FORMAT_VERSION.
+            uint32_t FormatVersion = FORMAT_VERSION;
+            /// The number of vertices.
+            uint64_t VertexCount = 0;
+            /// The offset of the vertices from the start of the file.
+            uint64_t VerticesOffsetInBytes = 0;
+            /// The number of triangle vertex indices.
+            uint64_t IndexCount = 0;
+            /// The offset of the triangle vertex indices from the start of the file.
+            uint64_t IndicesOffsetInBytes = 0;
+            /// The number of material filenames.
+            uint64_t MaterialFilenameCount = 0;
+            /// The offset of the material filenames from the start of the file.
+            uint64_t MaterialFilenamesOffsetInBytes = 0;
+            /// The size of the material filenames section.
+            uint64_t MaterialFilenamesSizeInBytes = 0;
+            /// The number of material ranges.
+            uint64_t MaterialRangeCount = 0;
+            /// The offset of the material ranges from the start of the file.
+            uint64_t MaterialRangesOffsetInBytes = 0;
+            /// The size of the material ranges section.
+            uint64_t MaterialRangesSizeInBytes = 0;
+        };
+
+        // CONSTRUCTION.
+        explicit BinaryMeshFile() = default;
+
+        // MEMBER VARIABLES.
+        /// The mapped file that all data is read from.
+        std::unique_ptr<FILESYSTEM::MemoryMappedFile> MappedFile = nullptr;
+        /// The vertices within the mapped file.
+        std::span<const IndexedMesh::Vertex> MappedVertices = {};
+        /// The triangle vertex indices within the mapped file.
+        std::span<const uint32_t> MappedIndices = {};
+        /// The material filenames.  These are few and small, so they're copied out of the file.
+        std::vector<std::filesystem::path> CopiedMaterialFilenames = {};
+        /// The material ranges.  These are few and small, so they're copied out of the file.
+        std::vector<IndexedMesh::MaterialRange> CopiedMaterialRanges = {};
+    };
+}
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <unordered_map>
+#include "Graphics/Modeling/IndexedMesh.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// Creates an indexed mesh from parsed .obj data.
+    /// Face vertices referencing the same position, texture coordinates, and normal
+    /// become a single vertex, and consecutive faces using the same material form a single range.
+    /// Normals for any vertices without explicit normals are computed once here
+    /// (rather than needing to be recomputed from faces during rendering).
+    /// @param[in]  data - The parsed .obj data.
+    /// @return The indexed mesh, if all faces reference existing data; null otherwise.
+    std::optional<IndexedMesh> IndexedMesh::FromObjectData(const WavefrontObjectData& data)
+    {
+        constexpr std::size_t TRIANGLE_VERTEX_COUNT = 3;
+        IndexedMesh mesh;
+        mesh.MaterialFilenames = data.MaterialFilenames;
+
+        // DEDUPLICATE ALL FACE VERTICES.
+        // Vertices without explicit normals are tracked so that their normals can be computed.
+        std::unordered_map<WavefrontFaceVertex, uint32_t, FaceVertexHash> vertex_indices_by_face_vertex;
+        vertex_indices_by_face_vertex.reserve(data.VertexPositions.size());
+        std::vector<bool> vertex_normals_to_compute;
+        mesh.Indices.reserve(data.Faces.size() * TRIANGLE_VERTEX_COUNT);
+        for (const auto& face : data.Faces)
+        {
+            for (const WavefrontFaceVertex& face_vertex : face)
+            {
+                // MAKE SURE THE FACE VERTEX ONLY REFERENCES EXISTING DATA.
+                bool position_exists = (face_vertex.PositionIndex < data.VertexPositions.size());
+                bool texture_coordinates_exist = (face_vertex.TextureCoordinateIndex < data.VertexTextureCoordinates.size());
+                bool texture_coordinates_valid = texture_coordinates_exist || (WavefrontFaceVertex::NO_INDEX == face_vertex.TextureCoordinateIndex);
+                bool normal_exists = (face_vertex.NormalIndex < data.VertexNormals.size());
+                bool normal_valid = normal_exists || (WavefrontFaceVertex::NO_INDEX == face_vertex.NormalIndex);
+                bool face_vertex_valid = position_exists && texture_coordinates_valid && normal_valid;
+                if (!face_vertex_valid)
+                {
+                    return std::nullopt;
+                }
+
+                // ADD A NEW VERTEX IF THIS IS THE FIRST TIME THE FACE VERTEX HAS BEEN SEEN.
+                uint32_t next_vertex_index = static_cast<uint32_t>(mesh.Vertices.size());
+                auto [face_vertex_and_index, vertex_is_new] = vertex_indices_by_face_vertex.try_emplace(face_vertex, next_vertex_index);
+                if (vertex_is_new)
+                {
+                    Vertex vertex;
+                    vertex.Position = data.VertexPositions[face_vertex.PositionIndex];
+                    if (texture_coordinates_exist)
+                    {
+                        vertex.TextureCoordinates = data.VertexTextureCoordinates[face_vertex.TextureCoordinateIndex];
+                    }
+                    if (normal_exists)
+                    {
+                        vertex.Normal = MATH::Vector3f::Normalize(data.VertexNormals[face_vertex.NormalIndex]);
+                    }
+                    mesh.Vertices.push_back(vertex);
+                    vertex_normals_to_compute.push_back(!normal_exists);
+                }
+
+                mesh.Indices.push_back(face_vertex_and_index->second);
+            }
+        }
+
+        // COMPUTE NORMALS FOR ANY VERTICES WITHOUT EXPLICIT NORMALS.
+        // Unnormalized triangle normals are summed so that larger triangles have more influence.
+        for (std::size_t first_index = 0; first_index + TRIANGLE_VERTEX_COUNT <= mesh.Indices.size(); first_index += TRIANGLE_VERTEX_COUNT)
+        {
+            const Vertex& first_vertex = mesh.Vertices[mesh.Indices[first_index]];
+            const Vertex& second_vertex = mesh.Vertices[mesh.Indices[first_index + 1]];
+            const Vertex& third_vertex = mesh.Vertices[mesh.Indices[first_index + 2]];
+            MATH::Vector3f triangle_normal = MATH::Vector3f::CrossProduct(
+                second_vertex.Position - first_vertex.Position,
+                third_vertex.Position - first_vertex.Position);
+            for (std::size_t triangle_vertex_index = 0; triangle_vertex_index < TRIANGLE_VERTEX_COUNT; ++triangle_vertex_index)
+            {
+                uint32_t vertex_index = mesh.Indices[first_index + triangle_vertex_index];
+                if (vertex_normals_to_compute[vertex_index])
+                {
+                    mesh.Vertices[vertex_index].Normal += triangle_normal;
+                }
+            }
+        }
+        for (std::size_t vertex_index = 0; vertex_index < mesh.Vertices.size(); ++vertex_index)
+        {
+            // Degenerate triangles can result in zero-length normals, which are left as-is.
+            Vertex& vertex = mesh.Vertices[vertex_index];
+            bool normal_normalizable = vertex_normals_to_compute[vertex_index] && (vertex.Normal != MATH::Vector3f());
+            if (normal_normalizable)
+            {
+                vertex.Normal = MATH::Vector3f::Normalize(vertex.Normal);
+            }
+        }
+
+        // FORM RANGES OF TRIANGLES SHARING MATERIALS.
+        // Any faces before the first material use have no explicit material.
+        std::size_t current_range_first_face_index = 0;
+        std::string current_material_name = "";
+        auto add_material_range = [&mesh, &current_range_first_face_index, &current_material_name](const std::size_t end_face_index)
+        {
+            bool range_empty = (end_face_index <= current_range_first_face_index);
+            if (range_empty)
+            {
+                return;
+            }
+
+            mesh.MaterialRanges.push_back(MaterialRange
+            {
+                .MaterialName = current_material_name,
+                .FirstIndex = static_cast<uint32_t>(current_range_first_face_index * TRIANGLE_VERTEX_COUNT),
+                .IndexCount = static_cast<uint32_t>((end_face_index - current_range_first_face_index) * TRIANGLE_VERTEX_COUNT)
+            });
+        };
+        for (const WavefrontMaterialUse& material_use : data.MaterialUses)
+        {
+            add_material_range(material_use.FirstFaceIndex);
+            current_range_first_face_index = std::max(current_range_first_face_index, material_use.FirstFaceIndex);
+            current_material_name = material_use.MaterialName;
+        }
+        add_material_range(data.Faces.size());
+
+        return mesh;
+    }
+
+    /// Hashes a face vertex.
+    /// @param[in]  face_vertex - The face vertex to hash.
+    /// @return The hash of the face vertex.
+    std::size_t IndexedMesh::FaceVertexHash::operator()(const WavefrontFaceVertex& face_vertex) const
+    {
+        // COMBINE THE INDICES.
+        // Multiplying by large odd constants spreads the bits of each index across the hash,
+        // which is important since indices are often small and close together.
+        constexpr uint64_t POSITION_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+        constexpr uint64_t TEXTURE_COORDINATE_MULTIPLIER = 0xC2B2AE3D27D4EB4Full;
+        constexpr uint64_t NORMAL_MULTIPLIER = 0x165667B19E3779F9ull;
+        uint64_t hash = (
+            (face_vertex.PositionIndex * POSITION_MULTIPLIER) ^
+            (face_vertex.TextureCoordinateIndex * TEXTURE_COORDINATE_MULTIPLIER) ^
+            (face_vertex.NormalIndex * NORMAL_MULTIPLIER));
+        hash ^= (hash >> 32);
+        return static_cast<std::size_t>(hash);
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Graphics/Modeling/WavefrontObjectParser.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// A triangle mesh where each unique combination of vertex attributes is stored
+    /// only once and triangles reference vertices by index.  Faces in formats like
+    /// .obj reference positions, texture coordinates, and normals separately, so they
+    /// are deduplicated into combined vertices when forming an indexed mesh.
+    struct IndexedMesh
+    {
+        /// A single vertex with all of its attributes.
+        struct Vertex
+        {
+            /// The position of the vertex.
+            MATH::Vector3f Position = MATH::Vector3f();
+            /// The texture coordinates of the vertex.  Zero if the vertex has no texture coordinates.
+            MATH::Vector2f TextureCoordinates = MATH::Vector2f();
+            /// The unit normal of the vertex.  If not explicitly defined, this is
+            /// computed by averaging the normals of all triangles sharing the vertex.
+            MATH::Vector3f Normal = MATH::Vector3f();
+
+            bool operator==(const Vertex& rhs) const = default;
+        };
+
+        /// A contiguous range of indices for triangles sharing the same material.
+        struct MaterialRange
+        {
+            /// The name of the material, as defined in one of the material libraries.
+            /// Empty for triangles without any explicit material.
+            std::string MaterialName = "";
+            /// The index of the first triangle vertex index in the range.
+            uint32_t FirstIndex = 0;
+            /// The number of triangle vertex indices in the range (3 per triangle).
+            uint32_t IndexCount = 0;
+
+            bool operator==(const MaterialRange& rhs) const = default;
+        };
+
+        // CONSTRUCTION.
+        static std::optional<IndexedMesh> FromObjectData(const WavefrontObjectData& data);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The filenames of any referenced material libraries, in the order referenced.
+        std::vector<std::filesystem::path> MaterialFilenames = {};
+        /// All unique vertices.
+        std::vector<Vertex> Vertices = {};
+        /// The zero-based indices of vertices for each triangle (3 per triangle),
+        /// in counter-clockwise order.
+        std::vector<uint32_t> Indices = {};
+        /// The materials used by the triangles, in index order.
+        std::vector<MaterialRange> MaterialRanges = {};
+
+    private:
+        /// Hashes face vertices to allow deduplicating them.
+        struct FaceVertexHash
+        {
+            std::size_t operator()(const WavefrontFaceVertex& face_vertex) const;
+        };
+    };
+}
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <system_error>
+#include <utility>
+#include "Graphics/Modeling/MaterialLibraryCache.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// Gets the cache shared by the entire process, such as for loading models without
+    /// explicitly providing a cache.  It's created on first use with the default texture
+    /// memory budget, which can be changed via Textures().SetMemoryBudget().
+    /// @return The process-wide cache.
+    MaterialLibraryCache& MaterialLibraryCache::Shared()
+    {
+        static MaterialLibraryCache shared_cache;
+        return shared_cache;
+    }
+
+    /// Constructor.
+    /// @param[in]  texture_memory_budget_in_bytes - The maximum desired memory for cached textures.
+    MaterialLibraryCache::MaterialLibraryCache(const std::size_t texture_memory_budget_in_bytes) :
+        LoadedTextures(texture_memory_budget_in_bytes)
+    {}
+
+    /// Gets the cache of textures for materials.
+    /// @return The texture cache.
+    TextureCache& MaterialLibraryCache::Textures()
+    {
+        return LoadedTextures;
+    }
+
+    /// Gets all materials from a .mtl file (including any textures), loading them only if
+    /// they aren't already cached or the file has been modified since they were cached.
+    /// @param[in]  mtl_filepath - The path of the .mtl file.
+    /// @return The materials, in the order defined, if successfully loaded; null otherwise.
+    std::shared_ptr<const std::vector<WavefrontMaterial>> MaterialLibraryCache::Get(const std::filesystem::path& mtl_filepath)
+    {
+        // IDENTIFY THE CURRENT VERSION OF THE FILE.
+        // Missing files are never cached, so they'll be loaded if they're later created.
+        std::error_code filesystem_error;
+        std::filesystem::path canonical_filepath = std::filesystem::canonical(mtl_filepath, filesystem_error);
+        if (filesystem_error)
+        {
+            return nullptr;
+        }
+        std::filesystem::file_time_type last_write_time = std::filesystem::last_write_time(canonical_filepath, filesystem_error);
+        if (filesystem_error)
+        {
+            return nullptr;
+        }
+
+        // CHECK IF THE CURRENT VERSION OF THE FILE IS ALREADY CACHED.
+        // If not, an entry is reserved for this thread to load, so that other threads
+        // requesting the same library wait for this load rather than duplicating it.
+        // Any outdated library is replaced, although existing users keep it alive.
+        std::shared_future<std::shared_ptr<const std::vector<WavefrontMaterial>>> cached_library;
+        std::promise<std::shared_ptr<const std::vector<WavefrontMaterial>>> library_promise;
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            auto entry = Entries.find(canonical_filepath);
+            bool library_cached = (Entries.end() != entry) && (last_write_time == entry->second.LastWriteTime);
+            if (library_cached)
+            {
+                ++HitCount;
+                cached_library = entry->second.Library;
+            }
+            else
+            {
+                ++MissCount;
+                Entries.insert_or_assign(canonical_filepath, Entry
+                {
+                    .LastWriteTime = last_write_time,
+                    .Library = library_promise.get_future().share()
+                });
+            }
+        }
+
+        // SHARE ANY CACHED LIBRARY.
+        // The library may still be loading on another thread, in which case this waits for it.
+        if (cached_library.valid())
+        {
+            return cached_library.get();
+        }
+
+        // LOAD THE LIBRARY.
+        // The lock isn't held while loading to allow other libraries to be loaded in parallel.
+        std::shared_ptr<const std::vector<WavefrontMaterial>> materials = Load(canonical_filepath);
+        library_promise.set_value(materials);
+
+        // KEEP TEXTURES WITHIN THEIR MEMORY BUDGET.
+        // The newly loaded library is still referenced here, so it remains cached.
+        EnforceTextureMemoryBudget();
+        return materials;
+    }
+
+    /// Removes all libraries from the cache.  Libraries still in use remain valid,
+    /// but they'll be loaded again if requested.  Textures remain in the texture cache.
+    void MaterialLibraryCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Entries.clear();
+    }
+
+    /// Gets statistics about the cache.
+    /// @return The current statistics.
+    MaterialLibraryCache::Statistics MaterialLibraryCache::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        return Statistics
+        {
+            .HitCount = HitCount,
+            .MissCount = MissCount,
+            .EvictionCount = EvictionCount,
+            .CachedLibraryCount = Entries.size()
+        };
+    }
+
+    /// Hashes a filepath.
+    /// @param[in]  filepath - The filepath to hash.
+    /// @return The hash of the filepath.
+    std::size_t MaterialLibraryCache::FilepathHash::operator()(const std::filesystem::path& filepath) const
+    {
+        return std::filesystem::hash_value(filepath);
+    }
+
+    /// Loads all materials from a .mtl file, including any textures.
+    /// @param[in]  mtl_filepath - The path of the .mtl file.
+    /// @return The materials, if successfully loaded; null otherwise.
+    std::shared_ptr<const std::vector<WavefrontMaterial>> MaterialLibraryCache::Load(const std::filesystem::path& mtl_filepath)
+    {
+        // LOAD THE MATERIALS.
+        std::optional<std::vector<WavefrontMaterial>> materials = WavefrontMaterial::LoadLibrary(mtl_filepath);
+        if (!materials)
+        {
+            return nullptr;
+        }
+
+        // LOAD ANY TEXTURES.
+        // Textures are assigned before the materials are shared to avoid them
+        // being modified while they might be in use.
+        for (WavefrontMaterial& material : *materials)
+        {
+            bool texture_exists = !material.TextureFilepath.empty();
+            if (texture_exists)
+            {
+                material.Material->Texture = LoadedTextures.Get(material.TextureFilepath);
+            }
+        }
+
+        return std::make_shared<const std::vector<WavefrontMaterial>>(std::move(*materials));
+    }
+
+    /// Releases libraries no longer referenced outside of the cache if textures are over their
+    /// memory budget, and then evicts textures to get back within the budget if possible.
+    void MaterialLibraryCache::EnforceTextureMemoryBudget()
+    {
+        // CHECK IF TEXTURES ARE OVER BUDGET.
+        TextureCache::Statistics texture_statistics = LoadedTextures.GetStatistics();
+        bool textures_over_budget = (texture_statistics.ResidentSizeInBytes > texture_statistics.MemoryBudgetInBytes);
+        if (!textures_over_budget)
+        {
+            return;
+        }
+
+        // RELEASE LIBRARIES NO LONGER IN USE.
+        // Libraries still loading are skipped since threads may be waiting on them.
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            for (auto entry = Entries.begin(); Entries.end() != entry;)
+            {
+                const std::shared_future<std::shared_ptr<const std::vector<WavefrontMaterial>>>& library = entry->second.Library;
+                bool library_loaded = (std::future_status::ready == library.wait_for(std::chrono::seconds(0)));
+                bool library_in_use = !library_loaded || LibraryInUse(library.get());
+                if (library_in_use)
+                {
+                    ++entry;
+                    continue;
+                }
+
+                entry = Entries.erase(entry);
+                ++EvictionCount;
+            }
+        }
+
+        // EVICT TEXTURES NO LONGER IN USE.
+        LoadedTextures.EnforceMemoryBudget();
+    }
+
+    /// Checks if a library is in use outside of the cache.  Models typically copy materials out
+    /// of a library rather than keeping the library itself, so a library is in use if either it
+    /// or any of its materials are referenced outside of the cache.
+    /// @param[in]  library - The library to check.
+    /// @return True if the library is in use; false otherwise.
+    bool MaterialLibraryCache::LibraryInUse(const std::shared_ptr<const std::vector<WavefrontMaterial>>& library)
+    {
+        // CHECK IF THE LIBRARY ITSELF IS IN USE.
+        // The cache itself holds one reference, so any others mean the library is in use.
+        bool library_referenced = (library.use_count() > 1);
+        if (library_referenced)
+        {
+            return true;
+        }
+
+        // CHECK IF ANY MATERIALS ARE IN USE.
+        // Libraries that failed to load have no materials.
+        if (!library)
+        {
+            return false;
+        }
+        bool material_referenced = std::any_of(
+            library->cbegin(),
+            library->cend(),
+            [](const WavefrontMaterial& material) { return material.Material.use_count() > 1; });
+        return material_referenced;
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Graphics/Modeling/WavefrontMaterial.h"
+#include "Graphics/TextureCache.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// A cache of material libraries loaded from .mtl files, ensuring each library is only
+    /// parsed (and its textures only loaded) once no matter how many models reference it.
+    ///
+    /// Libraries are identified by canonical path, so different ways of referring to the
+    /// same file share a library.  A library is reloaded if its file has been modified
+    /// since it was cached.  Textures are shared through a TextureCache, so textures
+    /// referenced by multiple libraries are also only resident once.
+    ///
+    /// Cached libraries keep their textures in use, so whenever textures exceed their memory
+    /// budget after loading a library, libraries whose materials are no longer referenced
+    /// outside of the cache are released to allow their textures to be evicted.  Libraries
+    /// with materials still used by models are kept so that later models share those materials.
+    /// A released library will be loaded again if requested.
+    ///
+    /// Cached materials are shared by all models using them, so they must be treated as
+    /// immutable.  Callers wanting to modify a material should modify a copy instead.
+    ///
+    /// All methods are safe to call from multiple threads.  If multiple threads request
+    /// the same library at once, only one loads it and the others wait for that load.
+    class MaterialLibraryCache
+    {
+    public:
+        /// Statistics about how well the cache is working.
+        struct Statistics
+        {
+            /// The number of requests for libraries already cached (or being loaded).
+            uint64_t HitCount = 0;
+            /// The number of requests for libraries that had to be loaded.
+            uint64_t MissCount = 0;
+            /// The number of libraries released to allow textures to stay within their memory budget.
+            uint64_t EvictionCount = 0;
+            /// The number of libraries currently cached.
+            std::size_t CachedLibraryCount = 0;
+        };
+
+        // STATIC CONSTANTS.
+        /// The default maximum desired memory for cached textures (512 MB).
+        static constexpr std::size_t DEFAULT_TEXTURE_MEMORY_BUDGET_IN_BYTES = std::size_t(512) * 1024 * 1024;
+
+        // PROCESS-WIDE CACHE.
+        static MaterialLibraryCache& Shared();
+
+        // CONSTRUCTION.
+        explicit MaterialLibraryCache(const std::size_t texture_memory_budget_in_bytes = DEFAULT_TEXTURE_MEMORY_BUDGET_IN_BYTES);
+
+        // CACHE ACCESS.
+        TextureCache& Textures();
+
+        // LIBRARY ACCESS.
+        std::shared_ptr<const std::vector<WavefrontMaterial>> Get(const std::filesystem::path& mtl_filepath);
+
+        // MEMORY MANAGEMENT.
+        void Clear();
+
+        // STATISTICS.
+        Statistics GetStatistics() const;
+
+    private:
+        /// Hashes filepaths to allow them to be used as keys.
+        struct FilepathHash
+        {
+            std::size_t operator()(const std::filesystem::path& filepath) const;
+        };
+
+        /// A library in the cache, which may still be loading.
+        struct Entry
+        {
+            /// The last write time of the file when the library was loaded.
+            std::filesystem::file_time_type LastWriteTime = {};
+            /// The library, which holds null if it failed to load.
+            std::shared_future<std::shared_ptr<const std::vector<WavefrontMaterial>>> Library = {};
+        };
+
+        // HELPER METHODS.
+        std::shared_ptr<const std::vector<WavefrontMaterial>> Load(const std::filesystem::path& mtl_filepath);
+        void EnforceTextureMemoryBudget();
+        static bool LibraryInUse(const std::shared_ptr<const std::vector<WavefrontMaterial>>& library);
+
+        // MEMBER VARIABLES.
+        /// Protects access to all other member variables except the texture cache (which has its own protection).
+        mutable std::mutex Mutex = {};
+        /// Libraries by canonical filepath.
+        std::unordered_map<std::filesystem::path, Entry, FilepathHash> Entries = {};
+        /// The number of requests for cached libraries.
+        uint64_t HitCount = 0;
+        /// The number of requests for libraries that weren't cached.
+        uint64_t MissCount = 0;
+        /// The number of libraries released to allow textures to stay within their memory budget.
+        uint64_t EvictionCount = 0;
+        /// Textures for materials in all libraries.
+        TextureCache LoadedTextures;
+    };
+}
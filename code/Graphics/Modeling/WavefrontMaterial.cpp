@@ -1,31 +1,68 @@
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include "Benchmarking/Profiler.h"
 #include "Graphics/Modeling/WavefrontMaterial.h"
 
 namespace GRAPHICS::MODELING
 {
     /// Attempts to load the material from the specified .mtl file.
+    /// If the file defines multiple materials, only the first is returned.
     /// @param[in]  mtl_filepath - The path of the .mtl file to load.
     /// @return The material, if successfull loaded; null otherwise.
     std::shared_ptr<Material> WavefrontMaterial::Load(const std::filesystem::path& mtl_filepath)
     {
+        // LOAD ALL MATERIALS IN THE FILE.
+        std::optional<std::vector<WavefrontMaterial>> materials = LoadLibrary(mtl_filepath);
+        bool material_loaded = materials && !materials->empty();
+        if (!material_loaded)
+        {
+            return nullptr;
+        }
+
+        // RETURN THE FIRST MATERIAL.
+        return materials->front().Material;
+    }
+
+    /// Attempts to load all materials from the specified .mtl file.
+    /// Any properties before the first "newmtl" line apply to a material without a name.
+    /// Referenced textures aren't loaded, since callers may want to load them differently
+    /// (like in parallel); only their filepaths are read.
+    /// @param[in]  mtl_filepath - The path of the .mtl file to load.
+    /// @return The materials, in the order defined, if successfull loaded; null otherwise.
+    std::optional<std::vector<WavefrontMaterial>> WavefrontMaterial::LoadLibrary(const std::filesystem::path& mtl_filepath)
+    {
+        PROFILE_ZONE("Load material library");
+
         // OPEN THE FILE.
         std::ifstream material_file(mtl_filepath);
         bool material_file_opened = material_file.is_open();
         if (!material_file_opened)
         {
-            return nullptr;
+            return std::nullopt;
         }
 
         // READ IN THE DATA FROM THE .OBJ FILE.
         // Note that this reading may not yet be fully robust.
         // It only handles the absolute minimum as currently needed for basic demos.
-        constexpr char SPACE_SEPARATOR = ' ';
-        /// @todo   Handle multiple materials?
-        auto material = std::make_shared<Material>();
-        /// @todo   Handle different shading models?
-        material->Shading = ShadingType::MATERIAL;
+        std::vector<WavefrontMaterial> materials;
+        auto add_material = [&materials](const std::string& name)
+        {
+            auto material = std::make_shared<GRAPHICS::Material>();
+            /// @todo   Handle different shading models?
+            material->Shading = ShadingType::MATERIAL;
+            materials.push_back(WavefrontMaterial{ .Name = name, .Material = material });
+        };
+        auto get_line_remainder = [](const std::string& line, const std::size_t keyword_size)
+        {
+            // Values like names may contain spaces, so the entire remainder of the line is used.
+            constexpr std::string_view WHITESPACE_CHARACTERS = " \t\r";
+            std::size_t remainder_start_index = std::min(line.find_first_not_of(WHITESPACE_CHARACTERS, keyword_size), line.size());
+            std::size_t remainder_end_index = line.find_last_not_of(WHITESPACE_CHARACTERS) + 1;
+            return line.substr(remainder_start_index, std::max(remainder_start_index, remainder_end_index) - remainder_start_index);
+        };
         std::string line;
         while (std::getline(material_file, line))
         {
@@ -45,14 +82,22 @@ namespace GRAPHICS::MODELING
             }
 
             // CHECK IF A NEW MATERIAL IS BEING DEFINED.
-            /// @todo   Should we track this?
             const std::string NEW_MATERIAL_KEYWORD = "newmtl";
             bool is_new_material_line = line.starts_with(NEW_MATERIAL_KEYWORD);
             if (is_new_material_line)
             {
+                std::string name = get_line_remainder(line, NEW_MATERIAL_KEYWORD.size());
+                add_material(name);
                 continue;
             }
 
+            // MAKE SURE A MATERIAL EXISTS FOR ANY PROPERTIES.
+            if (materials.empty())
+            {
+                add_material("");
+            }
+            std::shared_ptr<GRAPHICS::Material>& material = materials.back().Material;
+
             // READ IN ANY SPECULAR EXPONENT.
             const std::string SPECULAR_EXPONENT_INDICATOR = "Ns";
             bool is_specular_exponent_line = line.starts_with(SPECULAR_EXPONENT_INDICATOR);
@@ -198,6 +243,21 @@ namespace GRAPHICS::MODELING
                 continue;
             }
 
+            // READ IN ANY DIFFUSE TEXTURE.
+            // Texture options aren't supported, so the remainder of the line is the filename.
+            const std::string DIFFUSE_TEXTURE_INDICATOR = "map_Kd";
+            bool is_diffuse_texture_line = line.starts_with(DIFFUSE_TEXTURE_INDICATOR);
+            if (is_diffuse_texture_line)
+            {
+                std::string texture_filename = get_line_remainder(line, DIFFUSE_TEXTURE_INDICATOR.size());
+                bool texture_filename_exists = !texture_filename.empty();
+                if (texture_filename_exists)
+                {
+                    materials.back().TextureFilepath = mtl_filepath.parent_path() / texture_filename;
+                }
+                continue;
+            }
+
             // READ IN THE ILLUMINATION MODEL.
             const std::string ILLUMINATION_MODEL_INDICATOR = "illum";
             bool is_illumination_model_line = line.starts_with(ILLUMINATION_MODEL_INDICATOR);
@@ -208,7 +268,20 @@ namespace GRAPHICS::MODELING
             }
         }
 
-        // RETURN THE MATERIAL.
-        return material;
+        // USE THE DIFFUSE COLOR FOR ANY MISSING VERTEX COLORS.
+        // Renderers expect a color for each vertex, but .mtl files only have material-wide colors.
+        constexpr std::size_t TRIANGLE_VERTEX_COUNT = 3;
+        for (WavefrontMaterial& material : materials)
+        {
+            std::vector<Color>& vertex_colors = material.Material->VertexColors;
+            bool vertex_colors_missing = vertex_colors.size() < TRIANGLE_VERTEX_COUNT;
+            if (vertex_colors_missing)
+            {
+                vertex_colors.assign(TRIANGLE_VERTEX_COUNT, material.Material->DiffuseColor);
+            }
+        }
+
+        // RETURN THE MATERIALS.
+        return materials;
     }
 }
@@ -2,15 +2,28 @@
 
 #include <filesystem>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 #include "Graphics/Material.h"
 
 namespace GRAPHICS::MODELING
 {
     /// A material in the .mtl (Material Template Library) format.
     /// See https://en.wikipedia.org/wiki/Wavefront_.obj_file#Material_template_library.
+    /// A single .mtl file (a material library) may define multiple named materials.
     class WavefrontMaterial
     {
     public:
-        static std::shared_ptr<Material> Load(const std::filesystem::path& mtl_filepath);
+        static std::shared_ptr<GRAPHICS::Material> Load(const std::filesystem::path& mtl_filepath);
+        static std::optional<std::vector<WavefrontMaterial>> LoadLibrary(const std::filesystem::path& mtl_filepath);
+
+        /// The name of the material, as referenced by .obj files.
+        std::string Name = "";
+        /// The material.
+        std::shared_ptr<GRAPHICS::Material> Material = nullptr;
+        /// The path of any diffuse texture for the material (relative to the current
+        /// working directory, rather than the .mtl file); empty if there is no texture.
+        std::filesystem::path TextureFilepath = "";
     };
 }
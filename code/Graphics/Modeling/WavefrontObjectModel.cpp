@@ -1,214 +1,273 @@
-#include <fstream>
-#include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <memory>
 #include <string>
-#include <tuple>
+#include <system_error>
+#include <unordered_map>
 #include <vector>
+#include "Benchmarking/Profiler.h"
+#include "Filesystem/MemoryMappedFile.h"
+#include "Graphics/Modeling/BinaryMeshFile.h"
+#include "Graphics/Modeling/MaterialLibraryCache.h"
 #include "Graphics/Modeling/WavefrontObjectModel.h"
-#include "Graphics/Modeling/WavefrontMaterial.h"
+#include "Graphics/Modeling/WavefrontObjectParser.h"
 
 namespace GRAPHICS::MODELING
 {
+    /// Gets the path of the binary mesh file used to cache the geometry of a .obj file.
+    /// The filename includes a hash of the full .obj filepath so that models with the same
+    /// filename in different folders don't share a cache file.
+    /// @param[in]  obj_filepath - The path of the .obj file.
+    /// @param[in]  cache_folder_path - The folder containing binary mesh cache files.
+    /// @return The path of the corresponding binary mesh cache file.
+    std::filesystem::path WavefrontObjectModel::BinaryMeshCacheFilepath(const std::filesystem::path& obj_filepath, const std::filesystem::path& cache_folder_path)
+    {
+        // HASH THE FULL .OBJ FILEPATH.
+        std::filesystem::path normalized_obj_filepath = std::filesystem::absolute(obj_filepath).lexically_normal();
+        std::size_t obj_filepath_hash = std::filesystem::hash_value(normalized_obj_filepath);
+        constexpr int HEXADECIMAL_BASE = 16;
+        char obj_filepath_hash_text[2 * sizeof(obj_filepath_hash)] = {};
+        std::to_chars_result hash_conversion_result = std::to_chars(
+            std::begin(obj_filepath_hash_text),
+            std::end(obj_filepath_hash_text),
+            obj_filepath_hash,
+            HEXADECIMAL_BASE);
+
+        // FORM THE CACHE FILEPATH.
+        std::filesystem::path binary_mesh_cache_filename = obj_filepath.filename();
+        binary_mesh_cache_filename += ".";
+        binary_mesh_cache_filename += std::string(obj_filepath_hash_text, hash_conversion_result.ptr);
+        binary_mesh_cache_filename += BINARY_MESH_CACHE_FILE_EXTENSION;
+        return cache_folder_path / binary_mesh_cache_filename;
+    }
+
+    /// Loads all materials from material libraries on the calling thread, including any textures.
+    /// Libraries are shared through the process-wide MaterialLibraryCache, so libraries used by
+    /// many models are only parsed once, and the returned materials must not be modified.
+    /// @param[in]  mtl_filepaths - The paths of the .mtl files to load.
+    /// @return The materials from all successfully loaded libraries, in order.
+    std::vector<WavefrontMaterial> WavefrontObjectModel::LoadMaterialLibraries(const std::vector<std::filesystem::path>& mtl_filepaths)
+    {
+        std::vector<WavefrontMaterial> materials;
+        MaterialLibraryCache& material_library_cache = MaterialLibraryCache::Shared();
+        for (const std::filesystem::path& mtl_filepath : mtl_filepaths)
+        {
+            std::shared_ptr<const std::vector<WavefrontMaterial>> material_library = material_library_cache.Get(mtl_filepath);
+            if (material_library)
+            {
+                materials.insert(materials.end(), material_library->cbegin(), material_library->cend());
+            }
+        }
+
+        return materials;
+    }
+
     /// Attempts to load the model from the specified .obj file.
     /// Any additional referenced files are automatically loaded to ensure a complete model is loaded.
+    ///
+    /// Parsing large .obj files can be slow, so geometry may optionally be cached in a binary
+    /// mesh file in a cache folder (see BinaryMeshCacheFilepath()).  The cache is used instead
+    /// of the .obj file whenever it's newer and is rewritten whenever it's out of date.
+    /// Caching is disabled by default so that loading models never writes files unexpectedly.
     /// @param[in]  obj_filepath - The path of the .obj file to load.
+    /// @param[in]  material_libraries_loader - The function to load any referenced material libraries.
+    /// @param[in]  binary_mesh_cache_folder_path - The folder to cache geometry in (created if needed),
+    ///     or empty to not cache geometry.
+    /// @param[out]  binary_mesh_cache_write_failed - If provided, set to true if the cache needed
+    ///     writing but couldn't be written; false otherwise.  The model is still loaded if this fails.
     /// @return The 3D model, if successfull loaded; null otherwise.
-    std::optional<Object3D> WavefrontObjectModel::Load(const std::filesystem::path& obj_filepath)
+    std::optional<Object3D> WavefrontObjectModel::Load(
+        const std::filesystem::path& obj_filepath,
+        const MaterialLibrariesLoader& material_libraries_loader,
+        const std::filesystem::path& binary_mesh_cache_folder_path,
+        bool* const binary_mesh_cache_write_failed)
     {
-        // OPEN THE FILE.
-        std::ifstream obj_file(obj_filepath);
-        bool obj_file_opened = obj_file.is_open();
-        if (!obj_file_opened)
+        PROFILE_ZONE("Load OBJ model");
+
+        if (binary_mesh_cache_write_failed)
         {
-            return std::nullopt;
+            *binary_mesh_cache_write_failed = false;
         }
 
-        // READ IN THE DATA FROM THE .OBJ FILE.
-        // Note that this reading may not yet be fully robust.
-        // It only handles the absolute minimum as currently needed for basic demos.
-        constexpr char SPACE_SEPARATOR = ' ';
-        std::vector<std::filesystem::path> material_filenames;
-        std::vector<MATH::Vector3f> vertices;
-        std::vector< std::tuple<std::size_t, std::size_t, std::size_t> > face_vertex_indices;
-        std::string line;
-        while (std::getline(obj_file, line))
+        // CHECK IF THE .OBJ FILE EXISTS.
+        std::error_code obj_file_time_error;
+        std::filesystem::file_time_type obj_file_last_write_time = std::filesystem::last_write_time(obj_filepath, obj_file_time_error);
+        if (obj_file_time_error)
         {
-            // SKIP OVER ANY BLANK LINES.
-            bool is_blank_line = line.empty();
-            if (is_blank_line)
-            {
-                continue;
-            }
-
-            // SKIP OVER ANY COMMENT LINES.
-            constexpr char OBJ_COMMENT_CHARACTER = '#';
-            bool is_comment_line = line.starts_with(OBJ_COMMENT_CHARACTER);
-            if (is_comment_line)
-            {
-                continue;
-            }
+            return std::nullopt;
+        }
+        std::filesystem::path model_folder_path = obj_filepath.parent_path();
 
-            // TRACK ANY MATERIALS THAT NEED TO BE LOADED SEPARATELY.
-            const std::string MATERIAL_LIBRARY_KEYWORD = "mtllib";
-            bool is_material_file_line = line.starts_with(MATERIAL_LIBRARY_KEYWORD);
-            if (is_material_file_line)
+        // LOAD THE MODEL FROM ANY UP-TO-DATE CACHE.
+        bool binary_mesh_cache_enabled = !binary_mesh_cache_folder_path.empty();
+        std::filesystem::path binary_mesh_cache_filepath;
+        bool cache_up_to_date = false;
+        if (binary_mesh_cache_enabled)
+        {
+            binary_mesh_cache_filepath = BinaryMeshCacheFilepath(obj_filepath, binary_mesh_cache_folder_path);
+            std::error_code cache_file_time_error;
+            std::filesystem::file_time_type cache_file_last_write_time = std::filesystem::last_write_time(binary_mesh_cache_filepath, cache_file_time_error);
+            cache_up_to_date = !cache_file_time_error && (cache_file_last_write_time > obj_file_last_write_time);
+        }
+        if (cache_up_to_date)
+        {
+            std::unique_ptr<BinaryMeshFile> binary_mesh_file = BinaryMeshFile::Open(binary_mesh_cache_filepath);
+            if (binary_mesh_file)
             {
-                // FIND WHERE THE MATERIAL FILENAME STARTS IN THE LINE.
-                std::size_t space_separator_index = line.find(SPACE_SEPARATOR);
-                bool space_separator_found = (std::string::npos != space_separator_index);
-                if (!space_separator_found)
+                std::optional<Object3D> cached_object_3d = CreateObject(
+                    material_libraries_loader,
+                    model_folder_path,
+                    binary_mesh_file->MaterialFilenames(),
+                    binary_mesh_file->Vertices(),
+                    binary_mesh_file->Indices(),
+                    binary_mesh_file->MaterialRanges());
+                if (cached_object_3d)
                 {
-                    return std::nullopt;
+                    return cached_object_3d;
                 }
-
-                // The material filename starts right after the space separator.
-                std::size_t material_filename_start_index = space_separator_index + 1;
-
-                // READ THE MATERIAL FILENAME.
-                std::string material_filename = line.substr(material_filename_start_index);
-                material_filenames.push_back(material_filename);
-
-                // CONTINUE PROCESSING OTHER LINES.
-                continue;
             }
+        }
 
-            /// @todo   What to do with usemtl?
-            const std::string USE_MATERIAL_KEYWORD = "usemtl";
-            bool is_use_material_line = line.starts_with(USE_MATERIAL_KEYWORD);
-            if (is_use_material_line)
-            {
-                continue;
-            }
+        // MAP THE FILE INTO MEMORY.
+        // This avoids copying the file's contents, which can be very large for detailed models.
+        std::unique_ptr<FILESYSTEM::MemoryMappedFile> obj_file = FILESYSTEM::MemoryMappedFile::Open(obj_filepath);
+        if (!obj_file)
+        {
+            return std::nullopt;
+        }
 
-            // CHECK IF AN OBJECT IS BEING DEFINED.
-            /// @todo   Should this code handle multiple objects per file?
-            constexpr char OBJECT_INDICATOR = 'o';
-            bool is_named_object_line = line.starts_with(OBJECT_INDICATOR);
-            if (is_named_object_line)
-            {
-                /// @todo   Track object names?
-                continue;
-            }
+        // PARSE THE DATA FROM THE .OBJ FILE.
+        // Vertex positions, texture coordinates, normals, faces, and materials are read.
+        // Other features (like groups or curves) are ignored.
+        std::optional<WavefrontObjectData> obj_data = WavefrontObjectParser::Parse(obj_file->Text());
+        if (!obj_data)
+        {
+            return std::nullopt;
+        }
 
-            // CHECK IF VERTEX DATA IS BEING DEFINED.
-            constexpr char VERTEX_INDICATOR = 'v';
-            bool is_vertex_line = line.starts_with(VERTEX_INDICATOR);
-            if (is_vertex_line)
-            {
-                // CHECK THE TYPE OF VERTEX DATA BEING DEFINED.
-                const std::string VERTEX_TEXTURE_COORDINATE_INDICATOR = "vt";
-                const std::string VERTEX_NORMAL_INDICATOR = "vn";
-                bool is_vertex_texture_coordinates = line.starts_with(VERTEX_TEXTURE_COORDINATE_INDICATOR);
-                bool is_vertex_normal_data = line.starts_with(VERTEX_NORMAL_INDICATOR);
-                if (is_vertex_texture_coordinates)
-                {
-                    /// @todo   Handle.  Not important yet.
-                }
-                else if (is_vertex_normal_data)
-                {
-                    /// @todo   Handle.  Not important yet.
-                }
-                else
-                {
-                    // The line just consists of regular vertex postion data.
-
-                    /// @todo   Make this more efficient.
-                    std::istringstream line_data(line);
-                    // Skip past the vertex data type indicator.
-                    std::string vertex_data_type_indicator;
-                    line_data >> vertex_data_type_indicator;
-
-                    MATH::Vector3f vertex_position;
-                    line_data >> vertex_position.X;
-                    line_data >> vertex_position.Y;
-                    line_data >> vertex_position.Z;
-                    vertices.push_back(vertex_position);
-                }
-            }
+        // DEDUPLICATE VERTICES INTO AN INDEXED MESH.
+        std::optional<IndexedMesh> mesh = IndexedMesh::FromObjectData(*obj_data);
+        if (!mesh)
+        {
+            return std::nullopt;
+        }
 
-            /// @todo   What to do with shading line?
-            constexpr char SHADING_INDICATOR = 's';
-            bool is_shading_line = line.starts_with(SHADING_INDICATOR);
-            if (is_shading_line)
-            {
-                continue;
-            }
+        // FORM THE FINAL OBJECT.
+        std::optional<Object3D> object_3d = CreateObject(
+            material_libraries_loader,
+            model_folder_path,
+            mesh->MaterialFilenames,
+            mesh->Vertices,
+            mesh->Indices,
+            mesh->MaterialRanges);
+        if (!object_3d)
+        {
+            return std::nullopt;
+        }
 
-            constexpr char FACE_INDICATOR = 'f';
-            bool is_face_line = line.starts_with(FACE_INDICATOR);
-            if (is_face_line)
+        // CACHE THE GEOMETRY FOR FASTER LOADING IN THE FUTURE.
+        // Failing to write the cache only affects performance, so the model is still returned.
+        if (binary_mesh_cache_enabled)
+        {
+            std::error_code cache_folder_error;
+            std::filesystem::create_directories(binary_mesh_cache_folder_path, cache_folder_error);
+            bool cache_written = !cache_folder_error && BinaryMeshFile::Write(*mesh, binary_mesh_cache_filepath);
+            if (binary_mesh_cache_write_failed)
             {
-                // The line has the following format:
-                // f v1_index/vt1_index/vn1_index v2_index/vt2_index/vn2_index v3_index/vt3_index/vn3_index
-
-                /// @todo   Make this more efficient.
-                std::istringstream line_data(line);
-                // Skip past the face data type indicator.
-                std::string face_data_type_indicator;
-                line_data >> face_data_type_indicator;
-
-                /// @todo   Make the below more robust and read in all indices.
-
-                std::string first_vertex_indices;
-                line_data >> first_vertex_indices;
-
-                constexpr char VERTEX_INDEX_DELIMITER = '/';
-                std::size_t first_vertex_delimiter_position = first_vertex_indices.find(VERTEX_INDEX_DELIMITER);
-                std::string first_vertex_index_string = first_vertex_indices.substr(0, first_vertex_delimiter_position);
-                std::size_t first_vertex_index = std::stoul(first_vertex_index_string);
-
-                // The vertex indices in the file start at 1, rather than 0.
-                constexpr std::size_t VERTEX_INDEX_OFFSET = 1;
-                first_vertex_index -= VERTEX_INDEX_OFFSET;
-
-                std::string second_vertex_indices;
-                line_data >> second_vertex_indices;
-
-                std::size_t second_vertex_delimiter_position = second_vertex_indices.find(VERTEX_INDEX_DELIMITER);
-                std::string second_vertex_index_string = second_vertex_indices.substr(0, second_vertex_delimiter_position);
-                std::size_t second_vertex_index = std::stoul(second_vertex_index_string);
-
-                second_vertex_index -= VERTEX_INDEX_OFFSET;
-
-                std::string third_vertex_indices;
-                line_data >> third_vertex_indices;
-
-                std::size_t third_vertex_delimiter_position = third_vertex_indices.find(VERTEX_INDEX_DELIMITER);
-                std::string third_vertex_index_string = third_vertex_indices.substr(0, third_vertex_delimiter_position);
-                std::size_t third_vertex_index = std::stoul(third_vertex_index_string);
-
-                third_vertex_index -= VERTEX_INDEX_OFFSET;
-
-                auto face_indices = std::make_tuple(first_vertex_index, second_vertex_index, third_vertex_index);
-                face_vertex_indices.push_back(face_indices);
+                *binary_mesh_cache_write_failed = !cache_written;
             }
         }
 
+        return object_3d;
+    }
+
+    /// Creates an object from mesh data loaded from a .obj file (or its cache).
+    /// Any referenced materials are loaded as part of this.  Triangles using materials
+    /// that can't be found (or without any explicit material) use the first loaded material.
+    /// @param[in]  material_libraries_loader - The function to load any referenced material libraries.
+    /// @param[in]  model_folder_path - The folder containing the .obj file.
+    /// @param[in]  material_filenames - The filenames of material libraries referenced by the .obj file.
+    /// @param[in]  vertices - All unique vertices.
+    /// @param[in]  indices - The zero-based vertex indices of each triangle.
+    /// @param[in]  material_ranges - The materials used for ranges of indices.
+    /// @return The 3D object, if all triangles were valid; null otherwise.
+    std::optional<Object3D> WavefrontObjectModel::CreateObject(
+        const MaterialLibrariesLoader& material_libraries_loader,
+        const std::filesystem::path& model_folder_path,
+        const std::vector<std::filesystem::path>& material_filenames,
+        const std::span<const IndexedMesh::Vertex> vertices,
+        const std::span<const uint32_t> indices,
+        const std::vector<IndexedMesh::MaterialRange>& material_ranges)
+    {
         // LOAD ANY MATERIALS.
         // Materials are expected to all be within the same folder as the .obj file.
-        std::filesystem::path model_folder_path = obj_filepath.parent_path();
-        std::vector<std::shared_ptr<Material>> materials;
+        // If multiple libraries define materials with the same name, the first is used.
+        std::vector<std::filesystem::path> material_filepaths;
         for (const auto& material_filename : material_filenames)
         {
-            std::filesystem::path material_filepath = model_folder_path / material_filename;
-            std::shared_ptr<Material> material = WavefrontMaterial::Load(material_filepath);
-            if (material)
+            material_filepaths.push_back(model_folder_path / material_filename);
+        }
+        std::vector<WavefrontMaterial> materials = material_libraries_loader(material_filepaths);
+
+        // INDEX THE MATERIALS BY NAME.
+        std::shared_ptr<Material> default_material = materials.empty() ? nullptr : materials.front().Material;
+        std::unordered_map<std::string, std::shared_ptr<Material>> materials_by_name;
+        for (const WavefrontMaterial& material : materials)
+        {
+            materials_by_name.try_emplace(material.Name, material.Material);
+        }
+
+        // MAKE SURE ALL TRIANGLES ONLY REFERENCE EXISTING VERTICES.
+        constexpr std::size_t TRIANGLE_VERTEX_COUNT = Triangle::VERTEX_COUNT;
+        bool indices_form_triangles = (0 == indices.size() % TRIANGLE_VERTEX_COUNT);
+        if (!indices_form_triangles)
+        {
+            return std::nullopt;
+        }
+        for (const uint32_t vertex_index : indices)
+        {
+            bool vertex_exists = (vertex_index < vertices.size());
+            if (!vertex_exists)
             {
-                materials.push_back(material);
+                return std::nullopt;
             }
         }
 
         // FORM THE FINAL OBJECT.
+        // Triangles outside of any material range use the default material.
         Object3D object_3d;
-        for (const std::tuple<std::size_t, std::size_t, std::size_t>& face : face_vertex_indices)
+        object_3d.Triangles.reserve(indices.size() / TRIANGLE_VERTEX_COUNT);
+        std::vector<std::shared_ptr<Material>> triangle_materials(indices.size() / TRIANGLE_VERTEX_COUNT, default_material);
+        for (const IndexedMesh::MaterialRange& material_range : material_ranges)
+        {
+            // SKIP ANY RANGES WITHOUT KNOWN MATERIALS.
+            auto material = materials_by_name.find(material_range.MaterialName);
+            bool material_found = (materials_by_name.cend() != material);
+            if (!material_found)
+            {
+                continue;
+            }
+
+            // ASSIGN THE MATERIAL TO ALL TRIANGLES IN THE RANGE.
+            std::size_t first_triangle_index = material_range.FirstIndex / TRIANGLE_VERTEX_COUNT;
+            std::size_t end_triangle_index = std::min<std::size_t>(
+                (static_cast<std::size_t>(material_range.FirstIndex) + material_range.IndexCount) / TRIANGLE_VERTEX_COUNT,
+                triangle_materials.size());
+            for (std::size_t triangle_index = first_triangle_index; triangle_index < end_triangle_index; ++triangle_index)
+            {
+                triangle_materials[triangle_index] = material->second;
+            }
+        }
+        for (std::size_t triangle_index = 0; triangle_index < triangle_materials.size(); ++triangle_index)
         {
             // GET THE VERTICES.
-            MATH::Vector3f first_vertex = vertices.at(std::get<0>(face));
-            MATH::Vector3f second_vertex = vertices.at(std::get<1>(face));
-            MATH::Vector3f third_vertex = vertices.at(std::get<2>(face));
+            std::size_t first_index = triangle_index * TRIANGLE_VERTEX_COUNT;
+            const MATH::Vector3f& first_vertex = vertices[indices[first_index]].Position;
+            const MATH::Vector3f& second_vertex = vertices[indices[first_index + 1]].Position;
+            const MATH::Vector3f& third_vertex = vertices[indices[first_index + 2]].Position;
 
             // ADD THE CURRENT TRIANGLE.
-            /// @todo   How to handle materials?  Need some kind of permanent storage.
-            Triangle triangle(materials[0], { first_vertex, second_vertex, third_vertex });
+            Triangle triangle(triangle_materials[triangle_index], { first_vertex, second_vertex, third_vertex });
             object_3d.Triangles.push_back(triangle);
         }
 
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+#include "Graphics/Modeling/IndexedMesh.h"
+#include "Graphics/Modeling/WavefrontMaterial.h"
 #include "Graphics/Object3D.h"
 
 /// Holds code related to 3D models in computer graphics.
@@ -11,10 +18,33 @@ namespace GRAPHICS::MODELING
     /// This is generally the simplest widely-supported 3D model format that is readable as plain text.
     /// This class is named based on the "model" concept rather than a "file" concept since
     /// a 3D model may include additional files such as a .mtl material file.
-    /// This class only supports files with triangulated faces (not quads).
+    /// Faces with more than 3 vertices are split into triangles.
     class WavefrontObjectModel
     {
     public:
-        static std::optional<Object3D> Load(const std::filesystem::path& obj_filepath);
+        /// The extension of binary mesh cache files.
+        static constexpr std::string_view BINARY_MESH_CACHE_FILE_EXTENSION = ".mesh";
+
+        /// A function that loads all materials (including any textures) from material libraries,
+        /// returning the materials from all successfully loaded libraries in order.
+        /// This allows callers to control how dependencies are loaded (like in parallel).
+        using MaterialLibrariesLoader = std::function<std::vector<WavefrontMaterial>(const std::vector<std::filesystem::path>& mtl_filepaths)>;
+
+        static std::filesystem::path BinaryMeshCacheFilepath(const std::filesystem::path& obj_filepath, const std::filesystem::path& cache_folder_path);
+        static std::vector<WavefrontMaterial> LoadMaterialLibraries(const std::vector<std::filesystem::path>& mtl_filepaths);
+        static std::optional<Object3D> Load(
+            const std::filesystem::path& obj_filepath,
+            const MaterialLibrariesLoader& material_libraries_loader = LoadMaterialLibraries,
+            const std::filesystem::path& binary_mesh_cache_folder_path = "",
+            bool* const binary_mesh_cache_write_failed = nullptr);
+
+    private:
+        static std::optional<Object3D> CreateObject(
+            const MaterialLibrariesLoader& material_libraries_loader,
+            const std::filesystem::path& model_folder_path,
+            const std::vector<std::filesystem::path>& material_filenames,
+            const std::span<const IndexedMesh::Vertex> vertices,
+            const std::span<const uint32_t> indices,
+            const std::vector<IndexedMesh::MaterialRange>& material_ranges);
     };
 }
@@ -0,0 +1,496 @@
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <thread>
+#include "Benchmarking/Profiler.h"
+#include "Graphics/Modeling/WavefrontObjectParser.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// Parses the text of a .obj file.
+    /// Vertex data, faces, and materials are read; other lines are ignored.
+    /// @param[in]  obj_text - The full text of the .obj file.
+    /// @param[in]  max_thread_count - The maximum number of threads to parse with.
+    ///     0 uses the number of hardware threads available.
+    /// @return The parsed data, if successfully parsed; null otherwise.
+    std::optional<WavefrontObjectData> WavefrontObjectParser::Parse(std::string_view obj_text, unsigned int max_thread_count)
+    {
+        PROFILE_ZONE("Parse OBJ");
+
+        // DETERMINE HOW MANY CHUNKS TO SPLIT THE TEXT INTO.
+        if (0 == max_thread_count)
+        {
+            max_thread_count = std::max(1u, std::thread::hardware_concurrency());
+        }
+        std::size_t max_chunk_count_for_text_size = std::max<std::size_t>(1, obj_text.size() / MIN_CHUNK_SIZE_IN_CHARACTERS);
+        std::size_t chunk_count = std::min<std::size_t>(max_thread_count, max_chunk_count_for_text_size);
+
+        // SPLIT THE TEXT INTO CHUNKS AT LINE BOUNDARIES.
+        // Chunks are roughly equal in size, with each extended to the end of its last line.
+        std::vector<std::string_view> chunks;
+        std::size_t chunk_start_index = 0;
+        for (std::size_t chunk_index = 1; chunk_index <= chunk_count; ++chunk_index)
+        {
+            std::size_t chunk_end_index = obj_text.size();
+            bool is_last_chunk = (chunk_count == chunk_index);
+            if (!is_last_chunk)
+            {
+                std::size_t approximate_chunk_end_index = std::max(chunk_start_index, (obj_text.size() * chunk_index) / chunk_count);
+                std::size_t line_end_index = obj_text.find('\n', approximate_chunk_end_index);
+                bool line_end_found = (std::string_view::npos != line_end_index);
+                if (line_end_found)
+                {
+                    chunk_end_index = line_end_index + 1;
+                }
+            }
+
+            chunks.push_back(obj_text.substr(chunk_start_index, chunk_end_index - chunk_start_index));
+            chunk_start_index = chunk_end_index;
+        }
+
+        // PARSE ALL CHUNKS IN PARALLEL.
+        // The first chunk is parsed on this thread since it would otherwise just be waiting.
+        std::vector<std::optional<ChunkData>> chunk_data(chunks.size());
+        std::vector<std::thread> chunk_threads;
+        for (std::size_t chunk_index = 1; chunk_index < chunks.size(); ++chunk_index)
+        {
+            chunk_threads.emplace_back([&chunks, &chunk_data, chunk_index]()
+            {
+                chunk_data[chunk_index] = ParseChunk(chunks[chunk_index]);
+            });
+        }
+        chunk_data[0] = ParseChunk(chunks[0]);
+        for (std::thread& chunk_thread : chunk_threads)
+        {
+            chunk_thread.join();
+        }
+
+        bool all_chunks_parsed = std::ranges::all_of(
+            chunk_data,
+            [](const std::optional<ChunkData>& current_chunk_data) { return current_chunk_data.has_value(); });
+        if (!all_chunks_parsed)
+        {
+            return std::nullopt;
+        }
+
+        // MERGE THE DATA FROM ALL CHUNKS IN ORDER.
+        // The first chunk's data is moved to avoid copying anything when there is only a single chunk.
+        WavefrontObjectData data = std::move(chunk_data[0]->Data);
+        std::vector<std::array<std::size_t, static_cast<std::size_t>(FaceIndexType::COUNT)>> chunk_data_offsets(chunk_data.size());
+        std::vector<std::size_t> chunk_face_offsets(chunk_data.size());
+        for (std::size_t chunk_index = 1; chunk_index < chunk_data.size(); ++chunk_index)
+        {
+            // TRACK WHERE THE CHUNK'S DATA STARTS.
+            chunk_data_offsets[chunk_index][static_cast<std::size_t>(FaceIndexType::POSITION)] = data.VertexPositions.size();
+            chunk_data_offsets[chunk_index][static_cast<std::size_t>(FaceIndexType::TEXTURE_COORDINATE)] = data.VertexTextureCoordinates.size();
+            chunk_data_offsets[chunk_index][static_cast<std::size_t>(FaceIndexType::NORMAL)] = data.VertexNormals.size();
+            chunk_face_offsets[chunk_index] = data.Faces.size();
+
+            // APPEND THE CHUNK'S DATA.
+            WavefrontObjectData& current_chunk_data = chunk_data[chunk_index]->Data;
+            std::ranges::move(current_chunk_data.MaterialFilenames, std::back_inserter(data.MaterialFilenames));
+            data.VertexPositions.insert(data.VertexPositions.end(), current_chunk_data.VertexPositions.cbegin(), current_chunk_data.VertexPositions.cend());
+            data.VertexTextureCoordinates.insert(data.VertexTextureCoordinates.end(), current_chunk_data.VertexTextureCoordinates.cbegin(), current_chunk_data.VertexTextureCoordinates.cend());
+            data.VertexNormals.insert(data.VertexNormals.end(), current_chunk_data.VertexNormals.cbegin(), current_chunk_data.VertexNormals.cend());
+            data.Faces.insert(data.Faces.end(), current_chunk_data.Faces.cbegin(), current_chunk_data.Faces.cend());
+            for (WavefrontMaterialUse& material_use : current_chunk_data.MaterialUses)
+            {
+                material_use.FirstFaceIndex += chunk_face_offsets[chunk_index];
+                data.MaterialUses.push_back(std::move(material_use));
+            }
+        }
+
+        // RESOLVE ANY RELATIVE FACE INDICES NOW THAT ALL DATA IS IN ITS FINAL LOCATION.
+        for (std::size_t chunk_index = 0; chunk_index < chunk_data.size(); ++chunk_index)
+        {
+            for (const RelativeFaceIndex& relative_face_index : chunk_data[chunk_index]->RelativeFaceIndices)
+            {
+                // MAKE SURE THE INDEX DOESN'T REFERENCE DATA BEFORE THE START OF THE FILE.
+                std::size_t index_type = static_cast<std::size_t>(relative_face_index.IndexType);
+                int64_t absolute_index = static_cast<int64_t>(chunk_data_offsets[chunk_index][index_type]) + relative_face_index.ChunkIndex;
+                bool absolute_index_valid = (0 <= absolute_index) && (absolute_index < WavefrontFaceVertex::NO_INDEX);
+                if (!absolute_index_valid)
+                {
+                    return std::nullopt;
+                }
+
+                // UPDATE THE FACE.
+                std::size_t face_index = chunk_face_offsets[chunk_index] + relative_face_index.FaceIndex;
+                WavefrontFaceVertex& face_vertex = data.Faces[face_index][relative_face_index.FaceVertexIndex];
+                switch (relative_face_index.IndexType)
+                {
+                    case FaceIndexType::POSITION:
+                        face_vertex.PositionIndex = static_cast<uint32_t>(absolute_index);
+                        break;
+                    case FaceIndexType::TEXTURE_COORDINATE:
+                        face_vertex.TextureCoordinateIndex = static_cast<uint32_t>(absolute_index);
+                        break;
+                    case FaceIndexType::NORMAL:
+                        face_vertex.NormalIndex = static_cast<uint32_t>(absolute_index);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        return data;
+    }
+
+    /// Parses a chunk of complete lines from a .obj file.
+    /// @param[in]  chunk_text - The text of the chunk.
+    /// @return The data in the chunk, if successfully parsed; null otherwise.
+    std::optional<WavefrontObjectParser::ChunkData> WavefrontObjectParser::ParseChunk(std::string_view chunk_text)
+    {
+        PROFILE_ZONE("Parse OBJ chunk");
+
+        ChunkData chunk_data;
+        while (!chunk_text.empty())
+        {
+            // GET THE NEXT LINE.
+            std::size_t line_end_index = chunk_text.find('\n');
+            std::string_view line = chunk_text.substr(0, line_end_index);
+            bool last_line = (std::string_view::npos == line_end_index);
+            chunk_text.remove_prefix(last_line ? chunk_text.size() : line_end_index + 1);
+
+            // PARSE THE LINE.
+            bool line_parsed = ParseLine(line, chunk_data);
+            if (!line_parsed)
+            {
+                return std::nullopt;
+            }
+        }
+
+        return chunk_data;
+    }
+
+    /// Parses a single line from a .obj file.
+    /// @param[in]  line - The line to parse, without any newline character.
+    /// @param[in,out]  chunk_data - The data for the current chunk to add any parsed data to.
+    /// @return True if the line was successfully parsed (or ignored); false if it was invalid.
+    bool WavefrontObjectParser::ParseLine(std::string_view line, ChunkData& chunk_data)
+    {
+        // SKIP OVER ANY BLANK LINES.
+        SkipWhitespace(line);
+        bool is_blank_line = line.empty();
+        if (is_blank_line)
+        {
+            return true;
+        }
+
+        // SKIP OVER ANY COMMENT LINES.
+        constexpr char OBJ_COMMENT_CHARACTER = '#';
+        bool is_comment_line = line.starts_with(OBJ_COMMENT_CHARACTER);
+        if (is_comment_line)
+        {
+            return true;
+        }
+
+        // SPLIT THE KEYWORD FROM THE REST OF THE LINE.
+        constexpr std::string_view WHITESPACE_CHARACTERS = " \t\r";
+        std::size_t keyword_end_index = std::min(line.find_first_of(WHITESPACE_CHARACTERS), line.size());
+        std::string_view keyword = line.substr(0, keyword_end_index);
+        line.remove_prefix(keyword_end_index);
+
+        // READ ANY VERTEX POSITION DATA.
+        WavefrontObjectData& data = chunk_data.Data;
+        constexpr std::string_view VERTEX_POSITION_KEYWORD = "v";
+        bool is_vertex_position_line = (VERTEX_POSITION_KEYWORD == keyword);
+        if (is_vertex_position_line)
+        {
+            MATH::Vector3f vertex_position;
+            bool vertex_position_parsed = (
+                ParseFloat(line, vertex_position.X) &&
+                ParseFloat(line, vertex_position.Y) &&
+                ParseFloat(line, vertex_position.Z));
+            if (!vertex_position_parsed)
+            {
+                return false;
+            }
+
+            data.VertexPositions.push_back(vertex_position);
+            return true;
+        }
+
+        // READ ANY VERTEX TEXTURE COORDINATE DATA.
+        constexpr std::string_view VERTEX_TEXTURE_COORDINATE_KEYWORD = "vt";
+        bool is_vertex_texture_coordinate_line = (VERTEX_TEXTURE_COORDINATE_KEYWORD == keyword);
+        if (is_vertex_texture_coordinate_line)
+        {
+            // The second coordinate is optional and defaults to 0.  Any third coordinate is ignored.
+            MATH::Vector2f vertex_texture_coordinates;
+            bool vertex_texture_coordinates_parsed = ParseFloat(line, vertex_texture_coordinates.X);
+            if (!vertex_texture_coordinates_parsed)
+            {
+                return false;
+            }
+            SkipWhitespace(line);
+            if (!line.empty())
+            {
+                bool second_texture_coordinate_parsed = ParseFloat(line, vertex_texture_coordinates.Y);
+                if (!second_texture_coordinate_parsed)
+                {
+                    return false;
+                }
+            }
+
+            data.VertexTextureCoordinates.push_back(vertex_texture_coordinates);
+            return true;
+        }
+
+        // READ ANY VERTEX NORMAL DATA.
+        constexpr std::string_view VERTEX_NORMAL_KEYWORD = "vn";
+        bool is_vertex_normal_line = (VERTEX_NORMAL_KEYWORD == keyword);
+        if (is_vertex_normal_line)
+        {
+            MATH::Vector3f vertex_normal;
+            bool vertex_normal_parsed = (
+                ParseFloat(line, vertex_normal.X) &&
+                ParseFloat(line, vertex_normal.Y) &&
+                ParseFloat(line, vertex_normal.Z));
+            if (!vertex_normal_parsed)
+            {
+                return false;
+            }
+
+            data.VertexNormals.push_back(vertex_normal);
+            return true;
+        }
+
+        // READ ANY FACE DATA.
+        constexpr std::string_view FACE_KEYWORD = "f";
+        bool is_face_line = (FACE_KEYWORD == keyword);
+        if (is_face_line)
+        {
+            bool face_parsed = ParseFace(line, chunk_data);
+            return face_parsed;
+        }
+
+        // READ ANY LINES WITH A NAME AS THE REMAINDER OF THE LINE.
+        // Names may contain spaces.
+        constexpr std::string_view MATERIAL_LIBRARY_KEYWORD = "mtllib";
+        constexpr std::string_view USE_MATERIAL_KEYWORD = "usemtl";
+        bool is_material_library_line = (MATERIAL_LIBRARY_KEYWORD == keyword);
+        bool is_use_material_line = (USE_MATERIAL_KEYWORD == keyword);
+        if (is_material_library_line || is_use_material_line)
+        {
+            // GET THE NAME.
+            SkipWhitespace(line);
+            std::size_t name_end_index = line.find_last_not_of(WHITESPACE_CHARACTERS);
+            bool name_exists = (std::string_view::npos != name_end_index);
+            if (!name_exists)
+            {
+                return false;
+            }
+            std::string_view name = line.substr(0, name_end_index + 1);
+
+            // STORE THE NAME.
+            if (is_material_library_line)
+            {
+                data.MaterialFilenames.emplace_back(name);
+            }
+            else
+            {
+                data.MaterialUses.push_back(WavefrontMaterialUse
+                {
+                    .MaterialName = std::string(name),
+                    .FirstFaceIndex = data.Faces.size()
+                });
+            }
+            return true;
+        }
+
+        // IGNORE ANY OTHER UNSUPPORTED LINES.
+        return true;
+    }
+
+    /// Parses the vertices of a face, splitting it into triangles if needed.
+    /// @param[in]  line - The remainder of the face line after the keyword.
+    ///     Each vertex has one of the following formats:
+    ///     v_index, v_index/vt_index, v_index//vn_index, or v_index/vt_index/vn_index.
+    /// @param[in,out]  chunk_data - The data for the current chunk to add the face to.
+    /// @return True if the face was successfully parsed; false otherwise.
+    bool WavefrontObjectParser::ParseFace(std::string_view line, ChunkData& chunk_data)
+    {
+        // PARSE THE INDICES FOR EACH VERTEX.
+        WavefrontObjectData& data = chunk_data.Data;
+        constexpr std::size_t POSITION = static_cast<std::size_t>(FaceIndexType::POSITION);
+        constexpr std::size_t TEXTURE_COORDINATE = static_cast<std::size_t>(FaceIndexType::TEXTURE_COORDINATE);
+        constexpr std::size_t NORMAL = static_cast<std::size_t>(FaceIndexType::NORMAL);
+        constexpr char INDEX_DELIMITER = '/';
+        chunk_data.CurrentFaceIndices.clear();
+        SkipWhitespace(line);
+        while (!line.empty())
+        {
+            // PARSE THE POSITION INDEX.
+            std::array<ChunkFaceIndex, static_cast<std::size_t>(FaceIndexType::COUNT)> vertex_indices = {};
+            bool position_index_parsed = ParseFaceIndex(line, data.VertexPositions.size(), vertex_indices[POSITION]);
+            if (!position_index_parsed)
+            {
+                return false;
+            }
+
+            // PARSE ANY TEXTURE COORDINATE AND NORMAL INDICES.
+            if (line.starts_with(INDEX_DELIMITER))
+            {
+                line.remove_prefix(1);
+                bool texture_coordinate_index_exists = !line.empty() && !line.starts_with(INDEX_DELIMITER);
+                if (texture_coordinate_index_exists)
+                {
+                    bool texture_coordinate_index_parsed = ParseFaceIndex(line, data.VertexTextureCoordinates.size(), vertex_indices[TEXTURE_COORDINATE]);
+                    if (!texture_coordinate_index_parsed)
+                    {
+                        return false;
+                    }
+                }
+
+                if (line.starts_with(INDEX_DELIMITER))
+                {
+                    line.remove_prefix(1);
+                    bool normal_index_parsed = ParseFaceIndex(line, data.VertexNormals.size(), vertex_indices[NORMAL]);
+                    if (!normal_index_parsed)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            // MAKE SURE THE VERTEX DIDN'T HAVE ANY EXTRA CHARACTERS.
+            std::size_t whitespace_character_count = std::min(line.find_first_not_of(" \t\r"), line.size());
+            bool vertex_ended = line.empty() || (whitespace_character_count > 0);
+            if (!vertex_ended)
+            {
+                return false;
+            }
+            line.remove_prefix(whitespace_character_count);
+
+            chunk_data.CurrentFaceIndices.push_back(vertex_indices);
+        }
+
+        // MAKE SURE THE FACE HAS ENOUGH VERTICES.
+        constexpr std::size_t TRIANGLE_VERTEX_COUNT = 3;
+        bool face_has_enough_vertices = (chunk_data.CurrentFaceIndices.size() >= TRIANGLE_VERTEX_COUNT);
+        if (!face_has_enough_vertices)
+        {
+            return false;
+        }
+
+        // ADD TRIANGLES FANNING OUT FROM THE FIRST VERTEX.
+        for (std::size_t next_vertex_index = 2; next_vertex_index < chunk_data.CurrentFaceIndices.size(); ++next_vertex_index)
+        {
+            std::size_t face_index = data.Faces.size();
+            std::array<std::size_t, TRIANGLE_VERTEX_COUNT> polygon_vertex_indices = { 0, next_vertex_index - 1, next_vertex_index };
+            std::array<WavefrontFaceVertex, TRIANGLE_VERTEX_COUNT> triangle = {};
+            for (std::size_t triangle_vertex_index = 0; triangle_vertex_index < TRIANGLE_VERTEX_COUNT; ++triangle_vertex_index)
+            {
+                // GET THE INDICES FOR THE CURRENT VERTEX.
+                const auto& vertex_indices = chunk_data.CurrentFaceIndices[polygon_vertex_indices[triangle_vertex_index]];
+                std::array<uint32_t*, static_cast<std::size_t>(FaceIndexType::COUNT)> triangle_vertex_indices =
+                {
+                    &triangle[triangle_vertex_index].PositionIndex,
+                    &triangle[triangle_vertex_index].TextureCoordinateIndex,
+                    &triangle[triangle_vertex_index].NormalIndex,
+                };
+                for (std::size_t index_type = 0; index_type < vertex_indices.size(); ++index_type)
+                {
+                    // Relative indices are resolved once all chunks have been parsed.
+                    const ChunkFaceIndex& chunk_face_index = vertex_indices[index_type];
+                    if (chunk_face_index.RelativeToChunk)
+                    {
+                        chunk_data.RelativeFaceIndices.push_back(RelativeFaceIndex
+                        {
+                            .FaceIndex = face_index,
+                            .FaceVertexIndex = triangle_vertex_index,
+                            .IndexType = static_cast<FaceIndexType>(index_type),
+                            .ChunkIndex = chunk_face_index.Index
+                        });
+                    }
+                    else
+                    {
+                        *triangle_vertex_indices[index_type] = static_cast<uint32_t>(chunk_face_index.Index);
+                    }
+                }
+            }
+
+            data.Faces.push_back(triangle);
+        }
+
+        return true;
+    }
+
+    /// Parses a floating-point number from the start of some text.
+    /// @param[in,out]  text - The text to parse.  Leading whitespace is skipped.
+    ///     Updated to start right after the parsed number.
+    /// @param[out] value - The parsed number.
+    /// @return True if a number was parsed; false otherwise.
+    bool WavefrontObjectParser::ParseFloat(std::string_view& text, float& value)
+    {
+        // SKIP ANY LEADING WHITESPACE OR PLUS SIGN.
+        // std::from_chars doesn't accept leading plus signs.
+        SkipWhitespace(text);
+        if (text.starts_with('+'))
+        {
+            text.remove_prefix(1);
+        }
+
+        // PARSE THE NUMBER.
+        const char* text_end = text.data() + text.size();
+        std::from_chars_result result = std::from_chars(text.data(), text_end, value);
+        bool number_parsed = (std::errc() == result.ec);
+        if (!number_parsed)
+        {
+            return false;
+        }
+
+        text.remove_prefix(result.ptr - text.data());
+        return true;
+    }
+
+    /// Parses a single index for a face vertex.
+    /// @param[in,out]  text - The text to parse.  Updated to start right after the parsed index.
+    /// @param[in]  chunk_data_count - The number of elements of the referenced data type
+    ///     defined so far in the current chunk, which negative indices are relative to.
+    /// @param[out] index - The parsed index, converted to start at 0.
+    /// @return True if a valid index was parsed; false otherwise.
+    bool WavefrontObjectParser::ParseFaceIndex(std::string_view& text, const std::size_t chunk_data_count, ChunkFaceIndex& index)
+    {
+        // PARSE THE INDEX.
+        const char* text_end = text.data() + text.size();
+        int64_t one_based_index = 0;
+        std::from_chars_result result = std::from_chars(text.data(), text_end, one_based_index);
+        bool index_parsed = (std::errc() == result.ec);
+        if (!index_parsed)
+        {
+            return false;
+        }
+        text.remove_prefix(result.ptr - text.data());
+
+        // CONVERT THE INDEX TO START AT 0.
+        // Positive indices start at 1 from the beginning of the file.
+        // Negative indices count backwards from the most recently defined data (-1 being the last).
+        bool index_relative = (one_based_index < 0);
+        if (index_relative)
+        {
+            index.Index = static_cast<int64_t>(chunk_data_count) + one_based_index;
+            index.RelativeToChunk = true;
+            return true;
+        }
+        else
+        {
+            // Indices too large for 32 bits aren't supported.
+            constexpr int64_t VERTEX_INDEX_OFFSET = 1;
+            index.Index = one_based_index - VERTEX_INDEX_OFFSET;
+            index.RelativeToChunk = false;
+            bool index_valid = (0 <= index.Index) && (index.Index < WavefrontFaceVertex::NO_INDEX);
+            return index_valid;
+        }
+    }
+
+    /// Skips over any whitespace at the start of some text.
+    /// @param[in,out]  text - The text to update to start at the first non-whitespace character.
+    void WavefrontObjectParser::SkipWhitespace(std::string_view& text)
+    {
+        std::size_t first_non_whitespace_index = std::min(text.find_first_not_of(" \t\r"), text.size());
+        text.remove_prefix(first_non_whitespace_index);
+    }
+}
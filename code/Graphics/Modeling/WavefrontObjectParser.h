@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS::MODELING
+{
+    /// A single vertex of a face in a Wavefront .obj file, referencing separately defined data.
+    struct WavefrontFaceVertex
+    {
+        /// The index used for data that isn't referenced by a face vertex.
+        static constexpr uint32_t NO_INDEX = std::numeric_limits<uint32_t>::max();
+
+        /// The zero-based index of the vertex position.
+        uint32_t PositionIndex = 0;
+        /// The zero-based index of the vertex texture coordinates, if any; NO_INDEX otherwise.
+        uint32_t TextureCoordinateIndex = NO_INDEX;
+        /// The zero-based index of the vertex normal, if any; NO_INDEX otherwise.
+        uint32_t NormalIndex = NO_INDEX;
+
+        bool operator==(const WavefrontFaceVertex& rhs) const = default;
+    };
+
+    /// A material used for all faces starting at some point in a Wavefront .obj file.
+    struct WavefrontMaterialUse
+    {
+        /// The name of the material, as defined in one of the material libraries.
+        std::string MaterialName = "";
+        /// The index of the first face using the material.  The material is used
+        /// until the next material use (or the end of the file).
+        std::size_t FirstFaceIndex = 0;
+
+        bool operator==(const WavefrontMaterialUse& rhs) const = default;
+    };
+
+    /// The raw data from a Wavefront .obj file, before being formed into 3D objects.
+    struct WavefrontObjectData
+    {
+        /// The filenames of any referenced material libraries, in the order referenced.
+        std::vector<std::filesystem::path> MaterialFilenames = {};
+        /// The positions of all vertices, in the order defined.
+        std::vector<MATH::Vector3f> VertexPositions = {};
+        /// The texture coordinates of all vertices, in the order defined.
+        std::vector<MATH::Vector2f> VertexTextureCoordinates = {};
+        /// The normals of all vertices, in the order defined.
+        std::vector<MATH::Vector3f> VertexNormals = {};
+        /// All faces, in the order defined.  Faces with more than 3 vertices
+        /// are split into triangles fanning out from their first vertex.
+        std::vector<std::array<WavefrontFaceVertex, 3>> Faces = {};
+        /// The materials used for faces, in the order used.
+        std::vector<WavefrontMaterialUse> MaterialUses = {};
+    };
+
+    /// A parser for the text of Wavefront .obj files, designed to handle
+    /// very large files quickly.  Text is parsed in place without any per-line
+    /// string allocations, using std::from_chars for numbers, and large inputs
+    /// are split into chunks at line boundaries that are parsed in parallel
+    /// before being merged back together in their original order.
+    class WavefrontObjectParser
+    {
+    public:
+        /// The minimum amount of text each thread parses.
+        /// Smaller inputs are parsed on fewer threads since starting threads isn't free.
+        static constexpr std::size_t MIN_CHUNK_SIZE_IN_CHARACTERS = 1 << 20;
+
+        static std::optional<WavefrontObjectData> Parse(std::string_view obj_text, unsigned int max_thread_count = 0);
+
+    private:
+        /// The different kinds of data that faces reference by index.
+        enum class FaceIndexType
+        {
+            POSITION = 0,
+            TEXTURE_COORDINATE,
+            NORMAL,
+            COUNT
+        };
+
+        /// A face vertex index that is relative to the data defined before it (a negative index),
+        /// which can only be resolved once the amount of data in earlier chunks is known.
+        struct RelativeFaceIndex
+        {
+            /// The index of the face (within the chunk) with the relative index.
+            std::size_t FaceIndex = 0;
+            /// The index of the vertex within the face.
+            std::size_t FaceVertexIndex = 0;
+            /// The kind of data referenced.
+            FaceIndexType IndexType = FaceIndexType::POSITION;
+            /// The zero-based index relative to the start of the chunk.  May be negative
+            /// if the data is defined in an earlier chunk.
+            int64_t ChunkIndex = 0;
+        };
+
+        /// A face vertex index as it appears within a chunk.
+        struct ChunkFaceIndex
+        {
+            /// The zero-based index, either from the start of the file or the start of the chunk.
+            int64_t Index = WavefrontFaceVertex::NO_INDEX;
+            /// True if the index is relative to the start of the chunk; false otherwise.
+            bool RelativeToChunk = false;
+        };
+
+        /// The data parsed from a single chunk.
+        struct ChunkData
+        {
+            /// The data in the chunk.  Face indices and material uses are relative to the chunk.
+            WavefrontObjectData Data = {};
+            /// Any face indices that still need to be resolved.
+            std::vector<RelativeFaceIndex> RelativeFaceIndices = {};
+            /// The indices of each vertex in the face currently being parsed.
+            /// Kept here to avoid allocating memory for each face.
+            std::vector<std::array<ChunkFaceIndex, static_cast<std::size_t>(FaceIndexType::COUNT)>> CurrentFaceIndices = {};
+        };
+
+        // HELPER METHODS.
+        static std::optional<ChunkData> ParseChunk(std::string_view chunk_text);
+        static bool ParseLine(std::string_view line, ChunkData& chunk_data);
+        static bool ParseFace(std::string_view line, ChunkData& chunk_data);
+        static bool ParseFloat(std::string_view& text, float& value);
+        static bool ParseFaceIndex(std::string_view& text, const std::size_t chunk_data_count, ChunkFaceIndex& index);
+        static void SkipWhitespace(std::string_view& text);
+    };
+}
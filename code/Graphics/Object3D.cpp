@@ -3,14 +3,51 @@
 namespace GRAPHICS
 {
     /// Gets the world transformation matrix of the object.
+    /// Updates the cache if it's out of date, so this isn't thread-safe unless the cache is current.
     /// @return The object's world transform.
     MATH::Matrix4x4f Object3D::WorldTransform() const
     {
-        MATH::Matrix4x4f translation_matrix = MATH::Matrix4x4f::Translation(WorldPosition);
-        MATH::Matrix4x4f rotation_matrix = MATH::Matrix4x4f::Rotation(RotationInRadians);
-        MATH::Matrix4x4f scale_matrix = MATH::Matrix4x4f::Scale(Scale);
+        // RECOMPUTE THE LOCAL TRANSFORM IF IT'S OUT OF DATE.
+        bool local_transform_current = (
+            WorldTransformCache.Valid &&
+            (WorldTransformCache.WorldPosition == WorldPosition) &&
+            (WorldTransformCache.RotationInRadians == RotationInRadians) &&
+            (WorldTransformCache.Scale == Scale));
+        if (!local_transform_current)
+        {
+            MATH::Matrix4x4f translation_matrix = MATH::Matrix4x4f::Translation(WorldPosition);
+            MATH::Matrix4x4f rotation_matrix = MATH::Matrix4x4f::Rotation(RotationInRadians);
+            MATH::Matrix4x4f scale_matrix = MATH::Matrix4x4f::Scale(Scale);
 
-        MATH::Matrix4x4f world_transform = translation_matrix * rotation_matrix * scale_matrix;
-        return world_transform;
+            WorldTransformCache.WorldPosition = WorldPosition;
+            WorldTransformCache.RotationInRadians = RotationInRadians;
+            WorldTransformCache.Scale = Scale;
+            WorldTransformCache.LocalTransform = translation_matrix * rotation_matrix * scale_matrix;
+        }
+
+        // RECOMPUTE THE WORLD TRANSFORM IF IT'S OUT OF DATE.
+        const TransformNode* parent = Parent.get();
+        uint64_t parent_world_transform_version = parent ? parent->WorldTransformVersion() : 0;
+        bool world_transform_current = (
+            local_transform_current &&
+            (WorldTransformCache.Parent == parent) &&
+            (WorldTransformCache.ParentWorldTransformVersion == parent_world_transform_version));
+        if (!world_transform_current)
+        {
+            if (parent)
+            {
+                WorldTransformCache.WorldTransform = parent->WorldTransform() * WorldTransformCache.LocalTransform;
+            }
+            else
+            {
+                WorldTransformCache.WorldTransform = WorldTransformCache.LocalTransform;
+            }
+
+            WorldTransformCache.Parent = parent;
+            WorldTransformCache.ParentWorldTransformVersion = parent_world_transform_version;
+            WorldTransformCache.Valid = true;
+        }
+
+        return WorldTransformCache.WorldTransform;
     }
 }
@@ -1,15 +1,33 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <vector>
-#include "Graphics/OpenGL/ShaderProgram.h"
+#include "Graphics/TransformNode.h"
 #include "Graphics/Triangle.h"
 #include "Math/Angle.h"
 #include "Math/Matrix4x4.h"
 #include "Math/Vector3.h"
 
+namespace GRAPHICS::OPEN_GL
+{
+    // Only declared here so that objects don't require OpenGL (and Windows) headers
+    // for platforms or renderers that don't use shader programs.
+    class ShaderProgram;
+}
+
 namespace GRAPHICS
 {
     /// A generic object that exists in a 3D space.
+    /// The world transform is cached and only recomputed when the object's
+    /// position, rotation, scale, or parent transform changes.
+    ///
+    /// Since the cache is lazily updated, objects aren't thread-safe (like TransformNodes).
+    /// Multiple threads may only get the world transform of the same object if it's already
+    /// current (the object and its parents haven't changed since it was last retrieved),
+    /// since the cache is then only read.  Renderers retrieve world transforms on the
+    /// calling thread before any parallel work, and the AssetManager retrieves them
+    /// before sharing loaded models.
     class Object3D
     {
     public:
@@ -27,5 +45,33 @@ namespace GRAPHICS
         MATH::Vector3f Scale = MATH::Vector3f(1.0f, 1.0f, 1.0f);
         /// The shader program for the object, if one exists.
         std::shared_ptr<OPEN_GL::ShaderProgram> ShaderProgram = nullptr;
+        /// The transform node the object is attached to, if any.  If set, the object's
+        /// position, rotation, and scale are relative to this node rather than the world.
+        std::shared_ptr<TransformNode> Parent = nullptr;
+
+    private:
+        /// A world transform along with the values it was computed from.
+        struct CachedWorldTransform
+        {
+            /// True if the cache has been populated.
+            bool Valid = false;
+            /// The world position used to compute the transform.
+            MATH::Vector3f WorldPosition = MATH::Vector3f();
+            /// The rotation used to compute the transform.
+            MATH::Vector3< MATH::Angle<float>::Radians > RotationInRadians = MATH::Vector3< MATH::Angle<float>::Radians >();
+            /// The scale used to compute the transform.
+            MATH::Vector3f Scale = MATH::Vector3f();
+            /// The local transform computed from the position, rotation, and scale.
+            MATH::Matrix4x4f LocalTransform = MATH::Matrix4x4f::Identity();
+            /// The parent used to compute the transform, if any.
+            const TransformNode* Parent = nullptr;
+            /// The version of the parent's world transform used to compute the transform.
+            uint64_t ParentWorldTransformVersion = 0;
+            /// The world transform.
+            MATH::Matrix4x4f WorldTransform = MATH::Matrix4x4f::Identity();
+        };
+
+        /// The cached world transform.  Mutable since it's lazily updated when retrieved.
+        mutable CachedWorldTransform WorldTransformCache = {};
     };
 }
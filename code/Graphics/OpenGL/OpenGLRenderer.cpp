@@ -3,6 +3,7 @@
 #include <gl/GLU.h>
 #include <GL/gl3w.h>
 #include "Graphics/OpenGL/OpenGLRenderer.h"
+#include "Graphics/OpenGL/ShaderProgram.h"
 
 namespace GRAPHICS::OPEN_GL
 {
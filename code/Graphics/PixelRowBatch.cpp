@@ -0,0 +1,58 @@
+#include "Graphics/ColorConversion.h"
+#include "Graphics/PixelRowBatch.h"
+
+namespace GRAPHICS
+{
+    /// Constructor for an initially empty batch.
+    /// @param[in]  y - The vertical coordinate of the row of pixels.
+    /// @param[in,out]  render_target - The bitmap to write pixels to.
+    PixelRowBatch::PixelRowBatch(const unsigned int y, Bitmap& render_target) :
+        Y(y),
+        RenderTarget(&render_target)
+    {}
+
+    /// Adds a pixel to the batch, writing all pixels in the batch if it becomes full.
+    /// @param[in]  x - The horizontal coordinate of the pixel.
+    /// @param[in]  color - The color of the pixel.
+    void PixelRowBatch::Add(const unsigned int x, const Color& color)
+    {
+        // ADD THE PIXEL.
+        XCoordinates[PixelCount] = x;
+        Reds[PixelCount] = color.Red;
+        Greens[PixelCount] = color.Green;
+        Blues[PixelCount] = color.Blue;
+        Alphas[PixelCount] = color.Alpha;
+        ++PixelCount;
+
+        // WRITE THE PIXELS IF THE BATCH IS FULL.
+        bool batch_full = (PixelCount >= MAX_PIXEL_COUNT);
+        if (batch_full)
+        {
+            Flush();
+        }
+    }
+
+    /// Writes all pixels in the batch to the render target, leaving the batch empty.
+    void PixelRowBatch::Flush()
+    {
+        // PACK ALL COLORS AT ONCE.
+        std::array<uint32_t, MAX_PIXEL_COUNT> packed_colors;
+        ColorConversion::Pack(
+            Reds.data(),
+            Greens.data(),
+            Blues.data(),
+            Alphas.data(),
+            PixelCount,
+            RenderTarget->GetColorFormat(),
+            packed_colors.data());
+
+        // WRITE THE PIXELS.
+        for (std::size_t pixel_index = 0; pixel_index < PixelCount; ++pixel_index)
+        {
+            RenderTarget->WritePixel(XCoordinates[pixel_index], Y, packed_colors[pixel_index]);
+        }
+
+        // EMPTY THE BATCH.
+        PixelCount = 0;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "Graphics/Bitmap.h"
+#include "Graphics/Color.h"
+
+namespace GRAPHICS
+{
+    /// A small batch of pixels within a single row of a bitmap that are written together.
+    /// Rather than packing each pixel's color individually when written, colors are collected
+    /// in separate component arrays so that several can be converted to the bitmap's
+    /// color format at once.  Pixels are written when the batch fills up or is flushed,
+    /// so callers must flush the batch once done with the row.
+    class PixelRowBatch
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The maximum number of pixels held in the batch before they're written.
+        static constexpr std::size_t MAX_PIXEL_COUNT = 16;
+
+        // CONSTRUCTION.
+        explicit PixelRowBatch(const unsigned int y, Bitmap& render_target);
+
+        // DRAWING.
+        void Add(const unsigned int x, const Color& color);
+        void Flush();
+
+    private:
+        // MEMBER VARIABLES.
+        /// The vertical coordinate of the row of pixels.
+        unsigned int Y = 0;
+        /// The bitmap to which pixels are written.
+        Bitmap* RenderTarget = nullptr;
+        /// The number of pixels currently in the batch.
+        std::size_t PixelCount = 0;
+        /// The horizontal coordinates of pixels in the batch.
+        std::array<unsigned int, MAX_PIXEL_COUNT> XCoordinates = {};
+        /// The red components of pixels in the batch.
+        std::array<float, MAX_PIXEL_COUNT> Reds = {};
+        /// The green components of pixels in the batch.
+        std::array<float, MAX_PIXEL_COUNT> Greens = {};
+        /// The blue components of pixels in the batch.
+        std::array<float, MAX_PIXEL_COUNT> Blues = {};
+        /// The alpha components of pixels in the batch.
+        std::array<float, MAX_PIXEL_COUNT> Alphas = {};
+    };
+}
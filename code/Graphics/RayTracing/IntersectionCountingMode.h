@@ -0,0 +1,15 @@
+#pragma once
+
+namespace GRAPHICS::RAY_TRACING
+{
+    /// The different ways ray-triangle intersection tests can be counted when ray tracing.
+    enum class IntersectionCountingMode
+    {
+        /// No intersection tests are counted, so ray tracing has no extra overhead.
+        DISABLED = 0,
+        /// Intersection tests are counted per pixel for diagnosing how much work each pixel takes.
+        ENABLED,
+        /// An extra enum to indicate the number of different intersection counting modes.
+        COUNT
+    };
+}
@@ -20,13 +20,13 @@ namespace RAY_TRACING
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The ray that intersected an object.  Memory is managed externally (outside of this class).
-        const Ray* Ray = nullptr;
+        const RAY_TRACING::Ray* Ray = nullptr;
         /// The distance along the ray to the intersection of the object (in units of the ray).
         /// Initialized to infinity to avoid accidental intersections caused by checking
         /// if this distance is closer between two intersections.
         float DistanceFromRayToObject = std::numeric_limits<float>::infinity();
         /// The intersected triangle.  Memory is managed externally (outside of this class).
-        const Triangle* Triangle = nullptr;
+        const GRAPHICS::Triangle* Triangle = nullptr;
     };
 }
 }
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cmath>
+#include "Benchmarking/Profiler.h"
 #include "Graphics/RayTracing/RayTracingAlgorithm.h"
 #include "Math/Angle.h"
 
@@ -13,24 +14,63 @@ namespace RAY_TRACING
     /// @param[in,out]  render_target - The target to render to.
     void RayTracingAlgorithm::Render(const Scene& scene, const Camera& camera, GRAPHICS::Bitmap& render_target)
     {
+        PROFILE_ZONE("Ray tracing");
+
         // TRANSFORM OBJECTS IN THE SCENE INTO WORLD SPACE.
-        Scene scene_with_world_space_objects;
-        scene_with_world_space_objects.BackgroundColor = scene.BackgroundColor;
-        scene_with_world_space_objects.PointLights = scene.PointLights;
-        for (const Object3D& untransformed_object : scene.Objects)
+        TransformToWorldSpace(scene);
+
+        /// @todo   A lot of this ray tracing stuff still isn't working correctly.  Needs more updates!
+
+        // RENDER ALL PIXELS.
+        PROFILE_ZONE("Ray casting");
+        LastRenderIntersectionTestCount = 0;
+        if (CountIntersectionTestsPerPixel)
+        {
+            // The counts are only reallocated if the size changes since every pixel's count is overwritten.
+            bool count_size_changed = (
+                (LastRenderIntersectionTestCountsPerPixel.GetWidth() != render_target.GetWidthInPixels()) ||
+                (LastRenderIntersectionTestCountsPerPixel.GetHeight() != render_target.GetHeightInPixels()));
+            if (count_size_changed)
+            {
+                LastRenderIntersectionTestCountsPerPixel = CONTAINERS::Array2D<uint32_t>(render_target.GetWidthInPixels(), render_target.GetHeightInPixels());
+            }
+            RenderPixels<IntersectionCountingMode::ENABLED>(WorldSpaceScene, camera, render_target);
+        }
+        else
+        {
+            RenderPixels<IntersectionCountingMode::DISABLED>(WorldSpaceScene, camera, render_target);
+        }
+    }
+
+    /// Transforms all objects in a scene into world space, which simplifies intersection tests.
+    /// The world space scene from the previous render is overwritten, so that its memory
+    /// is reused rather than allocated again for every render.
+    /// @param[in]  scene - The scene to transform.
+    void RayTracingAlgorithm::TransformToWorldSpace(const Scene& scene)
+    {
+        PROFILE_ZONE("World transform");
+
+        // COPY PROPERTIES NOT AFFECTED BY TRANSFORMATION.
+        WorldSpaceScene.BackgroundColor = scene.BackgroundColor;
+        WorldSpaceScene.PointLights = scene.PointLights;
+        WorldSpaceScene.Objects.resize(scene.Objects.size());
+        for (std::size_t object_index = 0; object_index < scene.Objects.size(); ++object_index)
         {
             // INITIALIZE THE TRANSFORMED VERSION OF THE OBJECT.
-            Object3D transformed_object;
+            const Object3D& untransformed_object = scene.Objects[object_index];
+            Object3D& transformed_object = WorldSpaceScene.Objects[object_index];
             transformed_object.Scale = untransformed_object.Scale;
             transformed_object.WorldPosition = untransformed_object.WorldPosition;
             transformed_object.RotationInRadians = untransformed_object.RotationInRadians;
 
             // TRANSFORM ALL TRIANGLES IN THE OBJECT.
             MATH::Matrix4x4f world_transform = untransformed_object.WorldTransform();
-            for (const Triangle& untransformed_triangle : untransformed_object.Triangles)
+            transformed_object.Triangles.resize(untransformed_object.Triangles.size());
+            for (std::size_t triangle_index = 0; triangle_index < untransformed_object.Triangles.size(); ++triangle_index)
             {
                 // INITIALIZE THE TRANSFORMED VERSION OF THE TRIANGLE.
-                Triangle transformed_triangle;
+                const Triangle& untransformed_triangle = untransformed_object.Triangles[triangle_index];
+                Triangle& transformed_triangle = transformed_object.Triangles[triangle_index];
                 transformed_triangle.Material = untransformed_triangle.Material;
 
                 // TRANSFORM EACH VERTEX OF THE TRIANGLE.
@@ -41,18 +81,21 @@ namespace RAY_TRACING
                     MATH::Vector4f transformed_vertex = world_transform * homogeneous_vertex;
                     transformed_triangle.Vertices[vertex_index] = MATH::Vector3f(transformed_vertex.X, transformed_vertex.Y, transformed_vertex.Z);
                 }
-
-                // STORE THE TRANSFORMED TRIANGLE.
-                transformed_object.Triangles.push_back(transformed_triangle);
             }
-
-            // STORE THE TRANSFORMED OBJECT.
-            scene_with_world_space_objects.Objects.push_back(transformed_object);
         }
+    }
 
-        /// @todo   A lot of this ray tracing stuff still isn't working correctly.  Needs more updates!
-
-        // RENDER EACH ROW OF PIXELS.
+    /// Renders each pixel of a scene to the specified render target.
+    /// @tparam INTERSECTION_COUNTING_MODE - Whether intersection tests are counted per pixel.
+    /// @param[in]  scene_with_world_space_objects - The scene to render, with all objects already in world space.
+    /// @param[in]  camera - The camera to use to view the scene.
+    /// @param[in,out]  render_target - The target to render to.
+    template <IntersectionCountingMode INTERSECTION_COUNTING_MODE>
+    void RayTracingAlgorithm::RenderPixels(const Scene& scene_with_world_space_objects, const Camera& camera, GRAPHICS::Bitmap& render_target)
+    {
+        // Rays are counted locally and only stored once all pixels are rendered,
+        // which keeps the tracing helpers free of member state.
+        RayCounts ray_counts;
         unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
         for (unsigned int y = 0; y < render_target_height_in_pixels; ++y)
         {
@@ -63,15 +106,25 @@ namespace RAY_TRACING
                 // COMPUTE THE VIEWING RAY.
                 MATH::Vector2ui pixel_coordinates(x, y);
                 Ray ray = camera.ViewingRay(pixel_coordinates, render_target);
+                ++ray_counts.PrimaryRayCount;
+                uint32_t pixel_intersection_test_count = 0;
 
                 // FIND THE CLOSEST OBJECT IN THE SCENE THAT THE RAY INTERSECTS.
-                std::optional<RayObjectIntersection> closest_intersection = ComputeClosestIntersection(scene_with_world_space_objects, ray);
+                std::optional<RayObjectIntersection> closest_intersection = ComputeClosestIntersection<INTERSECTION_COUNTING_MODE>(
+                    scene_with_world_space_objects,
+                    ray,
+                    pixel_intersection_test_count);
 
                 // COLOR THE CURRENT PIXEL.
                 if (closest_intersection)
                 {
                     // COMPUTE THE CURRENT PIXEL'S COLOR.
-                    Color color = ComputeColor(scene_with_world_space_objects, *closest_intersection, ReflectionCount);
+                    Color color = ComputeColor<INTERSECTION_COUNTING_MODE>(
+                        scene_with_world_space_objects,
+                        *closest_intersection,
+                        ReflectionCount,
+                        ray_counts,
+                        pixel_intersection_test_count);
                     render_target.WritePixel(x, y, color);
                 }
                 else
@@ -79,22 +132,37 @@ namespace RAY_TRACING
                     // FILL THE PIXEL WITH THE BACKGROUND COLOR.
                     render_target.WritePixel(x, y, scene_with_world_space_objects.BackgroundColor);
                 }
+
+                // RECORD THE INTERSECTION TESTS FOR THE PIXEL.
+                if constexpr (IntersectionCountingMode::ENABLED == INTERSECTION_COUNTING_MODE)
+                {
+                    LastRenderIntersectionTestCount += pixel_intersection_test_count;
+                    LastRenderIntersectionTestCountsPerPixel(x, y) = pixel_intersection_test_count;
+                }
             }
         }
+
+        LastRenderRayCounts = ray_counts;
     }
 
     /// Computes color based on the specified intersection in the scene.
+    /// @tparam INTERSECTION_COUNTING_MODE - Whether intersection tests are counted.
     /// @param[in]  scene - The scene in which the color is being computed.
     /// @param[in]  intersection - The intersection for which to compute the color.
     /// @param[in]  remaining_reflection_count - The remaining reflection depth for color computation.
     ///     To compute more accurate light, rays need to be reflected, but we don't want this to go on forever.
     ///     Furthermore, more rays can be computationally expensive for little more gain, which is why 
     ///     the amount of reflection is capped.
+    /// @param[in,out]  ray_counts - The counts to add any rays traced to.
+    /// @param[in,out]  intersection_test_count - The count to add any intersection tests to, if counting them.
     /// @return The computed color.
+    template <IntersectionCountingMode INTERSECTION_COUNTING_MODE>
     GRAPHICS::Color RayTracingAlgorithm::ComputeColor(
         const Scene& scene, 
         const RayObjectIntersection& intersection,
-        const unsigned int remaining_reflection_count) const
+        const unsigned int remaining_reflection_count,
+        RayCounts& ray_counts,
+        uint32_t& intersection_test_count) const
     {
         // INITIALIZE THE COLOR TO HAVE NO CONTRIBUTION FROM ANY SOURCES.
         Color final_color = Color::BLACK;
@@ -106,9 +174,16 @@ namespace RAY_TRACING
             final_color += intersected_material->AmbientColor;
         }
 
-        // COMPUTE SHADOWS.
-        std::vector<float> shadow_factors_by_light_index;
+        // ADD IN LIGHT FROM EACH LIGHT SOURCE.
+        // Each light's shadow factor is only needed for that light's contributions, so all of a light's
+        // contributions are computed together rather than storing shadow factors for all lights first
+        // (which would allocate memory for every intersection).
         MATH::Vector3f intersection_point = intersection.IntersectionPoint();
+        MATH::Vector3f unit_surface_normal = intersection.Triangle->SurfaceNormal();
+        MATH::Vector3f ray_from_intersection_to_eye = intersection.Ray->Origin - intersection_point;
+        MATH::Vector3f normalized_ray_from_intersection_to_eye = MATH::Vector3f::Normalize(ray_from_intersection_to_eye);
+        Color light_total_color = Color::BLACK;
+        Color specular_light_total_color = Color::BLACK;
         for (const Light& light : (*scene.PointLights))
         {
             // CAST A RAY OUT TO COMPUTE SHADOWS IF ENABLED.
@@ -121,7 +196,8 @@ namespace RAY_TRACING
                 // SHOOT A SHADOW RAY OUT FROM THE INTERSECTION POINT TO THE LIGHT.
                 MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(intersection_point);
                 Ray shadow_ray(intersection_point, direction_from_point_to_light);
-                std::optional<RayObjectIntersection> shadow_intersection = ComputeClosestIntersection(scene, shadow_ray, intersection.Triangle);
+                ++ray_counts.ShadowRayCount;
+                std::optional<RayObjectIntersection> shadow_intersection = ComputeClosestIntersection<INTERSECTION_COUNTING_MODE>(scene, shadow_ray, intersection_test_count, intersection.Triangle);
                 if (shadow_intersection)
                 {
                     // DETERMINE THE SHADOW FACTOR BASED ON THE INTERSECTION.
@@ -146,57 +222,32 @@ namespace RAY_TRACING
                 }
             }
 
-            // STORE THE SHADOW FACTOR FOR THE LIGHT.
-            shadow_factors_by_light_index.push_back(shadow_factor);
-        }
-
-        // ADD IN DIFFUSE COLOR FROM LIGHTS IF ENABLED.
-        MATH::Vector3f unit_surface_normal = intersection.Triangle->SurfaceNormal();
-        if (Diffuse)
-        {
-            // ADD DIFFUSE CONTRIBUTIONS FROM ALL LIGHT SOURCES.
-            Color light_total_color = Color::BLACK;
-            for (std::size_t light_index = 0; light_index < scene.PointLights->size(); ++light_index)
+            // ADD DIFFUSE COLOR FROM THE LIGHT IF ENABLED.
+            if (Diffuse)
             {
-                // ADD COLOR FROM THE CURRENT LIGHT.
+                // COMPUTE THE AMOUNT OF ILLUMINATION FROM THE LIGHT.
                 // This is based on the Lambertian shading model.
                 // An object is maximally illuminated when facing toward the light.
                 // An object tangent to the light direction or facing away receives no illumination.
                 // In-between, the amount of illumination is proportional to the cosine of the angle between
                 // the light and surface normal (where the cosine can be computed via the dot product).
-                const Light& light = scene.PointLights->at(light_index);
                 MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(intersection_point);
                 MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
                 constexpr float NO_ILLUMINATION = 0.0f;
                 float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
                 illumination_proportion = std::max(NO_ILLUMINATION, illumination_proportion);
 
-                // ADD THE CURRENT LIGHT'S COLOR.
-                float shadow_factor = shadow_factors_by_light_index.at(light_index);
+                // ADD THE LIGHT'S COLOR.
                 Color current_light_color = Color::ScaleRedGreenBlue(illumination_proportion, light.Color);
                 current_light_color = Color::ScaleRedGreenBlue(shadow_factor, current_light_color);
                 light_total_color += current_light_color;
             }
 
-            // The diffuse color is multiplied component-wise by the amount of light.
-            Color diffuse_color = Color::ComponentMultiplyRedGreenBlue(
-                intersected_material->DiffuseColor,
-                light_total_color);
-            final_color += diffuse_color;
-        }
-
-        // ADD IN SPECULAR COLOR IF ENABLED.
-        // This is based on the Blinn-Phong model.
-        if (Specular)
-        {
-            // ADD SPECULAR CONTRIBUTIONS FROM ALL LIGHT SOURCES.
-            Color specular_light_total_color = Color::BLACK;
-            MATH::Vector3f ray_from_intersection_to_eye = intersection.Ray->Origin - intersection_point;
-            MATH::Vector3f normalized_ray_from_intersection_to_eye = MATH::Vector3f::Normalize(ray_from_intersection_to_eye);
-            for (std::size_t light_index = 0; light_index < scene.PointLights->size(); ++light_index)
+            // ADD SPECULAR COLOR FROM THE LIGHT IF ENABLED.
+            // This is based on the Blinn-Phong model.
+            if (Specular)
             {
-                // COMPUTE THE AMOUNT OF ILLUMINATION FROM THE CURRENT LIGHT.
-                const Light& light = scene.PointLights->at(light_index);
+                // COMPUTE THE AMOUNT OF ILLUMINATION FROM THE LIGHT.
                 MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(intersection_point);
                 MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
                 constexpr float NO_ILLUMINATION = 0.0f;
@@ -213,13 +264,26 @@ namespace RAY_TRACING
                 specular_proportion = std::max(NO_ILLUMINATION, specular_proportion);
                 specular_proportion = std::pow(specular_proportion, intersected_material->SpecularPower);
 
-                // ADD THE CURRENT LIGHT'S SPECULAR COLOR.
-                float shadow_factor = shadow_factors_by_light_index.at(light_index);
+                // ADD THE LIGHT'S SPECULAR COLOR.
                 float light_proportion = shadow_factor * specular_proportion;
                 Color current_light_specular_color = Color::ScaleRedGreenBlue(light_proportion, light.Color);
                 specular_light_total_color += current_light_specular_color;
             }
+        }
 
+        // ADD IN THE TOTAL DIFFUSE COLOR IF ENABLED.
+        if (Diffuse)
+        {
+            // The diffuse color is multiplied component-wise by the amount of light.
+            Color diffuse_color = Color::ComponentMultiplyRedGreenBlue(
+                intersected_material->DiffuseColor,
+                light_total_color);
+            final_color += diffuse_color;
+        }
+
+        // ADD IN THE TOTAL SPECULAR COLOR IF ENABLED.
+        if (Specular)
+        {
             // The specular color is multiplied component-wise by the amount of light.
             Color specular_color = Color::ComponentMultiplyRedGreenBlue(
                 intersected_material->SpecularColor,
@@ -249,14 +313,15 @@ namespace RAY_TRACING
             MATH::Vector3f reflected_ray_direction = normalized_direction_from_ray_origin_to_intersection - twice_reflected_ray_along_surface_normal;
             MATH::Vector3f normalized_reflected_ray_direction = MATH::Vector3f::Normalize(reflected_ray_direction);
             Ray reflected_ray(intersection_point, normalized_reflected_ray_direction);
+            ++ray_counts.ReflectionRayCount;
 
             // CHECK FOR ANY INTERSECTIONS FROM THE REFLECTED RAY.
-            std::optional<RayObjectIntersection> reflected_intersection = ComputeClosestIntersection(scene, reflected_ray, intersection.Triangle);
+            std::optional<RayObjectIntersection> reflected_intersection = ComputeClosestIntersection<INTERSECTION_COUNTING_MODE>(scene, reflected_ray, intersection_test_count, intersection.Triangle);
             if (reflected_intersection)
             {
                 // COMPUTE THE REFLECTED COLOR.
                 const unsigned int child_reflection_count = remaining_reflection_count - 1;
-                Color raw_reflected_color = ComputeColor(scene, *reflected_intersection, child_reflection_count);
+                Color raw_reflected_color = ComputeColor<INTERSECTION_COUNTING_MODE>(scene, *reflected_intersection, child_reflection_count, ray_counts, intersection_test_count);
                 Color reflected_color = Color::ScaleRedGreenBlue(intersected_material->ReflectivityProportion, raw_reflected_color);
                 final_color += reflected_color;
             }
@@ -272,17 +337,21 @@ namespace RAY_TRACING
     }
 
     /// Computes the closest intersection in the scene of a specific ray.
+    /// @tparam INTERSECTION_COUNTING_MODE - Whether intersection tests are counted.
     /// @param[in]  scene - The scene in which to search for intersections.
     /// @param[in]  ray - The ray to use for searching for intersections.
+    /// @param[in,out]  intersection_test_count - The count to add any intersection tests to, if counting them.
     /// @param[in]  ignored_object - An optional object to be ignored.  If provided,
     ///     this object will be ignored for intersections.  This provides an easy way
     ///     to calculate intersections from reflected rays without having the object
     ///     being reflected off of infinitely intersected with.
     /// @return The closest intersection, if one was found; unpopulated if no intersection
     ///     was found between the ray and an object in the scene.
+    template <IntersectionCountingMode INTERSECTION_COUNTING_MODE>
     std::optional<RayObjectIntersection> RayTracingAlgorithm::ComputeClosestIntersection(
         const Scene& scene,
         const Ray& ray,
+        uint32_t& intersection_test_count,
         const Triangle* const ignored_object) const
     {
         // FIND THE CLOSEST OBJECT IN THE SCENE THAT THE RAY INTERSECTS.
@@ -300,6 +369,10 @@ namespace RAY_TRACING
                 }
 
                 // CHECK IF THE RAY INTERSECTS THE CURRENT OBJECT.
+                if constexpr (IntersectionCountingMode::ENABLED == INTERSECTION_COUNTING_MODE)
+                {
+                    ++intersection_test_count;
+                }
                 std::optional<RayObjectIntersection> intersection = current_triangle.Intersect(ray);
                 bool ray_hit_object = (std::nullopt != intersection);
                 if (!ray_hit_object)
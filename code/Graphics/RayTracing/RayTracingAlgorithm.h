@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
+#include "Containers/Array2D.h"
 #include "Graphics/Bitmap.h"
 #include "Graphics/Camera.h"
 #include "Graphics/Color.h"
+#include "Graphics/RayTracing/IntersectionCountingMode.h"
 #include "Graphics/RayTracing/Ray.h"
 #include "Graphics/RayTracing/RayObjectIntersection.h"
 #include "Graphics/Scene.h"
@@ -16,6 +19,24 @@ namespace GRAPHICS::RAY_TRACING
     class RayTracingAlgorithm
     {
     public:
+        /// Counts of rays traced, allowing ray tracing throughput to be measured.
+        struct RayCounts
+        {
+            /// The number of rays from the camera through pixels.
+            uint64_t PrimaryRayCount = 0;
+            /// The number of rays from intersections toward lights.
+            uint64_t ShadowRayCount = 0;
+            /// The number of rays reflected off of intersections.
+            uint64_t ReflectionRayCount = 0;
+
+            /// Gets the total number of rays of all kinds.
+            /// @return The total number of rays.
+            uint64_t Total() const
+            {
+                return PrimaryRayCount + ShadowRayCount + ReflectionRayCount;
+            }
+        };
+
         // PUBLIC METHODS.
         void Render(const Scene& scene, const Camera& camera, GRAPHICS::Bitmap& render_target);
 
@@ -33,16 +54,40 @@ namespace GRAPHICS::RAY_TRACING
         /// The maximum number of reflections to computer (if reflections are enabled).
         /// More reflections will take longer to render an image.
         unsigned int ReflectionCount = 5;
+        /// True if intersection tests should be counted per pixel, for diagnosing expensive pixels; false otherwise.
+        /// Rendering without counting avoids any counting overhead.
+        bool CountIntersectionTestsPerPixel = false;
+        /// The rays traced during the most recent render.
+        RayCounts LastRenderRayCounts = {};
+        /// The number of ray-triangle intersection tests during the most recent render, if counting them per pixel.
+        uint64_t LastRenderIntersectionTestCount = 0;
+        /// The number of ray-triangle intersection tests for each pixel (including tests for shadow
+        /// and reflection rays) during the most recent render, if counting them per pixel.
+        CONTAINERS::Array2D<uint32_t> LastRenderIntersectionTestCountsPerPixel = CONTAINERS::Array2D<uint32_t>();
 
     private:
+
         // PRIVATE HELPER METHODS.
+        void TransformToWorldSpace(const Scene& scene);
+        template <IntersectionCountingMode INTERSECTION_COUNTING_MODE>
+        void RenderPixels(const Scene& scene_with_world_space_objects, const Camera& camera, GRAPHICS::Bitmap& render_target);
+        template <IntersectionCountingMode INTERSECTION_COUNTING_MODE>
         GRAPHICS::Color ComputeColor(
             const Scene& scene,
             const RayObjectIntersection& intersection,
-            const unsigned int remaining_reflection_count) const;
+            const unsigned int remaining_reflection_count,
+            RayCounts& ray_counts,
+            uint32_t& intersection_test_count) const;
+        template <IntersectionCountingMode INTERSECTION_COUNTING_MODE>
         std::optional<RayObjectIntersection> ComputeClosestIntersection(
             const Scene& scene,
             const Ray& ray,
+            uint32_t& intersection_test_count,
             const Triangle* const ignored_object = nullptr) const;
+
+        // PRIVATE MEMBER VARIABLES.
+        /// The scene being rendered with all objects transformed into world space,
+        /// kept between renders so that its memory can be reused.
+        Scene WorldSpaceScene = {};
     };
 }
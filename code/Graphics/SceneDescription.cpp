@@ -0,0 +1,233 @@
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Benchmarking/Profiler.h"
+#include "Graphics/AssetManager.h"
+#include "Graphics/SceneDescription.h"
+#include "Math/Angle.h"
+
+namespace GRAPHICS
+{
+    /// Attempts to load a scene description from a file (see the class description for the format).
+    /// Any referenced models are also loaded, in parallel via an AssetManager.
+    /// @param[in]  filepath - The path of the scene description file.
+    /// @param[in]  binary_mesh_cache_folder_path - The folder to cache model geometry in
+    ///     (see WavefrontObjectModel::Load()), or empty to not cache geometry.
+    /// @param[out]  binary_mesh_cache_write_failed - If provided, set to true if the geometry
+    ///     cache of any model couldn't be written; false otherwise.
+    /// @return The scene description, if successfully loaded; null if the file or any
+    ///     referenced models couldn't be loaded or any line was invalid.
+    std::optional<SceneDescription> SceneDescription::Load(
+        const std::filesystem::path& filepath,
+        const std::filesystem::path& binary_mesh_cache_folder_path,
+        bool* const binary_mesh_cache_write_failed)
+    {
+        PROFILE_ZONE("Load scene description");
+
+        if (binary_mesh_cache_write_failed)
+        {
+            *binary_mesh_cache_write_failed = false;
+        }
+
+        // OPEN THE FILE.
+        std::ifstream scene_file(filepath);
+        bool scene_file_opened = scene_file.is_open();
+        if (!scene_file_opened)
+        {
+            return std::nullopt;
+        }
+
+        // READ ALL LINES OF THE FILE.
+        // The camera orientation depends on multiple lines, so it's only computed at the end.
+        SceneDescription scene_description;
+        MATH::Vector3f camera_world_position = scene_description.Camera.WorldPosition;
+        MATH::Vector3f camera_look_at_world_position = MATH::Vector3f(0.0f, 0.0f, 0.0f);
+        const std::filesystem::path scene_folder_path = filepath.parent_path();
+        AssetManager asset_manager;
+        std::vector<AssetHandle<Object3D>> model_loads;
+        auto read_vector = [](std::istringstream& line_data, MATH::Vector3f& vector)
+        {
+            line_data >> vector.X >> vector.Y >> vector.Z;
+            return !line_data.fail();
+        };
+        auto read_color = [](std::istringstream& line_data, Color& color)
+        {
+            line_data >> color.Red >> color.Green >> color.Blue;
+            color.Alpha = Color::MAX_FLOAT_COLOR_COMPONENT;
+            return !line_data.fail();
+        };
+        auto add_light = [&scene_description](const Light& light)
+        {
+            if (!scene_description.Scene.PointLights)
+            {
+                scene_description.Scene.PointLights = std::vector<Light>();
+            }
+            scene_description.Scene.PointLights->push_back(light);
+        };
+        std::string line;
+        while (std::getline(scene_file, line))
+        {
+            // READ THE KEYWORD.
+            // Blank and comment lines have no values to read.
+            std::istringstream line_data(line);
+            std::string keyword;
+            line_data >> keyword;
+            constexpr char COMMENT_CHARACTER = '#';
+            bool line_has_values = !keyword.empty() && !keyword.starts_with(COMMENT_CHARACTER);
+            if (!line_has_values)
+            {
+                continue;
+            }
+
+            // READ THE VALUES FOR THE KEYWORD.
+            bool line_valid = false;
+            std::vector<Object3D>& objects = scene_description.Scene.Objects;
+            if ("background" == keyword)
+            {
+                line_valid = read_color(line_data, scene_description.Scene.BackgroundColor);
+            }
+            else if ("camera_position" == keyword)
+            {
+                line_valid = read_vector(line_data, camera_world_position);
+            }
+            else if ("camera_look_at" == keyword)
+            {
+                line_valid = read_vector(line_data, camera_look_at_world_position);
+            }
+            else if ("camera_projection" == keyword)
+            {
+                std::string projection_name;
+                line_data >> projection_name;
+                if ("orthographic" == projection_name)
+                {
+                    scene_description.Camera.Projection = ProjectionType::ORTHOGRAPHIC;
+                    line_valid = true;
+                }
+                else if ("perspective" == projection_name)
+                {
+                    scene_description.Camera.Projection = ProjectionType::PERSPECTIVE;
+                    line_valid = true;
+                }
+            }
+            else if ("camera_field_of_view" == keyword)
+            {
+                line_data >> scene_description.Camera.FieldOfView.Value;
+                line_valid = !line_data.fail();
+            }
+            else if ("camera_clip_planes" == keyword)
+            {
+                line_data >> scene_description.Camera.NearClipPlaneViewDistance >> scene_description.Camera.FarClipPlaneViewDistance;
+                line_valid = !line_data.fail();
+            }
+            else if ("ambient_light" == keyword)
+            {
+                Light light;
+                light.Type = LightType::AMBIENT;
+                line_valid = read_color(line_data, light.Color);
+                add_light(light);
+            }
+            else if ("directional_light" == keyword)
+            {
+                Light light;
+                light.Type = LightType::DIRECTIONAL;
+                line_valid = read_color(line_data, light.Color) && read_vector(line_data, light.DirectionalLightDirection);
+                light.DirectionalLightDirection = MATH::Vector3f::Normalize(light.DirectionalLightDirection);
+                add_light(light);
+            }
+            else if ("point_light" == keyword)
+            {
+                Light light;
+                light.Type = LightType::POINT;
+                line_valid = read_color(line_data, light.Color) && read_vector(line_data, light.PointLightWorldPosition);
+                add_light(light);
+            }
+            else if ("model" == keyword)
+            {
+                // START LOADING THE MODEL.
+                // The path may contain spaces, so the entire remainder of the line is used.
+                // The object only gets its triangles once all models are loaded,
+                // but any following transform lines can be applied in the meantime.
+                std::string model_filename;
+                std::getline(line_data >> std::ws, model_filename);
+                std::size_t filename_end_index = model_filename.find_last_not_of(" \t\r");
+                model_filename.resize(filename_end_index + 1);
+                model_loads.push_back(asset_manager.LoadModel(scene_folder_path / model_filename, binary_mesh_cache_folder_path));
+                objects.emplace_back();
+                line_valid = true;
+            }
+            else if (!objects.empty())
+            {
+                // READ ANY TRANSFORM OF THE MOST RECENT MODEL.
+                Object3D& model = objects.back();
+                if ("position" == keyword)
+                {
+                    line_valid = read_vector(line_data, model.WorldPosition);
+                }
+                else if ("rotation" == keyword)
+                {
+                    MATH::Vector3f rotation_in_degrees;
+                    line_valid = read_vector(line_data, rotation_in_degrees);
+                    model.RotationInRadians.X = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(rotation_in_degrees.X));
+                    model.RotationInRadians.Y = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(rotation_in_degrees.Y));
+                    model.RotationInRadians.Z = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(rotation_in_degrees.Z));
+                }
+                else if ("scale" == keyword)
+                {
+                    line_valid = read_vector(line_data, model.Scale);
+                }
+            }
+
+            if (!line_valid)
+            {
+                return std::nullopt;
+            }
+        }
+
+        // WAIT FOR ALL MODELS TO LOAD.
+        // Models referenced multiple times share a single load, so triangles are copied.
+        std::shared_ptr<Material> default_material = nullptr;
+        for (std::size_t model_index = 0; model_index < model_loads.size(); ++model_index)
+        {
+            std::shared_ptr<Object3D> model = model_loads[model_index].Get();
+            if (!model)
+            {
+                return std::nullopt;
+            }
+            Object3D& object = scene_description.Scene.Objects[model_index];
+            object.Triangles = model->Triangles;
+
+            // ASSIGN A MATERIAL TO ANY TRIANGLES WITHOUT ONE.
+            for (Triangle& triangle : object.Triangles)
+            {
+                if (triangle.Material)
+                {
+                    continue;
+                }
+
+                if (!default_material)
+                {
+                    default_material = std::make_shared<Material>();
+                    default_material->Shading = ShadingType::MATERIAL;
+                    default_material->VertexColors = { Color(0.5f, 0.5f, 0.5f, 1.0f), Color(0.5f, 0.5f, 0.5f, 1.0f), Color(0.5f, 0.5f, 0.5f, 1.0f) };
+                    default_material->AmbientColor = Color(0.2f, 0.2f, 0.2f, 1.0f);
+                    default_material->DiffuseColor = Color(0.8f, 0.8f, 0.8f, 1.0f);
+                }
+                triangle.Material = default_material;
+            }
+        }
+        if (binary_mesh_cache_write_failed)
+        {
+            *binary_mesh_cache_write_failed = (asset_manager.BinaryMeshCacheWriteFailureCount() > 0);
+        }
+
+        // ORIENT THE CAMERA.
+        // The projection and other settings must be preserved.
+        GRAPHICS::Camera oriented_camera = GRAPHICS::Camera::LookAtFrom(camera_look_at_world_position, camera_world_position);
+        scene_description.Camera.WorldPosition = oriented_camera.WorldPosition;
+        scene_description.Camera.CoordinateFrame = oriented_camera.CoordinateFrame;
+        return scene_description;
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include "Graphics/Camera.h"
+#include "Graphics/Scene.h"
+
+namespace GRAPHICS
+{
+    /// A scene along with the camera for viewing it, as described in a simple text file.
+    /// This allows scenes to be rendered without any code specific to the scene
+    /// (like for offline or batch rendering).
+    ///
+    /// Each line of the file has a keyword followed by values separated by whitespace.
+    /// Blank lines and lines starting with '#' are ignored.  Supported keywords:
+    /// - background <red> <green> <blue>
+    /// - camera_position <x> <y> <z>
+    /// - camera_look_at <x> <y> <z>
+    /// - camera_projection <orthographic|perspective>
+    /// - camera_field_of_view <degrees>
+    /// - camera_clip_planes <near distance> <far distance>
+    /// - ambient_light <red> <green> <blue>
+    /// - directional_light <red> <green> <blue> <direction x> <direction y> <direction z>
+    /// - point_light <red> <green> <blue> <x> <y> <z>
+    /// - model <path of .obj file, relative to the scene file>
+    /// - position <x> <y> <z> (for the most recent model)
+    /// - rotation <x degrees> <y degrees> <z degrees> (for the most recent model)
+    /// - scale <x> <y> <z> (for the most recent model)
+    ///
+    /// Without any lights, lighting isn't computed (colors come directly from materials).
+    /// Triangles of models without materials use a default gray material.
+    class SceneDescription
+    {
+    public:
+        // LOADING.
+        static std::optional<SceneDescription> Load(
+            const std::filesystem::path& filepath,
+            const std::filesystem::path& binary_mesh_cache_folder_path = "",
+            bool* const binary_mesh_cache_write_failed = nullptr);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The scene.
+        GRAPHICS::Scene Scene = {};
+        /// The camera for viewing the scene.
+        GRAPHICS::Camera Camera = {};
+    };
+}
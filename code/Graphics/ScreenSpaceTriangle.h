@@ -20,11 +20,12 @@ namespace GRAPHICS
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The material of the triangle.
-        std::shared_ptr<Material> Material = nullptr;
+        std::shared_ptr<GRAPHICS::Material> Material = nullptr;
         /// The vertices of the triangle.  Should be in counter-clockwise order.
         /// A z-coordinate is included to support depth-testing.
         std::array<MATH::Vector3f, VERTEX_COUNT> VertexPositions = {};
         /// The colors of each vertex (same order as vertex positions).
-        std::array<GRAPHICS::Color, VERTEX_COUNT> VertexColors = {};
+        /// Not brace-initialized since colors can only be explicitly default-constructed.
+        std::array<GRAPHICS::Color, VERTEX_COUNT> VertexColors;
     };
 }
@@ -1,6 +1,8 @@
 // To avoid annoyances with Windows min/max #defines.
 #define NOMINMAX
 
+#include "Benchmarking/Profiler.h"
+#include "Graphics/PixelRowBatch.h"
 #include "Graphics/Shading.h"
 #include "Graphics/SoftwareRasterizationAlgorithm.h"
 #include "Graphics/ViewingTransformations.h"
@@ -13,6 +15,8 @@ namespace GRAPHICS
     /// @param[in,out]  render_target - The target to render to.
     void SoftwareRasterizationAlgorithm::Render(const GUI::Text& text, Bitmap& render_target)
     {
+        PROFILE_ZONE("Text overlay");
+
         // MAKE SURE A FONT EXISTS.
         if (!text.Font)
         {
@@ -54,24 +58,33 @@ namespace GRAPHICS
     /// @param[in]  cull_backfaces - True if backfaces should be culled; false otherwise.
     /// @param[in,out]  output_bitmap - The bitmap to render to.
     /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    /// @param[in,out]  fragment_counters - Any counters to count fragments per pixel with, for diagnosing overdraw.
+    ///     They're cleared before rendering so that they only count fragments for the scene.
     void SoftwareRasterizationAlgorithm::Render(
         const Scene& scene, 
         const Camera& camera, 
         const bool cull_backfaces, 
         Bitmap& output_bitmap,
-        DepthBuffer* depth_buffer)
+        DepthBuffer* depth_buffer,
+        FragmentCounters* fragment_counters)
     {
+        PROFILE_ZONE("Software rasterization");
+
         // CLEAR THE BACKGROUND.
         output_bitmap.FillPixels(scene.BackgroundColor);
         if (depth_buffer)
         {
             depth_buffer->ClearToDepth(DepthBuffer::MAX_DEPTH);
         }
+        if (fragment_counters)
+        {
+            fragment_counters->Clear();
+        }
 
         // RENDER EACH OBJECT IN THE SCENE.
         for (const auto& object_3D : scene.Objects)
         {
-            Render(object_3D, scene.PointLights, camera, cull_backfaces, output_bitmap, depth_buffer);
+            Render(object_3D, scene.PointLights, camera, cull_backfaces, output_bitmap, depth_buffer, fragment_counters);
         }
     }
 
@@ -81,24 +94,37 @@ namespace GRAPHICS
     /// @param[in]  camera - The camera to use to view the object.
     /// @param[in,out]  output_bitmap - The bitmap to render to.
     /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    /// @param[in,out]  fragment_counters - Any counters to count fragments per pixel with, for diagnosing overdraw.
     void SoftwareRasterizationAlgorithm::Render(
         const Object3D& object_3D, 
         const std::optional<std::vector<Light>>& lights, 
         const Camera& camera, 
         const bool cull_backfaces, 
         Bitmap& output_bitmap,
-        DepthBuffer* depth_buffer)
+        DepthBuffer* depth_buffer,
+        FragmentCounters* fragment_counters)
     {
+        PROFILE_ZONE("Object");
+
         // GET RE-USED TRANSFORMATIONS.
         // This is done before the loop to avoid performance hits for repeatedly calculating these matrices.
         MATH::Matrix4x4f object_world_transform = object_3D.WorldTransform();
         ViewingTransformations viewing_transformations(camera, output_bitmap);
 
         // RENDER EACH TRIANGLE OF THE OBJECT.
+        // Consecutive triangles typically share materials, so the rasterizer is only
+        // re-selected when the material changes.
+        // Stages for each triangle are too small to profile as separate zones, so their times are accumulated.
+        enum TriangleStage { OBJECT_TRANSFORM, BACKFACE_CULLING, CLIPPING_AND_PROJECTION, VERTEX_SHADING, RASTERIZATION };
+        PROFILE_STAGES(triangle_stages, "Object transform", "Backface culling", "Clipping and projection", "Vertex shading", "Rasterization");
+        const Material* current_material = nullptr;
+        TriangleRasterizer current_triangle_rasterizer = nullptr;
         for (const auto& local_triangle : object_3D.Triangles)
         {
             // TRANSFORM THE TRIANGLE INTO WORLD SPACE.
+            PROFILE_STAGES_START(triangle_stages);
             Triangle world_space_triangle = TransformLocalToWorld(local_triangle, object_world_transform);
+            PROFILE_STAGE_END(triangle_stages, OBJECT_TRANSFORM);
 
             // CULL BACKFACES IF APPLICABLE.
             MATH::Vector3f unit_surface_normal = world_space_triangle.SurfaceNormal();
@@ -109,6 +135,7 @@ namespace GRAPHICS
                 MATH::Vector3f view_direction = -camera.CoordinateFrame.Forward;
                 float surface_normal_camera_view_direction_dot_product = MATH::Vector3f::DotProduct(unit_surface_normal, view_direction);
                 bool triangle_facing_toward_camera = (surface_normal_camera_view_direction_dot_product < 0.0f);
+                PROFILE_STAGE_END(triangle_stages, BACKFACE_CULLING);
                 if (!triangle_facing_toward_camera)
                 {
                     continue;
@@ -117,6 +144,7 @@ namespace GRAPHICS
 
             // TRANSFORM THE TRIANGLE FOR PROPER CAMERA VIEWING.
             std::optional<ScreenSpaceTriangle> screen_space_triangle = viewing_transformations.Apply(world_space_triangle);
+            PROFILE_STAGE_END(triangle_stages, CLIPPING_AND_PROJECTION);
             if (!screen_space_triangle)
             {
                 continue;
@@ -139,9 +167,17 @@ namespace GRAPHICS
 
                 screen_space_triangle->VertexColors[vertex_index] = final_vertex_color;
             }
+            PROFILE_STAGE_END(triangle_stages, VERTEX_SHADING);
 
             // RENDER THE FINAL SCREEN SPACE TRIANGLE.
-            Render(*screen_space_triangle, output_bitmap, depth_buffer);
+            bool material_changed = (current_material != screen_space_triangle->Material.get());
+            if (material_changed)
+            {
+                current_material = screen_space_triangle->Material.get();
+                current_triangle_rasterizer = SelectTriangleRasterizer(*current_material, depth_buffer, fragment_counters);
+            }
+            current_triangle_rasterizer(*screen_space_triangle, output_bitmap, depth_buffer, fragment_counters);
+            PROFILE_STAGE_END(triangle_stages, RASTERIZATION);
         }
     }
 
@@ -169,370 +205,50 @@ namespace GRAPHICS
         return world_space_triangle;
     }
 
+    /// Selects the triangle rasterizer specialized for the specified pipeline state.
+    /// Selection only needs to happen once for a batch of triangles sharing the same state,
+    /// which avoids re-checking that state for every triangle or pixel.
+    /// @param[in]  material - The material of the triangles to render.
+    /// @param[in]  depth_buffer - Any depth buffer to use for depth testing.
+    /// @param[in]  fragment_counters - Any counters to count fragments with.
+    /// @return The rasterizer for triangles with the specified state.
+    SoftwareRasterizationAlgorithm::TriangleRasterizer SoftwareRasterizationAlgorithm::SelectTriangleRasterizer(
+        const Material& material,
+        const DepthBuffer* depth_buffer,
+        const FragmentCounters* fragment_counters)
+    {
+        // DETERMINE THE PIPELINE STATE.
+        // Textures are only sampled for textured materials that actually have a texture.
+        std::size_t shading_type_index = static_cast<std::size_t>(material.Shading);
+        DepthTestMode depth_test_mode = depth_buffer ? DepthTestMode::ENABLED : DepthTestMode::DISABLED;
+        bool texture_sampled = (ShadingType::TEXTURED == material.Shading) && material.Texture;
+        TextureSamplingMode texture_sampling_mode = texture_sampled ? TextureSamplingMode::NEAREST : TextureSamplingMode::NONE;
+        FragmentCountingMode fragment_counting_mode = fragment_counters ? FragmentCountingMode::ENABLED : FragmentCountingMode::DISABLED;
+
+        // LOOK UP THE SPECIALIZED RASTERIZER.
+        const ShadingSpecializedTriangleRasterizers& fragment_counting_mode_rasterizers = TRIANGLE_RASTERIZERS[static_cast<std::size_t>(fragment_counting_mode)];
+        const DepthAndTextureSpecializedTriangleRasterizers& shading_type_rasterizers = fragment_counting_mode_rasterizers.at(shading_type_index);
+        TriangleRasterizer triangle_rasterizer = shading_type_rasterizers
+            [static_cast<std::size_t>(depth_test_mode)]
+            [static_cast<std::size_t>(texture_sampling_mode)];
+        return triangle_rasterizer;
+    }
+
     /// Renders a single triangle to the render target.
+    /// When rendering many triangles with the same material, it's more efficient to
+    /// select the rasterizer once via SelectTriangleRasterizer() and call it directly.
     /// @param[in]  triangle - The triangle to render.
     /// @param[in,out]  render_target - The target to render to.
     /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    /// @param[in,out]  fragment_counters - Any counters to count fragments per pixel with, for diagnosing overdraw.
     void SoftwareRasterizationAlgorithm::Render(
         const ScreenSpaceTriangle& triangle, 
         Bitmap& render_target,
-        DepthBuffer* depth_buffer)
+        DepthBuffer* depth_buffer,
+        FragmentCounters* fragment_counters)
     {
-        // GET THE VERTICES.
-        // They're needed for all kinds of shading.
-        const MATH::Vector3f& first_vertex = triangle.VertexPositions[0];
-        const MATH::Vector3f& second_vertex = triangle.VertexPositions[1];
-        const MATH::Vector3f& third_vertex = triangle.VertexPositions[2];
-
-        // RENDER THE TRIANGLE BASED ON SHADING TYPE.
-        switch (triangle.Material->Shading)
-        {
-            case ShadingType::WIREFRAME:
-            {
-                // GET THE VERTEX COLORS.
-                Color vertex_0_wireframe_color = triangle.VertexColors[0];
-                Color vertex_1_wireframe_color = triangle.VertexColors[1];
-                Color vertex_2_wireframe_color = triangle.VertexColors[2];
-
-                // DRAW THE FIRST EDGE.
-                DrawLineWithInterpolatedColor(
-                    first_vertex,
-                    second_vertex,
-                    vertex_0_wireframe_color,
-                    vertex_1_wireframe_color,
-                    render_target,
-                    depth_buffer);
-
-                // DRAW THE SECOND EDGE.
-                DrawLineWithInterpolatedColor(
-                    second_vertex,
-                    third_vertex,
-                    vertex_1_wireframe_color,
-                    vertex_2_wireframe_color,
-                    render_target,
-                    depth_buffer);
-
-                // DRAW THE THIRD EDGE.
-                DrawLineWithInterpolatedColor(
-                    third_vertex,
-                    first_vertex,
-                    vertex_2_wireframe_color,
-                    vertex_0_wireframe_color,
-                    render_target,
-                    depth_buffer);
-                break;
-            }
-            case ShadingType::FLAT:
-            {
-                // COMPUTE THE BARYCENTRIC COORDINATES OF THE TRIANGLE VERTICES.
-                float top_vertex_signed_distance_from_bottom_edge = (
-                    ((second_vertex.Y - third_vertex.Y) * first_vertex.X) +
-                    ((third_vertex.X - second_vertex.X) * first_vertex.Y) +
-                    (second_vertex.X * third_vertex.Y) -
-                    (third_vertex.X * second_vertex.Y));
-                float right_vertex_signed_distance_from_left_edge = (
-                    ((second_vertex.Y - first_vertex.Y) * third_vertex.X) +
-                    ((first_vertex.X - second_vertex.X) * third_vertex.Y) +
-                    (second_vertex.X * first_vertex.Y) -
-                    (first_vertex.X * second_vertex.Y));
-
-                // GET THE BOUNDING RECTANGLE OF THE TRIANGLE.
-                /// @todo   Create rectangle class.
-                float min_x = std::min({ first_vertex.X, second_vertex.X, third_vertex.X });
-                float max_x = std::max({ first_vertex.X, second_vertex.X, third_vertex.X });
-                float min_y = std::min({ first_vertex.Y, second_vertex.Y, third_vertex.Y });
-                float max_y = std::max({ first_vertex.Y, second_vertex.Y, third_vertex.Y });
-
-                // Endpoints are clamped to avoid trying to draw really huge lines off-screen.
-                constexpr float MIN_BITMAP_COORDINATE = 1.0f;
-
-                float max_x_position = static_cast<float>(render_target.GetWidthInPixels() - 1);
-                float clamped_min_x = MATH::Number::Clamp<float>(min_x, MIN_BITMAP_COORDINATE, max_x_position);
-                float clamped_max_x = MATH::Number::Clamp<float>(max_x, MIN_BITMAP_COORDINATE, max_x_position);
-
-                float max_y_position = static_cast<float>(render_target.GetHeightInPixels() - 1);
-                float clamped_min_y = MATH::Number::Clamp<float>(min_y, MIN_BITMAP_COORDINATE, max_y_position);
-                float clamped_max_y = MATH::Number::Clamp<float>(max_y, MIN_BITMAP_COORDINATE, max_y_position);
-
-                // COLOR PIXELS WITHIN THE TRIANGLE.
-                constexpr float ONE_PIXEL = 1.0f;
-                for (float y = clamped_min_y; y <= clamped_max_y; y += ONE_PIXEL)
-                {
-                    for (float x = clamped_min_x; x <= clamped_max_x; x += ONE_PIXEL)
-                    {
-                        // COMPUTE THE BARYCENTRIC COORDINATES OF THE CURRENT PIXEL POSITION.
-                        // The following diagram shows the order of the vertices:
-                        //             first_vertex
-                        //                 /\
-                        //                /  \
-                        // second_vertex /____\ third_vertex
-                        float current_pixel_signed_distance_from_bottom_edge = (
-                            ((second_vertex.Y - third_vertex.Y) * x) +
-                            ((third_vertex.X - second_vertex.X) * y) +
-                            (second_vertex.X * third_vertex.Y) -
-                            (third_vertex.X * second_vertex.Y));
-                        float scaled_signed_distance_of_current_pixel_relative_to_bottom_edge = (current_pixel_signed_distance_from_bottom_edge / top_vertex_signed_distance_from_bottom_edge);
-
-                        float current_pixel_signed_distance_from_left_edge = (
-                            ((second_vertex.Y - first_vertex.Y) * x) +
-                            ((first_vertex.X - second_vertex.X) * y) +
-                            (second_vertex.X * first_vertex.Y) -
-                            (first_vertex.X * second_vertex.Y));
-                        float scaled_signed_distance_of_current_pixel_relative_to_left_edge = (current_pixel_signed_distance_from_left_edge / right_vertex_signed_distance_from_left_edge);
-
-                        float scaled_signed_distance_of_current_pixel_relative_to_right_edge = (
-                            1.0f -
-                            scaled_signed_distance_of_current_pixel_relative_to_left_edge -
-                            scaled_signed_distance_of_current_pixel_relative_to_bottom_edge);
-
-                        // CHECK IF THE PIXEL IS WITHIN THE TRIANGLE.
-                        // It's allowed to be on the borders too.
-                        constexpr float MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE = 0.0f;
-                        constexpr float MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX = 1.0f;
-                        bool pixel_between_bottom_edge_and_top_vertex = (
-                            (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_bottom_edge) &&
-                            (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                        bool pixel_between_left_edge_and_right_vertex = (
-                            (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_left_edge) &&
-                            (scaled_signed_distance_of_current_pixel_relative_to_left_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                        bool pixel_between_right_edge_and_left_vertex = (
-                            (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_right_edge) &&
-                            (scaled_signed_distance_of_current_pixel_relative_to_right_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                        bool pixel_in_triangle = (
-                            pixel_between_bottom_edge_and_top_vertex &&
-                            pixel_between_left_edge_and_right_vertex &&
-                            pixel_between_right_edge_and_left_vertex);
-                        if (pixel_in_triangle)
-                        {
-                            float interpolated_z = (
-                                (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex.Z) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex.Z) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex.Z));
-
-                            // Apply depth buffering filtering if applicable.
-                            unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
-                            unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
-                            if (depth_buffer)
-                            {
-                                float current_pixel_depth = depth_buffer->GetDepth(current_pixel_x, current_pixel_y);
-                                bool current_pixel_in_front_of_old_pixels = (interpolated_z <= current_pixel_depth);
-                                if (!current_pixel_in_front_of_old_pixels)
-                                {
-                                    // Continue to the next iteration of the loop in
-                                    // case there is another pixel to draw.
-                                    continue;
-                                }
-                            }
-
-                            // GET THE COLOR.
-                            /// @todo   Assuming all vertices have the same color here.
-                            Color face_color = triangle.VertexColors[0];
-
-                            // DRAW THE COLORED PIXEL.
-                            // The coordinates need to be rounded to integer in order
-                            // to plot a pixel on a fixed grid.
-                            render_target.WritePixel(
-                                current_pixel_x,
-                                current_pixel_y,
-                                face_color);
-                            if (depth_buffer)
-                            {
-                                depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, interpolated_z);
-                            }
-                        }
-                    }
-                }
-                break;
-            }
-            case ShadingType::FACE_VERTEX_COLOR_INTERPOLATION:
-            case ShadingType::GOURAUD: /// @todo    This should be the same?
-            case ShadingType::TEXTURED: /// @todo    This should be the same?
-            case ShadingType::MATERIAL: /// @todo    This should be the same?
-            {
-                // COMPUTE THE BARYCENTRIC COORDINATES OF THE TRIANGLE VERTICES.
-                float top_vertex_signed_distance_from_bottom_edge = (
-                    ((second_vertex.Y - third_vertex.Y) * first_vertex.X) +
-                    ((third_vertex.X - second_vertex.X) * first_vertex.Y) +
-                    (second_vertex.X * third_vertex.Y) -
-                    (third_vertex.X * second_vertex.Y));
-                float right_vertex_signed_distance_from_left_edge = (
-                    ((second_vertex.Y - first_vertex.Y) * third_vertex.X) +
-                    ((first_vertex.X - second_vertex.X) * third_vertex.Y) +
-                    (second_vertex.X * first_vertex.Y) -
-                    (first_vertex.X * second_vertex.Y));
-
-                // GET THE BOUNDING RECTANGLE OF THE TRIANGLE.
-                /// @todo   Create rectangle class.
-                float min_x = std::min({ first_vertex.X, second_vertex.X, third_vertex.X });
-                float max_x = std::max({ first_vertex.X, second_vertex.X, third_vertex.X });
-                float min_y = std::min({ first_vertex.Y, second_vertex.Y, third_vertex.Y });
-                float max_y = std::max({ first_vertex.Y, second_vertex.Y, third_vertex.Y });
-
-                // Endpoints are clamped to avoid trying to draw really huge lines off-screen.
-                constexpr float MIN_BITMAP_COORDINATE = 1.0f;
-
-                float max_x_position = static_cast<float>(render_target.GetWidthInPixels() - 1);
-                float clamped_min_x = MATH::Number::Clamp<float>(min_x, MIN_BITMAP_COORDINATE, max_x_position);
-                float clamped_max_x = MATH::Number::Clamp<float>(max_x, MIN_BITMAP_COORDINATE, max_x_position);
-
-                float max_y_position = static_cast<float>(render_target.GetHeightInPixels() - 1);
-                float clamped_min_y = MATH::Number::Clamp<float>(min_y, MIN_BITMAP_COORDINATE, max_y_position);
-                float clamped_max_y = MATH::Number::Clamp<float>(max_y, MIN_BITMAP_COORDINATE, max_y_position);
-
-                // COLOR PIXELS WITHIN THE TRIANGLE.
-                constexpr float ONE_PIXEL = 1.0f;
-                for (float y = clamped_min_y; y <= clamped_max_y; y += ONE_PIXEL)
-                {
-                    for (float x = clamped_min_x; x <= clamped_max_x; x += ONE_PIXEL)
-                    {
-                        // COMPUTE THE BARYCENTRIC COORDINATES OF THE CURRENT PIXEL POSITION.
-                        // The following diagram shows the order of the vertices:
-                        //             first_vertex
-                        //                 /\
-                        //                /  \
-                        // second_vertex /____\ third_vertex
-                        float current_pixel_signed_distance_from_bottom_edge = (
-                            ((second_vertex.Y - third_vertex.Y) * x) +
-                            ((third_vertex.X - second_vertex.X) * y) +
-                            (second_vertex.X * third_vertex.Y) -
-                            (third_vertex.X * second_vertex.Y));
-                        float scaled_signed_distance_of_current_pixel_relative_to_bottom_edge = (current_pixel_signed_distance_from_bottom_edge / top_vertex_signed_distance_from_bottom_edge);
-
-                        float current_pixel_signed_distance_from_left_edge = (
-                            ((second_vertex.Y - first_vertex.Y) * x) +
-                            ((first_vertex.X - second_vertex.X) * y) +
-                            (second_vertex.X * first_vertex.Y) -
-                            (first_vertex.X * second_vertex.Y));
-                        float scaled_signed_distance_of_current_pixel_relative_to_left_edge = (current_pixel_signed_distance_from_left_edge / right_vertex_signed_distance_from_left_edge);
-
-                        float scaled_signed_distance_of_current_pixel_relative_to_right_edge = (
-                            1.0f -
-                            scaled_signed_distance_of_current_pixel_relative_to_left_edge -
-                            scaled_signed_distance_of_current_pixel_relative_to_bottom_edge);
-
-                        // CHECK IF THE PIXEL IS WITHIN THE TRIANGLE.
-                        float interpolated_z = DepthBuffer::MAX_DEPTH;
-                        // It's allowed to be on the borders too.
-                        constexpr float MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE = 0.0f;
-                        constexpr float MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX = 1.0f;
-                        bool pixel_between_bottom_edge_and_top_vertex = (
-                            (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_bottom_edge) &&
-                            (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                        bool pixel_between_left_edge_and_right_vertex = (
-                            (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_left_edge) &&
-                            (scaled_signed_distance_of_current_pixel_relative_to_left_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                        bool pixel_between_right_edge_and_left_vertex = (
-                            (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_right_edge) &&
-                            (scaled_signed_distance_of_current_pixel_relative_to_right_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
-                        bool pixel_in_triangle = (
-                            pixel_between_bottom_edge_and_top_vertex &&
-                            pixel_between_left_edge_and_right_vertex &&
-                            pixel_between_right_edge_and_left_vertex);
-                        if (pixel_in_triangle)
-                        {
-                            // The color needs to be interpolated with this kind of shading.
-                            Color interpolated_color = GRAPHICS::Color::BLACK;
-
-                            const Color& first_vertex_color = triangle.VertexColors[0];
-                            const Color& second_vertex_color = triangle.VertexColors[1];
-                            const Color& third_vertex_color = triangle.VertexColors[2];
-                            interpolated_color.Red = (
-                                (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex_color.Red) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex_color.Red) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex_color.Red));
-                            interpolated_color.Green = (
-                                (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex_color.Green) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex_color.Green) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex_color.Green));
-                            interpolated_color.Blue = (
-                                (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex_color.Blue) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex_color.Blue) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex_color.Blue));
-                            interpolated_color.Clamp();
-
-                            interpolated_z = (
-                                (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex.Z) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex.Z) +
-                                (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex.Z));
-
-                            if (ShadingType::TEXTURED == triangle.Material->Shading)
-                            {
-                                // INTERPOLATE THE TEXTURE COORDINATES.
-                                const MATH::Vector2f& first_texture_coordinate = triangle.Material->VertexTextureCoordinates[0];
-                                const MATH::Vector2f& second_texture_coordinate = triangle.Material->VertexTextureCoordinates[1];
-                                const MATH::Vector2f& third_texture_coordinate = triangle.Material->VertexTextureCoordinates[2];
-
-                                MATH::Vector2f interpolated_texture_coordinate;
-                                interpolated_texture_coordinate.X = (
-                                    (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_texture_coordinate.X) +
-                                    (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_texture_coordinate.X) +
-                                    (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_texture_coordinate.X));
-                                interpolated_texture_coordinate.Y = (
-                                    (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_texture_coordinate.Y) +
-                                    (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_texture_coordinate.Y) +
-                                    (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_texture_coordinate.Y));
-                                // Clamping.
-                                if (interpolated_texture_coordinate.X < 0.0f)
-                                {
-                                    interpolated_texture_coordinate.X = 0.0f;
-                                }
-                                else if (interpolated_texture_coordinate.X > 1.0f)
-                                {
-                                    interpolated_texture_coordinate.X = 1.0f;
-                                }
-                                if (interpolated_texture_coordinate.Y < 0.0f)
-                                {
-                                    interpolated_texture_coordinate.Y = 0.0f;
-                                }
-                                else if (interpolated_texture_coordinate.Y > 1.0f)
-                                {
-                                    interpolated_texture_coordinate.Y = 1.0f;
-                                }
-
-                                // LOOK UP THE TEXTURE COLOR AT THE COORDINATES.
-                                unsigned int texture_width_in_pixels = triangle.Material->Texture->GetWidthInPixels();
-                                unsigned int texture_pixel_x_coordinate = static_cast<unsigned int>(texture_width_in_pixels * interpolated_texture_coordinate.X);
-
-                                unsigned int texture_height_in_pixels = triangle.Material->Texture->GetHeightInPixels();
-                                unsigned int texture_pixel_y_coordinate = static_cast<unsigned int>(texture_height_in_pixels * interpolated_texture_coordinate.Y);
-
-                                Color texture_color = triangle.Material->Texture->GetPixel(texture_pixel_x_coordinate, texture_pixel_y_coordinate);
-
-                                interpolated_color = Color::ComponentMultiplyRedGreenBlue(interpolated_color, texture_color);
-                                interpolated_color.Clamp();
-                            }
-
-                            // Apply depth buffering filtering if applicable.
-                            unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
-                            unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
-                            if (depth_buffer)
-                            {
-                                float current_pixel_depth = depth_buffer->GetDepth(current_pixel_x, current_pixel_y);
-                                bool current_pixel_in_front_of_old_pixels = (interpolated_z >= current_pixel_depth);
-                                if (!current_pixel_in_front_of_old_pixels)
-                                {
-                                    // Continue to the next iteration of the loop in
-                                    // case there is another pixel to draw.
-                                    continue;
-                                }
-                            }
-
-                            // The coordinates need to be rounded to integer in order
-                            // to plot a pixel on a fixed grid.
-                            render_target.WritePixel(
-                                current_pixel_x,
-                                current_pixel_y,
-                                interpolated_color);
-                            if (depth_buffer)
-                            {
-                                depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, interpolated_z);
-                            }
-                        }
-                    }
-                }
-                break;
-            }
-        }
+        TriangleRasterizer triangle_rasterizer = SelectTriangleRasterizer(*triangle.Material, depth_buffer, fragment_counters);
+        triangle_rasterizer(triangle, render_target, depth_buffer, fragment_counters);
     }
 
     /// Renders a line with the specified endpoints (in screen coordinates).
@@ -737,4 +453,458 @@ namespace GRAPHICS
             }
         }
     }
+
+    /// Gets the triangle rasterizers for a fragment counting mode specialized for all shading types,
+    /// depth test modes, and texture sampling modes.
+    /// @tparam FRAGMENT_COUNTING_MODE - Whether the rasterizers count fragments.
+    /// @return The rasterizers, indexed by [shading type][depth test mode][texture sampling mode].
+    template <FragmentCountingMode FRAGMENT_COUNTING_MODE>
+    constexpr SoftwareRasterizationAlgorithm::ShadingSpecializedTriangleRasterizers SoftwareRasterizationAlgorithm::SpecializeShadingTriangleRasterizers()
+    {
+        // Only textured shading has variants that sample textures.  All kinds of shading
+        // that interpolate colors across faces currently share the same rasterizer.
+        ShadingSpecializedTriangleRasterizers triangle_rasterizers =
+        {
+            SpecializeTriangleRasterizers<FRAGMENT_COUNTING_MODE, ShadingType::WIREFRAME, TextureSamplingMode::NONE>(),
+            SpecializeTriangleRasterizers<FRAGMENT_COUNTING_MODE, ShadingType::FLAT, TextureSamplingMode::NONE>(),
+            SpecializeTriangleRasterizers<FRAGMENT_COUNTING_MODE, ShadingType::FACE_VERTEX_COLOR_INTERPOLATION, TextureSamplingMode::NONE>(),
+            SpecializeTriangleRasterizers<FRAGMENT_COUNTING_MODE, ShadingType::FACE_VERTEX_COLOR_INTERPOLATION, TextureSamplingMode::NONE>(),
+            SpecializeTriangleRasterizers<FRAGMENT_COUNTING_MODE, ShadingType::FACE_VERTEX_COLOR_INTERPOLATION, TextureSamplingMode::NEAREST>(),
+            SpecializeTriangleRasterizers<FRAGMENT_COUNTING_MODE, ShadingType::FACE_VERTEX_COLOR_INTERPOLATION, TextureSamplingMode::NONE>(),
+        };
+        return triangle_rasterizers;
+    }
+
+    /// Gets the triangle rasterizers for a shading type specialized for all depth test modes
+    /// and texture sampling modes.
+    /// @tparam FRAGMENT_COUNTING_MODE - Whether the rasterizers count fragments.
+    /// @tparam SHADING_TYPE - The type of shading for the rasterizers.
+    /// @tparam TEXTURED_SAMPLING_MODE - The texture sampling mode to use for rasterizers
+    ///     selected when a texture should be sampled.  Shading types that don't support textures
+    ///     can use TextureSamplingMode::NONE to avoid generating unnecessary rasterizers.
+    /// @return The rasterizers, indexed by [depth test mode][texture sampling mode].
+    template <FragmentCountingMode FRAGMENT_COUNTING_MODE, ShadingType SHADING_TYPE, TextureSamplingMode TEXTURED_SAMPLING_MODE>
+    constexpr SoftwareRasterizationAlgorithm::DepthAndTextureSpecializedTriangleRasterizers SoftwareRasterizationAlgorithm::SpecializeTriangleRasterizers()
+    {
+        DepthAndTextureSpecializedTriangleRasterizers triangle_rasterizers =
+        {{
+            {{
+                &RenderTriangle<SHADING_TYPE, DepthTestMode::DISABLED, TextureSamplingMode::NONE, FRAGMENT_COUNTING_MODE>,
+                &RenderTriangle<SHADING_TYPE, DepthTestMode::DISABLED, TEXTURED_SAMPLING_MODE, FRAGMENT_COUNTING_MODE>
+            }},
+            {{
+                &RenderTriangle<SHADING_TYPE, DepthTestMode::ENABLED, TextureSamplingMode::NONE, FRAGMENT_COUNTING_MODE>,
+                &RenderTriangle<SHADING_TYPE, DepthTestMode::ENABLED, TEXTURED_SAMPLING_MODE, FRAGMENT_COUNTING_MODE>
+            }}
+        }};
+        return triangle_rasterizers;
+    }
+
+    /// Renders a single triangle to the render target using a rasterizer specialized
+    /// at compile-time for a particular pipeline state, so that inner loops only
+    /// contain work needed for that state.
+    /// @tparam SHADING_TYPE - The type of shading for the triangle.
+    /// @tparam DEPTH_TEST_MODE - Whether depth testing is performed.
+    /// @tparam TEXTURE_SAMPLING_MODE - How (if at all) the triangle's texture is sampled.
+    /// @tparam FRAGMENT_COUNTING_MODE - Whether fragments are counted.  Wireframe lines aren't counted.
+    /// @param[in]  triangle - The triangle to render.
+    /// @param[in,out]  render_target - The target to render to.
+    /// @param[in,out]  depth_buffer - The depth buffer to use for any depth buffering.
+    ///     Must be non-null if depth testing is enabled.
+    /// @param[in,out]  fragment_counters - The counters to count fragments with.
+    ///     Must be non-null if fragment counting is enabled.
+    template <ShadingType SHADING_TYPE, DepthTestMode DEPTH_TEST_MODE, TextureSamplingMode TEXTURE_SAMPLING_MODE, FragmentCountingMode FRAGMENT_COUNTING_MODE>
+    void SoftwareRasterizationAlgorithm::RenderTriangle(
+        const ScreenSpaceTriangle& triangle,
+        Bitmap& render_target,
+        [[maybe_unused]] DepthBuffer* depth_buffer,
+        [[maybe_unused]] FragmentCounters* fragment_counters)
+    {
+        // GET THE VERTICES.
+        // They're needed for all kinds of shading.
+        const MATH::Vector3f& first_vertex = triangle.VertexPositions[0];
+        const MATH::Vector3f& second_vertex = triangle.VertexPositions[1];
+        const MATH::Vector3f& third_vertex = triangle.VertexPositions[2];
+
+        // RENDER THE TRIANGLE BASED ON SHADING TYPE.
+        if constexpr (ShadingType::WIREFRAME == SHADING_TYPE)
+        {
+            // GET THE DEPTH BUFFER FOR THE LINES.
+            // Lines only perform depth testing if given a depth buffer.
+            DepthBuffer* wireframe_depth_buffer = nullptr;
+            if constexpr (DepthTestMode::ENABLED == DEPTH_TEST_MODE)
+            {
+                wireframe_depth_buffer = depth_buffer;
+            }
+
+            // GET THE VERTEX COLORS.
+            Color vertex_0_wireframe_color = triangle.VertexColors[0];
+            Color vertex_1_wireframe_color = triangle.VertexColors[1];
+            Color vertex_2_wireframe_color = triangle.VertexColors[2];
+
+            // DRAW THE FIRST EDGE.
+            DrawLineWithInterpolatedColor(
+                first_vertex,
+                second_vertex,
+                vertex_0_wireframe_color,
+                vertex_1_wireframe_color,
+                render_target,
+                wireframe_depth_buffer);
+
+            // DRAW THE SECOND EDGE.
+            DrawLineWithInterpolatedColor(
+                second_vertex,
+                third_vertex,
+                vertex_1_wireframe_color,
+                vertex_2_wireframe_color,
+                render_target,
+                wireframe_depth_buffer);
+
+            // DRAW THE THIRD EDGE.
+            DrawLineWithInterpolatedColor(
+                third_vertex,
+                first_vertex,
+                vertex_2_wireframe_color,
+                vertex_0_wireframe_color,
+                render_target,
+                wireframe_depth_buffer);
+        }
+        else if constexpr (ShadingType::FLAT == SHADING_TYPE)
+        {
+            // COMPUTE THE BARYCENTRIC COORDINATES OF THE TRIANGLE VERTICES.
+            float top_vertex_signed_distance_from_bottom_edge = (
+                ((second_vertex.Y - third_vertex.Y) * first_vertex.X) +
+                ((third_vertex.X - second_vertex.X) * first_vertex.Y) +
+                (second_vertex.X * third_vertex.Y) -
+                (third_vertex.X * second_vertex.Y));
+            float right_vertex_signed_distance_from_left_edge = (
+                ((second_vertex.Y - first_vertex.Y) * third_vertex.X) +
+                ((first_vertex.X - second_vertex.X) * third_vertex.Y) +
+                (second_vertex.X * first_vertex.Y) -
+                (first_vertex.X * second_vertex.Y));
+
+            // GET THE BOUNDING RECTANGLE OF THE TRIANGLE.
+            /// @todo   Create rectangle class.
+            float min_x = std::min({ first_vertex.X, second_vertex.X, third_vertex.X });
+            float max_x = std::max({ first_vertex.X, second_vertex.X, third_vertex.X });
+            float min_y = std::min({ first_vertex.Y, second_vertex.Y, third_vertex.Y });
+            float max_y = std::max({ first_vertex.Y, second_vertex.Y, third_vertex.Y });
+
+            // Endpoints are clamped to avoid trying to draw really huge lines off-screen.
+            constexpr float MIN_BITMAP_COORDINATE = 1.0f;
+
+            float max_x_position = static_cast<float>(render_target.GetWidthInPixels() - 1);
+            float clamped_min_x = MATH::Number::Clamp<float>(min_x, MIN_BITMAP_COORDINATE, max_x_position);
+            float clamped_max_x = MATH::Number::Clamp<float>(max_x, MIN_BITMAP_COORDINATE, max_x_position);
+
+            float max_y_position = static_cast<float>(render_target.GetHeightInPixels() - 1);
+            float clamped_min_y = MATH::Number::Clamp<float>(min_y, MIN_BITMAP_COORDINATE, max_y_position);
+            float clamped_max_y = MATH::Number::Clamp<float>(max_y, MIN_BITMAP_COORDINATE, max_y_position);
+
+            // GET THE COLOR.
+            // It only needs to be packed once since it's the same for all pixels.
+            /// @todo   Assuming all vertices have the same color here.
+            uint32_t packed_face_color = triangle.VertexColors[0].Pack(render_target.GetColorFormat());
+
+            // COLOR PIXELS WITHIN THE TRIANGLE.
+            constexpr float ONE_PIXEL = 1.0f;
+            for (float y = clamped_min_y; y <= clamped_max_y; y += ONE_PIXEL)
+            {
+                for (float x = clamped_min_x; x <= clamped_max_x; x += ONE_PIXEL)
+                {
+                    // COMPUTE THE BARYCENTRIC COORDINATES OF THE CURRENT PIXEL POSITION.
+                    // The following diagram shows the order of the vertices:
+                    //             first_vertex
+                    //                 /\
+                    //                /  \
+                    // second_vertex /____\ third_vertex
+                    float current_pixel_signed_distance_from_bottom_edge = (
+                        ((second_vertex.Y - third_vertex.Y) * x) +
+                        ((third_vertex.X - second_vertex.X) * y) +
+                        (second_vertex.X * third_vertex.Y) -
+                        (third_vertex.X * second_vertex.Y));
+                    float scaled_signed_distance_of_current_pixel_relative_to_bottom_edge = (current_pixel_signed_distance_from_bottom_edge / top_vertex_signed_distance_from_bottom_edge);
+
+                    float current_pixel_signed_distance_from_left_edge = (
+                        ((second_vertex.Y - first_vertex.Y) * x) +
+                        ((first_vertex.X - second_vertex.X) * y) +
+                        (second_vertex.X * first_vertex.Y) -
+                        (first_vertex.X * second_vertex.Y));
+                    float scaled_signed_distance_of_current_pixel_relative_to_left_edge = (current_pixel_signed_distance_from_left_edge / right_vertex_signed_distance_from_left_edge);
+
+                    float scaled_signed_distance_of_current_pixel_relative_to_right_edge = (
+                        1.0f -
+                        scaled_signed_distance_of_current_pixel_relative_to_left_edge -
+                        scaled_signed_distance_of_current_pixel_relative_to_bottom_edge);
+
+                    // CHECK IF THE PIXEL IS WITHIN THE TRIANGLE.
+                    // It's allowed to be on the borders too.
+                    constexpr float MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE = 0.0f;
+                    constexpr float MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX = 1.0f;
+                    bool pixel_between_bottom_edge_and_top_vertex = (
+                        (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_bottom_edge) &&
+                        (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                    bool pixel_between_left_edge_and_right_vertex = (
+                        (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_left_edge) &&
+                        (scaled_signed_distance_of_current_pixel_relative_to_left_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                    bool pixel_between_right_edge_and_left_vertex = (
+                        (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_right_edge) &&
+                        (scaled_signed_distance_of_current_pixel_relative_to_right_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                    bool pixel_in_triangle = (
+                        pixel_between_bottom_edge_and_top_vertex &&
+                        pixel_between_left_edge_and_right_vertex &&
+                        pixel_between_right_edge_and_left_vertex);
+                    if (pixel_in_triangle)
+                    {
+                        float interpolated_z = (
+                            (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex.Z) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex.Z) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex.Z));
+
+                        // Apply depth buffering filtering if applicable.
+                        unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
+                        unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
+                        if constexpr (DepthTestMode::ENABLED == DEPTH_TEST_MODE)
+                        {
+                            float current_pixel_depth = depth_buffer->GetDepth(current_pixel_x, current_pixel_y);
+                            bool current_pixel_in_front_of_old_pixels = (interpolated_z >= current_pixel_depth);
+                            if constexpr (FragmentCountingMode::ENABLED == FRAGMENT_COUNTING_MODE)
+                            {
+                                fragment_counters->CountDepthTest(current_pixel_x, current_pixel_y, current_pixel_in_front_of_old_pixels);
+                            }
+                            if (!current_pixel_in_front_of_old_pixels)
+                            {
+                                // Continue to the next iteration of the loop in
+                                // case there is another pixel to draw.
+                                continue;
+                            }
+                        }
+                        else if constexpr (FragmentCountingMode::ENABLED == FRAGMENT_COUNTING_MODE)
+                        {
+                            // Without depth testing, all fragments pass.
+                            fragment_counters->CountDepthTest(current_pixel_x, current_pixel_y, true);
+                        }
+
+                        // DRAW THE COLORED PIXEL.
+                        // The coordinates need to be rounded to integer in order
+                        // to plot a pixel on a fixed grid.
+                        render_target.WritePixel(
+                            current_pixel_x,
+                            current_pixel_y,
+                            packed_face_color);
+                        if constexpr (FragmentCountingMode::ENABLED == FRAGMENT_COUNTING_MODE)
+                        {
+                            fragment_counters->CountShadedFragment(current_pixel_x, current_pixel_y);
+                        }
+                        if constexpr (DepthTestMode::ENABLED == DEPTH_TEST_MODE)
+                        {
+                            depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, interpolated_z);
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            // COMPUTE THE BARYCENTRIC COORDINATES OF THE TRIANGLE VERTICES.
+            float top_vertex_signed_distance_from_bottom_edge = (
+                ((second_vertex.Y - third_vertex.Y) * first_vertex.X) +
+                ((third_vertex.X - second_vertex.X) * first_vertex.Y) +
+                (second_vertex.X * third_vertex.Y) -
+                (third_vertex.X * second_vertex.Y));
+            float right_vertex_signed_distance_from_left_edge = (
+                ((second_vertex.Y - first_vertex.Y) * third_vertex.X) +
+                ((first_vertex.X - second_vertex.X) * third_vertex.Y) +
+                (second_vertex.X * first_vertex.Y) -
+                (first_vertex.X * second_vertex.Y));
+
+            // GET THE BOUNDING RECTANGLE OF THE TRIANGLE.
+            /// @todo   Create rectangle class.
+            float min_x = std::min({ first_vertex.X, second_vertex.X, third_vertex.X });
+            float max_x = std::max({ first_vertex.X, second_vertex.X, third_vertex.X });
+            float min_y = std::min({ first_vertex.Y, second_vertex.Y, third_vertex.Y });
+            float max_y = std::max({ first_vertex.Y, second_vertex.Y, third_vertex.Y });
+
+            // Endpoints are clamped to avoid trying to draw really huge lines off-screen.
+            constexpr float MIN_BITMAP_COORDINATE = 1.0f;
+
+            float max_x_position = static_cast<float>(render_target.GetWidthInPixels() - 1);
+            float clamped_min_x = MATH::Number::Clamp<float>(min_x, MIN_BITMAP_COORDINATE, max_x_position);
+            float clamped_max_x = MATH::Number::Clamp<float>(max_x, MIN_BITMAP_COORDINATE, max_x_position);
+
+            float max_y_position = static_cast<float>(render_target.GetHeightInPixels() - 1);
+            float clamped_min_y = MATH::Number::Clamp<float>(min_y, MIN_BITMAP_COORDINATE, max_y_position);
+            float clamped_max_y = MATH::Number::Clamp<float>(max_y, MIN_BITMAP_COORDINATE, max_y_position);
+
+            // GET THE VERTEX ATTRIBUTES TO INTERPOLATE.
+            const Color& first_vertex_color = triangle.VertexColors[0];
+            const Color& second_vertex_color = triangle.VertexColors[1];
+            const Color& third_vertex_color = triangle.VertexColors[2];
+
+            // GET ANY TEXTURE INFORMATION.
+            // This is only needed if textures are being sampled.
+            [[maybe_unused]] const Bitmap* texture = nullptr;
+            [[maybe_unused]] float texture_width_in_pixels = 0.0f;
+            [[maybe_unused]] float texture_height_in_pixels = 0.0f;
+            [[maybe_unused]] MATH::Vector2f first_texture_coordinate;
+            [[maybe_unused]] MATH::Vector2f second_texture_coordinate;
+            [[maybe_unused]] MATH::Vector2f third_texture_coordinate;
+            if constexpr (TextureSamplingMode::NEAREST == TEXTURE_SAMPLING_MODE)
+            {
+                texture = triangle.Material->Texture.get();
+                texture_width_in_pixels = static_cast<float>(texture->GetWidthInPixels());
+                texture_height_in_pixels = static_cast<float>(texture->GetHeightInPixels());
+                first_texture_coordinate = triangle.Material->VertexTextureCoordinates[0];
+                second_texture_coordinate = triangle.Material->VertexTextureCoordinates[1];
+                third_texture_coordinate = triangle.Material->VertexTextureCoordinates[2];
+            }
+
+            // COLOR PIXELS WITHIN THE TRIANGLE.
+            constexpr float ONE_PIXEL = 1.0f;
+            for (float y = clamped_min_y; y <= clamped_max_y; y += ONE_PIXEL)
+            {
+                // Colors for pixels in the current row are converted to the render target's format in batches.
+                unsigned int current_pixel_y = static_cast<unsigned int>(std::round(y));
+                PixelRowBatch row_pixels(current_pixel_y, render_target);
+                for (float x = clamped_min_x; x <= clamped_max_x; x += ONE_PIXEL)
+                {
+                    // COMPUTE THE BARYCENTRIC COORDINATES OF THE CURRENT PIXEL POSITION.
+                    // The following diagram shows the order of the vertices:
+                    //             first_vertex
+                    //                 /\
+                    //                /  \
+                    // second_vertex /____\ third_vertex
+                    float current_pixel_signed_distance_from_bottom_edge = (
+                        ((second_vertex.Y - third_vertex.Y) * x) +
+                        ((third_vertex.X - second_vertex.X) * y) +
+                        (second_vertex.X * third_vertex.Y) -
+                        (third_vertex.X * second_vertex.Y));
+                    float scaled_signed_distance_of_current_pixel_relative_to_bottom_edge = (current_pixel_signed_distance_from_bottom_edge / top_vertex_signed_distance_from_bottom_edge);
+
+                    float current_pixel_signed_distance_from_left_edge = (
+                        ((second_vertex.Y - first_vertex.Y) * x) +
+                        ((first_vertex.X - second_vertex.X) * y) +
+                        (second_vertex.X * first_vertex.Y) -
+                        (first_vertex.X * second_vertex.Y));
+                    float scaled_signed_distance_of_current_pixel_relative_to_left_edge = (current_pixel_signed_distance_from_left_edge / right_vertex_signed_distance_from_left_edge);
+
+                    float scaled_signed_distance_of_current_pixel_relative_to_right_edge = (
+                        1.0f -
+                        scaled_signed_distance_of_current_pixel_relative_to_left_edge -
+                        scaled_signed_distance_of_current_pixel_relative_to_bottom_edge);
+
+                    // CHECK IF THE PIXEL IS WITHIN THE TRIANGLE.
+                    // It's allowed to be on the borders too.
+                    constexpr float MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE = 0.0f;
+                    constexpr float MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX = 1.0f;
+                    bool pixel_between_bottom_edge_and_top_vertex = (
+                        (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_bottom_edge) &&
+                        (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                    bool pixel_between_left_edge_and_right_vertex = (
+                        (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_left_edge) &&
+                        (scaled_signed_distance_of_current_pixel_relative_to_left_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                    bool pixel_between_right_edge_and_left_vertex = (
+                        (MIN_SIGNED_DISTANCE_TO_BE_ON_EDGE <= scaled_signed_distance_of_current_pixel_relative_to_right_edge) &&
+                        (scaled_signed_distance_of_current_pixel_relative_to_right_edge <= MAX_SIGNED_DISTANCE_TO_BE_ON_VERTEX));
+                    bool pixel_in_triangle = (
+                        pixel_between_bottom_edge_and_top_vertex &&
+                        pixel_between_left_edge_and_right_vertex &&
+                        pixel_between_right_edge_and_left_vertex);
+                    if (pixel_in_triangle)
+                    {
+                        // APPLY DEPTH BUFFERING FILTERING IF APPLICABLE.
+                        // This is done before computing the color to avoid shading hidden pixels.
+                        float interpolated_z = (
+                            (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex.Z) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex.Z) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex.Z));
+                        unsigned int current_pixel_x = static_cast<unsigned int>(std::round(x));
+                        if constexpr (DepthTestMode::ENABLED == DEPTH_TEST_MODE)
+                        {
+                            float current_pixel_depth = depth_buffer->GetDepth(current_pixel_x, current_pixel_y);
+                            bool current_pixel_in_front_of_old_pixels = (interpolated_z >= current_pixel_depth);
+                            if constexpr (FragmentCountingMode::ENABLED == FRAGMENT_COUNTING_MODE)
+                            {
+                                fragment_counters->CountDepthTest(current_pixel_x, current_pixel_y, current_pixel_in_front_of_old_pixels);
+                            }
+                            if (!current_pixel_in_front_of_old_pixels)
+                            {
+                                // Continue to the next iteration of the loop in
+                                // case there is another pixel to draw.
+                                continue;
+                            }
+                        }
+                        else if constexpr (FragmentCountingMode::ENABLED == FRAGMENT_COUNTING_MODE)
+                        {
+                            // Without depth testing, all fragments pass.
+                            fragment_counters->CountDepthTest(current_pixel_x, current_pixel_y, true);
+                        }
+
+                        // The color needs to be interpolated with this kind of shading.
+                        Color interpolated_color = GRAPHICS::Color::BLACK;
+                        interpolated_color.Red = (
+                            (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex_color.Red) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex_color.Red) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex_color.Red));
+                        interpolated_color.Green = (
+                            (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex_color.Green) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex_color.Green) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex_color.Green));
+                        interpolated_color.Blue = (
+                            (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_vertex_color.Blue) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_vertex_color.Blue) +
+                            (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex_color.Blue));
+                        interpolated_color.Clamp();
+
+                        if constexpr (TextureSamplingMode::NEAREST == TEXTURE_SAMPLING_MODE)
+                        {
+                            // INTERPOLATE THE TEXTURE COORDINATES.
+                            MATH::Vector2f interpolated_texture_coordinate;
+                            interpolated_texture_coordinate.X = (
+                                (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_texture_coordinate.X) +
+                                (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_texture_coordinate.X) +
+                                (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_texture_coordinate.X));
+                            interpolated_texture_coordinate.Y = (
+                                (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_texture_coordinate.Y) +
+                                (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_texture_coordinate.Y) +
+                                (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_texture_coordinate.Y));
+                            // Clamping.
+                            interpolated_texture_coordinate.X = MATH::Number::Clamp<float>(interpolated_texture_coordinate.X, 0.0f, 1.0f);
+                            interpolated_texture_coordinate.Y = MATH::Number::Clamp<float>(interpolated_texture_coordinate.Y, 0.0f, 1.0f);
+
+                            // LOOK UP THE TEXTURE COLOR AT THE COORDINATES.
+                            unsigned int texture_pixel_x_coordinate = static_cast<unsigned int>(texture_width_in_pixels * interpolated_texture_coordinate.X);
+                            unsigned int texture_pixel_y_coordinate = static_cast<unsigned int>(texture_height_in_pixels * interpolated_texture_coordinate.Y);
+                            Color texture_color = texture->GetPixel(texture_pixel_x_coordinate, texture_pixel_y_coordinate);
+
+                            interpolated_color = Color::ComponentMultiplyRedGreenBlue(interpolated_color, texture_color);
+                            interpolated_color.Clamp();
+                        }
+
+                        // DRAW THE COLORED PIXEL.
+                        // The coordinates need to be rounded to integer in order
+                        // to plot a pixel on a fixed grid.
+                        row_pixels.Add(current_pixel_x, interpolated_color);
+                        if constexpr (FragmentCountingMode::ENABLED == FRAGMENT_COUNTING_MODE)
+                        {
+                            fragment_counters->CountShadedFragment(current_pixel_x, current_pixel_y);
+                        }
+                        if constexpr (DepthTestMode::ENABLED == DEPTH_TEST_MODE)
+                        {
+                            depth_buffer->WriteDepth(current_pixel_x, current_pixel_y, interpolated_z);
+                        }
+                    }
+                }
+
+                // WRITE ANY REMAINING PIXELS FOR THE ROW.
+                row_pixels.Flush();
+            }
+        }
+    }
+
+    const std::array<SoftwareRasterizationAlgorithm::ShadingSpecializedTriangleRasterizers, static_cast<std::size_t>(FragmentCountingMode::COUNT)> SoftwareRasterizationAlgorithm::TRIANGLE_RASTERIZERS =
+    {
+        SpecializeShadingTriangleRasterizers<FragmentCountingMode::DISABLED>(),
+        SpecializeShadingTriangleRasterizers<FragmentCountingMode::ENABLED>(),
+    };
 }
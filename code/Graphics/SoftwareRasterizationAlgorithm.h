@@ -1,14 +1,20 @@
 #pragma once
 
+#include <array>
 #include <optional>
 #include <vector>
 #include "Graphics/Bitmap.h"
 #include "Graphics/Camera.h"
 #include "Graphics/DepthBuffer.h"
+#include "Graphics/DepthTestMode.h"
+#include "Graphics/FragmentCounters.h"
+#include "Graphics/FragmentCountingMode.h"
 #include "Graphics/Gui/Text.h"
 #include "Graphics/Light.h"
+#include "Graphics/Material.h"
 #include "Graphics/Scene.h"
 #include "Graphics/ScreenSpaceTriangle.h"
+#include "Graphics/TextureSamplingMode.h"
 
 namespace GRAPHICS
 {
@@ -18,6 +24,12 @@ namespace GRAPHICS
     class SoftwareRasterizationAlgorithm
     {
     public:
+        /// A function for rasterizing a single screen-space triangle that has been specialized
+        /// for a particular combination of shading type, depth testing, texture sampling, and fragment counting.
+        /// The depth buffer is ignored by rasterizers that don't perform depth testing,
+        /// and the fragment counters are ignored by rasterizers that don't count fragments.
+        using TriangleRasterizer = void (*)(const ScreenSpaceTriangle& triangle, Bitmap& render_target, DepthBuffer* depth_buffer, FragmentCounters* fragment_counters);
+
         static void Render(const GUI::Text& text, Bitmap& render_target);
 
         static void Render(
@@ -25,21 +37,28 @@ namespace GRAPHICS
             const Camera& camera, 
             const bool cull_backfaces, 
             Bitmap& output_bitmap,
-            DepthBuffer* depth_buffer);
+            DepthBuffer* depth_buffer,
+            FragmentCounters* fragment_counters = nullptr);
         static void Render(
             const Object3D& object_3D, 
             const std::optional<std::vector<Light>>& lights, 
             const Camera& camera, 
             const bool cull_backfaces, 
             Bitmap& output_bitmap,
-            DepthBuffer* depth_buffer);
+            DepthBuffer* depth_buffer,
+            FragmentCounters* fragment_counters = nullptr);
 
         static Triangle TransformLocalToWorld(const Triangle& local_triangle, const MATH::Matrix4x4f& world_transform);
 
+        static TriangleRasterizer SelectTriangleRasterizer(
+            const Material& material,
+            const DepthBuffer* depth_buffer,
+            const FragmentCounters* fragment_counters = nullptr);
         static void Render(
             const ScreenSpaceTriangle& triangle, 
             Bitmap& render_target,
-            DepthBuffer* depth_buffer);
+            DepthBuffer* depth_buffer,
+            FragmentCounters* fragment_counters = nullptr);
 
         static void DrawLine(
             const MATH::Vector3f& start_vertex,
@@ -54,5 +73,34 @@ namespace GRAPHICS
             const Color& end_color,
             Bitmap& render_target,
             DepthBuffer* depth_buffer);
+
+    private:
+        /// Triangle rasterizers for each depth test mode and texture sampling mode,
+        /// indexed by [depth test mode][texture sampling mode].
+        using DepthAndTextureSpecializedTriangleRasterizers = std::array<
+            std::array<TriangleRasterizer, static_cast<std::size_t>(TextureSamplingMode::COUNT)>,
+            static_cast<std::size_t>(DepthTestMode::COUNT)>;
+
+        /// Triangle rasterizers for each shading type, indexed by [shading type][depth test mode][texture sampling mode].
+        using ShadingSpecializedTriangleRasterizers = std::array<
+            DepthAndTextureSpecializedTriangleRasterizers,
+            static_cast<std::size_t>(ShadingType::COUNT)>;
+
+        // STATIC CONSTANTS.
+        /// Triangle rasterizers specialized for each combination of pipeline state, indexed by
+        /// [fragment counting mode][shading type][depth test mode][texture sampling mode].
+        static const std::array<ShadingSpecializedTriangleRasterizers, static_cast<std::size_t>(FragmentCountingMode::COUNT)> TRIANGLE_RASTERIZERS;
+
+        // HELPER METHODS.
+        template <FragmentCountingMode FRAGMENT_COUNTING_MODE>
+        static constexpr ShadingSpecializedTriangleRasterizers SpecializeShadingTriangleRasterizers();
+        template <FragmentCountingMode FRAGMENT_COUNTING_MODE, ShadingType SHADING_TYPE, TextureSamplingMode TEXTURED_SAMPLING_MODE>
+        static constexpr DepthAndTextureSpecializedTriangleRasterizers SpecializeTriangleRasterizers();
+        template <ShadingType SHADING_TYPE, DepthTestMode DEPTH_TEST_MODE, TextureSamplingMode TEXTURE_SAMPLING_MODE, FragmentCountingMode FRAGMENT_COUNTING_MODE>
+        static void RenderTriangle(
+            const ScreenSpaceTriangle& triangle,
+            Bitmap& render_target,
+            DepthBuffer* depth_buffer,
+            FragmentCounters* fragment_counters);
     };
 }
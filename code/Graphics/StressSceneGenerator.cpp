@@ -0,0 +1,501 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include "Graphics/Cube.h"
+#include "Graphics/StressSceneGenerator.h"
+#include "Graphics/TransformNode.h"
+#include "Graphics/Triangle.h"
+
+namespace GRAPHICS
+{
+    /// Gets parameters for a type of stress scene at its default scale.
+    /// Defaults aim for sizes typical of production scenes for the aspect being stressed.
+    /// @param[in]  type - The type of stress scene.
+    /// @return The default parameters for the type of scene.
+    StressSceneParameters StressSceneParameters::Default(const StressSceneType type)
+    {
+        StressSceneParameters parameters;
+        parameters.Type = type;
+        switch (type)
+        {
+            case StressSceneType::SMALL_TRIANGLES:
+                parameters.TriangleCount = 1000000;
+                break;
+            case StressSceneType::OVERDRAW:
+                // Each layer is a quad of 2 triangles.
+                parameters.TriangleCount = 64;
+                break;
+            case StressSceneType::INSTANCING:
+                // Each instance is a cube of 12 triangles.
+                parameters.TriangleCount = 120000;
+                break;
+            case StressSceneType::MANY_LIGHTS:
+                parameters.TriangleCount = 20000;
+                parameters.LightCount = 64;
+                break;
+            case StressSceneType::REFLECTIONS:
+                parameters.TriangleCount = 20000;
+                parameters.LightCount = 2;
+                break;
+            default:
+                break;
+        }
+        return parameters;
+    }
+
+    /// Gets the name of a type of stress scene, such as for command line arguments or reporting.
+    /// @param[in]  type - The type of stress scene.
+    /// @return The name of the type.
+    std::string_view StressSceneGenerator::TypeName(const StressSceneType type)
+    {
+        switch (type)
+        {
+            case StressSceneType::SMALL_TRIANGLES:
+                return "small_triangles";
+            case StressSceneType::OVERDRAW:
+                return "overdraw";
+            case StressSceneType::INSTANCING:
+                return "instancing";
+            case StressSceneType::MANY_LIGHTS:
+                return "many_lights";
+            case StressSceneType::REFLECTIONS:
+                return "reflections";
+            default:
+                return "unknown";
+        }
+    }
+
+    /// Gets the type of stress scene with a name.
+    /// @param[in]  name - The name of the type, as returned by TypeName().
+    /// @return The type of stress scene, if the name is valid; null otherwise.
+    std::optional<StressSceneType> StressSceneGenerator::TypeFromName(const std::string_view name)
+    {
+        for (std::size_t type_index = 0; type_index < static_cast<std::size_t>(StressSceneType::COUNT); ++type_index)
+        {
+            StressSceneType type = static_cast<StressSceneType>(type_index);
+            if (TypeName(type) == name)
+            {
+                return type;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// Generates a stress scene.
+    /// @param[in]  parameters - The parameters of the scene.
+    /// @return The scene along with a camera for viewing it.
+    SceneDescription StressSceneGenerator::Generate(const StressSceneParameters& parameters)
+    {
+        SceneDescription scene_description;
+        scene_description.Scene.BackgroundColor = Color(0.1f, 0.1f, 0.2f, 1.0f);
+
+        // ADD THE OBJECTS FOR THE TYPE OF SCENE.
+        std::mt19937 random_number_generator(parameters.Seed);
+        switch (parameters.Type)
+        {
+            case StressSceneType::SMALL_TRIANGLES:
+                AddSmallTriangles(parameters, random_number_generator, scene_description);
+                break;
+            case StressSceneType::OVERDRAW:
+                AddOverdraw(parameters, random_number_generator, scene_description);
+                break;
+            case StressSceneType::INSTANCING:
+                AddInstancing(parameters, random_number_generator, scene_description);
+                break;
+            case StressSceneType::MANY_LIGHTS:
+                AddManyLights(parameters, random_number_generator, scene_description);
+                break;
+            case StressSceneType::REFLECTIONS:
+                AddReflections(parameters, random_number_generator, scene_description);
+                break;
+            default:
+                break;
+        }
+
+        // ADD THE LIGHTS.
+        AddLights(parameters.LightCount, random_number_generator, scene_description);
+
+        // SET UP THE CAMERA PROJECTION.
+        // This is done last since scene types position the camera by replacing it.
+        scene_description.Camera.Projection = ProjectionType::PERSPECTIVE;
+        scene_description.Camera.FieldOfView = MATH::Angle<float>::Degrees(60.0f);
+        scene_description.Camera.NearClipPlaneViewDistance = 1.0f;
+        scene_description.Camera.FarClipPlaneViewDistance = 1000.0f;
+        return scene_description;
+    }
+
+    /// Creates a sphere (with a radius of 1) tessellated into rings of latitude and segments of longitude.
+    /// There are twice as many segments as rings so that triangles are roughly evenly shaped,
+    /// resulting in 4 * ring_count * (ring_count - 1) triangles.
+    /// @param[in]  material - The material of the sphere.
+    /// @param[in]  ring_count - The number of rings from the top to the bottom of the sphere (at least 2).
+    /// @return The sphere, with triangles facing outward.
+    Object3D StressSceneGenerator::CreateSphere(const std::shared_ptr<Material>& material, const unsigned int ring_count)
+    {
+        // DEFINE HOW TO GET VERTICES ON THE SPHERE.
+        unsigned int valid_ring_count = std::max(2u, ring_count);
+        unsigned int segment_count = 2 * valid_ring_count;
+        auto vertex_at = [valid_ring_count, segment_count](const unsigned int ring_index, const unsigned int segment_index)
+        {
+            float polar_angle_in_radians = std::numbers::pi_v<float> * static_cast<float>(ring_index) / static_cast<float>(valid_ring_count);
+            float azimuth_angle_in_radians = 2.0f * std::numbers::pi_v<float> * static_cast<float>(segment_index) / static_cast<float>(segment_count);
+            return MATH::Vector3f(
+                std::sin(polar_angle_in_radians) * std::cos(azimuth_angle_in_radians),
+                std::cos(polar_angle_in_radians),
+                std::sin(polar_angle_in_radians) * std::sin(azimuth_angle_in_radians));
+        };
+
+        // CREATE TRIANGLES FOR EACH QUAD BETWEEN RINGS AND SEGMENTS.
+        // Quads touching the poles only have a single non-degenerate triangle.
+        Object3D sphere;
+        sphere.Triangles.reserve(4 * static_cast<std::size_t>(valid_ring_count) * (valid_ring_count - 1));
+        for (unsigned int ring_index = 0; ring_index < valid_ring_count; ++ring_index)
+        {
+            bool is_top_ring = (0 == ring_index);
+            bool is_bottom_ring = (valid_ring_count - 1 == ring_index);
+            for (unsigned int segment_index = 0; segment_index < segment_count; ++segment_index)
+            {
+                MATH::Vector3f top_left = vertex_at(ring_index, segment_index);
+                MATH::Vector3f bottom_left = vertex_at(ring_index + 1, segment_index);
+                MATH::Vector3f bottom_right = vertex_at(ring_index + 1, segment_index + 1);
+                MATH::Vector3f top_right = vertex_at(ring_index, segment_index + 1);
+                if (!is_bottom_ring)
+                {
+                    sphere.Triangles.push_back(Triangle(material, { top_left, bottom_right, bottom_left }));
+                }
+                if (!is_top_ring)
+                {
+                    sphere.Triangles.push_back(Triangle(material, { top_left, top_right, bottom_right }));
+                }
+            }
+        }
+        return sphere;
+    }
+
+    /// Adds many small spheres scattered through a volume, so that most triangles cover
+    /// only a few pixels.  Spheres are each limited to about a thousand triangles so that
+    /// the scene consists of many objects, like production scenes.
+    /// @param[in]  parameters - The parameters of the scene.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @param[in,out]  scene_description - The scene to add to.
+    void StressSceneGenerator::AddSmallTriangles(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description)
+    {
+        scene_description.Camera = Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 3.0f, 10.0f));
+
+        // DETERMINE HOW MANY SPHERES ARE NEEDED.
+        constexpr std::size_t MAX_TRIANGLES_PER_SPHERE = 1000;
+        unsigned int ring_count = SphereRingCountForTriangleCount(std::min(parameters.TriangleCount, MAX_TRIANGLES_PER_SPHERE));
+        std::size_t triangles_per_sphere = 4 * static_cast<std::size_t>(ring_count) * (ring_count - 1);
+        std::size_t sphere_count = std::max<std::size_t>(1, (parameters.TriangleCount + triangles_per_sphere / 2) / triangles_per_sphere);
+
+        // SCATTER THE SPHERES.
+        // A few materials are shared, like in typical scenes.
+        constexpr std::size_t MATERIAL_COUNT = 8;
+        std::array<std::shared_ptr<Material>, MATERIAL_COUNT> materials;
+        for (std::shared_ptr<Material>& material : materials)
+        {
+            material = CreateMaterial(RandomColor(random_number_generator), 0.0f);
+        }
+        scene_description.Scene.Objects.reserve(sphere_count);
+        for (std::size_t sphere_index = 0; sphere_index < sphere_count; ++sphere_index)
+        {
+            Object3D& sphere = scene_description.Scene.Objects.emplace_back(CreateSphere(materials[sphere_index % MATERIAL_COUNT], ring_count));
+            sphere.WorldPosition = RandomPosition(random_number_generator, MATH::Vector3f(-5.0f, -2.5f, -5.0f), MATH::Vector3f(5.0f, 2.5f, 5.0f));
+            float radius = RandomFloat(random_number_generator, 0.15f, 0.4f);
+            sphere.Scale = MATH::Vector3f(radius, radius, radius);
+        }
+    }
+
+    /// Adds large quads facing the camera, ordered from back to front so that every layer
+    /// passes depth testing (the worst case for overdraw).  Each layer covers most of the view.
+    /// @param[in]  parameters - The parameters of the scene.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @param[in,out]  scene_description - The scene to add to.
+    void StressSceneGenerator::AddOverdraw(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description)
+    {
+        scene_description.Camera = Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 10.0f));
+
+        constexpr std::size_t TRIANGLES_PER_LAYER = 2;
+        std::size_t layer_count = std::max<std::size_t>(1, parameters.TriangleCount / TRIANGLES_PER_LAYER);
+        constexpr float BACK_LAYER_Z = -10.0f;
+        constexpr float FRONT_LAYER_Z = 4.0f;
+        scene_description.Scene.Objects.reserve(layer_count);
+        for (std::size_t layer_index = 0; layer_index < layer_count; ++layer_index)
+        {
+            // POSITION THE LAYER.
+            float layer_proportion_toward_front = (layer_count > 1) ? static_cast<float>(layer_index) / static_cast<float>(layer_count - 1) : 1.0f;
+            float z = BACK_LAYER_Z + layer_proportion_toward_front * (FRONT_LAYER_Z - BACK_LAYER_Z);
+            float center_x = RandomFloat(random_number_generator, -1.0f, 1.0f);
+            float center_y = RandomFloat(random_number_generator, -1.0f, 1.0f);
+            float half_width = RandomFloat(random_number_generator, 6.0f, 9.0f);
+            float half_height = RandomFloat(random_number_generator, 4.5f, 7.0f);
+
+            // CREATE THE QUAD.
+            // Vertices are counter-clockwise when viewed from the camera.
+            std::shared_ptr<Material> material = CreateMaterial(RandomColor(random_number_generator), 0.0f);
+            MATH::Vector3f bottom_left(center_x - half_width, center_y - half_height, z);
+            MATH::Vector3f bottom_right(center_x + half_width, center_y - half_height, z);
+            MATH::Vector3f top_right(center_x + half_width, center_y + half_height, z);
+            MATH::Vector3f top_left(center_x - half_width, center_y + half_height, z);
+            Object3D& layer = scene_description.Scene.Objects.emplace_back();
+            layer.Triangles.push_back(Triangle(material, { bottom_left, bottom_right, top_right }));
+            layer.Triangles.push_back(Triangle(material, { bottom_left, top_right, top_left }));
+        }
+    }
+
+    /// Adds clusters of many small cubes.  Each cluster shares a transform node and material,
+    /// so this stresses per-object overhead (like transforms) rather than per-triangle work.
+    /// @param[in]  parameters - The parameters of the scene.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @param[in,out]  scene_description - The scene to add to.
+    void StressSceneGenerator::AddInstancing(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description)
+    {
+        scene_description.Camera = Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 4.0f, 10.0f));
+
+        // DETERMINE HOW MANY INSTANCES AND CLUSTERS ARE NEEDED.
+        constexpr std::size_t TRIANGLES_PER_CUBE = 12;
+        std::size_t instance_count = std::max<std::size_t>(1, parameters.TriangleCount / TRIANGLES_PER_CUBE);
+        std::size_t cluster_count = std::max<std::size_t>(1, static_cast<std::size_t>(std::sqrt(static_cast<double>(instance_count))));
+
+        // CREATE THE CLUSTERS.
+        std::vector<std::shared_ptr<TransformNode>> cluster_nodes;
+        std::vector<Object3D> cluster_cubes;
+        for (std::size_t cluster_index = 0; cluster_index < cluster_count; ++cluster_index)
+        {
+            auto cluster_node = std::make_shared<TransformNode>();
+            cluster_node->SetLocalPosition(RandomPosition(random_number_generator, MATH::Vector3f(-5.0f, -1.5f, -5.0f), MATH::Vector3f(5.0f, 1.5f, 5.0f)));
+            cluster_node->SetLocalRotationInRadians(RandomRotation(random_number_generator));
+            cluster_nodes.push_back(cluster_node);
+
+            Object3D& cube = cluster_cubes.emplace_back(Cube::Create(CreateMaterial(RandomColor(random_number_generator), 0.0f)));
+            cube.Parent = cluster_node;
+        }
+
+        // CREATE THE INSTANCES.
+        scene_description.Scene.Objects.reserve(instance_count);
+        for (std::size_t instance_index = 0; instance_index < instance_count; ++instance_index)
+        {
+            Object3D& instance = scene_description.Scene.Objects.emplace_back(cluster_cubes[instance_index % cluster_count]);
+            instance.WorldPosition = RandomPosition(random_number_generator, MATH::Vector3f(-0.7f, -0.7f, -0.7f), MATH::Vector3f(0.7f, 0.7f, 0.7f));
+            instance.RotationInRadians = RandomRotation(random_number_generator);
+            float size = RandomFloat(random_number_generator, 0.05f, 0.12f);
+            instance.Scale = MATH::Vector3f(size, size, size);
+        }
+    }
+
+    /// Adds a tessellated floor with spheres on it, which is intended to be lit by many lights.
+    /// Half of the triangles are in the floor, since lighting is computed per vertex when rasterizing.
+    /// @param[in]  parameters - The parameters of the scene.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @param[in,out]  scene_description - The scene to add to.
+    void StressSceneGenerator::AddManyLights(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description)
+    {
+        scene_description.Camera = Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 5.0f, 10.0f));
+
+        // ADD THE FLOOR.
+        constexpr float FLOOR_SIZE = 12.0f;
+        std::size_t floor_triangle_count = parameters.TriangleCount / 2;
+        unsigned int floor_quads_per_side = std::max(1u, static_cast<unsigned int>(std::sqrt(static_cast<double>(floor_triangle_count / 2))));
+        scene_description.Scene.Objects.push_back(CreateGrid(CreateMaterial(Color(0.8f, 0.8f, 0.8f, 1.0f), 0.0f), FLOOR_SIZE, floor_quads_per_side));
+
+        // ADD SPHERES ON THE FLOOR.
+        constexpr std::size_t SPHERE_COUNT = 8;
+        unsigned int ring_count = SphereRingCountForTriangleCount((parameters.TriangleCount - floor_triangle_count) / SPHERE_COUNT);
+        for (std::size_t sphere_index = 0; sphere_index < SPHERE_COUNT; ++sphere_index)
+        {
+            Object3D& sphere = scene_description.Scene.Objects.emplace_back(CreateSphere(CreateMaterial(RandomColor(random_number_generator), 0.0f), ring_count));
+            // Spheres rest on the floor.
+            float radius = RandomFloat(random_number_generator, 0.4f, 1.0f);
+            sphere.WorldPosition = RandomPosition(random_number_generator, MATH::Vector3f(-4.0f, radius, -4.0f), MATH::Vector3f(4.0f, radius, 4.0f));
+            sphere.Scale = MATH::Vector3f(radius, radius, radius);
+        }
+    }
+
+    /// Adds reflective spheres on a reflective floor in front of a mirror,
+    /// so that most rays reflect several times when ray tracing.
+    /// @param[in]  parameters - The parameters of the scene.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @param[in,out]  scene_description - The scene to add to.
+    void StressSceneGenerator::AddReflections(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description)
+    {
+        scene_description.Camera = Camera::LookAtFrom(MATH::Vector3f(0.0f, 1.0f, 0.0f), MATH::Vector3f(0.0f, 2.5f, 8.0f));
+
+        // ADD THE FLOOR AND MIRROR.
+        constexpr float FLOOR_SIZE = 12.0f;
+        constexpr unsigned int FLOOR_QUADS_PER_SIDE = 8;
+        scene_description.Scene.Objects.push_back(CreateGrid(CreateMaterial(Color(0.5f, 0.5f, 0.5f, 1.0f), 0.5f), FLOOR_SIZE, FLOOR_QUADS_PER_SIDE));
+
+        constexpr float HALF_FLOOR_SIZE = FLOOR_SIZE / 2.0f;
+        constexpr float MIRROR_HEIGHT = 5.0f;
+        std::shared_ptr<Material> mirror_material = CreateMaterial(Color(0.2f, 0.2f, 0.2f, 1.0f), 0.9f);
+        MATH::Vector3f mirror_bottom_left(-HALF_FLOOR_SIZE, 0.0f, -HALF_FLOOR_SIZE);
+        MATH::Vector3f mirror_bottom_right(HALF_FLOOR_SIZE, 0.0f, -HALF_FLOOR_SIZE);
+        MATH::Vector3f mirror_top_right(HALF_FLOOR_SIZE, MIRROR_HEIGHT, -HALF_FLOOR_SIZE);
+        MATH::Vector3f mirror_top_left(-HALF_FLOOR_SIZE, MIRROR_HEIGHT, -HALF_FLOOR_SIZE);
+        Object3D& mirror = scene_description.Scene.Objects.emplace_back();
+        mirror.Triangles.push_back(Triangle(mirror_material, { mirror_bottom_left, mirror_bottom_right, mirror_top_right }));
+        mirror.Triangles.push_back(Triangle(mirror_material, { mirror_bottom_left, mirror_top_right, mirror_top_left }));
+
+        // ADD REFLECTIVE SPHERES ON THE FLOOR.
+        constexpr std::size_t SPHERE_COUNT = 12;
+        unsigned int ring_count = SphereRingCountForTriangleCount(parameters.TriangleCount / SPHERE_COUNT);
+        for (std::size_t sphere_index = 0; sphere_index < SPHERE_COUNT; ++sphere_index)
+        {
+            float reflectivity_proportion = RandomFloat(random_number_generator, 0.3f, 0.9f);
+            Object3D& sphere = scene_description.Scene.Objects.emplace_back(CreateSphere(CreateMaterial(RandomColor(random_number_generator), reflectivity_proportion), ring_count));
+            // Spheres rest on the floor in front of the mirror.
+            float radius = RandomFloat(random_number_generator, 0.4f, 1.0f);
+            sphere.WorldPosition = RandomPosition(random_number_generator, MATH::Vector3f(-4.0f, radius, -4.0f), MATH::Vector3f(4.0f, radius, 3.0f));
+            sphere.Scale = MATH::Vector3f(radius, radius, radius);
+        }
+    }
+
+    /// Adds a dim ambient light and point lights scattered above the scene.
+    /// Point lights are dimmer when there are more of them so that scenes aren't oversaturated.
+    /// @param[in]  point_light_count - The number of point lights to add.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @param[in,out]  scene_description - The scene to add to.
+    void StressSceneGenerator::AddLights(const std::size_t point_light_count, std::mt19937& random_number_generator, SceneDescription& scene_description)
+    {
+        std::vector<Light> lights;
+        lights.reserve(1 + point_light_count);
+
+        Light& ambient_light = lights.emplace_back();
+        ambient_light.Type = LightType::AMBIENT;
+        ambient_light.Color = Color(0.1f, 0.1f, 0.1f, 1.0f);
+
+        float point_light_intensity = std::min(1.0f, 2.0f / static_cast<float>(std::max<std::size_t>(1, point_light_count)));
+        for (std::size_t light_index = 0; light_index < point_light_count; ++light_index)
+        {
+            Light& point_light = lights.emplace_back();
+            point_light.Type = LightType::POINT;
+            point_light.Color = Color::ScaleRedGreenBlue(point_light_intensity, RandomColor(random_number_generator));
+            point_light.PointLightWorldPosition = RandomPosition(random_number_generator, MATH::Vector3f(-6.0f, 3.0f, -6.0f), MATH::Vector3f(6.0f, 7.0f, 6.0f));
+        }
+
+        scene_description.Scene.PointLights = lights;
+    }
+
+    /// Creates a square grid of quads in the XZ plane, centered at the origin and facing up.
+    /// @param[in]  material - The material of the grid.
+    /// @param[in]  size - The length of each side of the grid.
+    /// @param[in]  quads_per_side - The number of quads along each side of the grid.
+    /// @return The grid.
+    Object3D StressSceneGenerator::CreateGrid(
+        const std::shared_ptr<Material>& material,
+        const float size,
+        const unsigned int quads_per_side)
+    {
+        float half_size = size / 2.0f;
+        float quad_size = size / static_cast<float>(quads_per_side);
+        auto vertex_at = [half_size, quad_size](const unsigned int x_index, const unsigned int z_index)
+        {
+            return MATH::Vector3f(
+                static_cast<float>(x_index) * quad_size - half_size,
+                0.0f,
+                static_cast<float>(z_index) * quad_size - half_size);
+        };
+
+        Object3D grid;
+        grid.Triangles.reserve(2 * static_cast<std::size_t>(quads_per_side) * quads_per_side);
+        for (unsigned int z_index = 0; z_index < quads_per_side; ++z_index)
+        {
+            for (unsigned int x_index = 0; x_index < quads_per_side; ++x_index)
+            {
+                MATH::Vector3f back_left = vertex_at(x_index, z_index);
+                MATH::Vector3f back_right = vertex_at(x_index + 1, z_index);
+                MATH::Vector3f front_left = vertex_at(x_index, z_index + 1);
+                MATH::Vector3f front_right = vertex_at(x_index + 1, z_index + 1);
+                grid.Triangles.push_back(Triangle(material, { back_left, front_left, front_right }));
+                grid.Triangles.push_back(Triangle(material, { back_left, front_right, back_right }));
+            }
+        }
+        return grid;
+    }
+
+    /// Gets the number of rings for a sphere from CreateSphere() to have about a number of triangles.
+    /// @param[in]  triangle_count - The desired number of triangles.
+    /// @return The number of rings (at least 2).
+    unsigned int StressSceneGenerator::SphereRingCountForTriangleCount(const std::size_t triangle_count)
+    {
+        // Solving 4 * ring_count * (ring_count - 1) = triangle_count for the ring count.
+        double ring_count = (1.0 + std::sqrt(1.0 + static_cast<double>(triangle_count))) / 2.0;
+        return std::max(2u, static_cast<unsigned int>(std::lround(ring_count)));
+    }
+
+    /// Creates a material for stress scenes.
+    /// @param[in]  diffuse_color - The diffuse color of the material.
+    /// @param[in]  reflectivity_proportion - How reflective the material is, from [0, 1].
+    /// @return The material.
+    std::shared_ptr<Material> StressSceneGenerator::CreateMaterial(const Color& diffuse_color, const float reflectivity_proportion)
+    {
+        auto material = std::make_shared<Material>();
+        material->Shading = ShadingType::MATERIAL;
+        material->VertexColors = { diffuse_color, diffuse_color, diffuse_color };
+        material->AmbientColor = diffuse_color;
+        material->DiffuseColor = diffuse_color;
+        material->SpecularColor = Color(0.5f, 0.5f, 0.5f, 1.0f);
+        material->SpecularPower = 20.0f;
+        material->ReflectivityProportion = reflectivity_proportion;
+        return material;
+    }
+
+    /// Gets a random floating-point number in a range.
+    /// This only uses raw generator output so that results are identical on all platforms.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @param[in]  minimum - The minimum number (inclusive).
+    /// @param[in]  maximum - The maximum number (exclusive).
+    /// @return The random number.
+    float StressSceneGenerator::RandomFloat(std::mt19937& random_number_generator, const float minimum, const float maximum)
+    {
+        // The top 24 bits are used since that's the precision of a float.
+        constexpr float FLOAT_SIGNIFICAND_RANGE = 16777216.0f;
+        float proportion = static_cast<float>(random_number_generator() >> 8) / FLOAT_SIGNIFICAND_RANGE;
+        return minimum + proportion * (maximum - minimum);
+    }
+
+    /// Gets a random position within a box.
+    /// Components are generated in order (rather than as arguments to a single call,
+    /// whose evaluation order is unspecified) to keep positions identical across compilers.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @param[in]  minimum_corner - The corner of the box with the smallest coordinates.
+    /// @param[in]  maximum_corner - The corner of the box with the largest coordinates.
+    /// @return The random position.
+    MATH::Vector3f StressSceneGenerator::RandomPosition(
+        std::mt19937& random_number_generator,
+        const MATH::Vector3f& minimum_corner,
+        const MATH::Vector3f& maximum_corner)
+    {
+        float x = RandomFloat(random_number_generator, minimum_corner.X, maximum_corner.X);
+        float y = RandomFloat(random_number_generator, minimum_corner.Y, maximum_corner.Y);
+        float z = RandomFloat(random_number_generator, minimum_corner.Z, maximum_corner.Z);
+        return MATH::Vector3f(x, y, z);
+    }
+
+    /// Gets a random opaque color that isn't too dark.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @return The random color.
+    Color StressSceneGenerator::RandomColor(std::mt19937& random_number_generator)
+    {
+        float red = RandomFloat(random_number_generator, 0.2f, 1.0f);
+        float green = RandomFloat(random_number_generator, 0.2f, 1.0f);
+        float blue = RandomFloat(random_number_generator, 0.2f, 1.0f);
+        return Color(red, green, blue, 1.0f);
+    }
+
+    /// Gets a random rotation around all axes.
+    /// @param[in,out]  random_number_generator - The source of random choices.
+    /// @return The random rotation.
+    MATH::Vector3< MATH::Angle<float>::Radians > StressSceneGenerator::RandomRotation(std::mt19937& random_number_generator)
+    {
+        constexpr float FULL_ROTATION_IN_RADIANS = 2.0f * std::numbers::pi_v<float>;
+        float x_rotation = RandomFloat(random_number_generator, 0.0f, FULL_ROTATION_IN_RADIANS);
+        float y_rotation = RandomFloat(random_number_generator, 0.0f, FULL_ROTATION_IN_RADIANS);
+        float z_rotation = RandomFloat(random_number_generator, 0.0f, FULL_ROTATION_IN_RADIANS);
+        return MATH::Vector3< MATH::Angle<float>::Radians >(
+            MATH::Angle<float>::Radians(x_rotation),
+            MATH::Angle<float>::Radians(y_rotation),
+            MATH::Angle<float>::Radians(z_rotation));
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string_view>
+#include "Graphics/Color.h"
+#include "Graphics/Material.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/SceneDescription.h"
+
+namespace GRAPHICS
+{
+    /// The kinds of stress scenes that can be generated, each stressing a different part of rendering.
+    enum class StressSceneType
+    {
+        /// Many finely tessellated spheres, for millions of triangles covering few pixels each.
+        SMALL_TRIANGLES = 0,
+        /// Large quads stacked in front of each other from back to front, so every layer is drawn over the last.
+        OVERDRAW,
+        /// Clusters of many copies of a small mesh, each attached to a shared transform node.
+        INSTANCING,
+        /// A tessellated floor and spheres lit by many point lights.
+        MANY_LIGHTS,
+        /// Reflective spheres on a reflective floor in front of a mirror.
+        REFLECTIONS,
+        /// An extra enum to indicate the number of different stress scene types.
+        COUNT
+    };
+
+    /// Parameters controlling the content and scale of a generated stress scene.
+    struct StressSceneParameters
+    {
+        // CONSTRUCTION.
+        static StressSceneParameters Default(const StressSceneType type);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The kind of scene to generate.
+        StressSceneType Type = StressSceneType::SMALL_TRIANGLES;
+        /// The seed for all random choices.  The same parameters always generate the same scene.
+        uint32_t Seed = 1;
+        /// The approximate number of triangles in the scene.  Meshes are tessellated
+        /// in whole rings or quads, so the actual count may differ slightly.
+        std::size_t TriangleCount = 100000;
+        /// The number of point lights in the scene (in addition to a dim ambient light).
+        std::size_t LightCount = 1;
+    };
+
+    /// Procedurally generates scenes for testing how rendering scales with scene size,
+    /// without needing to store large assets.
+    ///
+    /// Generation is deterministic: random choices only use raw Mersenne Twister output
+    /// (since standard library distributions vary between implementations), so the same
+    /// parameters generate the same scene on all platforms.
+    ///
+    /// All scenes are centered around the origin and include a perspective camera
+    /// looking at them.  Materials use material shading so that lights affect them
+    /// with both renderers.  Point light colors are scaled down as the number of
+    /// lights increases, since lighting isn't attenuated by distance.
+    class StressSceneGenerator
+    {
+    public:
+        // NAMES.
+        static std::string_view TypeName(const StressSceneType type);
+        static std::optional<StressSceneType> TypeFromName(const std::string_view name);
+
+        // GENERATION.
+        static SceneDescription Generate(const StressSceneParameters& parameters);
+        static Object3D CreateSphere(const std::shared_ptr<Material>& material, const unsigned int ring_count);
+
+    private:
+        // SCENE TYPE GENERATION.
+        static void AddSmallTriangles(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description);
+        static void AddOverdraw(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description);
+        static void AddInstancing(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description);
+        static void AddManyLights(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description);
+        static void AddReflections(const StressSceneParameters& parameters, std::mt19937& random_number_generator, SceneDescription& scene_description);
+
+        // HELPER METHODS.
+        static void AddLights(const std::size_t point_light_count, std::mt19937& random_number_generator, SceneDescription& scene_description);
+        static Object3D CreateGrid(
+            const std::shared_ptr<Material>& material,
+            const float size,
+            const unsigned int quads_per_side);
+        static unsigned int SphereRingCountForTriangleCount(const std::size_t triangle_count);
+        static std::shared_ptr<Material> CreateMaterial(const Color& diffuse_color, const float reflectivity_proportion);
+        static float RandomFloat(std::mt19937& random_number_generator, const float minimum, const float maximum);
+        static MATH::Vector3f RandomPosition(
+            std::mt19937& random_number_generator,
+            const MATH::Vector3f& minimum_corner,
+            const MATH::Vector3f& maximum_corner);
+        static Color RandomColor(std::mt19937& random_number_generator);
+        static MATH::Vector3< MATH::Angle<float>::Radians > RandomRotation(std::mt19937& random_number_generator);
+    };
+}
@@ -0,0 +1,218 @@
+#include "Graphics/TextureCache.h"
+
+namespace GRAPHICS
+{
+    /// Constructor.
+    /// @param[in]  memory_budget_in_bytes - The maximum desired memory for pixels of resident textures.
+    TextureCache::TextureCache(const std::size_t memory_budget_in_bytes) :
+        MemoryBudgetInBytes(memory_budget_in_bytes)
+    {}
+
+    /// Gets a texture, loading it only if it's not already resident.
+    /// @param[in]  filepath - The path of the texture file.
+    /// @param[in]  color_format - The color format for the texture's pixels.
+    /// @return The texture, if successfully loaded; null otherwise.
+    std::shared_ptr<Bitmap> TextureCache::Get(const std::filesystem::path& filepath, const GRAPHICS::ColorFormat color_format)
+    {
+        Key key = CreateKey(filepath, color_format);
+
+        // RETURN THE TEXTURE IF IT'S ALREADY RESIDENT.
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            auto entry = Entries.find(key);
+            bool texture_resident = (Entries.end() != entry);
+            if (texture_resident)
+            {
+                ++HitCount;
+                LeastRecentlyUsedKeys.splice(LeastRecentlyUsedKeys.begin(), LeastRecentlyUsedKeys, entry->second.LeastRecentlyUsedPosition);
+                return entry->second.Texture;
+            }
+
+            ++MissCount;
+        }
+
+        // LOAD THE TEXTURE.
+        // The lock isn't held while loading to allow other textures to be loaded in parallel.
+        std::shared_ptr<Bitmap> texture = Bitmap::Load(key.Filepath, color_format);
+        if (!texture)
+        {
+            return nullptr;
+        }
+
+        // ADD THE TEXTURE TO THE CACHE.
+        // Another thread may have loaded the same texture in the meantime,
+        // in which case that texture is used to avoid having it resident twice.
+        std::lock_guard<std::mutex> lock(Mutex);
+        auto entry = Entries.find(key);
+        bool texture_resident = (Entries.end() != entry);
+        if (texture_resident)
+        {
+            return entry->second.Texture;
+        }
+
+        Insert(key, texture);
+        EvictToBudget(MemoryBudgetInBytes);
+        return texture;
+    }
+
+    /// Reloads a texture from its file, such as after the file has been modified.
+    /// If the texture is already resident, the reloaded texture replaces it in the cache
+    /// so that later requests get the reloaded texture.  Existing users keep the previous
+    /// texture unchanged (so rendering on other threads is unaffected) until they get the
+    /// texture again, and the previous texture no longer counts against the memory budget.
+    /// @param[in]  filepath - The path of the texture file.
+    /// @param[in]  color_format - The color format for the texture's pixels.
+    /// @return The texture, if successfully reloaded; null otherwise (leaving any resident texture unchanged).
+    std::shared_ptr<Bitmap> TextureCache::Reload(const std::filesystem::path& filepath, const GRAPHICS::ColorFormat color_format)
+    {
+        // LOAD THE TEXTURE.
+        Key key = CreateKey(filepath, color_format);
+        std::shared_ptr<Bitmap> reloaded_texture = Bitmap::Load(key.Filepath, color_format);
+        if (!reloaded_texture)
+        {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(Mutex);
+
+        // ADD THE TEXTURE IF IT ISN'T ALREADY RESIDENT.
+        auto entry = Entries.find(key);
+        bool texture_resident = (Entries.end() != entry);
+        if (!texture_resident)
+        {
+            Insert(key, reloaded_texture);
+            EvictToBudget(MemoryBudgetInBytes);
+            return reloaded_texture;
+        }
+
+        // REPLACE THE RESIDENT TEXTURE.
+        Entry& resident_entry = entry->second;
+        resident_entry.Texture = reloaded_texture;
+        std::size_t reloaded_size_in_bytes = SizeInBytes(*reloaded_texture);
+        ResidentSizeInBytes = ResidentSizeInBytes - resident_entry.SizeInBytes + reloaded_size_in_bytes;
+        resident_entry.SizeInBytes = reloaded_size_in_bytes;
+        LeastRecentlyUsedKeys.splice(LeastRecentlyUsedKeys.begin(), LeastRecentlyUsedKeys, resident_entry.LeastRecentlyUsedPosition);
+
+        EvictToBudget(MemoryBudgetInBytes);
+        return reloaded_texture;
+    }
+
+    /// Changes the memory budget, immediately evicting textures if needed.
+    /// @param[in]  memory_budget_in_bytes - The maximum desired memory for pixels of resident textures.
+    void TextureCache::SetMemoryBudget(const std::size_t memory_budget_in_bytes)
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        MemoryBudgetInBytes = memory_budget_in_bytes;
+        EvictToBudget(MemoryBudgetInBytes);
+    }
+
+    /// Evicts textures no longer referenced outside of the cache until within the memory budget.
+    /// This already happens whenever textures are loaded, but textures in use at that time
+    /// may have since been released.
+    void TextureCache::EnforceMemoryBudget()
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        EvictToBudget(MemoryBudgetInBytes);
+    }
+
+    /// Evicts all textures no longer referenced outside of the cache, regardless of the memory budget.
+    void TextureCache::EvictUnreferenced()
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        EvictToBudget(0);
+    }
+
+    /// Gets statistics about the cache.
+    /// @return The current statistics.
+    TextureCache::Statistics TextureCache::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        return Statistics
+        {
+            .HitCount = HitCount,
+            .MissCount = MissCount,
+            .EvictionCount = EvictionCount,
+            .ResidentTextureCount = Entries.size(),
+            .ResidentSizeInBytes = ResidentSizeInBytes,
+            .MemoryBudgetInBytes = MemoryBudgetInBytes
+        };
+    }
+
+    /// Hashes a key.
+    /// @param[in]  key - The key to hash.
+    /// @return The hash of the key.
+    std::size_t TextureCache::KeyHash::operator()(const Key& key) const
+    {
+        // The color format is mixed into the low bits that are most likely used for hash table buckets.
+        std::size_t filepath_hash = std::filesystem::hash_value(key.Filepath);
+        std::size_t hash = (filepath_hash * 31) ^ static_cast<std::size_t>(key.ColorFormat);
+        return hash;
+    }
+
+    /// Creates a key for a texture.
+    /// @param[in]  filepath - The path of the texture file.
+    /// @param[in]  color_format - The color format for the texture's pixels.
+    /// @return The key for the texture.
+    TextureCache::Key TextureCache::CreateKey(const std::filesystem::path& filepath, const GRAPHICS::ColorFormat color_format)
+    {
+        // The filepath is normalized so that different ways of referring to the same file share a texture.
+        return Key
+        {
+            .Filepath = std::filesystem::absolute(filepath).lexically_normal(),
+            .ColorFormat = color_format
+        };
+    }
+
+    /// Computes the memory used by a texture's pixels.
+    /// @param[in]  texture - The texture.
+    /// @return The size of the texture's pixels in bytes.
+    std::size_t TextureCache::SizeInBytes(const Bitmap& texture)
+    {
+        std::size_t pixel_count = static_cast<std::size_t>(texture.GetWidthInPixels()) * texture.GetHeightInPixels();
+        return pixel_count * sizeof(uint32_t);
+    }
+
+    /// Adds a texture that isn't yet resident as the most recently used texture.
+    /// The mutex must already be locked.
+    /// @param[in]  key - The key for the texture.
+    /// @param[in]  texture - The texture to add.
+    void TextureCache::Insert(const Key& key, const std::shared_ptr<Bitmap>& texture)
+    {
+        LeastRecentlyUsedKeys.push_front(key);
+        std::size_t size_in_bytes = SizeInBytes(*texture);
+        Entries.emplace(key, Entry
+        {
+            .Texture = texture,
+            .SizeInBytes = size_in_bytes,
+            .LeastRecentlyUsedPosition = LeastRecentlyUsedKeys.begin()
+        });
+        ResidentSizeInBytes += size_in_bytes;
+    }
+
+    /// Evicts the least recently used unreferenced textures until resident textures fit within a budget
+    /// (or no more textures can be evicted).  The mutex must already be locked.
+    /// @param[in]  memory_budget_in_bytes - The budget to fit within.
+    void TextureCache::EvictToBudget(const std::size_t memory_budget_in_bytes)
+    {
+        auto key = LeastRecentlyUsedKeys.end();
+        while (ResidentSizeInBytes > memory_budget_in_bytes && LeastRecentlyUsedKeys.begin() != key)
+        {
+            --key;
+
+            // SKIP TEXTURES STILL IN USE.
+            // The cache itself holds one reference, so any others mean the texture is in use.
+            auto entry = Entries.find(*key);
+            bool texture_in_use = (entry->second.Texture.use_count() > 1);
+            if (texture_in_use)
+            {
+                continue;
+            }
+
+            // EVICT THE TEXTURE.
+            ResidentSizeInBytes -= entry->second.SizeInBytes;
+            Entries.erase(entry);
+            key = LeastRecentlyUsedKeys.erase(key);
+            ++EvictionCount;
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "Graphics/Bitmap.h"
+#include "Graphics/ColorFormat.h"
+
+namespace GRAPHICS
+{
+    /// A cache of textures loaded from files, ensuring each texture (in a given color format)
+    /// is only resident in memory once no matter how many materials use it.
+    ///
+    /// Total texture memory is kept within a budget by evicting the least recently used
+    /// textures that are no longer referenced outside of the cache.  Textures still in use
+    /// are never evicted, so the budget may be temporarily exceeded if all resident textures
+    /// are in use.
+    ///
+    /// All methods are safe to call from multiple threads.
+    class TextureCache
+    {
+    public:
+        /// Statistics about how well the cache is working.
+        struct Statistics
+        {
+            /// The number of requests for textures already resident in the cache.
+            uint64_t HitCount = 0;
+            /// The number of requests for textures that had to be loaded.
+            uint64_t MissCount = 0;
+            /// The number of textures evicted to stay within the memory budget.
+            uint64_t EvictionCount = 0;
+            /// The number of textures currently resident in the cache.
+            std::size_t ResidentTextureCount = 0;
+            /// The memory used by pixels of textures currently resident in the cache.
+            std::size_t ResidentSizeInBytes = 0;
+            /// The maximum desired memory for pixels of resident textures.
+            std::size_t MemoryBudgetInBytes = 0;
+        };
+
+        // CONSTRUCTION.
+        explicit TextureCache(const std::size_t memory_budget_in_bytes = std::numeric_limits<std::size_t>::max());
+
+        // TEXTURE ACCESS.
+        std::shared_ptr<Bitmap> Get(
+            const std::filesystem::path& filepath,
+            const GRAPHICS::ColorFormat color_format = GRAPHICS::ColorFormat::RGBA);
+        std::shared_ptr<Bitmap> Reload(
+            const std::filesystem::path& filepath,
+            const GRAPHICS::ColorFormat color_format = GRAPHICS::ColorFormat::RGBA);
+
+        // MEMORY MANAGEMENT.
+        void SetMemoryBudget(const std::size_t memory_budget_in_bytes);
+        void EnforceMemoryBudget();
+        void EvictUnreferenced();
+
+        // STATISTICS.
+        Statistics GetStatistics() const;
+
+    private:
+        /// Identifies a texture in a specific color format.
+        struct Key
+        {
+            /// The normalized path of the texture file.
+            std::filesystem::path Filepath = "";
+            /// The color format of the texture's pixels.
+            GRAPHICS::ColorFormat ColorFormat = GRAPHICS::ColorFormat::RGBA;
+
+            bool operator==(const Key& rhs) const = default;
+        };
+
+        /// Hashes keys to allow them to be used in hash tables.
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const;
+        };
+
+        /// A texture resident in the cache.
+        struct Entry
+        {
+            /// The texture.
+            std::shared_ptr<Bitmap> Texture = nullptr;
+            /// The memory used by the texture's pixels.
+            std::size_t SizeInBytes = 0;
+            /// The position of the texture's key in the least recently used list.
+            std::list<Key>::iterator LeastRecentlyUsedPosition = {};
+        };
+
+        // HELPER METHODS.
+        static Key CreateKey(const std::filesystem::path& filepath, const GRAPHICS::ColorFormat color_format);
+        static std::size_t SizeInBytes(const Bitmap& texture);
+        void Insert(const Key& key, const std::shared_ptr<Bitmap>& texture);
+        void EvictToBudget(const std::size_t memory_budget_in_bytes);
+
+        // MEMBER VARIABLES.
+        /// Protects access to all other member variables.
+        mutable std::mutex Mutex = {};
+        /// The maximum desired memory for pixels of resident textures.
+        std::size_t MemoryBudgetInBytes = 0;
+        /// The memory used by pixels of resident textures.
+        std::size_t ResidentSizeInBytes = 0;
+        /// Resident textures by key.
+        std::unordered_map<Key, Entry, KeyHash> Entries = {};
+        /// Keys of resident textures, from most recently used (front) to least recently used (back).
+        std::list<Key> LeastRecentlyUsedKeys = {};
+        /// The number of requests for resident textures.
+        uint64_t HitCount = 0;
+        /// The number of requests for textures that weren't resident.
+        uint64_t MissCount = 0;
+        /// The number of textures evicted.
+        uint64_t EvictionCount = 0;
+    };
+}
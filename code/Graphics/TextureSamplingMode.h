@@ -0,0 +1,15 @@
+#pragma once
+
+namespace GRAPHICS
+{
+    /// The different ways textures can be sampled when rasterizing.
+    enum class TextureSamplingMode
+    {
+        /// No texture is sampled.
+        NONE = 0,
+        /// The texel nearest to the (clamped) texture coordinates is sampled.
+        NEAREST,
+        /// An extra enum to indicate the number of different texture sampling modes.
+        COUNT
+    };
+}
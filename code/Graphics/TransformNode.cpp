@@ -0,0 +1,250 @@
+#include "Graphics/TransformNode.h"
+
+namespace GRAPHICS
+{
+    /// Destructor.  Detaches the node from its parent and children.
+    /// Former children keep their local transforms, which become relative to the world.
+    TransformNode::~TransformNode()
+    {
+        // DETACH FROM THE PARENT.
+        if (Parent)
+        {
+            std::erase(Parent->Children, this);
+        }
+
+        // DETACH ALL CHILDREN.
+        for (TransformNode* child : Children)
+        {
+            child->Parent = nullptr;
+            child->InvalidateWorldTransform();
+        }
+    }
+
+    /// Attaches this node to a new parent, detaching it from any previous parent.
+    /// @param[in]  parent - The new parent node.  Null to detach this node from any parent.
+    ///     The parent must outlive this node or be changed before being destroyed.
+    /// @return True if the parent was set; false if doing so would create a cycle in the hierarchy.
+    bool TransformNode::SetParent(TransformNode* const parent)
+    {
+        // CHECK IF THE PARENT IS ALREADY SET.
+        bool parent_unchanged = (Parent == parent);
+        if (parent_unchanged)
+        {
+            return true;
+        }
+
+        // PREVENT CYCLES IN THE HIERARCHY.
+        for (const TransformNode* ancestor = parent; ancestor; ancestor = ancestor->Parent)
+        {
+            bool ancestor_is_this_node = (this == ancestor);
+            if (ancestor_is_this_node)
+            {
+                return false;
+            }
+        }
+
+        // DETACH FROM THE OLD PARENT.
+        if (Parent)
+        {
+            std::erase(Parent->Children, this);
+        }
+
+        // ATTACH TO THE NEW PARENT.
+        Parent = parent;
+        if (Parent)
+        {
+            Parent->Children.push_back(this);
+        }
+
+        InvalidateWorldTransform();
+        return true;
+    }
+
+    /// Gets the parent node.
+    /// @return The parent node, if any; null otherwise.
+    TransformNode* TransformNode::GetParent() const
+    {
+        return Parent;
+    }
+
+    /// Gets the child nodes.
+    /// @return The child nodes.
+    const std::vector<TransformNode*>& TransformNode::GetChildren() const
+    {
+        return Children;
+    }
+
+    /// Gets the position relative to the parent.
+    /// @return The local position.
+    const MATH::Vector3f& TransformNode::GetLocalPosition() const
+    {
+        return LocalPosition;
+    }
+
+    /// Sets the position relative to the parent.
+    /// @param[in]  local_position - The new local position.
+    void TransformNode::SetLocalPosition(const MATH::Vector3f& local_position)
+    {
+        // Unchanged values are ignored to avoid needlessly invalidating descendants.
+        if (LocalPosition == local_position)
+        {
+            return;
+        }
+
+        LocalPosition = local_position;
+        InvalidateLocalTransform();
+    }
+
+    /// Gets the rotation relative to the parent.
+    /// @return The local rotation along the 3 primary axes, in radians per axis.
+    const MATH::Vector3< MATH::Angle<float>::Radians >& TransformNode::GetLocalRotationInRadians() const
+    {
+        return LocalRotationInRadians;
+    }
+
+    /// Sets the rotation relative to the parent.
+    /// @param[in]  local_rotation_in_radians - The new local rotation along the 3 primary axes.
+    void TransformNode::SetLocalRotationInRadians(const MATH::Vector3< MATH::Angle<float>::Radians >& local_rotation_in_radians)
+    {
+        // Unchanged values are ignored to avoid needlessly invalidating descendants.
+        if (LocalRotationInRadians == local_rotation_in_radians)
+        {
+            return;
+        }
+
+        LocalRotationInRadians = local_rotation_in_radians;
+        InvalidateLocalTransform();
+    }
+
+    /// Gets the scaling relative to the parent.
+    /// @return The local scale.
+    const MATH::Vector3f& TransformNode::GetLocalScale() const
+    {
+        return LocalScale;
+    }
+
+    /// Sets the scaling relative to the parent.
+    /// @param[in]  local_scale - The new local scale.
+    void TransformNode::SetLocalScale(const MATH::Vector3f& local_scale)
+    {
+        // Unchanged values are ignored to avoid needlessly invalidating descendants.
+        if (LocalScale == local_scale)
+        {
+            return;
+        }
+
+        LocalScale = local_scale;
+        InvalidateLocalTransform();
+    }
+
+    /// Gets the transform from this node's local space to its parent's space.
+    /// @return The local transform.
+    const MATH::Matrix4x4f& TransformNode::LocalTransform() const
+    {
+        // RECOMPUTE THE LOCAL TRANSFORM IF IT'S OUT OF DATE.
+        if (LocalTransformDirty)
+        {
+            MATH::Matrix4x4f translation_matrix = MATH::Matrix4x4f::Translation(LocalPosition);
+            MATH::Matrix4x4f rotation_matrix = MATH::Matrix4x4f::Rotation(LocalRotationInRadians);
+            MATH::Matrix4x4f scale_matrix = MATH::Matrix4x4f::Scale(LocalScale);
+            CachedLocalTransform = translation_matrix * rotation_matrix * scale_matrix;
+            LocalTransformDirty = false;
+        }
+
+        return CachedLocalTransform;
+    }
+
+    /// Gets the transform from this node's local space to world space.
+    /// @return The world transform.
+    const MATH::Matrix4x4f& TransformNode::WorldTransform() const
+    {
+        // RECOMPUTE THE WORLD TRANSFORM IF IT'S OUT OF DATE.
+        // Any out-of-date ancestors are recomputed as part of this.
+        if (WorldTransformDirty)
+        {
+            if (Parent)
+            {
+                CachedWorldTransform = Parent->WorldTransform() * LocalTransform();
+            }
+            else
+            {
+                CachedWorldTransform = LocalTransform();
+            }
+            WorldTransformDirty = false;
+        }
+
+        return CachedWorldTransform;
+    }
+
+    /// Gets a version number for the world transform that changes each time the
+    /// world transform becomes out of date.  Caches derived from the world transform
+    /// can store this version and compare it later to detect if they need updating.
+    /// @return The current version of the world transform.
+    uint64_t TransformNode::WorldTransformVersion() const
+    {
+        return CurrentWorldTransformVersion;
+    }
+
+    /// Subscribes a callback to be notified when this node's world transform becomes
+    /// out of date (due to changes to this node or any of its ancestors).  To avoid
+    /// redundant notifications, callbacks aren't called again until the world transform
+    /// has been retrieved via WorldTransform().
+    /// @param[in]  callback - The callback to call when the world transform changes.
+    /// @return An identifier for unsubscribing the callback.
+    TransformNode::SubscriptionId TransformNode::SubscribeToWorldTransformChanges(const ChangeCallback& callback)
+    {
+        SubscriptionId subscription_id = NextSubscriptionId;
+        ++NextSubscriptionId;
+        ChangeCallbacks.emplace_back(subscription_id, callback);
+        return subscription_id;
+    }
+
+    /// Unsubscribes a callback from change notifications.
+    /// @param[in]  subscription_id - The identifier returned when subscribing the callback.
+    void TransformNode::UnsubscribeFromWorldTransformChanges(const SubscriptionId subscription_id)
+    {
+        std::erase_if(
+            ChangeCallbacks,
+            [subscription_id](const std::pair<SubscriptionId, ChangeCallback>& subscription)
+            {
+                return subscription.first == subscription_id;
+            });
+    }
+
+    /// Marks the local transform (and therefore the world transforms of this node
+    /// and all descendants) as out of date.
+    void TransformNode::InvalidateLocalTransform()
+    {
+        LocalTransformDirty = true;
+        InvalidateWorldTransform();
+    }
+
+    /// Marks the world transforms of this node and all descendants as out of date.
+    void TransformNode::InvalidateWorldTransform()
+    {
+        ++CurrentWorldTransformVersion;
+
+        // STOP IF THE SUBTREE IS ALREADY OUT OF DATE.
+        // Descendants of an out-of-date node are always out of date too,
+        // so they have already been invalidated and notified.
+        if (WorldTransformDirty)
+        {
+            return;
+        }
+        WorldTransformDirty = true;
+
+        // NOTIFY ANY SUBSCRIBERS.
+        // Callbacks must not subscribe or unsubscribe while being notified.
+        for (const auto& subscription : ChangeCallbacks)
+        {
+            const ChangeCallback& callback = subscription.second;
+            callback(*this);
+        }
+
+        // INVALIDATE ALL DESCENDANTS.
+        for (TransformNode* child : Children)
+        {
+            child->InvalidateWorldTransform();
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "Math/Angle.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+    /// A node in a hierarchy of transforms (a scene graph).  Each node has a local
+    /// position, rotation, and scale relative to its parent, and its world transform
+    /// combines its local transform with those of all of its ancestors.
+    ///
+    /// Both local and world transforms are cached and only recomputed after changes.
+    /// Changing a node marks the world transforms of it and its descendants as out of date,
+    /// but nothing is recomputed until a world transform is requested, and subtrees
+    /// that are already out of date aren't revisited.  This means large hierarchies of
+    /// mostly static nodes pay almost nothing per frame for unchanged transforms.
+    ///
+    /// Nodes refer to their parents and children by pointer, so they can't be copied or moved.
+    /// A node that is destroyed is automatically detached from its parent and children.
+    /// Nodes aren't thread-safe, since world transforms are lazily computed.
+    class TransformNode
+    {
+    public:
+        // TYPES.
+        /// A function called when a node's world transform becomes out of date.
+        using ChangeCallback = std::function<void(const TransformNode& changed_node)>;
+        /// An identifier for a change callback, used to unsubscribe it.
+        using SubscriptionId = std::size_t;
+
+        // CONSTRUCTION/DESTRUCTION.
+        explicit TransformNode() = default;
+        ~TransformNode();
+        TransformNode(const TransformNode&) = delete;
+        TransformNode& operator=(const TransformNode&) = delete;
+
+        // HIERARCHY.
+        bool SetParent(TransformNode* const parent);
+        TransformNode* GetParent() const;
+        const std::vector<TransformNode*>& GetChildren() const;
+
+        // LOCAL TRANSFORM.
+        const MATH::Vector3f& GetLocalPosition() const;
+        void SetLocalPosition(const MATH::Vector3f& local_position);
+        const MATH::Vector3< MATH::Angle<float>::Radians >& GetLocalRotationInRadians() const;
+        void SetLocalRotationInRadians(const MATH::Vector3< MATH::Angle<float>::Radians >& local_rotation_in_radians);
+        const MATH::Vector3f& GetLocalScale() const;
+        void SetLocalScale(const MATH::Vector3f& local_scale);
+        const MATH::Matrix4x4f& LocalTransform() const;
+
+        // WORLD TRANSFORM.
+        const MATH::Matrix4x4f& WorldTransform() const;
+        uint64_t WorldTransformVersion() const;
+
+        // CHANGE NOTIFICATIONS.
+        SubscriptionId SubscribeToWorldTransformChanges(const ChangeCallback& callback);
+        void UnsubscribeFromWorldTransformChanges(const SubscriptionId subscription_id);
+
+    private:
+        // HELPER METHODS.
+        void InvalidateLocalTransform();
+        void InvalidateWorldTransform();
+
+        // HIERARCHY MEMBER VARIABLES.
+        /// The parent node, if any.  Not owned by this node.
+        TransformNode* Parent = nullptr;
+        /// The child nodes.  Not owned by this node.
+        std::vector<TransformNode*> Children = {};
+
+        // LOCAL TRANSFORM MEMBER VARIABLES.
+        /// The position relative to the parent.
+        MATH::Vector3f LocalPosition = MATH::Vector3f();
+        /// The rotation relative to the parent along the 3 primary axes, expressed in radians per axis.
+        MATH::Vector3< MATH::Angle<float>::Radians > LocalRotationInRadians = MATH::Vector3< MATH::Angle<float>::Radians >();
+        /// The scaling relative to the parent.  Defaults to no scaling.
+        MATH::Vector3f LocalScale = MATH::Vector3f(1.0f, 1.0f, 1.0f);
+
+        // CACHE MEMBER VARIABLES.
+        /// The cached local transform, valid only if not dirty.
+        mutable MATH::Matrix4x4f CachedLocalTransform = MATH::Matrix4x4f::Identity();
+        /// True if the cached local transform needs to be recomputed.
+        mutable bool LocalTransformDirty = false;
+        /// The cached world transform, valid only if not dirty.
+        mutable MATH::Matrix4x4f CachedWorldTransform = MATH::Matrix4x4f::Identity();
+        /// True if the cached world transform needs to be recomputed.
+        /// If a node's world transform is dirty, so are those of all of its descendants.
+        mutable bool WorldTransformDirty = false;
+        /// Incremented each time the world transform becomes out of date, allowing
+        /// external caches to detect changes without subscribing to notifications.
+        uint64_t CurrentWorldTransformVersion = 0;
+
+        // NOTIFICATION MEMBER VARIABLES.
+        /// The identifier to use for the next subscribed callback.
+        SubscriptionId NextSubscriptionId = 0;
+        /// Callbacks to call when the world transform becomes out of date, along with their identifiers.
+        std::vector<std::pair<SubscriptionId, ChangeCallback>> ChangeCallbacks = {};
+    };
+}
@@ -20,9 +20,9 @@ namespace GRAPHICS
         static constexpr std::size_t VERTEX_COUNT = 3;
 
         // CONSTRUCTION.
-        static Triangle CreateEquilateral(const std::shared_ptr<Material>& material);
+        static Triangle CreateEquilateral(const std::shared_ptr<GRAPHICS::Material>& material);
         explicit Triangle() = default;
-        explicit Triangle(const std::shared_ptr<Material>& material, const std::array<MATH::Vector3f, VERTEX_COUNT>& vertices);
+        explicit Triangle(const std::shared_ptr<GRAPHICS::Material>& material, const std::array<MATH::Vector3f, VERTEX_COUNT>& vertices);
 
         // OTHER METHODS.
         MATH::Vector3f SurfaceNormal() const;
@@ -30,7 +30,7 @@ namespace GRAPHICS
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The material of the triangle.
-        std::shared_ptr<Material> Material = nullptr;
+        std::shared_ptr<GRAPHICS::Material> Material = nullptr;
         /// The vertices of the triangle.
         /// Should be in counter-clockwise order.
         std::array<MATH::Vector3f, VERTEX_COUNT> Vertices = {};
@@ -44,12 +44,9 @@ namespace GRAPHICS
     {
         // CREATE THE INITIAL SCREEN SPACE TRIANGLE.
         // Vertex colors will be populated later.
-        ScreenSpaceTriangle screen_space_triangle =
-        {
-            .Material = world_triangle.Material,
-            .VertexPositions = world_triangle.Vertices,
-            .VertexColors = {}
-        };
+        ScreenSpaceTriangle screen_space_triangle;
+        screen_space_triangle.Material = world_triangle.Material;
+        screen_space_triangle.VertexPositions = world_triangle.Vertices;
 
         // TRANSFORM EACH VERTEX.
         std::size_t triangle_vertex_count = world_triangle.Vertices.size();
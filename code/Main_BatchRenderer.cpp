@@ -0,0 +1,708 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Benchmarking/AllocationTracker.h"
+#include "Benchmarking/Profiler.h"
+#include "Graphics/Bitmap.h"
+#include "Graphics/DepthBuffer.h"
+#include "Graphics/FragmentCounters.h"
+#include "Graphics/FrameStreaming/FrameSink.h"
+#include "Graphics/FrameStreaming/PpmFrameEncoder.h"
+#include "Graphics/FrameStreaming/RawRgbaFrameEncoder.h"
+#include "Graphics/FrameStreaming/Y4mFrameEncoder.h"
+#include "Graphics/Heatmap.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/SceneDescription.h"
+#include "Graphics/SoftwareRasterizationAlgorithm.h"
+#include "Graphics/StressSceneGenerator.h"
+#include "Math/Angle.h"
+
+#if _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+/// The algorithms that can be used for rendering.
+enum class RendererType
+{
+    /// The software rasterizer.
+    RASTERIZER,
+    /// The software ray tracer.
+    RAY_TRACER
+};
+
+/// The formats frames can be streamed in.
+enum class StreamFormat
+{
+    /// Raw RGBA bytes without any headers.
+    RAW_RGBA,
+    /// A sequence of binary PPM images.
+    PPM,
+    /// A YUV4MPEG2 video stream.
+    Y4M
+};
+
+/// Options for batch rendering, as specified on the command line.
+struct BatchRenderingOptions
+{
+    /// The path of the scene description file to render, if not generating a stress scene.
+    std::filesystem::path SceneFilepath = "";
+    /// The type of stress scene to generate instead of loading a scene file, if any.
+    std::optional<GRAPHICS::StressSceneType> GeneratedStressScene = std::nullopt;
+    /// The seed for generating any stress scene.
+    uint32_t StressSceneSeed = 1;
+    /// The approximate number of triangles in any stress scene, if not the default for its type.
+    std::optional<std::size_t> StressSceneTriangleCount = std::nullopt;
+    /// The number of point lights in any stress scene, if not the default for its type.
+    std::optional<std::size_t> StressSceneLightCount = std::nullopt;
+    /// The folder to cache model geometry in for faster loading, if any.
+    std::filesystem::path MeshCacheFolderPath = "";
+    /// The folder to write rendered images and timing to.
+    std::filesystem::path OutputFolderPath = "output";
+    /// The algorithm to render with.
+    RendererType Renderer = RendererType::RASTERIZER;
+    /// The width of rendered images in pixels.
+    unsigned int WidthInPixels = 640;
+    /// The height of rendered images in pixels.
+    unsigned int HeightInPixels = 480;
+    /// The number of frames to render.
+    unsigned int FrameCount = 1;
+    /// The rotation of all objects around the Y axis per frame, to allow rendering simple animations.
+    float RotationInDegreesPerFrame = 0.0f;
+    /// True if backfaces should be culled when rasterizing; false otherwise.
+    bool CullBackfaces = false;
+    /// True if rendered images should be written; false to only measure timing.
+    bool WriteImages = true;
+    /// True if per-pixel rendering costs should be measured, for finding where rendering work is wasted.
+    /// This slows down rendering, so timing is less representative.
+    bool MeasurePixelCosts = false;
+    /// The format to stream frames in, if frames should be streamed.
+    std::optional<StreamFormat> FrameStreamFormat = std::nullopt;
+    /// The path to stream frames to, with "-" for standard output.
+    std::filesystem::path StreamOutputPath = "-";
+    /// The frame rate indicated in streams that support it.
+    unsigned int FramesPerSecond = 30;
+    /// True to drop frames if the stream consumer falls behind; false to wait for it.
+    bool DropLateFrames = false;
+    /// The path of any Chrome trace event JSON file to record loading and rendering to.
+    std::filesystem::path TraceFilepath = "";
+    /// The number of warm-up frames after which rendering any frame must not allocate heap memory, if required.
+    /// Allocations are counted across all threads, so other work (like streaming) may also be counted.
+    std::optional<unsigned int> AllocationFreeFramesAfterWarmUpFrameCount = std::nullopt;
+};
+
+/// Prints how to use the program.
+static void PrintUsage()
+{
+    std::cerr <<
+        "Usage: BatchRenderer <scene file> [options]\n"
+        "       BatchRenderer --stress-scene <type> [options]\n"
+        "Options:\n"
+        "  --stress-scene <type>                Generate a stress scene instead of loading a file (small_triangles,\n"
+        "                                       overdraw, instancing, many_lights, or reflections).\n"
+        "  --seed <number>                      Seed for generating the stress scene (default 1).\n"
+        "  --triangles <count>                  Approximate triangles in the stress scene (default depends on type).\n"
+        "  --lights <count>                     Point lights in the stress scene (default depends on type).\n"
+        "  --renderer <rasterizer|ray_tracer>   Rendering algorithm (default rasterizer).\n"
+        "  --width <pixels>                     Image width (default 640).\n"
+        "  --height <pixels>                    Image height (default 480).\n"
+        "  --frames <count>                     Number of frames to render (default 1).\n"
+        "  --rotate <degrees>                   Rotation of objects around the Y axis per frame (default 0).\n"
+        "  --output <folder>                    Folder for images and timings.csv (default output).\n"
+        "  --mesh-cache <folder>                Cache model geometry in binary mesh files for faster loading.\n"
+        "  --cull-backfaces                     Cull backfaces when rasterizing.\n"
+        "  --no-images                          Only measure timing without writing images.\n"
+        "  --heatmap                            Measure per-pixel costs (fragments or intersection tests) to\n"
+        "                                       pixel_costs.csv and heatmap images (slows rendering).\n"
+        "  --stream <raw|ppm|y4m>               Also stream frames in the given format.\n"
+        "  --stream-output <path>               Path to stream frames to; - for standard output (default -).\n"
+        "  --fps <count>                        Frame rate for y4m streams (default 30).\n"
+        "  --drop-late-frames                   Drop frames rather than waiting if the stream consumer falls behind.\n"
+        "  --trace <path>                       Record a Chrome trace of loading and rendering (requires PROFILING_ENABLED).\n"
+        "  --require-allocation-free-frames <warm-up frames>\n"
+        "                                       Fail if rendering any frame after the warm-up frames allocates heap\n"
+        "                                       memory (requires ALLOCATION_TRACKING_ENABLED).\n";
+}
+
+/// Parses a number from a command line argument.
+/// @tparam Number - The type of number to parse.
+/// @param[in]  argument - The argument to parse.
+/// @param[out]  number - The parsed number.
+/// @return True if the entire argument was a valid number; false otherwise.
+template <typename Number>
+static bool ParseNumber(const std::string_view argument, Number& number)
+{
+    const char* argument_end = argument.data() + argument.size();
+    std::from_chars_result result = std::from_chars(argument.data(), argument_end, number);
+    bool number_parsed = (std::errc() == result.ec) && (argument_end == result.ptr);
+    return number_parsed;
+}
+
+/// Parses command line arguments.
+/// @param[in]  arguments - The command line arguments, excluding the program name.
+/// @return The options, if all arguments were valid; null otherwise.
+static std::optional<BatchRenderingOptions> ParseOptions(const std::vector<std::string_view>& arguments)
+{
+    BatchRenderingOptions options;
+    for (std::size_t argument_index = 0; argument_index < arguments.size(); ++argument_index)
+    {
+        // HANDLE FLAGS WITHOUT VALUES.
+        std::string_view argument = arguments[argument_index];
+        if ("--cull-backfaces" == argument)
+        {
+            options.CullBackfaces = true;
+            continue;
+        }
+        else if ("--no-images" == argument)
+        {
+            options.WriteImages = false;
+            continue;
+        }
+        else if ("--drop-late-frames" == argument)
+        {
+            options.DropLateFrames = true;
+            continue;
+        }
+        else if ("--heatmap" == argument)
+        {
+            options.MeasurePixelCosts = true;
+            continue;
+        }
+
+        // HANDLE THE SCENE FILEPATH.
+        bool is_option = argument.starts_with("--");
+        if (!is_option)
+        {
+            bool scene_filepath_already_specified = !options.SceneFilepath.empty();
+            if (scene_filepath_already_specified)
+            {
+                return std::nullopt;
+            }
+
+            options.SceneFilepath = argument;
+            continue;
+        }
+
+        // HANDLE OPTIONS WITH VALUES.
+        ++argument_index;
+        bool value_exists = (argument_index < arguments.size());
+        if (!value_exists)
+        {
+            return std::nullopt;
+        }
+        std::string_view value = arguments[argument_index];
+        bool option_valid = false;
+        if ("--renderer" == argument)
+        {
+            if ("rasterizer" == value)
+            {
+                options.Renderer = RendererType::RASTERIZER;
+                option_valid = true;
+            }
+            else if ("ray_tracer" == value)
+            {
+                options.Renderer = RendererType::RAY_TRACER;
+                option_valid = true;
+            }
+        }
+        else if ("--width" == argument)
+        {
+            option_valid = ParseNumber(value, options.WidthInPixels) && (options.WidthInPixels > 0);
+        }
+        else if ("--height" == argument)
+        {
+            option_valid = ParseNumber(value, options.HeightInPixels) && (options.HeightInPixels > 0);
+        }
+        else if ("--frames" == argument)
+        {
+            option_valid = ParseNumber(value, options.FrameCount);
+        }
+        else if ("--rotate" == argument)
+        {
+            option_valid = ParseNumber(value, options.RotationInDegreesPerFrame);
+        }
+        else if ("--output" == argument)
+        {
+            options.OutputFolderPath = value;
+            option_valid = true;
+        }
+        else if ("--mesh-cache" == argument)
+        {
+            options.MeshCacheFolderPath = value;
+            option_valid = true;
+        }
+        else if ("--stream" == argument)
+        {
+            if ("raw" == value)
+            {
+                options.FrameStreamFormat = StreamFormat::RAW_RGBA;
+                option_valid = true;
+            }
+            else if ("ppm" == value)
+            {
+                options.FrameStreamFormat = StreamFormat::PPM;
+                option_valid = true;
+            }
+            else if ("y4m" == value)
+            {
+                options.FrameStreamFormat = StreamFormat::Y4M;
+                option_valid = true;
+            }
+        }
+        else if ("--stream-output" == argument)
+        {
+            options.StreamOutputPath = value;
+            option_valid = true;
+        }
+        else if ("--fps" == argument)
+        {
+            option_valid = ParseNumber(value, options.FramesPerSecond) && (options.FramesPerSecond > 0);
+        }
+        else if ("--trace" == argument)
+        {
+            options.TraceFilepath = value;
+            option_valid = true;
+        }
+        else if ("--stress-scene" == argument)
+        {
+            options.GeneratedStressScene = GRAPHICS::StressSceneGenerator::TypeFromName(value);
+            option_valid = options.GeneratedStressScene.has_value();
+        }
+        else if ("--seed" == argument)
+        {
+            option_valid = ParseNumber(value, options.StressSceneSeed);
+        }
+        else if ("--triangles" == argument)
+        {
+            std::size_t triangle_count = 0;
+            option_valid = ParseNumber(value, triangle_count) && (triangle_count > 0);
+            options.StressSceneTriangleCount = triangle_count;
+        }
+        else if ("--lights" == argument)
+        {
+            std::size_t light_count = 0;
+            option_valid = ParseNumber(value, light_count);
+            options.StressSceneLightCount = light_count;
+        }
+        else if ("--require-allocation-free-frames" == argument)
+        {
+            unsigned int warm_up_frame_count = 0;
+            option_valid = ParseNumber(value, warm_up_frame_count);
+            options.AllocationFreeFramesAfterWarmUpFrameCount = warm_up_frame_count;
+        }
+
+        if (!option_valid)
+        {
+            return std::nullopt;
+        }
+    }
+
+    // Exactly one scene must be specified.
+    bool scene_filepath_specified = !options.SceneFilepath.empty();
+    bool stress_scene_specified = options.GeneratedStressScene.has_value();
+    if (scene_filepath_specified == stress_scene_specified)
+    {
+        return std::nullopt;
+    }
+
+    return options;
+}
+
+/// Renders a scene without any window, writing images and timing to files.
+/// This allows rendering on machines without displays (like build servers),
+/// for offline rendering or benchmarking.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments, starting with the program name.
+/// @return EXIT_SUCCESS if all frames were rendered; EXIT_FAILURE otherwise.
+int main(int argument_count, char* arguments[])
+{
+    // PARSE THE COMMAND LINE.
+    std::vector<std::string_view> command_line_arguments(arguments + std::min(argument_count, 1), arguments + argument_count);
+    std::optional<BatchRenderingOptions> options = ParseOptions(command_line_arguments);
+    if (!options)
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    // MAKE SURE ALLOCATIONS CAN BE CHECKED IF REQUIRED.
+    // Silently passing without checking would hide allocations.
+    bool allocation_free_frames_required = options->AllocationFreeFramesAfterWarmUpFrameCount.has_value();
+    if (allocation_free_frames_required && !BENCHMARKING::AllocationTracker::IsEnabled())
+    {
+        std::cerr << "Built without ALLOCATION_TRACKING_ENABLED, so allocation-free frames can't be verified\n";
+        return EXIT_FAILURE;
+    }
+
+    // DETERMINE WHERE TO REPORT PROGRESS.
+    // Standard output can't be used for progress if frames are streamed to it.
+    bool streaming_to_standard_output = options->FrameStreamFormat && ("-" == options->StreamOutputPath);
+    std::ostream& progress_output = streaming_to_standard_output ? std::cerr : std::cout;
+
+    // START RECORDING ANY TRACE.
+    // This is done before loading so that asset loading is included.
+    bool tracing = !options->TraceFilepath.empty();
+    if (tracing)
+    {
+#if !defined(PROFILING_ENABLED)
+        std::cerr << "Warning: Built without PROFILING_ENABLED, so the trace will be empty\n";
+#endif
+        BENCHMARKING::TraceRecorder::Shared().Start();
+    }
+
+    // LOAD OR GENERATE THE SCENE.
+    auto scene_load_start_time = std::chrono::steady_clock::now();
+    std::optional<GRAPHICS::SceneDescription> scene_description = std::nullopt;
+    if (options->GeneratedStressScene)
+    {
+        GRAPHICS::StressSceneParameters stress_scene_parameters = GRAPHICS::StressSceneParameters::Default(*options->GeneratedStressScene);
+        stress_scene_parameters.Seed = options->StressSceneSeed;
+        stress_scene_parameters.TriangleCount = options->StressSceneTriangleCount.value_or(stress_scene_parameters.TriangleCount);
+        stress_scene_parameters.LightCount = options->StressSceneLightCount.value_or(stress_scene_parameters.LightCount);
+        scene_description = GRAPHICS::StressSceneGenerator::Generate(stress_scene_parameters);
+    }
+    else
+    {
+        bool mesh_cache_write_failed = false;
+        scene_description = GRAPHICS::SceneDescription::Load(options->SceneFilepath, options->MeshCacheFolderPath, &mesh_cache_write_failed);
+        if (!scene_description)
+        {
+            std::cerr << "Failed to load scene: " << options->SceneFilepath.string() << "\n";
+            return EXIT_FAILURE;
+        }
+        if (mesh_cache_write_failed)
+        {
+            std::cerr << "Failed to write mesh cache to: " << options->MeshCacheFolderPath.string() << "\n";
+        }
+    }
+    std::chrono::duration<double, std::milli> scene_load_time = std::chrono::steady_clock::now() - scene_load_start_time;
+    std::size_t triangle_count = 0;
+    for (const GRAPHICS::Object3D& object_3D : scene_description->Scene.Objects)
+    {
+        triangle_count += object_3D.Triangles.size();
+    }
+    progress_output << (options->GeneratedStressScene ? "Generated " : "Loaded ") << scene_description->Scene.Objects.size() << " objects (" << triangle_count << " triangles) in " << scene_load_time.count() << " ms\n";
+
+    // PREPARE TO WRITE OUTPUT.
+    std::error_code output_folder_error;
+    std::filesystem::create_directories(options->OutputFolderPath, output_folder_error);
+    std::ofstream timing_file(options->OutputFolderPath / "timings.csv");
+    if (output_folder_error || !timing_file)
+    {
+        std::cerr << "Failed to create output in: " << options->OutputFolderPath.string() << "\n";
+        return EXIT_FAILURE;
+    }
+    timing_file << "frame,render_milliseconds";
+    if (BENCHMARKING::AllocationTracker::IsEnabled())
+    {
+        timing_file << ",allocations,allocated_bytes";
+    }
+    timing_file << "\n";
+
+    // PREPARE TO WRITE PER-PIXEL COSTS.
+    std::ofstream pixel_cost_file;
+    if (options->MeasurePixelCosts)
+    {
+        pixel_cost_file.open(options->OutputFolderPath / "pixel_costs.csv");
+        if (!pixel_cost_file)
+        {
+            std::cerr << "Failed to create output in: " << options->OutputFolderPath.string() << "\n";
+            return EXIT_FAILURE;
+        }
+
+        if (RendererType::RAY_TRACER == options->Renderer)
+        {
+            pixel_cost_file << "frame,rays,intersection_tests,max_intersection_tests_per_pixel\n";
+        }
+        else
+        {
+            pixel_cost_file << "frame,tested_fragments,depth_passed_fragments,shaded_fragments,max_tested_fragments_per_pixel\n";
+        }
+    }
+
+    // PREPARE TO STREAM FRAMES.
+    std::ofstream stream_file;
+    std::unique_ptr<GRAPHICS::FRAME_STREAMING::FrameSink> frame_sink;
+    if (options->FrameStreamFormat)
+    {
+        // OPEN THE STREAM.
+        std::ostream* frame_stream = &std::cout;
+        if (streaming_to_standard_output)
+        {
+#if _WIN32
+            // Standard output translates newlines by default, which would corrupt binary frames.
+            _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        }
+        else
+        {
+            stream_file.open(options->StreamOutputPath, std::ios::binary);
+            if (!stream_file)
+            {
+                std::cerr << "Failed to open stream output: " << options->StreamOutputPath.string() << "\n";
+                return EXIT_FAILURE;
+            }
+            frame_stream = &stream_file;
+        }
+
+        // CREATE THE ENCODER FOR THE STREAM FORMAT.
+        std::unique_ptr<GRAPHICS::FRAME_STREAMING::IFrameEncoder> frame_encoder;
+        switch (*options->FrameStreamFormat)
+        {
+            case StreamFormat::RAW_RGBA:
+                frame_encoder = std::make_unique<GRAPHICS::FRAME_STREAMING::RawRgbaFrameEncoder>();
+                break;
+            case StreamFormat::PPM:
+                frame_encoder = std::make_unique<GRAPHICS::FRAME_STREAMING::PpmFrameEncoder>();
+                break;
+            case StreamFormat::Y4M:
+                frame_encoder = std::make_unique<GRAPHICS::FRAME_STREAMING::Y4mFrameEncoder>(options->FramesPerSecond);
+                break;
+        }
+        frame_sink = std::make_unique<GRAPHICS::FRAME_STREAMING::FrameSink>(std::move(frame_encoder), *frame_stream);
+    }
+
+    // PREPARE THE RENDERER.
+    GRAPHICS::Bitmap render_target(options->WidthInPixels, options->HeightInPixels, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::DepthBuffer depth_buffer(options->WidthInPixels, options->HeightInPixels);
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.CountIntersectionTestsPerPixel = options->MeasurePixelCosts;
+    std::unique_ptr<GRAPHICS::FragmentCounters> fragment_counters;
+    if (options->MeasurePixelCosts)
+    {
+        fragment_counters = std::make_unique<GRAPHICS::FragmentCounters>(options->WidthInPixels, options->HeightInPixels);
+    }
+    GRAPHICS::Camera& camera = scene_description->Camera;
+    // The ray tracer maps pixels onto the viewing plane, so its width is adjusted to avoid stretching non-square images.
+    float aspect_ratio_width_over_height = static_cast<float>(options->WidthInPixels) / static_cast<float>(options->HeightInPixels);
+    camera.ViewingPlane.Width = camera.ViewingPlane.Height * aspect_ratio_width_over_height;
+
+    // RENDER ALL FRAMES.
+    std::vector<double> frame_render_times_in_milliseconds;
+    frame_render_times_in_milliseconds.reserve(options->FrameCount);
+    std::vector<GRAPHICS::Object3D>& objects = scene_description->Scene.Objects;
+    std::vector<float> initial_y_rotations_in_radians;
+    for (const GRAPHICS::Object3D& object_3D : objects)
+    {
+        initial_y_rotations_in_radians.push_back(object_3D.RotationInRadians.Y.Value);
+    }
+    unsigned int dropped_frame_count = 0;
+    BENCHMARKING::AllocationCounts total_frame_allocations;
+    unsigned int allocating_steady_state_frame_count = 0;
+    for (unsigned int frame_index = 0; frame_index < options->FrameCount; ++frame_index)
+    {
+        // ANIMATE THE OBJECTS.
+        MATH::Angle<float>::Radians frame_rotation = MATH::Angle<float>::DegreesToRadians(
+            MATH::Angle<float>::Degrees(options->RotationInDegreesPerFrame * static_cast<float>(frame_index)));
+        for (std::size_t object_index = 0; object_index < objects.size(); ++object_index)
+        {
+            objects[object_index].RotationInRadians.Y = MATH::Angle<float>::Radians(initial_y_rotations_in_radians[object_index] + frame_rotation.Value);
+        }
+
+        // RENDER THE FRAME.
+        BENCHMARKING::AllocationCounts frame_start_allocations = BENCHMARKING::AllocationTracker::GetProcessCounts();
+        auto frame_start_time = std::chrono::steady_clock::now();
+        if (RendererType::RAY_TRACER == options->Renderer)
+        {
+            ray_tracer.Render(scene_description->Scene, camera, render_target);
+        }
+        else
+        {
+            GRAPHICS::SoftwareRasterizationAlgorithm::Render(
+                scene_description->Scene,
+                camera,
+                options->CullBackfaces,
+                render_target,
+                &depth_buffer,
+                fragment_counters.get());
+        }
+        std::chrono::duration<double, std::milli> frame_render_time = std::chrono::steady_clock::now() - frame_start_time;
+        BENCHMARKING::AllocationCounts frame_allocations = BENCHMARKING::AllocationTracker::GetProcessCounts() - frame_start_allocations;
+        frame_render_times_in_milliseconds.push_back(frame_render_time.count());
+        timing_file << frame_index << "," << frame_render_time.count();
+        if (BENCHMARKING::AllocationTracker::IsEnabled())
+        {
+            timing_file << "," << frame_allocations.AllocationCount << "," << frame_allocations.AllocatedByteCount;
+        }
+        timing_file << "\n";
+        PROFILE_END_FRAME();
+
+        // CHECK FOR ALLOCATIONS IN STEADY-STATE FRAMES.
+        // All frames are still rendered so that every allocating frame is reported.
+        total_frame_allocations.AllocationCount += frame_allocations.AllocationCount;
+        total_frame_allocations.AllocatedByteCount += frame_allocations.AllocatedByteCount;
+        bool steady_state_frame = allocation_free_frames_required && (frame_index >= *options->AllocationFreeFramesAfterWarmUpFrameCount);
+        if (steady_state_frame && frame_allocations.AllocationCount > 0)
+        {
+            std::cerr << "Frame " << frame_index << " allocated " << frame_allocations.AllocationCount << " times (" << frame_allocations.AllocatedByteCount << " bytes)\n";
+            ++allocating_steady_state_frame_count;
+        }
+
+        // RECORD THE PER-PIXEL COSTS.
+        std::optional<GRAPHICS::Bitmap> heatmap = std::nullopt;
+        if (options->MeasurePixelCosts)
+        {
+            if (RendererType::RAY_TRACER == options->Renderer)
+            {
+                const CONTAINERS::Array2D<uint32_t>& intersection_test_counts = ray_tracer.LastRenderIntersectionTestCountsPerPixel;
+                const uint32_t* intersection_test_counts_begin = intersection_test_counts.ValuesInRowMajorOrder();
+                const uint32_t* intersection_test_counts_end = intersection_test_counts_begin + (static_cast<std::size_t>(intersection_test_counts.GetWidth()) * intersection_test_counts.GetHeight());
+                pixel_cost_file
+                    << frame_index << ","
+                    << ray_tracer.LastRenderRayCounts.Total() << ","
+                    << ray_tracer.LastRenderIntersectionTestCount << ","
+                    << *std::max_element(intersection_test_counts_begin, intersection_test_counts_end) << "\n";
+                heatmap = GRAPHICS::Heatmap::Create(intersection_test_counts);
+            }
+            else
+            {
+                // The number of fragments tested per pixel shows overdraw.
+                GRAPHICS::FragmentCounters::Totals fragment_totals = fragment_counters->GetTotals();
+                pixel_cost_file
+                    << frame_index << ","
+                    << fragment_totals.TestedFragmentCount << ","
+                    << fragment_totals.DepthPassedFragmentCount << ","
+                    << fragment_totals.ShadedFragmentCount << ","
+                    << fragment_totals.MaxTestedFragmentCountPerPixel << "\n";
+                heatmap = GRAPHICS::Heatmap::Create(fragment_counters->TestedFragmentCounts, fragment_totals.MaxTestedFragmentCountPerPixel);
+            }
+        }
+
+        // STREAM THE FRAME.
+        if (frame_sink)
+        {
+            bool wait_for_stream_consumer = !options->DropLateFrames;
+            GRAPHICS::FRAME_STREAMING::FrameSubmissionResult submission_result = frame_sink->Submit(render_target, wait_for_stream_consumer);
+            if (GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::FAILED == submission_result)
+            {
+                std::cerr << "Failed to stream frame " << frame_index << "\n";
+                return EXIT_FAILURE;
+            }
+            else if (GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::BACK_PRESSURE == submission_result)
+            {
+                ++dropped_frame_count;
+            }
+        }
+
+        // WRITE THE IMAGE.
+        if (options->WriteImages)
+        {
+            std::string frame_number = std::to_string(frame_index);
+            constexpr std::size_t FRAME_NUMBER_DIGIT_COUNT = 5;
+            frame_number.insert(0, FRAME_NUMBER_DIGIT_COUNT - std::min(frame_number.size(), FRAME_NUMBER_DIGIT_COUNT), '0');
+            std::filesystem::path image_filepath = options->OutputFolderPath / ("frame_" + frame_number + ".bmp");
+            bool image_written = render_target.Save(image_filepath);
+            if (!image_written)
+            {
+                std::cerr << "Failed to write image: " << image_filepath.string() << "\n";
+                return EXIT_FAILURE;
+            }
+
+            if (heatmap)
+            {
+                std::filesystem::path heatmap_filepath = options->OutputFolderPath / ("heatmap_" + frame_number + ".bmp");
+                bool heatmap_written = heatmap->Save(heatmap_filepath);
+                if (!heatmap_written)
+                {
+                    std::cerr << "Failed to write image: " << heatmap_filepath.string() << "\n";
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    // SUMMARIZE THE TIMING.
+    if (!frame_render_times_in_milliseconds.empty())
+    {
+        double total_render_time_in_milliseconds = 0.0;
+        for (double frame_render_time_in_milliseconds : frame_render_times_in_milliseconds)
+        {
+            total_render_time_in_milliseconds += frame_render_time_in_milliseconds;
+        }
+        double average_render_time_in_milliseconds = total_render_time_in_milliseconds / static_cast<double>(frame_render_times_in_milliseconds.size());
+        auto [min_render_time, max_render_time] = std::minmax_element(frame_render_times_in_milliseconds.cbegin(), frame_render_times_in_milliseconds.cend());
+        progress_output
+            << "Rendered " << frame_render_times_in_milliseconds.size() << " frames at "
+            << options->WidthInPixels << "x" << options->HeightInPixels << ": "
+            << "avg " << average_render_time_in_milliseconds << " ms, "
+            << "min " << *min_render_time << " ms, "
+            << "max " << *max_render_time << " ms, "
+            << (1000.0 / average_render_time_in_milliseconds) << " fps\n";
+        if (BENCHMARKING::AllocationTracker::IsEnabled())
+        {
+            double frame_count = static_cast<double>(frame_render_times_in_milliseconds.size());
+            progress_output
+                << "Allocated avg " << (static_cast<double>(total_frame_allocations.AllocationCount) / frame_count) << " times ("
+                << (static_cast<double>(total_frame_allocations.AllocatedByteCount) / frame_count) << " bytes) per frame\n";
+        }
+    }
+
+    // WRITE ANY TRACE.
+    if (tracing)
+    {
+        BENCHMARKING::TraceRecorder::Shared().Stop();
+        std::ofstream trace_file(options->TraceFilepath);
+        BENCHMARKING::TraceRecorder::Shared().WriteChromeTraceJson(trace_file);
+        if (!trace_file)
+        {
+            std::cerr << "Failed to write trace: " << options->TraceFilepath.string() << "\n";
+            return EXIT_FAILURE;
+        }
+        progress_output << "Wrote trace to " << options->TraceFilepath.string() << "\n";
+        std::size_t dropped_event_count = BENCHMARKING::TraceRecorder::Shared().GetDroppedEventCount();
+        if (dropped_event_count > 0)
+        {
+            std::cerr << "Warning: Dropped " << dropped_event_count << " trace events beyond the per-thread limit\n";
+        }
+    }
+
+#if defined(PROFILING_ENABLED)
+    // WRITE PER-STAGE PROFILING STATISTICS.
+    std::filesystem::path profile_filepath = options->OutputFolderPath / "profile.csv";
+    std::ofstream profile_file(profile_filepath);
+    BENCHMARKING::Profiler::Shared().WriteCsv(profile_file);
+    if (!profile_file)
+    {
+        std::cerr << "Failed to write profile: " << profile_filepath.string() << "\n";
+        return EXIT_FAILURE;
+    }
+    progress_output << "Wrote per-stage profile to " << profile_filepath.string() << "\n";
+#endif
+
+    // FINISH STREAMING.
+    if (frame_sink)
+    {
+        bool all_frames_streamed = frame_sink->Finish();
+        GRAPHICS::FRAME_STREAMING::FrameSink::Statistics stream_statistics = frame_sink->GetStatistics();
+        progress_output
+            << "Streamed " << stream_statistics.WrittenFrameCount << " frames ("
+            << stream_statistics.WrittenSizeInBytes << " bytes), "
+            << "back-pressure " << stream_statistics.BackPressureCount << " times ("
+            << stream_statistics.BackPressureWaitTimeInMilliseconds << " ms waiting), "
+            << dropped_frame_count << " frames dropped\n";
+        if (!all_frames_streamed)
+        {
+            std::cerr << "Failed to stream all frames\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // REPORT ANY STEADY-STATE FRAMES THAT ALLOCATED.
+    if (allocating_steady_state_frame_count > 0)
+    {
+        std::cerr << allocating_steady_state_frame_count << " frames allocated after " << *options->AllocationFreeFramesAfterWarmUpFrameCount << " warm-up frames\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,448 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Graphics/Bitmap.h"
+#include "Graphics/Camera.h"
+#include "Graphics/Cube.h"
+#include "Graphics/DepthBuffer.h"
+#include "Graphics/ImageComparison.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/Scene.h"
+#include "Graphics/SoftwareRasterizationAlgorithm.h"
+#include "Math/Angle.h"
+
+/// A scene in the catalog of scenes rendered for golden image tests, along with the camera to view it.
+struct GoldenImageScene
+{
+    /// The name of the scene, which identifies its reference images.
+    std::string Name = "";
+    /// The scene.
+    GRAPHICS::Scene Scene = {};
+    /// The camera to view the scene.
+    GRAPHICS::Camera Camera = {};
+};
+
+/// A way of rendering scenes that should be verified against reference images.
+struct RenderPath
+{
+    /// The name of the render path, which identifies its reference images.
+    std::string_view Name = "";
+    /// Renders a scene with a camera to a render target.
+    std::function<void(const GRAPHICS::Scene&, const GRAPHICS::Camera&, GRAPHICS::Bitmap&)> Render = {};
+};
+
+/// Options for golden image tests, as specified on the command line.
+struct GoldenImageTestOptions
+{
+    /// The folder containing reference images.
+    std::filesystem::path ReferenceFolderPath = "testing/GoldenImages";
+    /// The folder to write actual and difference images to for failed comparisons.
+    std::filesystem::path FailureOutputFolderPath = "golden_image_failures";
+    /// True if reference images should be replaced with newly rendered images; false to compare against them.
+    bool UpdateReferences = false;
+    /// Only images whose names contain this text are tested (all images if empty).
+    std::string NameFilter = "";
+    /// How much rendered images may differ from reference images.
+    GRAPHICS::ImageComparisonTolerance Tolerance = {};
+};
+
+/// The width of rendered images in pixels.  Images are kept small so that reference images are cheap to store.
+constexpr unsigned int IMAGE_WIDTH_IN_PIXELS = 64;
+/// The height of rendered images in pixels.
+constexpr unsigned int IMAGE_HEIGHT_IN_PIXELS = 48;
+
+/// Prints how to use the program.
+static void PrintUsage()
+{
+    std::cerr <<
+        "Usage: GoldenImageTests [options]\n"
+        "Renders a catalog of scenes through each render path and compares them against reference images.\n"
+        "Options:\n"
+        "  --references <folder>                Folder of reference images (default testing/GoldenImages).\n"
+        "  --output <folder>                    Folder for actual and difference images of failures (default golden_image_failures).\n"
+        "  --filter <text>                      Only test images whose names contain the text.\n"
+        "  --max-channel-difference <0-255>     Largest color component difference for a matching pixel (default 2).\n"
+        "  --max-mismatched-pixels <proportion> Proportion of pixels that may mismatch (default 0.002).\n"
+        "  --update                             Replace reference images with newly rendered images.\n";
+}
+
+/// Parses a number from a command line argument.
+/// @tparam Number - The type of number to parse.
+/// @param[in]  argument - The argument to parse.
+/// @param[out]  number - The parsed number.
+/// @return True if the entire argument was a valid number; false otherwise.
+template <typename Number>
+static bool ParseNumber(const std::string_view argument, Number& number)
+{
+    const char* argument_end = argument.data() + argument.size();
+    std::from_chars_result result = std::from_chars(argument.data(), argument_end, number);
+    bool number_parsed = (std::errc() == result.ec) && (argument_end == result.ptr);
+    return number_parsed;
+}
+
+/// Parses command line arguments.
+/// @param[in]  arguments - The command line arguments, excluding the program name.
+/// @return The options, if all arguments were valid; null otherwise.
+static std::optional<GoldenImageTestOptions> ParseOptions(const std::vector<std::string_view>& arguments)
+{
+    GoldenImageTestOptions options;
+    for (std::size_t argument_index = 0; argument_index < arguments.size(); ++argument_index)
+    {
+        // HANDLE FLAGS WITHOUT VALUES.
+        std::string_view argument = arguments[argument_index];
+        if ("--update" == argument)
+        {
+            options.UpdateReferences = true;
+            continue;
+        }
+
+        // HANDLE OPTIONS WITH VALUES.
+        ++argument_index;
+        bool value_exists = (argument_index < arguments.size());
+        if (!value_exists)
+        {
+            return std::nullopt;
+        }
+        std::string_view value = arguments[argument_index];
+        bool option_valid = false;
+        if ("--references" == argument)
+        {
+            options.ReferenceFolderPath = value;
+            option_valid = true;
+        }
+        else if ("--output" == argument)
+        {
+            options.FailureOutputFolderPath = value;
+            option_valid = true;
+        }
+        else if ("--filter" == argument)
+        {
+            options.NameFilter = value;
+            option_valid = true;
+        }
+        else if ("--max-channel-difference" == argument)
+        {
+            unsigned int max_channel_difference = 0;
+            constexpr unsigned int MAX_COLOR_COMPONENT = 255;
+            option_valid = ParseNumber(value, max_channel_difference) && (max_channel_difference <= MAX_COLOR_COMPONENT);
+            options.Tolerance.MaxChannelDifference = static_cast<uint8_t>(max_channel_difference);
+        }
+        else if ("--max-mismatched-pixels" == argument)
+        {
+            option_valid = ParseNumber(value, options.Tolerance.MaxMismatchedPixelProportion) && (options.Tolerance.MaxMismatchedPixelProportion >= 0.0);
+        }
+
+        if (!option_valid)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+/// Creates a small checkerboard texture, so that textured scenes don't depend on external files.
+/// @return The texture.
+static std::shared_ptr<GRAPHICS::Bitmap> CreateCheckerboardTexture()
+{
+    constexpr unsigned int TEXTURE_DIMENSION_IN_PIXELS = 8;
+    auto texture = std::make_shared<GRAPHICS::Bitmap>(TEXTURE_DIMENSION_IN_PIXELS, TEXTURE_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (unsigned int y = 0; y < TEXTURE_DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < TEXTURE_DIMENSION_IN_PIXELS; ++x)
+        {
+            bool light_square = (0 == ((x + y) % 2));
+            GRAPHICS::Color color = light_square ? GRAPHICS::Color(1.0f, 0.9f, 0.2f, 1.0f) : GRAPHICS::Color(0.2f, 0.3f, 0.8f, 1.0f);
+            texture->WritePixel(x, y, color);
+        }
+    }
+    return texture;
+}
+
+/// Creates a material exercising a shading type.
+/// @param[in]  shading_type - The type of shading for the material.
+/// @param[in]  texture - The texture for textured materials.
+/// @return The material.
+static std::shared_ptr<GRAPHICS::Material> CreateMaterial(const GRAPHICS::ShadingType shading_type, const std::shared_ptr<GRAPHICS::Bitmap>& texture)
+{
+    // Distinct vertex colors make differences in interpolation visible.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->Shading = shading_type;
+    material->VertexColors = { GRAPHICS::Color(1.0f, 0.2f, 0.2f, 1.0f), GRAPHICS::Color(0.2f, 1.0f, 0.2f, 1.0f), GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f) };
+    material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
+    material->DiffuseColor = GRAPHICS::Color(0.8f, 0.5f, 0.3f, 1.0f);
+    material->SpecularColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+    material->SpecularPower = 16.0f;
+    if (GRAPHICS::ShadingType::TEXTURED == shading_type)
+    {
+        material->VertexColors = { GRAPHICS::Color::WHITE, GRAPHICS::Color::WHITE, GRAPHICS::Color::WHITE };
+        material->Texture = texture;
+        material->VertexTextureCoordinates = { MATH::Vector2f(0.0f, 0.0f), MATH::Vector2f(1.0f, 0.0f), MATH::Vector2f(0.0f, 1.0f) };
+    }
+    return material;
+}
+
+/// Creates the catalog of scenes to test, covering every shading type with every projection.
+/// Each scene has a rotated cube partially in front of a floor, so that depth testing and
+/// backface culling both affect the output.
+/// @return The scenes.
+static std::vector<GoldenImageScene> CreateSceneCatalog()
+{
+    // DEFINE THE VARIATIONS TO COVER.
+    struct NamedShadingType
+    {
+        std::string_view Name;
+        GRAPHICS::ShadingType Shading;
+    };
+    const std::array<NamedShadingType, static_cast<std::size_t>(GRAPHICS::ShadingType::COUNT)> SHADING_TYPES =
+    {{
+        { "wireframe", GRAPHICS::ShadingType::WIREFRAME },
+        { "flat", GRAPHICS::ShadingType::FLAT },
+        { "face_vertex_color_interpolation", GRAPHICS::ShadingType::FACE_VERTEX_COLOR_INTERPOLATION },
+        { "gouraud", GRAPHICS::ShadingType::GOURAUD },
+        { "textured", GRAPHICS::ShadingType::TEXTURED },
+        { "material", GRAPHICS::ShadingType::MATERIAL },
+    }};
+    struct NamedProjectionType
+    {
+        std::string_view Name;
+        GRAPHICS::ProjectionType Projection;
+    };
+    const std::array<NamedProjectionType, 2> PROJECTION_TYPES =
+    {{
+        { "orthographic", GRAPHICS::ProjectionType::ORTHOGRAPHIC },
+        { "perspective", GRAPHICS::ProjectionType::PERSPECTIVE },
+    }};
+
+    // DEFINE THE LIGHTING SHARED BY ALL SCENES.
+    GRAPHICS::Light ambient_light;
+    ambient_light.Type = GRAPHICS::LightType::AMBIENT;
+    ambient_light.Color = GRAPHICS::Color(0.3f, 0.3f, 0.3f, 1.0f);
+    GRAPHICS::Light directional_light;
+    directional_light.Type = GRAPHICS::LightType::DIRECTIONAL;
+    directional_light.Color = GRAPHICS::Color(0.6f, 0.6f, 0.6f, 1.0f);
+    directional_light.DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(-1.0f, -1.0f, -1.0f));
+    GRAPHICS::Light point_light;
+    point_light.Type = GRAPHICS::LightType::POINT;
+    point_light.Color = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f);
+    point_light.PointLightWorldPosition = MATH::Vector3f(2.0f, 4.0f, 3.0f);
+
+    // CREATE A SCENE FOR EACH VARIATION.
+    std::shared_ptr<GRAPHICS::Bitmap> texture = CreateCheckerboardTexture();
+    std::vector<GoldenImageScene> scenes;
+    for (const NamedShadingType& shading_type : SHADING_TYPES)
+    {
+        std::shared_ptr<GRAPHICS::Material> material = CreateMaterial(shading_type.Shading, texture);
+        for (const NamedProjectionType& projection_type : PROJECTION_TYPES)
+        {
+            // CREATE THE CUBE.
+            GoldenImageScene& scene = scenes.emplace_back();
+            scene.Name = std::string(shading_type.Name) + "_" + std::string(projection_type.Name);
+            scene.Scene.BackgroundColor = GRAPHICS::Color(0.1f, 0.1f, 0.2f, 1.0f);
+            GRAPHICS::Object3D& cube = scene.Scene.Objects.emplace_back(GRAPHICS::Cube::Create(material));
+            cube.RotationInRadians.X = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(20.0f));
+            cube.RotationInRadians.Y = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(30.0f));
+
+            // CREATE THE FLOOR.
+            constexpr float FLOOR_Y = -0.6f;
+            constexpr float FLOOR_HALF_SIZE = 2.0f;
+            std::array<MATH::Vector3f, 4> floor_corners =
+            {
+                MATH::Vector3f(-FLOOR_HALF_SIZE, FLOOR_Y, -FLOOR_HALF_SIZE),
+                MATH::Vector3f(-FLOOR_HALF_SIZE, FLOOR_Y, FLOOR_HALF_SIZE),
+                MATH::Vector3f(FLOOR_HALF_SIZE, FLOOR_Y, FLOOR_HALF_SIZE),
+                MATH::Vector3f(FLOOR_HALF_SIZE, FLOOR_Y, -FLOOR_HALF_SIZE)
+            };
+            GRAPHICS::Object3D& floor = scene.Scene.Objects.emplace_back();
+            floor.Triangles.push_back(GRAPHICS::Triangle(material, { floor_corners[0], floor_corners[1], floor_corners[2] }));
+            floor.Triangles.push_back(GRAPHICS::Triangle(material, { floor_corners[0], floor_corners[2], floor_corners[3] }));
+
+            // SET UP THE LIGHTS AND CAMERA.
+            scene.Scene.PointLights = std::vector<GRAPHICS::Light>{ ambient_light, directional_light, point_light };
+            scene.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 1.5f, 3.0f));
+            scene.Camera.Projection = projection_type.Projection;
+            scene.Camera.FieldOfView = MATH::Angle<float>::Degrees(60.0f);
+            scene.Camera.NearClipPlaneViewDistance = 1.0f;
+            scene.Camera.FarClipPlaneViewDistance = 100.0f;
+            float aspect_ratio_width_over_height = static_cast<float>(IMAGE_WIDTH_IN_PIXELS) / static_cast<float>(IMAGE_HEIGHT_IN_PIXELS);
+            scene.Camera.ViewingPlane.Width = scene.Camera.ViewingPlane.Height * aspect_ratio_width_over_height;
+        }
+    }
+    return scenes;
+}
+
+/// Creates the render paths to verify.  New optimized render paths (like multithreaded, SIMD,
+/// or tiled rendering) should be added here so that they're verified against the same references.
+/// @return The render paths.
+static std::vector<RenderPath> CreateRenderPaths()
+{
+    std::vector<RenderPath> render_paths =
+    {
+        RenderPath
+        {
+            .Name = "rasterizer",
+            .Render = [](const GRAPHICS::Scene& scene, const GRAPHICS::Camera& camera, GRAPHICS::Bitmap& render_target)
+            {
+                GRAPHICS::DepthBuffer depth_buffer(render_target.GetWidthInPixels(), render_target.GetHeightInPixels());
+                constexpr bool CULL_BACKFACES = false;
+                GRAPHICS::SoftwareRasterizationAlgorithm::Render(scene, camera, CULL_BACKFACES, render_target, &depth_buffer);
+            }
+        },
+        RenderPath
+        {
+            .Name = "rasterizer_culled",
+            .Render = [](const GRAPHICS::Scene& scene, const GRAPHICS::Camera& camera, GRAPHICS::Bitmap& render_target)
+            {
+                GRAPHICS::DepthBuffer depth_buffer(render_target.GetWidthInPixels(), render_target.GetHeightInPixels());
+                constexpr bool CULL_BACKFACES = true;
+                GRAPHICS::SoftwareRasterizationAlgorithm::Render(scene, camera, CULL_BACKFACES, render_target, &depth_buffer);
+            }
+        },
+        RenderPath
+        {
+            .Name = "rasterizer_no_depth",
+            .Render = [](const GRAPHICS::Scene& scene, const GRAPHICS::Camera& camera, GRAPHICS::Bitmap& render_target)
+            {
+                constexpr bool CULL_BACKFACES = false;
+                GRAPHICS::SoftwareRasterizationAlgorithm::Render(scene, camera, CULL_BACKFACES, render_target, nullptr);
+            }
+        },
+        RenderPath
+        {
+            .Name = "ray_tracer",
+            .Render = [](const GRAPHICS::Scene& scene, const GRAPHICS::Camera& camera, GRAPHICS::Bitmap& render_target)
+            {
+                GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+                ray_tracer.Render(scene, camera, render_target);
+            }
+        },
+    };
+    return render_paths;
+}
+
+/// Renders a catalog of scenes through each render path and compares the images against
+/// stored reference images, so that optimizations can't silently change rendered output.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments, starting with the program name.
+/// @return EXIT_SUCCESS if all images matched their references; EXIT_FAILURE otherwise.
+int main(int argument_count, char* arguments[])
+{
+    // PARSE THE COMMAND LINE.
+    std::vector<std::string_view> command_line_arguments(arguments + std::min(argument_count, 1), arguments + argument_count);
+    std::optional<GoldenImageTestOptions> options = ParseOptions(command_line_arguments);
+    if (!options)
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    // PREPARE THE OUTPUT FOLDER.
+    std::filesystem::path output_folder_path = options->UpdateReferences ? options->ReferenceFolderPath : options->FailureOutputFolderPath;
+    std::error_code output_folder_error;
+    std::filesystem::create_directories(output_folder_path, output_folder_error);
+    if (output_folder_error)
+    {
+        std::cerr << "Failed to create folder: " << output_folder_path.string() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // RENDER AND COMPARE EACH SCENE WITH EACH RENDER PATH.
+    std::vector<GoldenImageScene> scenes = CreateSceneCatalog();
+    std::vector<RenderPath> render_paths = CreateRenderPaths();
+    std::size_t tested_image_count = 0;
+    std::size_t failed_image_count = 0;
+    std::cout << std::fixed << std::setprecision(2);
+    for (const GoldenImageScene& scene : scenes)
+    {
+        for (const RenderPath& render_path : render_paths)
+        {
+            // SKIP IMAGES NOT MATCHING ANY FILTER.
+            std::string image_name = scene.Name + "." + std::string(render_path.Name);
+            bool image_included = image_name.find(options->NameFilter) != std::string::npos;
+            if (!image_included)
+            {
+                continue;
+            }
+            ++tested_image_count;
+
+            // RENDER THE IMAGE.
+            GRAPHICS::Bitmap actual_image(IMAGE_WIDTH_IN_PIXELS, IMAGE_HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+            render_path.Render(scene.Scene, scene.Camera, actual_image);
+            std::filesystem::path reference_filepath = options->ReferenceFolderPath / (image_name + ".bmp");
+
+            // UPDATE THE REFERENCE IMAGE IF APPLICABLE.
+            if (options->UpdateReferences)
+            {
+                bool reference_written = actual_image.Save(reference_filepath);
+                if (!reference_written)
+                {
+                    std::cerr << "Failed to write reference image: " << reference_filepath.string() << "\n";
+                    return EXIT_FAILURE;
+                }
+                std::cout << "UPDATED " << image_name << "\n";
+                continue;
+            }
+
+            // COMPARE AGAINST THE REFERENCE IMAGE.
+            std::shared_ptr<GRAPHICS::Bitmap> reference_image = GRAPHICS::Bitmap::Load(reference_filepath);
+            if (!reference_image)
+            {
+                std::cout << "FAILED " << image_name << ": missing reference image " << reference_filepath.string() << "\n";
+                ++failed_image_count;
+                continue;
+            }
+            GRAPHICS::ImageComparisonResult comparison = GRAPHICS::ImageComparison::Compare(*reference_image, actual_image, options->Tolerance);
+            if (!comparison.DimensionsMatch)
+            {
+                std::cout << "FAILED " << image_name << ": reference image is "
+                    << reference_image->GetWidthInPixels() << "x" << reference_image->GetHeightInPixels() << "\n";
+                ++failed_image_count;
+                continue;
+            }
+            std::cout
+                << (comparison.Matches ? "PASSED " : "FAILED ") << image_name << ": "
+                << "PSNR " << comparison.PeakSignalToNoiseRatioInDecibels << " dB, "
+                << "max error " << static_cast<unsigned int>(comparison.MaxChannelDifference) << ", "
+                << comparison.MismatchedPixelCount << " mismatched pixels\n";
+            if (comparison.Matches)
+            {
+                continue;
+            }
+            ++failed_image_count;
+
+            // WRITE IMAGES FOR INVESTIGATING THE FAILURE.
+            std::optional<GRAPHICS::Bitmap> difference_image = GRAPHICS::ImageComparison::CreateDifferenceImage(*reference_image, actual_image, options->Tolerance);
+            std::filesystem::path actual_filepath = output_folder_path / (image_name + ".actual.bmp");
+            std::filesystem::path difference_filepath = output_folder_path / (image_name + ".diff.bmp");
+            bool failure_images_written = actual_image.Save(actual_filepath) && difference_image && difference_image->Save(difference_filepath);
+            if (!failure_images_written)
+            {
+                std::cerr << "Failed to write failure images to: " << output_folder_path.string() << "\n";
+            }
+        }
+    }
+
+    // SUMMARIZE THE RESULTS.
+    if (options->UpdateReferences)
+    {
+        std::cout << "Updated " << tested_image_count << " reference images in " << options->ReferenceFolderPath.string() << "\n";
+        return EXIT_SUCCESS;
+    }
+    std::cout << (tested_image_count - failed_image_count) << " of " << tested_image_count << " images matched\n";
+    if (failed_image_count > 0)
+    {
+        std::cout << "Actual and difference images for failures are in " << output_folder_path.string() << "\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,681 @@
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Benchmarking/Benchmark.h"
+#include "Benchmarking/HardwareCounters.h"
+#include "Graphics/Color.h"
+#include "Math/Angle.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Simd.h"
+#include "Math/Vector3.h"
+#include "Math/Vector3Batch.h"
+#include "Math/Vector4.h"
+
+/// Options for benchmarking, as specified on the command line.
+struct MathBenchmarkOptions
+{
+    /// Only kernels with names containing this text are run (all kernels if empty).
+    std::string KernelNameFilter = "";
+    /// The number of elements each kernel operates on per run.
+    std::size_t ElementCount = 65536;
+    /// The number of unmeasured runs before measured runs of each kernel.
+    std::size_t WarmUpRunCount = 3;
+    /// The number of measured runs of each kernel.
+    std::size_t MeasuredRunCount = 20;
+    /// The path of any CSV file to also write results to.
+    std::string CsvFilepath = "";
+    /// The path of any CSV file from a previous run to compare results against.
+    std::string BaselineCsvFilepath = "";
+    /// True if hardware performance counters are measured; false otherwise.
+    bool HardwareCountersEnabled = false;
+};
+
+/// Inputs and outputs for all kernels, with one of each per element.
+/// Inputs are pseudo-random but deterministic so that runs are comparable.
+/// Outputs are kept in memory after each run so that the work can't be optimized away.
+struct MathBenchmarkData
+{
+    /// Left-hand matrices to multiply.
+    std::vector<MATH::Matrix4x4f> LhsMatrices = {};
+    /// Right-hand matrices to multiply.
+    std::vector<MATH::Matrix4x4f> RhsMatrices = {};
+    /// Rotation angles for building rotation matrices.
+    std::vector<MATH::Vector3< MATH::Angle<float>::Radians >> RotationAngles = {};
+    /// Angles in degrees.
+    std::vector<float> AnglesInDegrees = {};
+    /// First 3D vectors for binary operations.
+    std::vector<MATH::Vector3f> Vector3s1 = {};
+    /// Second 3D vectors for binary operations.
+    std::vector<MATH::Vector3f> Vector3s2 = {};
+    /// First 4D vectors for binary operations.
+    std::vector<MATH::Vector4f> Vector4s1 = {};
+    /// Second 4D vectors for binary operations.
+    std::vector<MATH::Vector4f> Vector4s2 = {};
+    /// The same vectors as Vector3s1 as a batch.
+    MATH::Vector3Batch Vector3Batch1 = MATH::Vector3Batch();
+    /// The same vectors as Vector3s2 as a batch.
+    MATH::Vector3Batch Vector3Batch2 = MATH::Vector3Batch();
+    /// First colors for interpolation and packing.
+    std::vector<GRAPHICS::Color> Colors1 = {};
+    /// Second colors for interpolation.
+    std::vector<GRAPHICS::Color> Colors2 = {};
+    /// Ratios in [0,1] for interpolation.
+    std::vector<float> Ratios = {};
+    /// Packed versions of Colors1.
+    std::vector<uint32_t> PackedColors = {};
+    /// A single transform applied to many vectors.
+    MATH::Matrix4x4f Transform = MATH::Matrix4x4f::Identity();
+
+    /// Output matrices.
+    std::vector<MATH::Matrix4x4f> MatrixResults = {};
+    /// Output 3D vectors.
+    std::vector<MATH::Vector3f> Vector3Results = {};
+    /// Output 4D vectors.
+    std::vector<MATH::Vector4f> Vector4Results = {};
+    /// Output batch of 3D vectors.
+    MATH::Vector3Batch Vector3BatchResults = MATH::Vector3Batch();
+    /// Output scalars.
+    std::vector<float> FloatResults = {};
+    /// Output colors.
+    std::vector<GRAPHICS::Color> ColorResults = {};
+    /// Output packed colors.
+    std::vector<uint32_t> PackedColorResults = {};
+};
+
+/// A single operation benchmarked over many elements.
+struct MathKernel
+{
+    /// The name of the kernel for reporting and filtering.
+    std::string Name = "";
+    /// Performs the operation on all elements.
+    std::function<void()> Run = nullptr;
+};
+
+/// Prints how to use the program.
+static void PrintUsage()
+{
+    std::cerr <<
+        "Usage: MathBenchmark [options]\n"
+        "Options:\n"
+        "  --filter <text>                         Only run kernels with names containing the text (default all).\n"
+        "  --count <count>                         Elements per kernel run (default 65536).\n"
+        "  --warmup <count>                        Unmeasured runs per kernel (default 3).\n"
+        "  --runs <count>                          Measured runs per kernel (default 20).\n"
+        "  --csv <path>                            Also write results to a CSV file.\n"
+        "  --compare <path>                        Report speedups relative to a CSV file from a previous run.\n"
+        "  --counters <on|off>                     Measure hardware performance counters (default off).\n"
+        "\n"
+        "To compare scalar and SIMD implementations, write a CSV with MathBenchmarkScalar\n"
+        "(built with MATH_SIMD_DISABLED) and pass it to MathBenchmark with --compare.\n";
+}
+
+/// Parses a number from a command line argument.
+/// @tparam Number - The type of number to parse.
+/// @param[in]  argument - The argument to parse.
+/// @param[out]  number - The parsed number.
+/// @return True if the entire argument was a valid number; false otherwise.
+template <typename Number>
+static bool ParseNumber(const std::string_view argument, Number& number)
+{
+    const char* argument_end = argument.data() + argument.size();
+    std::from_chars_result result = std::from_chars(argument.data(), argument_end, number);
+    bool number_parsed = (std::errc() == result.ec) && (argument_end == result.ptr);
+    return number_parsed;
+}
+
+/// Parses command line arguments.
+/// @param[in]  arguments - The command line arguments, excluding the program name.
+/// @return The options, if all arguments were valid; null otherwise.
+static std::optional<MathBenchmarkOptions> ParseOptions(const std::vector<std::string_view>& arguments)
+{
+    MathBenchmarkOptions options;
+    for (std::size_t argument_index = 0; argument_index < arguments.size(); ++argument_index)
+    {
+        // ALL OPTIONS HAVE VALUES.
+        std::string_view argument = arguments[argument_index];
+        ++argument_index;
+        bool value_exists = (argument_index < arguments.size());
+        if (!value_exists)
+        {
+            return std::nullopt;
+        }
+        std::string_view value = arguments[argument_index];
+
+        bool option_valid = false;
+        if ("--filter" == argument)
+        {
+            options.KernelNameFilter = value;
+            option_valid = true;
+        }
+        else if ("--count" == argument)
+        {
+            option_valid = ParseNumber(value, options.ElementCount) && (options.ElementCount > 0);
+        }
+        else if ("--warmup" == argument)
+        {
+            option_valid = ParseNumber(value, options.WarmUpRunCount);
+        }
+        else if ("--runs" == argument)
+        {
+            option_valid = ParseNumber(value, options.MeasuredRunCount) && (options.MeasuredRunCount > 0);
+        }
+        else if ("--csv" == argument)
+        {
+            options.CsvFilepath = value;
+            option_valid = true;
+        }
+        else if ("--compare" == argument)
+        {
+            options.BaselineCsvFilepath = value;
+            option_valid = true;
+        }
+        else if ("--counters" == argument)
+        {
+            options.HardwareCountersEnabled = ("on" == value);
+            option_valid = ("on" == value) || ("off" == value);
+        }
+
+        if (!option_valid)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+/// Reads the time per element for each kernel from a CSV file written by this program.
+/// @param[in]  csv_filepath - The path of the CSV file.
+/// @return The nanoseconds per element, keyed by kernel name, if the file could be read; null otherwise.
+static std::optional<std::map<std::string, double>> ReadBaselineNanosecondsPerElement(const std::string& csv_filepath)
+{
+    // OPEN THE FILE.
+    std::ifstream csv_file(csv_filepath);
+    if (!csv_file)
+    {
+        return std::nullopt;
+    }
+
+    // FIND THE NEEDED COLUMNS FROM THE HEADER.
+    auto split_line = [](const std::string& line) -> std::vector<std::string>
+    {
+        std::vector<std::string> fields;
+        std::istringstream line_stream(line);
+        std::string field;
+        while (std::getline(line_stream, field, ','))
+        {
+            fields.push_back(field);
+        }
+        return fields;
+    };
+    std::string header_line;
+    if (!std::getline(csv_file, header_line))
+    {
+        return std::nullopt;
+    }
+    std::vector<std::string> column_names = split_line(header_line);
+    auto kernel_column = std::find(column_names.cbegin(), column_names.cend(), "kernel");
+    auto nanoseconds_per_element_column = std::find(column_names.cbegin(), column_names.cend(), "ns_per_element");
+    bool columns_found = (column_names.cend() != kernel_column) && (column_names.cend() != nanoseconds_per_element_column);
+    if (!columns_found)
+    {
+        return std::nullopt;
+    }
+    std::size_t kernel_column_index = static_cast<std::size_t>(kernel_column - column_names.cbegin());
+    std::size_t nanoseconds_per_element_column_index = static_cast<std::size_t>(nanoseconds_per_element_column - column_names.cbegin());
+
+    // READ THE TIME FOR EACH KERNEL.
+    std::map<std::string, double> nanoseconds_per_element_by_kernel_name;
+    std::string line;
+    while (std::getline(csv_file, line))
+    {
+        std::vector<std::string> fields = split_line(line);
+        bool fields_exist = (kernel_column_index < fields.size()) && (nanoseconds_per_element_column_index < fields.size());
+        if (!fields_exist)
+        {
+            return std::nullopt;
+        }
+
+        // The CSV file is written with default stream formatting, which from_chars can parse.
+        double nanoseconds_per_element = 0.0;
+        if (!ParseNumber(fields[nanoseconds_per_element_column_index], nanoseconds_per_element))
+        {
+            return std::nullopt;
+        }
+        nanoseconds_per_element_by_kernel_name[fields[kernel_column_index]] = nanoseconds_per_element;
+    }
+
+    return nanoseconds_per_element_by_kernel_name;
+}
+
+/// Creates pseudo-random inputs (and space for outputs) for all kernels.
+/// @param[in]  element_count - The number of elements for each kernel.
+/// @return The data for all kernels.
+static std::unique_ptr<MathBenchmarkData> CreateData(const std::size_t element_count)
+{
+    // A fixed seed keeps inputs identical across runs and builds.
+    constexpr unsigned int RANDOM_SEED = 49;
+    std::mt19937 random_number_generator(RANDOM_SEED);
+    std::uniform_real_distribution<float> random_component(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> random_angle_in_degrees(-360.0f, 360.0f);
+    std::uniform_real_distribution<float> random_ratio(0.0f, 1.0f);
+    auto random_vector_3 = [&]() { return MATH::Vector3f(random_component(random_number_generator), random_component(random_number_generator), random_component(random_number_generator)); };
+    auto random_radians = [&]() { return MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(random_angle_in_degrees(random_number_generator))); };
+    auto random_color = [&]()
+    {
+        return GRAPHICS::Color(
+            random_ratio(random_number_generator),
+            random_ratio(random_number_generator),
+            random_ratio(random_number_generator),
+            random_ratio(random_number_generator));
+    };
+    auto random_world_transform = [&]()
+    {
+        MATH::Vector3< MATH::Angle<float>::Radians > rotation_angles(random_radians(), random_radians(), random_radians());
+        return MATH::Matrix4x4f::Translation(random_vector_3()) * MATH::Matrix4x4f::Rotation(rotation_angles);
+    };
+
+    // CREATE THE INPUTS.
+    auto data = std::make_unique<MathBenchmarkData>();
+    data->Transform = random_world_transform();
+    for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+    {
+        data->LhsMatrices.push_back(random_world_transform());
+        data->RhsMatrices.push_back(random_world_transform());
+        data->RotationAngles.emplace_back(random_radians(), random_radians(), random_radians());
+        data->AnglesInDegrees.push_back(random_angle_in_degrees(random_number_generator));
+
+        MATH::Vector3f vector_3_1 = random_vector_3();
+        MATH::Vector3f vector_3_2 = random_vector_3();
+        data->Vector3s1.push_back(vector_3_1);
+        data->Vector3s2.push_back(vector_3_2);
+        data->Vector4s1.push_back(MATH::Vector4f::HomogeneousPositionVector(vector_3_1));
+        data->Vector4s2.push_back(MATH::Vector4f::HomogeneousPositionVector(vector_3_2));
+
+        data->Colors1.push_back(random_color());
+        data->Colors2.push_back(random_color());
+        data->Ratios.push_back(random_ratio(random_number_generator));
+        data->PackedColors.push_back(data->Colors1.back().Pack(GRAPHICS::ColorFormat::RGBA));
+    }
+    data->Vector3Batch1 = MATH::Vector3Batch::FromVectors(data->Vector3s1);
+    data->Vector3Batch2 = MATH::Vector3Batch::FromVectors(data->Vector3s2);
+
+    // ALLOCATE THE OUTPUTS.
+    // Outputs are allocated up-front so that runs only measure the math.
+    data->MatrixResults.resize(element_count);
+    data->Vector3Results.resize(element_count);
+    data->Vector4Results.resize(element_count);
+    data->Vector3BatchResults.Resize(element_count);
+    data->FloatResults.resize(element_count);
+    data->ColorResults.resize(element_count);
+    data->PackedColorResults.resize(element_count);
+
+    return data;
+}
+
+/// Creates all kernels to benchmark.  Kernels operating on individual vectors
+/// have batch counterparts with the same names prefixed by "vector3_batch_",
+/// so that the benefit of the structure-of-arrays layout can be seen directly.
+/// @param[in,out]  data - The data for all kernels, which must outlive the kernels.
+/// @return The kernels.
+static std::vector<MathKernel> CreateKernels(MathBenchmarkData& data)
+{
+    std::size_t element_count = data.LhsMatrices.size();
+    std::vector<MathKernel> kernels;
+
+    // MATRIX KERNELS.
+    kernels.push_back({ "matrix_multiply", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.MatrixResults[element_index] = data.LhsMatrices[element_index] * data.RhsMatrices[element_index];
+        }
+    }});
+    kernels.push_back({ "matrix_vector_multiply", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.Vector4Results[element_index] = data.LhsMatrices[element_index] * data.Vector4s1[element_index];
+        }
+    }});
+    kernels.push_back({ "matrix_rotation", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.MatrixResults[element_index] = MATH::Matrix4x4f::Rotation(data.RotationAngles[element_index]);
+        }
+    }});
+    kernels.push_back({ "matrix_world_transform", [&data, element_count]()
+    {
+        // This mirrors how objects build their world transforms.
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.MatrixResults[element_index] =
+                MATH::Matrix4x4f::Translation(data.Vector3s1[element_index]) *
+                MATH::Matrix4x4f::Rotation(data.RotationAngles[element_index]) *
+                MATH::Matrix4x4f::Scale(data.Vector3s2[element_index]);
+        }
+    }});
+
+    // 3D VECTOR KERNELS.
+    kernels.push_back({ "vector3_add", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.Vector3Results[element_index] = data.Vector3s1[element_index] + data.Vector3s2[element_index];
+        }
+    }});
+    kernels.push_back({ "vector3_length", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.FloatResults[element_index] = data.Vector3s1[element_index].Length();
+        }
+    }});
+    kernels.push_back({ "vector3_normalize", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.Vector3Results[element_index] = MATH::Vector3f::Normalize(data.Vector3s1[element_index]);
+        }
+    }});
+    kernels.push_back({ "vector3_dot", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.FloatResults[element_index] = MATH::Vector3f::DotProduct(data.Vector3s1[element_index], data.Vector3s2[element_index]);
+        }
+    }});
+    kernels.push_back({ "vector3_cross", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.Vector3Results[element_index] = MATH::Vector3f::CrossProduct(data.Vector3s1[element_index], data.Vector3s2[element_index]);
+        }
+    }});
+    kernels.push_back({ "vector3_transform", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            MATH::Vector4f transformed_vector = data.Transform * MATH::Vector4f::HomogeneousPositionVector(data.Vector3s1[element_index]);
+            data.Vector3Results[element_index] = MATH::Vector3f(transformed_vector.X, transformed_vector.Y, transformed_vector.Z);
+        }
+    }});
+
+    // BATCH 3D VECTOR KERNELS.
+    kernels.push_back({ "vector3_batch_normalize", [&data]()
+    {
+        MATH::Vector3Batch::Normalize(data.Vector3Batch1, data.Vector3BatchResults);
+    }});
+    kernels.push_back({ "vector3_batch_fast_normalize", [&data]()
+    {
+        MATH::Vector3Batch::FastNormalize(data.Vector3Batch1, data.Vector3BatchResults);
+    }});
+    kernels.push_back({ "vector3_batch_dot", [&data]()
+    {
+        MATH::Vector3Batch::DotProduct(data.Vector3Batch1, data.Vector3Batch2, data.FloatResults);
+    }});
+    kernels.push_back({ "vector3_batch_cross", [&data]()
+    {
+        MATH::Vector3Batch::CrossProduct(data.Vector3Batch1, data.Vector3Batch2, data.Vector3BatchResults);
+    }});
+    kernels.push_back({ "vector3_batch_transform", [&data]()
+    {
+        constexpr float POSITION_W = 1.0f;
+        MATH::Vector3Batch::Transform(data.Transform, data.Vector3Batch1, POSITION_W, data.Vector3BatchResults);
+    }});
+
+    // 4D VECTOR KERNELS.
+    kernels.push_back({ "vector4_add", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.Vector4Results[element_index] = data.Vector4s1[element_index] + data.Vector4s2[element_index];
+        }
+    }});
+    kernels.push_back({ "vector4_normalize", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.Vector4Results[element_index] = MATH::Vector4f::Normalize(data.Vector4s1[element_index]);
+        }
+    }});
+    kernels.push_back({ "vector4_dot", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.FloatResults[element_index] = MATH::Vector4f::DotProduct(data.Vector4s1[element_index], data.Vector4s2[element_index]);
+        }
+    }});
+
+    // ANGLE KERNELS.
+    kernels.push_back({ "angle_degrees_to_radians", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            MATH::Angle<float>::Degrees angle_in_degrees(data.AnglesInDegrees[element_index]);
+            data.FloatResults[element_index] = MATH::Angle<float>::DegreesToRadians(angle_in_degrees).Value;
+        }
+    }});
+
+    // COLOR KERNELS.
+    kernels.push_back({ "color_pack", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.PackedColorResults[element_index] = data.Colors1[element_index].Pack(GRAPHICS::ColorFormat::RGBA);
+        }
+    }});
+    kernels.push_back({ "color_unpack", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.ColorResults[element_index] = GRAPHICS::Color::Unpack(data.PackedColors[element_index], GRAPHICS::ColorFormat::RGBA);
+        }
+    }});
+    kernels.push_back({ "color_interpolate", [&data, element_count]()
+    {
+        for (std::size_t element_index = 0; element_index < element_count; ++element_index)
+        {
+            data.ColorResults[element_index] = GRAPHICS::Color::InterpolateRedGreenBlue(
+                data.Colors1[element_index],
+                data.Colors2[element_index],
+                data.Ratios[element_index]);
+        }
+    }});
+
+    return kernels;
+}
+
+/// Benchmarks the math primitives underlying all rendering, to provide per-primitive
+/// numbers for guiding optimizations.  Each kernel performs a single operation over
+/// arrays of elements large enough that per-run overhead is negligible.  The default
+/// element count keeps each kernel's data within typical L2/L3 caches; larger counts
+/// can be used to measure memory-bound throughput.
+///
+/// SIMD code paths are selected at compile time, so scalar and SIMD implementations are
+/// compared by building this program both normally and with MATH_SIMD_DISABLED (which the
+/// build scripts do), then using --compare.  Within a single build, the "vector3_*" and
+/// "vector3_batch_*" kernels compare operating on individual vectors versus batches.
+///
+/// Hardware counters (if enabled) are reported per run, averaged across measured runs.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments, starting with the program name.
+/// @return EXIT_SUCCESS if benchmarks were run; EXIT_FAILURE otherwise.
+int main(int argument_count, char* arguments[])
+{
+    // PARSE THE COMMAND LINE.
+    std::vector<std::string_view> command_line_arguments(arguments + std::min(argument_count, 1), arguments + argument_count);
+    std::optional<MathBenchmarkOptions> options = ParseOptions(command_line_arguments);
+    if (!options)
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    // READ ANY BASELINE RESULTS.
+    std::optional<std::map<std::string, double>> baseline_nanoseconds_per_element_by_kernel_name;
+    if (!options->BaselineCsvFilepath.empty())
+    {
+        baseline_nanoseconds_per_element_by_kernel_name = ReadBaselineNanosecondsPerElement(options->BaselineCsvFilepath);
+        if (!baseline_nanoseconds_per_element_by_kernel_name)
+        {
+            std::cerr << "Failed to read baseline CSV file: " << options->BaselineCsvFilepath << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // OPEN ANY HARDWARE COUNTERS.
+    std::unique_ptr<BENCHMARKING::HardwareCounters> hardware_counters = nullptr;
+    if (options->HardwareCountersEnabled)
+    {
+        hardware_counters = std::make_unique<BENCHMARKING::HardwareCounters>();
+        if (!hardware_counters->IsAvailable())
+        {
+            std::cerr << "Hardware counters are unavailable on this system, so only timing is reported.\n";
+        }
+    }
+
+    // OPEN ANY CSV FILE.
+    std::ofstream csv_file;
+    if (!options->CsvFilepath.empty())
+    {
+        csv_file.open(options->CsvFilepath);
+        if (!csv_file)
+        {
+            std::cerr << "Failed to open CSV file: " << options->CsvFilepath << "\n";
+            return EXIT_FAILURE;
+        }
+        csv_file << "kernel,simd,elements,runs,min_ns,median_ns,mean_ns,stddev_ns,max_ns,ns_per_element,elements_per_second";
+        if (hardware_counters)
+        {
+            BENCHMARKING::HardwareCounters::WriteCsvHeader(csv_file);
+        }
+        csv_file << "\n";
+    }
+
+    // CREATE THE KERNELS.
+    std::unique_ptr<MathBenchmarkData> data = CreateData(options->ElementCount);
+    std::vector<MathKernel> kernels = CreateKernels(*data);
+
+    // PRINT THE TABLE HEADER.
+    std::string_view simd_name = MATH_SIMD_SSE2 ? "sse2" : "scalar";
+    std::cout << "SIMD: " << simd_name << ", elements per run: " << options->ElementCount << "\n";
+    std::cout
+        << std::left
+        << std::setw(30) << "kernel"
+        << std::right
+        << std::setw(12) << "median_us"
+        << std::setw(11) << "stddev_%"
+        << std::setw(12) << "ns/element"
+        << std::setw(14) << "Melements/s";
+    if (baseline_nanoseconds_per_element_by_kernel_name)
+    {
+        std::cout << std::setw(10) << "speedup";
+    }
+    if (hardware_counters)
+    {
+        BENCHMARKING::HardwareCounters::WriteTableHeader(std::cout);
+    }
+    std::cout << "\n";
+
+    // BENCHMARK EACH KERNEL.
+    for (const MathKernel& kernel : kernels)
+    {
+        // SKIP ANY KERNELS NOT MATCHING THE FILTER.
+        bool kernel_matches_filter = (std::string::npos != kernel.Name.find(options->KernelNameFilter));
+        if (!kernel_matches_filter)
+        {
+            continue;
+        }
+
+        // MEASURE THE KERNEL.
+        if (hardware_counters)
+        {
+            hardware_counters->Reset();
+        }
+        BENCHMARKING::TimingStatistics statistics = BENCHMARKING::Benchmark::Run(
+            options->WarmUpRunCount,
+            options->MeasuredRunCount,
+            kernel.Run,
+            nullptr,
+            hardware_counters.get());
+
+        // COMPUTE THROUGHPUT.
+        constexpr double NANOSECONDS_PER_SECOND = 1e9;
+        double element_count = static_cast<double>(options->ElementCount);
+        double nanoseconds_per_element = statistics.MedianTimeInNanoseconds / element_count;
+        double elements_per_second = NANOSECONDS_PER_SECOND / nanoseconds_per_element;
+        double relative_standard_deviation_percentage = 100.0 * statistics.StandardDeviationInNanoseconds / statistics.MeanTimeInNanoseconds;
+
+        // REPORT THE RESULTS.
+        constexpr double NANOSECONDS_PER_MICROSECOND = 1e3;
+        constexpr double MILLION = 1e6;
+        std::cout
+            << std::left
+            << std::setw(30) << kernel.Name
+            << std::right << std::fixed
+            << std::setw(12) << std::setprecision(1) << (statistics.MedianTimeInNanoseconds / NANOSECONDS_PER_MICROSECOND)
+            << std::setw(11) << std::setprecision(1) << relative_standard_deviation_percentage
+            << std::setw(12) << std::setprecision(3) << nanoseconds_per_element
+            << std::setw(14) << std::setprecision(1) << (elements_per_second / MILLION);
+        if (baseline_nanoseconds_per_element_by_kernel_name)
+        {
+            // A speedup above 1 means this run is faster than the baseline.
+            auto baseline = baseline_nanoseconds_per_element_by_kernel_name->find(kernel.Name);
+            bool baseline_exists = (baseline_nanoseconds_per_element_by_kernel_name->cend() != baseline);
+            if (baseline_exists)
+            {
+                double speedup = baseline->second / nanoseconds_per_element;
+                std::cout << std::setw(9) << std::setprecision(2) << speedup << "x";
+            }
+            else
+            {
+                std::cout << std::setw(10) << "n/a";
+            }
+        }
+        std::cout << std::defaultfloat;
+        BENCHMARKING::HardwareCounterValues hardware_counter_values_per_run;
+        if (hardware_counters)
+        {
+            hardware_counter_values_per_run = hardware_counters->GetTotals().DividedBy(static_cast<double>(statistics.RunCount));
+            BENCHMARKING::HardwareCounters::WriteTableColumns(hardware_counter_values_per_run, std::cout);
+        }
+        std::cout << "\n";
+        if (csv_file)
+        {
+            csv_file
+                << kernel.Name << ","
+                << simd_name << ","
+                << options->ElementCount << ","
+                << statistics.RunCount << ","
+                << statistics.MinimumTimeInNanoseconds << ","
+                << statistics.MedianTimeInNanoseconds << ","
+                << statistics.MeanTimeInNanoseconds << ","
+                << statistics.StandardDeviationInNanoseconds << ","
+                << statistics.MaximumTimeInNanoseconds << ","
+                << nanoseconds_per_element << ","
+                << elements_per_second;
+            if (hardware_counters)
+            {
+                BENCHMARKING::HardwareCounters::WriteCsvColumns(hardware_counter_values_per_run, csv_file);
+            }
+            csv_file << "\n";
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
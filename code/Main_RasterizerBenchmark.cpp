@@ -0,0 +1,583 @@
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Benchmarking/Benchmark.h"
+#include "Benchmarking/HardwareCounters.h"
+#include "Graphics/Bitmap.h"
+#include "Graphics/DepthBuffer.h"
+#include "Graphics/Material.h"
+#include "Graphics/ScreenSpaceTriangle.h"
+#include "Graphics/SoftwareRasterizationAlgorithm.h"
+#include "Graphics/StressSceneGenerator.h"
+
+/// A synthetic workload for the rasterizer.
+struct RasterizerWorkload
+{
+    /// The name of the sweep the workload is part of.
+    std::string SweepName = "";
+    /// The width of the render target in pixels.
+    unsigned int WidthInPixels = 640;
+    /// The height of the render target in pixels.
+    unsigned int HeightInPixels = 480;
+    /// The length of the two equal sides of each right triangle in pixels.
+    /// Zero for two triangles covering the full screen.
+    float TriangleLegLengthInPixels = 16.0f;
+    /// The number of layers of triangles drawn over the same pixels.
+    unsigned int OverdrawLayerCount = 1;
+    /// The type of shading for all triangles.
+    GRAPHICS::ShadingType Shading = GRAPHICS::ShadingType::FLAT;
+    /// True if depth testing is enabled; false otherwise.
+    bool DepthTestingEnabled = true;
+    /// The type of stress scene to render in full (including transforming and lighting vertices)
+    /// instead of synthetic screen-space triangles, if any.
+    std::optional<GRAPHICS::StressSceneType> StressScene = std::nullopt;
+};
+
+/// Options for benchmarking, as specified on the command line.
+struct RasterizerBenchmarkOptions
+{
+    /// The sweep to run, or "all" for every sweep.
+    std::string SweepName = "all";
+    /// The number of unmeasured runs before measured runs of each workload.
+    std::size_t WarmUpRunCount = 3;
+    /// The number of measured runs of each workload.
+    std::size_t MeasuredRunCount = 10;
+    /// The maximum number of triangles in any workload, to limit memory and time for tiny triangles.
+    std::size_t MaxTriangleCount = 250000;
+    /// The seed for generating stress scenes.
+    uint32_t StressSceneSeed = 1;
+    /// The path of any CSV file to also write results to.
+    std::string CsvFilepath = "";
+    /// True if hardware performance counters are measured; false otherwise.
+    bool HardwareCountersEnabled = false;
+};
+
+/// Prints how to use the program.
+static void PrintUsage()
+{
+    std::cerr <<
+        "Usage: RasterizerBenchmark [options]\n"
+        "Options:\n"
+        "  --sweep <all|triangle_size|overdraw|shading|resolution|stress_scene>\n"
+        "                                                            Workloads to run (default all).\n"
+        "  --warmup <count>                                          Unmeasured runs per workload (default 3).\n"
+        "  --runs <count>                                            Measured runs per workload (default 10).\n"
+        "  --max-triangles <count>                                   Maximum triangles per workload (default 250000).\n"
+        "  --stress-seed <number>                                    Seed for generating stress scenes (default 1).\n"
+        "  --csv <path>                                              Also write results to a CSV file.\n"
+        "  --counters <on|off>                                       Measure hardware performance counters (default off).\n";
+}
+
+/// Parses a number from a command line argument.
+/// @tparam Number - The type of number to parse.
+/// @param[in]  argument - The argument to parse.
+/// @param[out]  number - The parsed number.
+/// @return True if the entire argument was a valid number; false otherwise.
+template <typename Number>
+static bool ParseNumber(const std::string_view argument, Number& number)
+{
+    const char* argument_end = argument.data() + argument.size();
+    std::from_chars_result result = std::from_chars(argument.data(), argument_end, number);
+    bool number_parsed = (std::errc() == result.ec) && (argument_end == result.ptr);
+    return number_parsed;
+}
+
+/// Parses command line arguments.
+/// @param[in]  arguments - The command line arguments, excluding the program name.
+/// @return The options, if all arguments were valid; null otherwise.
+static std::optional<RasterizerBenchmarkOptions> ParseOptions(const std::vector<std::string_view>& arguments)
+{
+    RasterizerBenchmarkOptions options;
+    for (std::size_t argument_index = 0; argument_index < arguments.size(); ++argument_index)
+    {
+        // ALL OPTIONS HAVE VALUES.
+        std::string_view argument = arguments[argument_index];
+        ++argument_index;
+        bool value_exists = (argument_index < arguments.size());
+        if (!value_exists)
+        {
+            return std::nullopt;
+        }
+        std::string_view value = arguments[argument_index];
+
+        bool option_valid = false;
+        if ("--sweep" == argument)
+        {
+            options.SweepName = value;
+            option_valid = ("all" == value) || ("triangle_size" == value) || ("overdraw" == value) || ("shading" == value) || ("resolution" == value) || ("stress_scene" == value);
+        }
+        else if ("--warmup" == argument)
+        {
+            option_valid = ParseNumber(value, options.WarmUpRunCount);
+        }
+        else if ("--runs" == argument)
+        {
+            option_valid = ParseNumber(value, options.MeasuredRunCount) && (options.MeasuredRunCount > 0);
+        }
+        else if ("--max-triangles" == argument)
+        {
+            option_valid = ParseNumber(value, options.MaxTriangleCount) && (options.MaxTriangleCount > 0);
+        }
+        else if ("--stress-seed" == argument)
+        {
+            option_valid = ParseNumber(value, options.StressSceneSeed);
+        }
+        else if ("--csv" == argument)
+        {
+            options.CsvFilepath = value;
+            option_valid = true;
+        }
+        else if ("--counters" == argument)
+        {
+            options.HardwareCountersEnabled = ("on" == value);
+            option_valid = ("on" == value) || ("off" == value);
+        }
+
+        if (!option_valid)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+/// Gets the name of a shading type for reporting.
+/// @param[in]  shading_type - The shading type.
+/// @return The name of the shading type.
+static std::string_view ShadingTypeName(const GRAPHICS::ShadingType shading_type)
+{
+    switch (shading_type)
+    {
+        case GRAPHICS::ShadingType::WIREFRAME:
+            return "wireframe";
+        case GRAPHICS::ShadingType::FLAT:
+            return "flat";
+        case GRAPHICS::ShadingType::FACE_VERTEX_COLOR_INTERPOLATION:
+            return "vertex_color";
+        case GRAPHICS::ShadingType::GOURAUD:
+            return "gouraud";
+        case GRAPHICS::ShadingType::TEXTURED:
+            return "textured";
+        case GRAPHICS::ShadingType::MATERIAL:
+            return "material";
+        default:
+            return "unknown";
+    }
+}
+
+/// Creates the workloads to benchmark.  Each sweep varies a single parameter
+/// from a common baseline, so that the effect of each parameter can be isolated.
+/// @param[in]  sweep_name - The sweep to create workloads for, or "all" for every sweep.
+/// @return The workloads.
+static std::vector<RasterizerWorkload> CreateWorkloads(const std::string_view sweep_name)
+{
+    const RasterizerWorkload BASELINE_WORKLOAD;
+    std::vector<RasterizerWorkload> workloads;
+    bool all_sweeps = ("all" == sweep_name);
+
+    // SWEEP TRIANGLE SIZES FROM SUB-PIXEL TO FULL-SCREEN.
+    if (all_sweeps || ("triangle_size" == sweep_name))
+    {
+        constexpr float FULL_SCREEN = 0.0f;
+        for (float leg_length_in_pixels : { 0.5f, 1.0f, 2.0f, 4.0f, 8.0f, 16.0f, 32.0f, 64.0f, 128.0f, 256.0f, FULL_SCREEN })
+        {
+            RasterizerWorkload& workload = workloads.emplace_back(BASELINE_WORKLOAD);
+            workload.SweepName = "triangle_size";
+            workload.TriangleLegLengthInPixels = leg_length_in_pixels;
+        }
+    }
+
+    // SWEEP OVERDRAW.
+    if (all_sweeps || ("overdraw" == sweep_name))
+    {
+        for (unsigned int overdraw_layer_count : { 1u, 2u, 4u, 8u })
+        {
+            RasterizerWorkload& workload = workloads.emplace_back(BASELINE_WORKLOAD);
+            workload.SweepName = "overdraw";
+            workload.OverdrawLayerCount = overdraw_layer_count;
+        }
+    }
+
+    // SWEEP SHADING TYPES WITH AND WITHOUT DEPTH TESTING.
+    if (all_sweeps || ("shading" == sweep_name))
+    {
+        for (std::size_t shading_type_index = 0; shading_type_index < static_cast<std::size_t>(GRAPHICS::ShadingType::COUNT); ++shading_type_index)
+        {
+            for (bool depth_testing_enabled : { false, true })
+            {
+                RasterizerWorkload& workload = workloads.emplace_back(BASELINE_WORKLOAD);
+                workload.SweepName = "shading";
+                workload.Shading = static_cast<GRAPHICS::ShadingType>(shading_type_index);
+                workload.DepthTestingEnabled = depth_testing_enabled;
+            }
+        }
+    }
+
+    // SWEEP RESOLUTIONS.
+    if (all_sweeps || ("resolution" == sweep_name))
+    {
+        constexpr unsigned int RESOLUTIONS[][2] = { { 320, 240 }, { 640, 480 }, { 1280, 720 }, { 1920, 1080 } };
+        for (const auto& resolution : RESOLUTIONS)
+        {
+            RasterizerWorkload& workload = workloads.emplace_back(BASELINE_WORKLOAD);
+            workload.SweepName = "resolution";
+            workload.WidthInPixels = resolution[0];
+            workload.HeightInPixels = resolution[1];
+        }
+    }
+
+    // SWEEP GENERATED STRESS SCENES.
+    if (all_sweeps || ("stress_scene" == sweep_name))
+    {
+        for (std::size_t stress_scene_type_index = 0; stress_scene_type_index < static_cast<std::size_t>(GRAPHICS::StressSceneType::COUNT); ++stress_scene_type_index)
+        {
+            RasterizerWorkload& workload = workloads.emplace_back(BASELINE_WORKLOAD);
+            workload.SweepName = "stress_scene";
+            workload.StressScene = static_cast<GRAPHICS::StressSceneType>(stress_scene_type_index);
+        }
+    }
+
+    return workloads;
+}
+
+/// Creates the material shared by all triangles of a workload.
+/// @param[in]  shading_type - The type of shading for the material.
+/// @return The material.
+static std::shared_ptr<GRAPHICS::Material> CreateMaterial(const GRAPHICS::ShadingType shading_type)
+{
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->Shading = shading_type;
+    material->VertexColors = { GRAPHICS::Color::RED, GRAPHICS::Color::GREEN, GRAPHICS::Color::BLUE };
+    material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+
+    // CREATE A CHECKERBOARD TEXTURE.
+    // Each triangle spans the entire texture so that texture sampling varies across pixels.
+    constexpr unsigned int TEXTURE_SIZE_IN_PIXELS = 64;
+    constexpr unsigned int CHECKER_SIZE_IN_PIXELS = 8;
+    material->Texture = std::make_shared<GRAPHICS::Bitmap>(TEXTURE_SIZE_IN_PIXELS, TEXTURE_SIZE_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (unsigned int y = 0; y < TEXTURE_SIZE_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < TEXTURE_SIZE_IN_PIXELS; ++x)
+        {
+            bool is_white_checker = (0 == ((x / CHECKER_SIZE_IN_PIXELS) + (y / CHECKER_SIZE_IN_PIXELS)) % 2);
+            material->Texture->WritePixel(x, y, is_white_checker ? GRAPHICS::Color::WHITE : GRAPHICS::Color::BLACK);
+        }
+    }
+    material->VertexTextureCoordinates = { MATH::Vector2f(0.0f, 0.0f), MATH::Vector2f(1.0f, 0.0f), MATH::Vector2f(0.0f, 1.0f) };
+
+    return material;
+}
+
+/// Creates the screen-space triangles for a workload.
+///
+/// Each layer tiles the screen with pairs of right triangles forming squares, in rows
+/// from the top of the screen, stopping early if the maximum triangle count would be
+/// exceeded.  Layers are drawn back-to-front so that every layer passes depth testing,
+/// which is the worst case for overdraw.
+/// @param[in]  workload - The workload to create triangles for.
+/// @param[in]  material - The material for all triangles.
+/// @param[in]  max_triangle_count - The maximum number of triangles to create.
+/// @param[out]  covered_pixel_count - The total area of all triangles in pixels
+///     (counting overlapping pixels in each layer).
+/// @return The triangles, in drawing order.
+static std::vector<GRAPHICS::ScreenSpaceTriangle> CreateTriangles(
+    const RasterizerWorkload& workload,
+    const std::shared_ptr<GRAPHICS::Material>& material,
+    const std::size_t max_triangle_count,
+    double& covered_pixel_count)
+{
+    // DETERMINE THE SIZE OF EACH SQUARE OF TRIANGLES.
+    float screen_width = static_cast<float>(workload.WidthInPixels);
+    float screen_height = static_cast<float>(workload.HeightInPixels);
+    bool full_screen_triangles = (workload.TriangleLegLengthInPixels <= 0.0f);
+    float square_width = full_screen_triangles ? screen_width : workload.TriangleLegLengthInPixels;
+    float square_height = full_screen_triangles ? screen_height : workload.TriangleLegLengthInPixels;
+    std::size_t column_count = static_cast<std::size_t>(std::ceil(screen_width / square_width));
+    std::size_t row_count = static_cast<std::size_t>(std::ceil(screen_height / square_height));
+
+    // LIMIT THE NUMBER OF SQUARES PER LAYER.
+    constexpr std::size_t TRIANGLES_PER_SQUARE = 2;
+    std::size_t max_squares_per_layer = std::max<std::size_t>(1, max_triangle_count / (TRIANGLES_PER_SQUARE * workload.OverdrawLayerCount));
+    std::size_t squares_per_layer = std::min(column_count * row_count, max_squares_per_layer);
+
+    // CREATE THE TRIANGLES FOR EACH LAYER.
+    std::vector<GRAPHICS::ScreenSpaceTriangle> triangles;
+    triangles.reserve(squares_per_layer * TRIANGLES_PER_SQUARE * workload.OverdrawLayerCount);
+    GRAPHICS::ScreenSpaceTriangle triangle;
+    triangle.Material = material;
+    triangle.VertexColors = { GRAPHICS::Color::RED, GRAPHICS::Color::GREEN, GRAPHICS::Color::BLUE };
+    for (unsigned int layer_index = 0; layer_index < workload.OverdrawLayerCount; ++layer_index)
+    {
+        // Larger depths are in front.
+        float depth = static_cast<float>(layer_index);
+        for (std::size_t square_index = 0; square_index < squares_per_layer; ++square_index)
+        {
+            float left_x = static_cast<float>(square_index % column_count) * square_width;
+            float top_y = static_cast<float>(square_index / column_count) * square_height;
+            float right_x = left_x + square_width;
+            float bottom_y = top_y + square_height;
+
+            triangle.VertexPositions = { MATH::Vector3f(left_x, top_y, depth), MATH::Vector3f(left_x, bottom_y, depth), MATH::Vector3f(right_x, top_y, depth) };
+            triangles.push_back(triangle);
+            triangle.VertexPositions = { MATH::Vector3f(right_x, top_y, depth), MATH::Vector3f(left_x, bottom_y, depth), MATH::Vector3f(right_x, bottom_y, depth) };
+            triangles.push_back(triangle);
+        }
+    }
+
+    double square_area_in_pixels = static_cast<double>(square_width) * static_cast<double>(square_height);
+    covered_pixel_count = square_area_in_pixels * static_cast<double>(squares_per_layer) * static_cast<double>(workload.OverdrawLayerCount);
+    return triangles;
+}
+
+/// Benchmarks the software rasterizer over synthetic workloads, to provide a baseline
+/// for judging rasterizer optimizations.  Triangles are already in screen-space, so
+/// only rasterization (not vertex transformation or lighting) is measured.
+///
+/// Throughput is reported from the median run time.  Pixel counts are the total area
+/// of all triangles, so they're nominal for tiny triangles (which may not cover any
+/// pixel centers) and don't account for early depth rejection.
+///
+/// Hardware counters (if enabled) are reported per run, averaged across measured runs.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments, starting with the program name.
+/// @return EXIT_SUCCESS if benchmarks were run; EXIT_FAILURE otherwise.
+int main(int argument_count, char* arguments[])
+{
+    // PARSE THE COMMAND LINE.
+    std::vector<std::string_view> command_line_arguments(arguments + std::min(argument_count, 1), arguments + argument_count);
+    std::optional<RasterizerBenchmarkOptions> options = ParseOptions(command_line_arguments);
+    if (!options)
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    // OPEN ANY HARDWARE COUNTERS.
+    std::unique_ptr<BENCHMARKING::HardwareCounters> hardware_counters = nullptr;
+    if (options->HardwareCountersEnabled)
+    {
+        hardware_counters = std::make_unique<BENCHMARKING::HardwareCounters>();
+        if (!hardware_counters->IsAvailable())
+        {
+            std::cerr << "Hardware counters are unavailable on this system, so only timing is reported.\n";
+        }
+    }
+
+    // OPEN ANY CSV FILE.
+    std::ofstream csv_file;
+    if (!options->CsvFilepath.empty())
+    {
+        csv_file.open(options->CsvFilepath);
+        if (!csv_file)
+        {
+            std::cerr << "Failed to open CSV file: " << options->CsvFilepath << "\n";
+            return EXIT_FAILURE;
+        }
+        csv_file <<
+            "sweep,width,height,triangle_leg_pixels,overdraw,shading,depth_test,triangles,pixels,runs,"
+            "min_ns,median_ns,mean_ns,stddev_ns,max_ns,triangles_per_second,pixels_per_second,ns_per_pixel";
+        if (hardware_counters)
+        {
+            BENCHMARKING::HardwareCounters::WriteCsvHeader(csv_file);
+        }
+        csv_file << "\n";
+    }
+
+    // PRINT THE TABLE HEADER.
+    std::cout
+        << std::left
+        << std::setw(14) << "sweep"
+        << std::setw(11) << "resolution"
+        << std::setw(8) << "leg"
+        << std::setw(9) << "overdraw"
+        << std::setw(16) << "shading"
+        << std::setw(7) << "depth"
+        << std::right
+        << std::setw(10) << "triangles"
+        << std::setw(12) << "median_ms"
+        << std::setw(11) << "stddev_%"
+        << std::setw(14) << "Mtriangles/s"
+        << std::setw(12) << "Mpixels/s"
+        << std::setw(10) << "ns/pixel";
+    if (hardware_counters)
+    {
+        BENCHMARKING::HardwareCounters::WriteTableHeader(std::cout);
+    }
+    std::cout << "\n";
+
+    // BENCHMARK EACH WORKLOAD.
+    std::vector<RasterizerWorkload> workloads = CreateWorkloads(options->SweepName);
+    for (const RasterizerWorkload& workload : workloads)
+    {
+        // CREATE THE RENDERING BUFFERS.
+        GRAPHICS::Bitmap render_target(workload.WidthInPixels, workload.HeightInPixels, GRAPHICS::ColorFormat::RGBA);
+        GRAPHICS::DepthBuffer depth_buffer(workload.WidthInPixels, workload.HeightInPixels);
+        GRAPHICS::DepthBuffer* depth_buffer_to_use = workload.DepthTestingEnabled ? &depth_buffer : nullptr;
+
+        // CREATE THE WORKLOAD.
+        std::size_t triangle_count = 0;
+        double covered_pixel_count = 0.0;
+        std::function<void()> rasterize;
+        std::shared_ptr<GRAPHICS::Material> material = CreateMaterial(workload.Shading);
+        std::vector<GRAPHICS::ScreenSpaceTriangle> triangles;
+        GRAPHICS::SoftwareRasterizationAlgorithm::TriangleRasterizer triangle_rasterizer = nullptr;
+        GRAPHICS::SceneDescription stress_scene_description;
+        if (workload.StressScene)
+        {
+            // GENERATE THE STRESS SCENE.
+            GRAPHICS::StressSceneParameters stress_scene_parameters = GRAPHICS::StressSceneParameters::Default(*workload.StressScene);
+            stress_scene_parameters.Seed = options->StressSceneSeed;
+            stress_scene_parameters.TriangleCount = std::min(stress_scene_parameters.TriangleCount, options->MaxTriangleCount);
+            stress_scene_description = GRAPHICS::StressSceneGenerator::Generate(stress_scene_parameters);
+            for (const GRAPHICS::Object3D& object_3D : stress_scene_description.Scene.Objects)
+            {
+                triangle_count += object_3D.Triangles.size();
+            }
+
+            // The whole scene is rendered (including transforming, clipping, and lighting vertices),
+            // so throughput is measured per screen pixel rather than per covered pixel.
+            covered_pixel_count = static_cast<double>(workload.WidthInPixels) * static_cast<double>(workload.HeightInPixels);
+            rasterize = [&]()
+            {
+                GRAPHICS::SoftwareRasterizationAlgorithm::Render(
+                    stress_scene_description.Scene,
+                    stress_scene_description.Camera,
+                    false,
+                    render_target,
+                    depth_buffer_to_use);
+            };
+        }
+        else
+        {
+            // CREATE THE SCREEN-SPACE TRIANGLES.
+            // All triangles share a material, so the rasterizer is selected once like in a real render.
+            triangles = CreateTriangles(workload, material, options->MaxTriangleCount, covered_pixel_count);
+            triangle_count = triangles.size();
+            triangle_rasterizer = GRAPHICS::SoftwareRasterizationAlgorithm::SelectTriangleRasterizer(*material, depth_buffer_to_use);
+            rasterize = [&]()
+            {
+                for (const GRAPHICS::ScreenSpaceTriangle& triangle : triangles)
+                {
+                    triangle_rasterizer(triangle, render_target, depth_buffer_to_use, nullptr);
+                }
+            };
+        }
+
+        // MEASURE RASTERIZING ALL TRIANGLES.
+        // Clearing buffers is done outside of the measured time.
+        if (hardware_counters)
+        {
+            hardware_counters->Reset();
+        }
+        BENCHMARKING::TimingStatistics statistics = BENCHMARKING::Benchmark::Run(
+            options->WarmUpRunCount,
+            options->MeasuredRunCount,
+            rasterize,
+            [&]()
+            {
+                render_target.FillPixels(GRAPHICS::Color::BLACK);
+                depth_buffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+            },
+            hardware_counters.get());
+
+        // COMPUTE THROUGHPUT.
+        constexpr double NANOSECONDS_PER_SECOND = 1e9;
+        double median_time_in_seconds = statistics.MedianTimeInNanoseconds / NANOSECONDS_PER_SECOND;
+        double triangles_per_second = static_cast<double>(triangle_count) / median_time_in_seconds;
+        double pixels_per_second = covered_pixel_count / median_time_in_seconds;
+        double nanoseconds_per_pixel = statistics.MedianTimeInNanoseconds / covered_pixel_count;
+        double relative_standard_deviation_percentage = 100.0 * statistics.StandardDeviationInNanoseconds / statistics.MeanTimeInNanoseconds;
+
+        // REPORT THE RESULTS.
+        std::string resolution = std::to_string(workload.WidthInPixels) + "x" + std::to_string(workload.HeightInPixels);
+        // Stress scenes don't have a single triangle size or overdraw, so their scene type is shown instead.
+        bool full_screen_triangles = (workload.TriangleLegLengthInPixels <= 0.0f);
+        std::ostringstream leg_length;
+        std::ostringstream overdraw;
+        std::string_view shading_type_name = ShadingTypeName(workload.Shading);
+        if (workload.StressScene)
+        {
+            leg_length << "-";
+            overdraw << "-";
+            shading_type_name = GRAPHICS::StressSceneGenerator::TypeName(*workload.StressScene);
+        }
+        else if (full_screen_triangles)
+        {
+            leg_length << "full";
+            overdraw << workload.OverdrawLayerCount;
+        }
+        else
+        {
+            leg_length << workload.TriangleLegLengthInPixels;
+            overdraw << workload.OverdrawLayerCount;
+        }
+        std::string_view depth_test = workload.DepthTestingEnabled ? "on" : "off";
+        constexpr double NANOSECONDS_PER_MILLISECOND = 1e6;
+        constexpr double MILLION = 1e6;
+        std::cout
+            << std::left
+            << std::setw(14) << workload.SweepName
+            << std::setw(11) << resolution
+            << std::setw(8) << leg_length.str()
+            << std::setw(9) << overdraw.str()
+            << std::setw(16) << shading_type_name
+            << std::setw(7) << depth_test
+            << std::right << std::fixed
+            << std::setw(10) << triangle_count
+            << std::setw(12) << std::setprecision(3) << (statistics.MedianTimeInNanoseconds / NANOSECONDS_PER_MILLISECOND)
+            << std::setw(11) << std::setprecision(1) << relative_standard_deviation_percentage
+            << std::setw(14) << std::setprecision(2) << (triangles_per_second / MILLION)
+            << std::setw(12) << std::setprecision(2) << (pixels_per_second / MILLION)
+            << std::setw(10) << std::setprecision(2) << nanoseconds_per_pixel
+            << std::defaultfloat;
+        BENCHMARKING::HardwareCounterValues hardware_counter_values_per_run;
+        if (hardware_counters)
+        {
+            hardware_counter_values_per_run = hardware_counters->GetTotals().DividedBy(static_cast<double>(statistics.RunCount));
+            BENCHMARKING::HardwareCounters::WriteTableColumns(hardware_counter_values_per_run, std::cout);
+        }
+        std::cout << "\n";
+        if (csv_file)
+        {
+            csv_file
+                << workload.SweepName << ","
+                << workload.WidthInPixels << ","
+                << workload.HeightInPixels << ","
+                << leg_length.str() << ","
+                << overdraw.str() << ","
+                << shading_type_name << ","
+                << depth_test << ","
+                << triangle_count << ","
+                << covered_pixel_count << ","
+                << statistics.RunCount << ","
+                << statistics.MinimumTimeInNanoseconds << ","
+                << statistics.MedianTimeInNanoseconds << ","
+                << statistics.MeanTimeInNanoseconds << ","
+                << statistics.StandardDeviationInNanoseconds << ","
+                << statistics.MaximumTimeInNanoseconds << ","
+                << triangles_per_second << ","
+                << pixels_per_second << ","
+                << nanoseconds_per_pixel;
+            if (hardware_counters)
+            {
+                BENCHMARKING::HardwareCounters::WriteCsvColumns(hardware_counter_values_per_run, csv_file);
+            }
+            csv_file << "\n";
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
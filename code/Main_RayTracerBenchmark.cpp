@@ -0,0 +1,821 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Benchmarking/Benchmark.h"
+#include "Benchmarking/HardwareCounters.h"
+#include "Graphics/Bitmap.h"
+#include "Graphics/Camera.h"
+#include "Graphics/Cube.h"
+#include "Graphics/Modeling/WavefrontObjectModel.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/Scene.h"
+#include "Graphics/StressSceneGenerator.h"
+#include "Math/Angle.h"
+
+/// A reference scene for benchmarking, along with the camera to view it.
+struct BenchmarkScene
+{
+    /// The name of the scene.
+    std::string Name = "";
+    /// The scene.
+    GRAPHICS::Scene Scene = {};
+    /// The camera to view the scene.
+    GRAPHICS::Camera Camera = {};
+};
+
+/// A combination of ray tracing features to measure.
+struct RayTracingMode
+{
+    /// The name of the mode.
+    std::string_view Name = "";
+    /// True if shadow rays are traced; false otherwise.
+    bool Shadows = false;
+    /// True if reflection rays are traced; false otherwise.
+    bool Reflections = false;
+};
+
+/// Options for benchmarking, as specified on the command line.
+struct RayTracerBenchmarkOptions
+{
+    /// The width of rendered images in pixels.
+    unsigned int WidthInPixels = 160;
+    /// The height of rendered images in pixels.
+    unsigned int HeightInPixels = 120;
+    /// The number of unmeasured renders before measured renders of each scene and mode.
+    std::size_t WarmUpRunCount = 1;
+    /// The number of measured renders of each scene and mode.
+    std::size_t MeasuredRunCount = 5;
+    /// The path of the .obj model for the medium scene.
+    std::filesystem::path ObjFilepath = "assets/default_cube.obj";
+    /// The folder to cache model geometry in for faster loading, if any.
+    std::filesystem::path MeshCacheFolderPath = "";
+    /// The number of quads along each side of the procedural mesh for the large scene.
+    /// The default (32768 triangles) is larger than any other scene, so it dominates benchmark time
+    /// since every ray is tested against every triangle (without an acceleration structure).
+    unsigned int LargeMeshQuadsPerSide = 128;
+    /// The generated stress scenes to also benchmark: "none", "all", or a single scene type name.
+    std::string StressSceneName = "none";
+    /// The seed for generating stress scenes.
+    uint32_t StressSceneSeed = 1;
+    /// The maximum number of triangles in each stress scene.  Every ray is tested against
+    /// every triangle (without an acceleration structure), so this is much lower than for rasterizing.
+    std::size_t StressSceneMaxTriangleCount = 10000;
+    /// A label to identify results (like a commit ID or machine name).
+    std::string Label = "";
+    /// The path of any JSON file to write results to.
+    std::filesystem::path JsonFilepath = "";
+    /// The path of any CSV file to write results to.
+    std::filesystem::path CsvFilepath = "";
+    /// True if hardware performance counters are measured; false otherwise.
+    bool HardwareCountersEnabled = false;
+};
+
+/// The result of benchmarking a single scene with a single mode.
+struct RayTracerBenchmarkResult
+{
+    /// The name of the scene.
+    std::string SceneName = "";
+    /// The number of triangles in the scene.
+    std::size_t TriangleCount = 0;
+    /// The time to build the scene (including loading or generating meshes).
+    double BuildTimeInMilliseconds = 0.0;
+    /// The name of the ray tracing mode.
+    std::string_view ModeName = "";
+    /// The rays traced for each render.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm::RayCounts RayCounts = {};
+    /// Statistics about render times.
+    BENCHMARKING::TimingStatistics Timing = {};
+    /// The number of millions of rays traced per second, based on the median render time.
+    double MillionRaysPerSecond = 0.0;
+    /// Hardware counter values per render, averaged across measured renders (if measured).
+    BENCHMARKING::HardwareCounterValues HardwareCountersPerRender = {};
+};
+
+/// Prints how to use the program.
+static void PrintUsage()
+{
+    std::cerr <<
+        "Usage: RayTracerBenchmark [options]\n"
+        "Options:\n"
+        "  --width <pixels>                Image width (default 160).\n"
+        "  --height <pixels>               Image height (default 120).\n"
+        "  --warmup <count>                Unmeasured renders per scene and mode (default 1).\n"
+        "  --runs <count>                  Measured renders per scene and mode (default 5).\n"
+        "  --obj <path>                    Model for the medium scene (default assets/default_cube.obj).\n"
+        "  --mesh-cache <folder>           Cache model geometry in binary mesh files for faster loading.\n"
+        "  --large-mesh-size <quads>       Quads per side of the large procedural mesh (default 128).\n"
+        "                                  Each quad is 2 triangles; smaller meshes give quicker runs.\n"
+        "  --stress-scenes <none|all|type> Also benchmark generated stress scenes (default none).\n"
+        "                                  Types: small_triangles, overdraw, instancing, many_lights, reflections.\n"
+        "  --stress-seed <number>          Seed for generating stress scenes (default 1).\n"
+        "  --stress-max-triangles <count>  Maximum triangles per stress scene (default 10000).\n"
+        "  --label <text>                  Label to identify results (like a commit ID).\n"
+        "  --json <path>                   Write results to a JSON file.\n"
+        "  --csv <path>                    Write results to a CSV file.\n"
+        "  --counters <on|off>             Measure hardware performance counters (default off).\n";
+}
+
+/// Parses a number from a command line argument.
+/// @tparam Number - The type of number to parse.
+/// @param[in]  argument - The argument to parse.
+/// @param[out]  number - The parsed number.
+/// @return True if the entire argument was a valid number; false otherwise.
+template <typename Number>
+static bool ParseNumber(const std::string_view argument, Number& number)
+{
+    const char* argument_end = argument.data() + argument.size();
+    std::from_chars_result result = std::from_chars(argument.data(), argument_end, number);
+    bool number_parsed = (std::errc() == result.ec) && (argument_end == result.ptr);
+    return number_parsed;
+}
+
+/// Parses command line arguments.
+/// @param[in]  arguments - The command line arguments, excluding the program name.
+/// @return The options, if all arguments were valid; null otherwise.
+static std::optional<RayTracerBenchmarkOptions> ParseOptions(const std::vector<std::string_view>& arguments)
+{
+    RayTracerBenchmarkOptions options;
+    for (std::size_t argument_index = 0; argument_index < arguments.size(); ++argument_index)
+    {
+        // ALL OPTIONS HAVE VALUES.
+        std::string_view argument = arguments[argument_index];
+        ++argument_index;
+        bool value_exists = (argument_index < arguments.size());
+        if (!value_exists)
+        {
+            return std::nullopt;
+        }
+        std::string_view value = arguments[argument_index];
+
+        bool option_valid = false;
+        if ("--width" == argument)
+        {
+            option_valid = ParseNumber(value, options.WidthInPixels) && (options.WidthInPixels > 0);
+        }
+        else if ("--height" == argument)
+        {
+            option_valid = ParseNumber(value, options.HeightInPixels) && (options.HeightInPixels > 0);
+        }
+        else if ("--warmup" == argument)
+        {
+            option_valid = ParseNumber(value, options.WarmUpRunCount);
+        }
+        else if ("--runs" == argument)
+        {
+            option_valid = ParseNumber(value, options.MeasuredRunCount) && (options.MeasuredRunCount > 0);
+        }
+        else if ("--obj" == argument)
+        {
+            options.ObjFilepath = value;
+            option_valid = true;
+        }
+        else if ("--mesh-cache" == argument)
+        {
+            options.MeshCacheFolderPath = value;
+            option_valid = true;
+        }
+        else if ("--large-mesh-size" == argument)
+        {
+            option_valid = ParseNumber(value, options.LargeMeshQuadsPerSide) && (options.LargeMeshQuadsPerSide > 0);
+        }
+        else if ("--stress-scenes" == argument)
+        {
+            options.StressSceneName = value;
+            option_valid = ("none" == value) || ("all" == value) || GRAPHICS::StressSceneGenerator::TypeFromName(value).has_value();
+        }
+        else if ("--stress-seed" == argument)
+        {
+            option_valid = ParseNumber(value, options.StressSceneSeed);
+        }
+        else if ("--stress-max-triangles" == argument)
+        {
+            option_valid = ParseNumber(value, options.StressSceneMaxTriangleCount) && (options.StressSceneMaxTriangleCount > 0);
+        }
+        else if ("--label" == argument)
+        {
+            options.Label = value;
+            option_valid = true;
+        }
+        else if ("--json" == argument)
+        {
+            options.JsonFilepath = value;
+            option_valid = true;
+        }
+        else if ("--csv" == argument)
+        {
+            options.CsvFilepath = value;
+            option_valid = true;
+        }
+        else if ("--counters" == argument)
+        {
+            options.HardwareCountersEnabled = ("on" == value);
+            option_valid = ("on" == value) || ("off" == value);
+        }
+
+        if (!option_valid)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+/// Creates a material for benchmark scenes.
+/// @param[in]  diffuse_color - The diffuse color of the material.
+/// @param[in]  reflectivity_proportion - How reflective the material is, from [0, 1].
+/// @return The material.
+static std::shared_ptr<GRAPHICS::Material> CreateMaterial(const GRAPHICS::Color& diffuse_color, const float reflectivity_proportion)
+{
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->Shading = GRAPHICS::ShadingType::MATERIAL;
+    material->VertexColors = { diffuse_color, diffuse_color, diffuse_color };
+    material->AmbientColor = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+    material->DiffuseColor = diffuse_color;
+    material->SpecularColor = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f);
+    material->SpecularPower = 20.0f;
+    material->ReflectivityProportion = reflectivity_proportion;
+    return material;
+}
+
+/// Creates a quad made of two triangles.
+/// @param[in]  material - The material of the quad.
+/// @param[in]  corners - The corners of the quad, in counter-clockwise order.
+/// @return The quad.
+static GRAPHICS::Object3D CreateQuad(const std::shared_ptr<GRAPHICS::Material>& material, const std::array<MATH::Vector3f, 4>& corners)
+{
+    GRAPHICS::Object3D quad;
+    quad.Triangles.push_back(GRAPHICS::Triangle(material, { corners[0], corners[1], corners[2] }));
+    quad.Triangles.push_back(GRAPHICS::Triangle(material, { corners[0], corners[2], corners[3] }));
+    return quad;
+}
+
+/// Creates a scene base with a single point light and a perspective camera.
+/// @param[in]  name - The name of the scene.
+/// @param[in]  camera_world_position - The position of the camera.
+/// @param[in]  light_world_position - The position of the light.
+/// @return The scene without any objects.
+static BenchmarkScene CreateEmptyScene(
+    const std::string& name,
+    const MATH::Vector3f& camera_world_position,
+    const MATH::Vector3f& light_world_position)
+{
+    BenchmarkScene benchmark_scene;
+    benchmark_scene.Name = name;
+    benchmark_scene.Scene.BackgroundColor = GRAPHICS::Color(0.1f, 0.1f, 0.2f, 1.0f);
+
+    GRAPHICS::Light light;
+    light.Type = GRAPHICS::LightType::POINT;
+    light.Color = GRAPHICS::Color::WHITE;
+    light.PointLightWorldPosition = light_world_position;
+    benchmark_scene.Scene.PointLights = std::vector<GRAPHICS::Light>{ light };
+
+    benchmark_scene.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), camera_world_position);
+    benchmark_scene.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    benchmark_scene.Camera.FieldOfView = MATH::Angle<float>::Degrees(60.0f);
+    return benchmark_scene;
+}
+
+/// Creates a scene with a single small box on a reflective floor.
+/// @return The scene.
+static std::optional<BenchmarkScene> CreateSmallBoxScene()
+{
+    BenchmarkScene benchmark_scene = CreateEmptyScene("small_box", MATH::Vector3f(0.0f, 1.5f, 3.0f), MATH::Vector3f(2.0f, 4.0f, 3.0f));
+
+    GRAPHICS::Object3D& box = benchmark_scene.Scene.Objects.emplace_back(GRAPHICS::Cube::Create(CreateMaterial(GRAPHICS::Color::RED, 0.0f)));
+    box.RotationInRadians.Y = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(30.0f));
+
+    constexpr float FLOOR_Y = -0.5f;
+    constexpr float FLOOR_HALF_SIZE = 4.0f;
+    constexpr float FLOOR_REFLECTIVITY = 0.5f;
+    benchmark_scene.Scene.Objects.push_back(CreateQuad(
+        CreateMaterial(GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f), FLOOR_REFLECTIVITY),
+        {
+            MATH::Vector3f(-FLOOR_HALF_SIZE, FLOOR_Y, -FLOOR_HALF_SIZE),
+            MATH::Vector3f(-FLOOR_HALF_SIZE, FLOOR_Y, FLOOR_HALF_SIZE),
+            MATH::Vector3f(FLOOR_HALF_SIZE, FLOOR_Y, FLOOR_HALF_SIZE),
+            MATH::Vector3f(FLOOR_HALF_SIZE, FLOOR_Y, -FLOOR_HALF_SIZE)
+        }));
+    return benchmark_scene;
+}
+
+/// Creates a scene with a grid of copies of a slightly reflective .obj model.
+/// @param[in]  obj_filepath - The path of the model.
+/// @param[in]  mesh_cache_folder_path - The folder to cache the model's geometry in, or empty to not cache it.
+/// @return The scene, if the model could be loaded; null otherwise.
+static std::optional<BenchmarkScene> CreateMediumObjScene(const std::filesystem::path& obj_filepath, const std::filesystem::path& mesh_cache_folder_path)
+{
+    // LOAD THE MODEL.
+    bool mesh_cache_write_failed = false;
+    std::optional<GRAPHICS::Object3D> model = GRAPHICS::MODELING::WavefrontObjectModel::Load(
+        obj_filepath,
+        GRAPHICS::MODELING::WavefrontObjectModel::LoadMaterialLibraries,
+        mesh_cache_folder_path,
+        &mesh_cache_write_failed);
+    if (!model)
+    {
+        return std::nullopt;
+    }
+    if (mesh_cache_write_failed)
+    {
+        std::cerr << "Failed to write mesh cache to: " << mesh_cache_folder_path.string() << "\n";
+    }
+
+    // MAKE ALL MATERIALS SLIGHTLY REFLECTIVE.
+    // Materials from .mtl files usually aren't reflective, so this ensures reflection rays are measured.
+    // Each material is only copied once so that triangles sharing materials continue to share them.
+    constexpr float MODEL_REFLECTIVITY = 0.25f;
+    std::shared_ptr<GRAPHICS::Material> default_material = CreateMaterial(GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f), MODEL_REFLECTIVITY);
+    std::unordered_map<const GRAPHICS::Material*, std::shared_ptr<GRAPHICS::Material>> reflective_materials;
+    for (GRAPHICS::Triangle& triangle : model->Triangles)
+    {
+        if (!triangle.Material)
+        {
+            triangle.Material = default_material;
+            continue;
+        }
+
+        std::shared_ptr<GRAPHICS::Material>& reflective_material = reflective_materials[triangle.Material.get()];
+        if (!reflective_material)
+        {
+            reflective_material = std::make_shared<GRAPHICS::Material>(*triangle.Material);
+            reflective_material->ReflectivityProportion = MODEL_REFLECTIVITY;
+        }
+        triangle.Material = reflective_material;
+    }
+
+    // ARRANGE COPIES OF THE MODEL IN A GRID.
+    // Small models (like the default cube) would otherwise be too simple to measure.
+    BenchmarkScene benchmark_scene = CreateEmptyScene("medium_obj", MATH::Vector3f(0.0f, 6.0f, 9.0f), MATH::Vector3f(3.0f, 8.0f, 6.0f));
+    constexpr int COPIES_PER_SIDE = 5;
+    constexpr float COPY_SPACING = 2.5f;
+    for (int z_index = 0; z_index < COPIES_PER_SIDE; ++z_index)
+    {
+        for (int x_index = 0; x_index < COPIES_PER_SIDE; ++x_index)
+        {
+            GRAPHICS::Object3D& copy = benchmark_scene.Scene.Objects.emplace_back(*model);
+            constexpr int HALF_COPIES_PER_SIDE = COPIES_PER_SIDE / 2;
+            copy.WorldPosition = MATH::Vector3f(
+                static_cast<float>(x_index - HALF_COPIES_PER_SIDE) * COPY_SPACING,
+                0.0f,
+                static_cast<float>(z_index - HALF_COPIES_PER_SIDE) * COPY_SPACING);
+        }
+    }
+
+    return benchmark_scene;
+}
+
+/// Creates a scene with a large, slightly reflective procedurally generated height field mesh.
+/// @param[in]  quads_per_side - The number of quads along each side of the mesh.
+/// @return The scene.
+static std::optional<BenchmarkScene> CreateLargeMeshScene(const unsigned int quads_per_side)
+{
+    BenchmarkScene benchmark_scene = CreateEmptyScene("large_mesh", MATH::Vector3f(0.0f, 4.0f, 6.0f), MATH::Vector3f(-2.0f, 6.0f, 2.0f));
+
+    // GENERATE A ROLLING HEIGHT FIELD.
+    constexpr float MESH_SIZE = 8.0f;
+    constexpr float HALF_MESH_SIZE = MESH_SIZE / 2.0f;
+    float quad_size = MESH_SIZE / static_cast<float>(quads_per_side);
+    auto vertex_at = [quad_size](const unsigned int x_index, const unsigned int z_index)
+    {
+        float x = static_cast<float>(x_index) * quad_size - HALF_MESH_SIZE;
+        float z = static_cast<float>(z_index) * quad_size - HALF_MESH_SIZE;
+        float y = 0.5f * std::sin(1.5f * x) * std::cos(1.5f * z);
+        return MATH::Vector3f(x, y, z);
+    };
+    // The mesh is slightly reflective so that reflected rays hitting other parts of it are measured.
+    constexpr float MESH_REFLECTIVITY = 0.25f;
+    std::shared_ptr<GRAPHICS::Material> material = CreateMaterial(GRAPHICS::Color::GREEN, MESH_REFLECTIVITY);
+    GRAPHICS::Object3D& mesh = benchmark_scene.Scene.Objects.emplace_back();
+    mesh.Triangles.reserve(static_cast<std::size_t>(quads_per_side) * quads_per_side * 2);
+    for (unsigned int z_index = 0; z_index < quads_per_side; ++z_index)
+    {
+        for (unsigned int x_index = 0; x_index < quads_per_side; ++x_index)
+        {
+            MATH::Vector3f back_left = vertex_at(x_index, z_index);
+            MATH::Vector3f back_right = vertex_at(x_index + 1, z_index);
+            MATH::Vector3f front_left = vertex_at(x_index, z_index + 1);
+            MATH::Vector3f front_right = vertex_at(x_index + 1, z_index + 1);
+            mesh.Triangles.push_back(GRAPHICS::Triangle(material, { back_left, front_left, front_right }));
+            mesh.Triangles.push_back(GRAPHICS::Triangle(material, { back_left, front_right, back_right }));
+        }
+    }
+    return benchmark_scene;
+}
+
+/// Creates a scene where most rays reflect many times, with a box between facing mirrors.
+/// @return The scene.
+static std::optional<BenchmarkScene> CreateReflectionScene()
+{
+    BenchmarkScene benchmark_scene = CreateEmptyScene("reflections", MATH::Vector3f(0.0f, 0.5f, 3.5f), MATH::Vector3f(0.0f, 2.5f, 2.0f));
+
+    // ADD MIRRORS ON EITHER SIDE AND A REFLECTIVE FLOOR.
+    constexpr float MIRROR_X = 2.0f;
+    constexpr float FLOOR_Y = -1.0f;
+    constexpr float CEILING_Y = 3.0f;
+    constexpr float BACK_Z = -6.0f;
+    constexpr float FRONT_Z = 6.0f;
+    std::shared_ptr<GRAPHICS::Material> mirror_material = CreateMaterial(GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f), 0.9f);
+    benchmark_scene.Scene.Objects.push_back(CreateQuad(
+        mirror_material,
+        {
+            MATH::Vector3f(-MIRROR_X, FLOOR_Y, BACK_Z),
+            MATH::Vector3f(-MIRROR_X, FLOOR_Y, FRONT_Z),
+            MATH::Vector3f(-MIRROR_X, CEILING_Y, FRONT_Z),
+            MATH::Vector3f(-MIRROR_X, CEILING_Y, BACK_Z)
+        }));
+    benchmark_scene.Scene.Objects.push_back(CreateQuad(
+        mirror_material,
+        {
+            MATH::Vector3f(MIRROR_X, FLOOR_Y, FRONT_Z),
+            MATH::Vector3f(MIRROR_X, FLOOR_Y, BACK_Z),
+            MATH::Vector3f(MIRROR_X, CEILING_Y, BACK_Z),
+            MATH::Vector3f(MIRROR_X, CEILING_Y, FRONT_Z)
+        }));
+    benchmark_scene.Scene.Objects.push_back(CreateQuad(
+        CreateMaterial(GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f), 0.5f),
+        {
+            MATH::Vector3f(-MIRROR_X, FLOOR_Y, BACK_Z),
+            MATH::Vector3f(MIRROR_X, FLOOR_Y, BACK_Z),
+            MATH::Vector3f(MIRROR_X, FLOOR_Y, FRONT_Z),
+            MATH::Vector3f(-MIRROR_X, FLOOR_Y, FRONT_Z)
+        }));
+
+    // ADD BOXES BETWEEN THE MIRRORS TO BE REFLECTED.
+    GRAPHICS::Object3D& near_box = benchmark_scene.Scene.Objects.emplace_back(GRAPHICS::Cube::Create(CreateMaterial(GRAPHICS::Color::RED, 0.3f)));
+    near_box.WorldPosition = MATH::Vector3f(-0.6f, -0.5f, 0.0f);
+    near_box.RotationInRadians.Y = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(20.0f));
+    GRAPHICS::Object3D& far_box = benchmark_scene.Scene.Objects.emplace_back(GRAPHICS::Cube::Create(CreateMaterial(GRAPHICS::Color::BLUE, 0.3f)));
+    far_box.WorldPosition = MATH::Vector3f(0.7f, -0.5f, -2.0f);
+    far_box.RotationInRadians.Y = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(45.0f));
+    return benchmark_scene;
+}
+
+/// Creates a procedurally generated stress scene.
+/// @param[in]  type - The type of stress scene.
+/// @param[in]  seed - The seed for generating the scene.
+/// @param[in]  max_triangle_count - The maximum number of triangles in the scene.
+/// @return The scene.
+static std::optional<BenchmarkScene> CreateStressScene(const GRAPHICS::StressSceneType type, const uint32_t seed, const std::size_t max_triangle_count)
+{
+    GRAPHICS::StressSceneParameters parameters = GRAPHICS::StressSceneParameters::Default(type);
+    parameters.Seed = seed;
+    parameters.TriangleCount = std::min(parameters.TriangleCount, max_triangle_count);
+    GRAPHICS::SceneDescription scene_description = GRAPHICS::StressSceneGenerator::Generate(parameters);
+
+    BenchmarkScene benchmark_scene;
+    benchmark_scene.Name = "stress_" + std::string(GRAPHICS::StressSceneGenerator::TypeName(type));
+    benchmark_scene.Scene = std::move(scene_description.Scene);
+    benchmark_scene.Camera = scene_description.Camera;
+    return benchmark_scene;
+}
+
+/// Escapes text for inclusion in a JSON string.
+/// @param[in]  text - The text to escape.
+/// @return The escaped text (without surrounding quotes).
+static std::string EscapeJson(const std::string_view text)
+{
+    std::string escaped_text;
+    for (char character : text)
+    {
+        if ('"' == character || '\\' == character)
+        {
+            escaped_text += '\\';
+            escaped_text += character;
+        }
+        else if (static_cast<unsigned char>(character) < 0x20)
+        {
+            // Control characters aren't expected in labels, so they're simply replaced.
+            escaped_text += ' ';
+        }
+        else
+        {
+            escaped_text += character;
+        }
+    }
+    return escaped_text;
+}
+
+/// Writes results as JSON.
+/// @param[in]  options - The options the benchmarks were run with.
+/// @param[in]  results - The results to write.
+/// @param[in,out]  json_file - The file to write to.
+static void WriteJson(const RayTracerBenchmarkOptions& options, const std::vector<RayTracerBenchmarkResult>& results, std::ostream& json_file)
+{
+    // Numbers are written with fixed precision since large values (like ray throughput or cycle
+    // counts) would otherwise lose precision to scientific notation.
+    std::ios_base::fmtflags original_format_flags = json_file.flags();
+    std::streamsize original_precision = json_file.precision();
+    json_file << std::fixed << std::setprecision(3);
+    json_file
+        << "{\n"
+        << "  \"benchmark\": \"ray_tracer\",\n"
+        << "  \"label\": \"" << EscapeJson(options.Label) << "\",\n"
+        << "  \"hardware_thread_count\": " << std::thread::hardware_concurrency() << ",\n"
+        << "  \"width\": " << options.WidthInPixels << ",\n"
+        << "  \"height\": " << options.HeightInPixels << ",\n"
+        << "  \"warm_up_runs\": " << options.WarmUpRunCount << ",\n"
+        << "  \"measured_runs\": " << options.MeasuredRunCount << ",\n"
+        << "  \"hardware_counters\": " << (options.HardwareCountersEnabled ? "true" : "false") << ",\n"
+        << "  \"results\": [\n";
+    for (std::size_t result_index = 0; result_index < results.size(); ++result_index)
+    {
+        const RayTracerBenchmarkResult& result = results[result_index];
+        bool is_last_result = (result_index + 1 == results.size());
+        json_file
+            << "    {"
+            << "\"scene\": \"" << EscapeJson(result.SceneName) << "\", "
+            << "\"triangles\": " << result.TriangleCount << ", "
+            << "\"build_ms\": " << result.BuildTimeInMilliseconds << ", "
+            << "\"mode\": \"" << result.ModeName << "\", "
+            << "\"primary_rays\": " << result.RayCounts.PrimaryRayCount << ", "
+            << "\"shadow_rays\": " << result.RayCounts.ShadowRayCount << ", "
+            << "\"reflection_rays\": " << result.RayCounts.ReflectionRayCount << ", "
+            << "\"min_ns\": " << result.Timing.MinimumTimeInNanoseconds << ", "
+            << "\"median_ns\": " << result.Timing.MedianTimeInNanoseconds << ", "
+            << "\"mean_ns\": " << result.Timing.MeanTimeInNanoseconds << ", "
+            << "\"stddev_ns\": " << result.Timing.StandardDeviationInNanoseconds << ", "
+            << "\"max_ns\": " << result.Timing.MaximumTimeInNanoseconds << ", "
+            << "\"mrays_per_second\": " << result.MillionRaysPerSecond;
+        if (options.HardwareCountersEnabled)
+        {
+            // Unavailable counters are null.
+            const BENCHMARKING::HardwareCounterValues& counters = result.HardwareCountersPerRender;
+            for (const auto& [counter_name, counter_value] :
+                {
+                    std::pair<std::string_view, std::optional<double>>("cycles", counters.CycleCount),
+                    std::pair<std::string_view, std::optional<double>>("instructions", counters.InstructionCount),
+                    std::pair<std::string_view, std::optional<double>>("ipc", counters.InstructionsPerCycle()),
+                    std::pair<std::string_view, std::optional<double>>("l1d_misses", counters.L1DataCacheMissCount),
+                    std::pair<std::string_view, std::optional<double>>("llc_misses", counters.LastLevelCacheMissCount),
+                    std::pair<std::string_view, std::optional<double>>("branch_mispredictions", counters.BranchMispredictionCount),
+                })
+            {
+                json_file << ", \"" << counter_name << "\": ";
+                if (counter_value)
+                {
+                    json_file << *counter_value;
+                }
+                else
+                {
+                    json_file << "null";
+                }
+            }
+        }
+        json_file << (is_last_result ? "}\n" : "},\n");
+    }
+    json_file
+        << "  ]\n"
+        << "}\n";
+    json_file.flags(original_format_flags);
+    json_file.precision(original_precision);
+}
+
+/// Writes results as CSV.
+/// @param[in]  options - The options the benchmarks were run with.
+/// @param[in]  results - The results to write.
+/// @param[in,out]  csv_file - The file to write to.
+static void WriteCsv(const RayTracerBenchmarkOptions& options, const std::vector<RayTracerBenchmarkResult>& results, std::ostream& csv_file)
+{
+    // Labels are written as-is, so they shouldn't contain commas.
+    // Numbers are written with fixed precision to avoid losing precision to scientific notation.
+    std::ios_base::fmtflags original_format_flags = csv_file.flags();
+    std::streamsize original_precision = csv_file.precision();
+    csv_file << std::fixed << std::setprecision(3);
+    csv_file << "label,width,height,scene,triangles,build_ms,mode,primary_rays,shadow_rays,reflection_rays,min_ns,median_ns,mean_ns,stddev_ns,max_ns,mrays_per_second";
+    if (options.HardwareCountersEnabled)
+    {
+        BENCHMARKING::HardwareCounters::WriteCsvHeader(csv_file);
+    }
+    csv_file << "\n";
+    for (const RayTracerBenchmarkResult& result : results)
+    {
+        csv_file
+            << options.Label << ","
+            << options.WidthInPixels << ","
+            << options.HeightInPixels << ","
+            << result.SceneName << ","
+            << result.TriangleCount << ","
+            << result.BuildTimeInMilliseconds << ","
+            << result.ModeName << ","
+            << result.RayCounts.PrimaryRayCount << ","
+            << result.RayCounts.ShadowRayCount << ","
+            << result.RayCounts.ReflectionRayCount << ","
+            << result.Timing.MinimumTimeInNanoseconds << ","
+            << result.Timing.MedianTimeInNanoseconds << ","
+            << result.Timing.MeanTimeInNanoseconds << ","
+            << result.Timing.StandardDeviationInNanoseconds << ","
+            << result.Timing.MaximumTimeInNanoseconds << ","
+            << result.MillionRaysPerSecond;
+        if (options.HardwareCountersEnabled)
+        {
+            BENCHMARKING::HardwareCounters::WriteCsvColumns(result.HardwareCountersPerRender, csv_file);
+        }
+        csv_file << "\n";
+    }
+    csv_file.flags(original_format_flags);
+    csv_file.precision(original_precision);
+}
+
+/// Benchmarks the ray tracer on a fixed set of reference scenes, with increasing numbers
+/// of ray tracing features enabled, so that runs can be compared across commits and machines.
+///
+/// The ray tracer doesn't yet have an acceleration structure, so the build time is the
+/// time to create each scene (including loading or generating meshes).
+///
+/// Hardware counters (if enabled) are reported per render, averaged across measured renders.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments, starting with the program name.
+/// @return EXIT_SUCCESS if all benchmarks were run; EXIT_FAILURE otherwise.
+int main(int argument_count, char* arguments[])
+{
+    // PARSE THE COMMAND LINE.
+    std::vector<std::string_view> command_line_arguments(arguments + std::min(argument_count, 1), arguments + argument_count);
+    std::optional<RayTracerBenchmarkOptions> options = ParseOptions(command_line_arguments);
+    if (!options)
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    // DEFINE THE SCENES AND MODES.
+    std::vector<std::function<std::optional<BenchmarkScene>()>> scene_builders =
+    {
+        CreateSmallBoxScene,
+        [&options]() { return CreateMediumObjScene(options->ObjFilepath, options->MeshCacheFolderPath); },
+        [&options]() { return CreateLargeMeshScene(options->LargeMeshQuadsPerSide); },
+        CreateReflectionScene
+    };
+    for (std::size_t stress_scene_type_index = 0; stress_scene_type_index < static_cast<std::size_t>(GRAPHICS::StressSceneType::COUNT); ++stress_scene_type_index)
+    {
+        GRAPHICS::StressSceneType stress_scene_type = static_cast<GRAPHICS::StressSceneType>(stress_scene_type_index);
+        bool stress_scene_selected = (
+            ("all" == options->StressSceneName) ||
+            (GRAPHICS::StressSceneGenerator::TypeName(stress_scene_type) == options->StressSceneName));
+        if (stress_scene_selected)
+        {
+            scene_builders.emplace_back([&options, stress_scene_type]()
+            {
+                return CreateStressScene(stress_scene_type, options->StressSceneSeed, options->StressSceneMaxTriangleCount);
+            });
+        }
+    }
+    const std::vector<RayTracingMode> MODES =
+    {
+        RayTracingMode{ .Name = "primary_only", .Shadows = false, .Reflections = false },
+        RayTracingMode{ .Name = "shadows", .Shadows = true, .Reflections = false },
+        RayTracingMode{ .Name = "full_reflections", .Shadows = true, .Reflections = true },
+    };
+
+    // OPEN ANY HARDWARE COUNTERS.
+    std::unique_ptr<BENCHMARKING::HardwareCounters> hardware_counters = nullptr;
+    if (options->HardwareCountersEnabled)
+    {
+        hardware_counters = std::make_unique<BENCHMARKING::HardwareCounters>();
+        if (!hardware_counters->IsAvailable())
+        {
+            std::cerr << "Hardware counters are unavailable on this system, so only timing is reported.\n";
+        }
+    }
+
+    // PRINT THE TABLE HEADER.
+    std::cout
+        << std::left
+        << std::setw(24) << "scene"
+        << std::setw(18) << "mode"
+        << std::right
+        << std::setw(11) << "triangles"
+        << std::setw(11) << "build_ms"
+        << std::setw(12) << "rays"
+        << std::setw(12) << "median_ms"
+        << std::setw(11) << "stddev_%"
+        << std::setw(10) << "Mrays/s";
+    if (hardware_counters)
+    {
+        BENCHMARKING::HardwareCounters::WriteTableHeader(std::cout);
+    }
+    std::cout << "\n";
+
+    // BENCHMARK EACH SCENE.
+    GRAPHICS::Bitmap render_target(options->WidthInPixels, options->HeightInPixels, GRAPHICS::ColorFormat::RGBA);
+    float aspect_ratio_width_over_height = static_cast<float>(options->WidthInPixels) / static_cast<float>(options->HeightInPixels);
+    std::vector<RayTracerBenchmarkResult> results;
+    for (const std::function<std::optional<BenchmarkScene>()>& build_scene : scene_builders)
+    {
+        // BUILD THE SCENE.
+        auto build_start_time = std::chrono::steady_clock::now();
+        std::optional<BenchmarkScene> benchmark_scene = build_scene();
+        std::chrono::duration<double, std::milli> build_time = std::chrono::steady_clock::now() - build_start_time;
+        if (!benchmark_scene)
+        {
+            std::cerr << "Failed to build scene (is the working directory the repository root?)\n";
+            return EXIT_FAILURE;
+        }
+        std::size_t triangle_count = 0;
+        for (const GRAPHICS::Object3D& object_3D : benchmark_scene->Scene.Objects)
+        {
+            triangle_count += object_3D.Triangles.size();
+        }
+        // The viewing plane width is adjusted to avoid stretching non-square images.
+        benchmark_scene->Camera.ViewingPlane.Width = benchmark_scene->Camera.ViewingPlane.Height * aspect_ratio_width_over_height;
+
+        // BENCHMARK EACH MODE.
+        for (const RayTracingMode& mode : MODES)
+        {
+            // MEASURE RENDERING.
+            GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+            ray_tracer.Shadows = mode.Shadows;
+            ray_tracer.Reflections = mode.Reflections;
+            if (hardware_counters)
+            {
+                hardware_counters->Reset();
+            }
+            BENCHMARKING::TimingStatistics timing = BENCHMARKING::Benchmark::Run(
+                options->WarmUpRunCount,
+                options->MeasuredRunCount,
+                [&]() { ray_tracer.Render(benchmark_scene->Scene, benchmark_scene->Camera, render_target); },
+                nullptr,
+                hardware_counters.get());
+
+            // RECORD THE RESULT.
+            // Scenes are static, so every render traces the same rays.
+            constexpr double NANOSECONDS_PER_SECOND = 1e9;
+            constexpr double MILLION = 1e6;
+            RayTracerBenchmarkResult& result = results.emplace_back();
+            result.SceneName = benchmark_scene->Name;
+            result.TriangleCount = triangle_count;
+            result.BuildTimeInMilliseconds = build_time.count();
+            result.ModeName = mode.Name;
+            result.RayCounts = ray_tracer.LastRenderRayCounts;
+            result.Timing = timing;
+            double median_time_in_seconds = timing.MedianTimeInNanoseconds / NANOSECONDS_PER_SECOND;
+            result.MillionRaysPerSecond = static_cast<double>(result.RayCounts.Total()) / median_time_in_seconds / MILLION;
+            if (hardware_counters)
+            {
+                result.HardwareCountersPerRender = hardware_counters->GetTotals().DividedBy(static_cast<double>(timing.RunCount));
+            }
+
+            // PRINT THE RESULT.
+            constexpr double NANOSECONDS_PER_MILLISECOND = 1e6;
+            double relative_standard_deviation_percentage = 100.0 * timing.StandardDeviationInNanoseconds / timing.MeanTimeInNanoseconds;
+            std::cout
+                << std::left
+                << std::setw(24) << result.SceneName
+                << std::setw(18) << result.ModeName
+                << std::right << std::fixed
+                << std::setw(11) << result.TriangleCount
+                << std::setw(11) << std::setprecision(2) << result.BuildTimeInMilliseconds
+                << std::setw(12) << result.RayCounts.Total()
+                << std::setw(12) << std::setprecision(2) << (timing.MedianTimeInNanoseconds / NANOSECONDS_PER_MILLISECOND)
+                << std::setw(11) << std::setprecision(1) << relative_standard_deviation_percentage
+                << std::setw(10) << std::setprecision(3) << result.MillionRaysPerSecond
+                << std::defaultfloat;
+            if (hardware_counters)
+            {
+                BENCHMARKING::HardwareCounters::WriteTableColumns(result.HardwareCountersPerRender, std::cout);
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    // WRITE MACHINE-READABLE RESULTS.
+    if (!options->JsonFilepath.empty())
+    {
+        std::ofstream json_file(options->JsonFilepath);
+        WriteJson(*options, results, json_file);
+        if (!json_file)
+        {
+            std::cerr << "Failed to write JSON file: " << options->JsonFilepath.string() << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+    if (!options->CsvFilepath.empty())
+    {
+        std::ofstream csv_file(options->CsvFilepath);
+        WriteCsv(*options, results, csv_file);
+        if (!csv_file)
+        {
+            std::cerr << "Failed to write CSV file: " << options->CsvFilepath.string() << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -2,8 +2,10 @@
 
 #include <array>
 #include <cmath>
-#include "Containers/Array2D.h"
+#include <type_traits>
+#include "Containers/FixedSizeArray2D.h"
 #include "Math/Angle.h"
+#include "Math/Simd.h"
 #include "Math/Vector3.h"
 #include "Math/Vector4.h"
 
@@ -15,65 +17,88 @@ namespace MATH
     ///
     /// The ElementType template parameter is intended to be replaced with
     /// any numerical type that is typically used for matrices (int, float, etc.).
+    /// Elements are stored inline (without heap allocations), and multiplication
+    /// of float matrices uses SIMD instructions when available.
+    /// Default-constructed matrices have all elements set to zero.
     template <typename ElementType>
     class Matrix4x4
     {
     public:
         // STATIC CONSTANTS.
         /// 4 elements exist per dimension.
-        static const unsigned int ELEMENT_COUNT_PER_DIMENSION = 4;
+        static constexpr unsigned int ELEMENT_COUNT_PER_DIMENSION = 4;
         /// 4 columns exist.
-        static const unsigned int COLUMN_COUNT = ELEMENT_COUNT_PER_DIMENSION;
+        static constexpr unsigned int COLUMN_COUNT = ELEMENT_COUNT_PER_DIMENSION;
         /// 4 rows exist.
-        static const unsigned int ROW_COUNT = ELEMENT_COUNT_PER_DIMENSION;
+        static constexpr unsigned int ROW_COUNT = ELEMENT_COUNT_PER_DIMENSION;
+        /// The total number of elements.
+        static constexpr std::size_t ELEMENT_COUNT = static_cast<std::size_t>(COLUMN_COUNT) * ROW_COUNT;
 
         // CONSTRUCTION.
-        static Matrix4x4 Identity();
-        static Matrix4x4 Translation(const Vector3<ElementType>& translation_vector);
-        static Matrix4x4 Scale(const Vector3<ElementType>& scale_vector);
+        static constexpr Matrix4x4 FromRowMajorElements(const std::array<ElementType, ELEMENT_COUNT>& elements_in_row_major_order);
+        static constexpr Matrix4x4 Identity();
+        static constexpr Matrix4x4 Translation(const Vector3<ElementType>& translation_vector);
+        static constexpr Matrix4x4 Scale(const Vector3<ElementType>& scale_vector);
         static Matrix4x4 RotateX(const typename Angle<ElementType>::Radians angle_in_radians);
         static Matrix4x4 RotateY(const typename Angle<ElementType>::Radians angle_in_radians);
         static Matrix4x4 RotateZ(const typename Angle<ElementType>::Radians angle_in_radians);
-        static Matrix4x4 Rotation(const typename Vector3< typename Angle<ElementType>::Radians >& angles_in_radians);
+        static Matrix4x4 Rotation(const Vector3< typename Angle<ElementType>::Radians >& angles_in_radians);
 
         // OPERATORS.
-        Matrix4x4 operator* (const Matrix4x4& rhs) const;
+        constexpr bool operator== (const Matrix4x4& rhs) const = default;
+        constexpr Matrix4x4 operator* (const Matrix4x4& rhs) const;
         Vector4<ElementType> operator* (const Vector4<ElementType>& vector) const;
 
         // ELEMENT RETRIEVAL.
-        const ElementType* ElementsInRowMajorOrder() const;
+        constexpr const ElementType* ElementsInRowMajorOrder() const;
 
         // ELEMENT SETTING.
-        void SetRow(const unsigned int row_index, const Vector3<ElementType>& vector);
+        constexpr void SetRow(const unsigned int row_index, const Vector3<ElementType>& vector);
 
         // MEMBER VARIABLES.
-        /// The underlying 4x4 array of elements.
-        CONTAINERS::Array2D<ElementType> Elements = CONTAINERS::Array2D<ElementType>(COLUMN_COUNT, ROW_COUNT);
+        /// The underlying 4x4 array of elements, accessed by (column, row).
+        CONTAINERS::FixedSizeArray2D<ElementType, COLUMN_COUNT, ROW_COUNT> Elements = {};
     };
 
     // DEFINE COMMON MATRIX4 TYPES.
     /// A 4x4 matrix composed of float components.
     typedef Matrix4x4<float> Matrix4x4f;
 
+    /// Creates a matrix with the specified elements.
+    /// @param[in]  elements_in_row_major_order - The elements of the matrix
+    ///     (each row's values before the next row).
+    /// @return The matrix with the specified elements.
+    template <typename ElementType>
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::FromRowMajorElements(const std::array<ElementType, ELEMENT_COUNT>& elements_in_row_major_order)
+    {
+        Matrix4x4<ElementType> matrix;
+
+        // COPY OVER ALL ELEMENTS.
+        std::size_t element_index = 0;
+        for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+        {
+            for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
+            {
+                matrix.Elements(column_index, row_index) = elements_in_row_major_order[element_index];
+                ++element_index;
+            }
+        }
+
+        return matrix;
+    }
+
     /// Creates an identity matrix.
     /// @return An identity matrix.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::Identity()
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Identity()
     {
-        // CREATE IDENTITY MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> identity_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT, 
-            ROW_COUNT,
+        Matrix4x4<ElementType> identity_matrix = FromRowMajorElements(
             {
                 1, 0, 0, 0,
                 0, 1, 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1
             });
-
-        // RETURN THE MATRIX.
-        Matrix4x4<ElementType> identity_matrix;
-        identity_matrix.Elements = identity_elements;
         return identity_matrix;
     }
 
@@ -81,22 +106,15 @@ namespace MATH
     /// @param[in]  translation_vector - The vector defining the translation amount.
     /// @return The translation matrix for the provided vector.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::Translation(const Vector3<ElementType>& translation_vector)
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Translation(const Vector3<ElementType>& translation_vector)
     {
-        // CREATE TRANSLATION MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> translation_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        Matrix4x4<ElementType> translation_matrix = FromRowMajorElements(
             {
                 1, 0, 0, translation_vector.X,
                 0, 1, 0, translation_vector.Y,
                 0, 0, 1, translation_vector.Z,
                 0, 0, 0, 1
             });
-
-        // RETURN THE MATRIX.
-        Matrix4x4<ElementType> translation_matrix;
-        translation_matrix.Elements = translation_elements;
         return translation_matrix;
     }
 
@@ -104,22 +122,15 @@ namespace MATH
     /// @param[in]  scale_vector - The vector defining the scaling amount.
     /// @return The scale matrix for the provided vector.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::Scale(const Vector3<ElementType>& scale_vector)
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::Scale(const Vector3<ElementType>& scale_vector)
     {
-        // CREATE SCALE MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> scale_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        Matrix4x4<ElementType> scale_matrix = FromRowMajorElements(
             {
                 scale_vector.X, 0, 0, 0,
                 0, scale_vector.Y, 0, 0,
                 0, 0, scale_vector.Z, 0,
                 0, 0, 0, 1
             });
-
-        // RETURN THE MATRIX.
-        Matrix4x4<ElementType> scale_matrix;
-        scale_matrix.Elements = scale_elements;
         return scale_matrix;
     }
 
@@ -129,20 +140,13 @@ namespace MATH
     template <typename ElementType>
     Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateX(const typename Angle<ElementType>::Radians angle_in_radians)
     {
-        // CREATE ROTATION MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> rotation_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        Matrix4x4<ElementType> rotation_matrix = FromRowMajorElements(
             {
                 1, 0, 0, 0,
                 0, cos(angle_in_radians.Value), -sin(angle_in_radians.Value), 0,
                 0, sin(angle_in_radians.Value), cos(angle_in_radians.Value), 0,
                 0, 0, 0, 1
             });
-
-        // RETURN THE MATRIX.
-        Matrix4x4<ElementType> rotation_matrix;
-        rotation_matrix.Elements = rotation_elements;
         return rotation_matrix;
     }
 
@@ -152,20 +156,13 @@ namespace MATH
     template <typename ElementType>
     Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateY(const typename Angle<ElementType>::Radians angle_in_radians)
     {
-        // CREATE ROTATION MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> rotation_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        Matrix4x4<ElementType> rotation_matrix = FromRowMajorElements(
             {
                 cos(angle_in_radians.Value), 0, sin(angle_in_radians.Value), 0,
                 0, 1, 0, 0,
                 -sin(angle_in_radians.Value), 0, cos(angle_in_radians.Value), 0,
                 0, 0, 0, 1
             });
-
-        // RETURN THE MATRIX.
-        Matrix4x4<ElementType> rotation_matrix;
-        rotation_matrix.Elements = rotation_elements;
         return rotation_matrix;
     }
 
@@ -175,20 +172,13 @@ namespace MATH
     template <typename ElementType>
     Matrix4x4<ElementType> Matrix4x4<ElementType>::RotateZ(const typename Angle<ElementType>::Radians angle_in_radians)
     {
-        // CREATE ROTATION MATRIX ELEMENTS.
-        CONTAINERS::Array2D<ElementType> rotation_elements = CONTAINERS::Array2D<ElementType>(
-            COLUMN_COUNT,
-            ROW_COUNT,
+        Matrix4x4<ElementType> rotation_matrix = FromRowMajorElements(
             {
                 cos(angle_in_radians.Value), -sin(angle_in_radians.Value), 0, 0,
                 sin(angle_in_radians.Value), cos(angle_in_radians.Value), 0, 0,
                 0, 0, 1, 0,
                 0, 0, 0, 1
             });
-
-        // RETURN THE MATRIX.
-        Matrix4x4<ElementType> rotation_matrix;
-        rotation_matrix.Elements = rotation_elements;
         return rotation_matrix;
     }
 
@@ -196,7 +186,7 @@ namespace MATH
     /// @param[in]  angles_in_radians - The rotation angles across the 3 primary axes.
     /// @return The specified rotation matrix about the primary axes.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::Rotation(const typename Vector3< typename Angle<ElementType>::Radians >& angles_in_radians)
+    Matrix4x4<ElementType> Matrix4x4<ElementType>::Rotation(const Vector3< typename Angle<ElementType>::Radians >& angles_in_radians)
     {
         MATH::Matrix4x4<ElementType> x_rotation_matrix = RotateX(angles_in_radians.X);
         MATH::Matrix4x4<ElementType> y_rotation_matrix = RotateY(angles_in_radians.Y);
@@ -217,42 +207,58 @@ namespace MATH
     /// @param[in]  rhs - The matrix to multiply on the right-hand side.
     /// @return The product of the matrix multiplication.
     template <typename ElementType>
-    Matrix4x4<ElementType> Matrix4x4<ElementType>::operator* (const Matrix4x4<ElementType>& rhs) const
+    constexpr Matrix4x4<ElementType> Matrix4x4<ElementType>::operator* (const Matrix4x4<ElementType>& rhs) const
     {
         Matrix4x4<ElementType> matrix_product;
 
+#if MATH_SIMD_SSE2
+        // COMPUTE THE PRODUCT USING SIMD IF POSSIBLE.
+        // SIMD intrinsics can't be used in constant expressions.
+        if constexpr (std::is_same_v<ElementType, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // LOAD THE ROWS OF THE RIGHT-HAND SIDE.
+                // Elements are stored in row-major order and aligned, so each row can be directly loaded.
+                const float* rhs_elements = rhs.ElementsInRowMajorOrder();
+                __m128 rhs_row_0 = _mm_load_ps(rhs_elements + (0 * COLUMN_COUNT));
+                __m128 rhs_row_1 = _mm_load_ps(rhs_elements + (1 * COLUMN_COUNT));
+                __m128 rhs_row_2 = _mm_load_ps(rhs_elements + (2 * COLUMN_COUNT));
+                __m128 rhs_row_3 = _mm_load_ps(rhs_elements + (3 * COLUMN_COUNT));
+
+                // COMPUTE EACH ROW OF THE PRODUCT.
+                // Each row of the product is a combination of the right-hand side's rows,
+                // weighted by the elements in the corresponding row of the left-hand side.
+                // Terms are added in the same order as the scalar computation below for identical results.
+                float* product_elements = matrix_product.Elements.ValuesInRowMajorOrder();
+                for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
+                {
+                    __m128 product_row = _mm_mul_ps(_mm_set1_ps(this->Elements(0, row_index)), rhs_row_0);
+                    product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(this->Elements(1, row_index)), rhs_row_1));
+                    product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(this->Elements(2, row_index)), rhs_row_2));
+                    product_row = _mm_add_ps(product_row, _mm_mul_ps(_mm_set1_ps(this->Elements(3, row_index)), rhs_row_3));
+                    _mm_store_ps(product_elements + (row_index * COLUMN_COUNT), product_row);
+                }
+
+                return matrix_product;
+            }
+        }
+#endif
+
         // COMPUTE PRODUCT ELEMENT VALUES FOR EACH ROW.
         for (unsigned int row_index = 0; row_index < ROW_COUNT; ++row_index)
         {
-            // GET THE CURRENT ROW VALUES FOR THE LEFT-HAND SIDE OF THE PRODUCT ELEMENT BEING COMPUTED.
-            std::array<ElementType, 4> lhs_row =
-            { 
-                this->Elements(0, row_index),
-                this->Elements(1, row_index),
-                this->Elements(2, row_index),
-                this->Elements(3, row_index)
-            };
-
             // COMPUTE PRODUCT ELEMENT VALUES FOR EACH COLUMN.
             for (unsigned int column_index = 0; column_index < COLUMN_COUNT; ++column_index)
             {
-                // GET THE CURRENT COLUMN VALUES FOR THE RIGHT-HAND SIDE OF THE PRODUCT ELEMENT BEING COMPUTED.
-                std::array<ElementType, 4> rhs_column =
-                {
-                    rhs.Elements(column_index, 0),
-                    rhs.Elements(column_index, 1),
-                    rhs.Elements(column_index, 2),
-                    rhs.Elements(column_index, 3)
-                };
-
                 // COMPUTE THE PRODUCT VALUE AT THE CURRENT ROW/COLUMN.
                 // The matrix elements are arranged by x, y (column, row),
                 // which makes this a bit unintuitive for matrix math.
                 matrix_product.Elements(column_index, row_index) =
-                    (lhs_row[0] * rhs_column[0]) +
-                    (lhs_row[1] * rhs_column[1]) +
-                    (lhs_row[2] * rhs_column[2]) +
-                    (lhs_row[3] * rhs_column[3]);
+                    (this->Elements(0, row_index) * rhs.Elements(column_index, 0)) +
+                    (this->Elements(1, row_index) * rhs.Elements(column_index, 1)) +
+                    (this->Elements(2, row_index) * rhs.Elements(column_index, 2)) +
+                    (this->Elements(3, row_index) * rhs.Elements(column_index, 3));
             }
         }
 
@@ -267,41 +273,72 @@ namespace MATH
     {
         Vector4<ElementType> transformed_vector;
 
-        // CALCULATE THE X COMPONENT OF THE VECTOR.
-        const unsigned int ROW_1 = 0;
-        const unsigned int COLUMN_1 = 0;
-        const unsigned int COLUMN_2 = 1;
-        const unsigned int COLUMN_3 = 2;
-        const unsigned int COLUMN_4 = 3;
-        transformed_vector.X =
-            (this->Elements(COLUMN_1, ROW_1) * vector.X) +
-            (this->Elements(COLUMN_2, ROW_1) * vector.Y) +
-            (this->Elements(COLUMN_3, ROW_1) * vector.Z) +
-            (this->Elements(COLUMN_4, ROW_1) * vector.W);
-
-        // CALCULATE THE Y COMPONENT OF THE VECTOR.
-        const unsigned int ROW_2 = 1;
-        transformed_vector.Y =
-            (this->Elements(COLUMN_1, ROW_2) * vector.X) +
-            (this->Elements(COLUMN_2, ROW_2) * vector.Y) +
-            (this->Elements(COLUMN_3, ROW_2) * vector.Z) +
-            (this->Elements(COLUMN_4, ROW_2) * vector.W);
-
-        // CALCULATE THE Z COMPONENT OF THE VECTOR.
-        const unsigned int ROW_3 = 2;
-        transformed_vector.Z =
-            (this->Elements(COLUMN_1, ROW_3) * vector.X) +
-            (this->Elements(COLUMN_2, ROW_3) * vector.Y) +
-            (this->Elements(COLUMN_3, ROW_3) * vector.Z) +
-            (this->Elements(COLUMN_4, ROW_3) * vector.W);
-
-        // CALCULATE THE W COMPONENT OF THE VECTOR.
-        const unsigned int ROW_4 = 3;
-        transformed_vector.W =
-            (this->Elements(COLUMN_1, ROW_4) * vector.X) +
-            (this->Elements(COLUMN_2, ROW_4) * vector.Y) +
-            (this->Elements(COLUMN_3, ROW_4) * vector.Z) +
-            (this->Elements(COLUMN_4, ROW_4) * vector.W);
+#if MATH_SIMD_SSE2
+        // COMPUTE THE PRODUCT USING SIMD IF POSSIBLE.
+        if constexpr (std::is_same_v<ElementType, float>)
+        {
+            // GET THE COLUMNS OF THIS MATRIX.
+            // Elements are stored in row-major order, so rows are loaded and transposed.
+            const float* elements = ElementsInRowMajorOrder();
+            __m128 column_0 = _mm_load_ps(elements + (0 * COLUMN_COUNT));
+            __m128 column_1 = _mm_load_ps(elements + (1 * COLUMN_COUNT));
+            __m128 column_2 = _mm_load_ps(elements + (2 * COLUMN_COUNT));
+            __m128 column_3 = _mm_load_ps(elements + (3 * COLUMN_COUNT));
+            _MM_TRANSPOSE4_PS(column_0, column_1, column_2, column_3);
+
+            // COMBINE THE COLUMNS WEIGHTED BY EACH VECTOR COMPONENT.
+            // Terms are added in the same order as the scalar computation below for identical results.
+            __m128 transformed_components = _mm_mul_ps(column_0, _mm_set1_ps(vector.X));
+            transformed_components = _mm_add_ps(transformed_components, _mm_mul_ps(column_1, _mm_set1_ps(vector.Y)));
+            transformed_components = _mm_add_ps(transformed_components, _mm_mul_ps(column_2, _mm_set1_ps(vector.Z)));
+            transformed_components = _mm_add_ps(transformed_components, _mm_mul_ps(column_3, _mm_set1_ps(vector.W)));
+
+            alignas(16) std::array<float, ELEMENT_COUNT_PER_DIMENSION> transformed_component_values;
+            _mm_store_ps(transformed_component_values.data(), transformed_components);
+            transformed_vector.X = transformed_component_values[0];
+            transformed_vector.Y = transformed_component_values[1];
+            transformed_vector.Z = transformed_component_values[2];
+            transformed_vector.W = transformed_component_values[3];
+        }
+        else
+#endif
+        {
+            // CALCULATE THE X COMPONENT OF THE VECTOR.
+            const unsigned int ROW_1 = 0;
+            const unsigned int COLUMN_1 = 0;
+            const unsigned int COLUMN_2 = 1;
+            const unsigned int COLUMN_3 = 2;
+            const unsigned int COLUMN_4 = 3;
+            transformed_vector.X =
+                (this->Elements(COLUMN_1, ROW_1) * vector.X) +
+                (this->Elements(COLUMN_2, ROW_1) * vector.Y) +
+                (this->Elements(COLUMN_3, ROW_1) * vector.Z) +
+                (this->Elements(COLUMN_4, ROW_1) * vector.W);
+
+            // CALCULATE THE Y COMPONENT OF THE VECTOR.
+            const unsigned int ROW_2 = 1;
+            transformed_vector.Y =
+                (this->Elements(COLUMN_1, ROW_2) * vector.X) +
+                (this->Elements(COLUMN_2, ROW_2) * vector.Y) +
+                (this->Elements(COLUMN_3, ROW_2) * vector.Z) +
+                (this->Elements(COLUMN_4, ROW_2) * vector.W);
+
+            // CALCULATE THE Z COMPONENT OF THE VECTOR.
+            const unsigned int ROW_3 = 2;
+            transformed_vector.Z =
+                (this->Elements(COLUMN_1, ROW_3) * vector.X) +
+                (this->Elements(COLUMN_2, ROW_3) * vector.Y) +
+                (this->Elements(COLUMN_3, ROW_3) * vector.Z) +
+                (this->Elements(COLUMN_4, ROW_3) * vector.W);
+
+            // CALCULATE THE W COMPONENT OF THE VECTOR.
+            const unsigned int ROW_4 = 3;
+            transformed_vector.W =
+                (this->Elements(COLUMN_1, ROW_4) * vector.X) +
+                (this->Elements(COLUMN_2, ROW_4) * vector.Y) +
+                (this->Elements(COLUMN_3, ROW_4) * vector.Z) +
+                (this->Elements(COLUMN_4, ROW_4) * vector.W);
+        }
 
         return transformed_vector;
     }
@@ -310,7 +347,7 @@ namespace MATH
     /// (each row's values before the next row).
     /// @return The element values in row-major order.
     template <typename ElementType>
-    const ElementType* Matrix4x4<ElementType>::ElementsInRowMajorOrder() const
+    constexpr const ElementType* Matrix4x4<ElementType>::ElementsInRowMajorOrder() const
     {
         return Elements.ValuesInRowMajorOrder();
     }
@@ -319,7 +356,7 @@ namespace MATH
     /// The 4th element is left unchanged.
     /// @param[in]  vector - The values for the 1st 3 elements in the row.
     template <typename ElementType>
-    void Matrix4x4<ElementType>::SetRow(const unsigned int row_index, const Vector3<ElementType>& vector)
+    constexpr void Matrix4x4<ElementType>::SetRow(const unsigned int row_index, const Vector3<ElementType>& vector)
     {
         // SET THE FIRST 3 ELEMENTS IN THE ROW.
         // X, Y, and Z ordering is based on intuitive understanding.
@@ -327,4 +364,4 @@ namespace MATH
         Elements(1, row_index) = vector.Y;
         Elements(2, row_index) = vector.Z;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+/// @file
+/// Detects which SIMD instruction sets can be used by code in this project.
+///
+/// SSE2 is guaranteed on all x64 processors, but MSVC doesn't define __SSE2__ for x64,
+/// so both compiler conventions are checked.  Defining MATH_SIMD_DISABLED before
+/// including this file (or on the command line) forces the scalar code paths,
+/// which is useful for comparing results or performance.
+
+#if !defined(MATH_SIMD_DISABLED) && (defined(_M_X64) || defined(__SSE2__))
+    /// 1 if SSE2 intrinsics are available; 0 otherwise.
+    #define MATH_SIMD_SSE2 1
+    #include <emmintrin.h>
+#else
+    /// 1 if SSE2 intrinsics are available; 0 otherwise.
+    #define MATH_SIMD_SSE2 0
+#endif
@@ -0,0 +1,299 @@
+#include <cmath>
+#include "Math/Simd.h"
+#include "Math/Vector3Batch.h"
+
+namespace MATH
+{
+    /// Creates a batch holding copies of the provided vectors.
+    /// @param[in]  vectors - The vectors to copy into the batch.
+    /// @return A batch with the provided vectors (in the same order).
+    Vector3Batch Vector3Batch::FromVectors(const std::vector<Vector3f>& vectors)
+    {
+        Vector3Batch batch(vectors.size());
+        for (std::size_t vector_index = 0; vector_index < vectors.size(); ++vector_index)
+        {
+            batch.Set(vector_index, vectors[vector_index]);
+        }
+        return batch;
+    }
+
+    /// Constructor.
+    /// @param[in]  vector_count - The number of (initially zero) vectors in the batch.
+    Vector3Batch::Vector3Batch(const std::size_t vector_count) :
+        Xs(vector_count),
+        Ys(vector_count),
+        Zs(vector_count)
+    {}
+
+    /// Gets the number of vectors in the batch.
+    /// @return The number of vectors.
+    std::size_t Vector3Batch::Count() const
+    {
+        return Xs.size();
+    }
+
+    /// Resizes the batch to hold the specified number of vectors.
+    /// Any newly added vectors are zero vectors.
+    /// @param[in]  vector_count - The new number of vectors in the batch.
+    void Vector3Batch::Resize(const std::size_t vector_count)
+    {
+        Xs.resize(vector_count);
+        Ys.resize(vector_count);
+        Zs.resize(vector_count);
+    }
+
+    /// Gets a copy of a single vector in the batch.
+    /// @param[in]  vector_index - The index of the vector to get.  Must be less than Count().
+    /// @return The vector at the specified index.
+    Vector3f Vector3Batch::Get(const std::size_t vector_index) const
+    {
+        return Vector3f(Xs[vector_index], Ys[vector_index], Zs[vector_index]);
+    }
+
+    /// Sets a single vector in the batch.
+    /// @param[in]  vector_index - The index of the vector to set.  Must be less than Count().
+    /// @param[in]  vector - The new value of the vector.
+    void Vector3Batch::Set(const std::size_t vector_index, const Vector3f& vector)
+    {
+        Xs[vector_index] = vector.X;
+        Ys[vector_index] = vector.Y;
+        Zs[vector_index] = vector.Z;
+    }
+
+    /// Normalizes all vectors to be unit length, like Vector3f::Normalize().
+    /// @param[in]  vectors - The vectors to normalize.
+    /// @param[out] normalized_vectors - The normalized vectors.  Zero vectors remain zero vectors.
+    void Vector3Batch::Normalize(const Vector3Batch& vectors, Vector3Batch& normalized_vectors)
+    {
+        const std::size_t vector_count = vectors.Count();
+        normalized_vectors.Resize(vector_count);
+
+        std::size_t vector_index = 0;
+
+#if MATH_SIMD_SSE2
+        // NORMALIZE GROUPS OF 4 VECTORS AT A TIME.
+        const __m128 ZERO = _mm_setzero_ps();
+        constexpr std::size_t VECTORS_PER_GROUP = 4;
+        for (; vector_index + VECTORS_PER_GROUP <= vector_count; vector_index += VECTORS_PER_GROUP)
+        {
+            // COMPUTE THE LENGTHS OF THE VECTORS.
+            __m128 xs = _mm_loadu_ps(vectors.Xs.data() + vector_index);
+            __m128 ys = _mm_loadu_ps(vectors.Ys.data() + vector_index);
+            __m128 zs = _mm_loadu_ps(vectors.Zs.data() + vector_index);
+            __m128 lengths_squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, xs), _mm_mul_ps(ys, ys)), _mm_mul_ps(zs, zs));
+            __m128 lengths = _mm_sqrt_ps(lengths_squared);
+
+            // DIVIDE EACH VECTOR BY ITS LENGTH.
+            // Zero-length vectors would be divided by zero, so they're masked back to zero.
+            __m128 zero_length_mask = _mm_cmpeq_ps(lengths, ZERO);
+            _mm_storeu_ps(normalized_vectors.Xs.data() + vector_index, _mm_andnot_ps(zero_length_mask, _mm_div_ps(xs, lengths)));
+            _mm_storeu_ps(normalized_vectors.Ys.data() + vector_index, _mm_andnot_ps(zero_length_mask, _mm_div_ps(ys, lengths)));
+            _mm_storeu_ps(normalized_vectors.Zs.data() + vector_index, _mm_andnot_ps(zero_length_mask, _mm_div_ps(zs, lengths)));
+        }
+#endif
+
+        // NORMALIZE ANY REMAINING VECTORS INDIVIDUALLY.
+        for (; vector_index < vector_count; ++vector_index)
+        {
+            Vector3f normalized_vector = Vector3f::Normalize(vectors.Get(vector_index));
+            normalized_vectors.Set(vector_index, normalized_vector);
+        }
+    }
+
+    /// Normalizes all vectors to be approximately unit length, trading a small amount
+    /// of accuracy for speed.  When SIMD is available, a hardware reciprocal square root
+    /// estimate (relative error at most 1.5 * 2^-12) is refined with a single Newton-Raphson
+    /// iteration, which leaves each component within a relative error of roughly 2^-20
+    /// (about 1e-6) of the result of Normalize().  That is well below what is visible
+    /// when shading but means results should not be compared exactly.
+    /// @param[in]  vectors - The vectors to normalize.
+    /// @param[out] normalized_vectors - The normalized vectors.  Zero vectors remain zero vectors.
+    void Vector3Batch::FastNormalize(const Vector3Batch& vectors, Vector3Batch& normalized_vectors)
+    {
+        const std::size_t vector_count = vectors.Count();
+        normalized_vectors.Resize(vector_count);
+
+        std::size_t vector_index = 0;
+
+#if MATH_SIMD_SSE2
+        // NORMALIZE GROUPS OF 4 VECTORS AT A TIME.
+        const __m128 ZERO = _mm_setzero_ps();
+        const __m128 HALF = _mm_set1_ps(0.5f);
+        const __m128 THREE_HALVES = _mm_set1_ps(1.5f);
+        constexpr std::size_t VECTORS_PER_GROUP = 4;
+        for (; vector_index + VECTORS_PER_GROUP <= vector_count; vector_index += VECTORS_PER_GROUP)
+        {
+            // ESTIMATE THE RECIPROCAL LENGTHS OF THE VECTORS.
+            __m128 xs = _mm_loadu_ps(vectors.Xs.data() + vector_index);
+            __m128 ys = _mm_loadu_ps(vectors.Ys.data() + vector_index);
+            __m128 zs = _mm_loadu_ps(vectors.Zs.data() + vector_index);
+            __m128 lengths_squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, xs), _mm_mul_ps(ys, ys)), _mm_mul_ps(zs, zs));
+            __m128 reciprocal_lengths = _mm_rsqrt_ps(lengths_squared);
+
+            // REFINE THE ESTIMATES.
+            // A Newton-Raphson iteration for 1/sqrt(a) is y' = y * (1.5 - 0.5 * a * y * y).
+            __m128 half_lengths_squared_times_estimate_squared = _mm_mul_ps(
+                _mm_mul_ps(HALF, lengths_squared),
+                _mm_mul_ps(reciprocal_lengths, reciprocal_lengths));
+            reciprocal_lengths = _mm_mul_ps(reciprocal_lengths, _mm_sub_ps(THREE_HALVES, half_lengths_squared_times_estimate_squared));
+
+            // SCALE EACH VECTOR BY ITS RECIPROCAL LENGTH.
+            // The estimate for zero-length vectors is infinite, so they're masked back to zero.
+            __m128 zero_length_mask = _mm_cmpeq_ps(lengths_squared, ZERO);
+            _mm_storeu_ps(normalized_vectors.Xs.data() + vector_index, _mm_andnot_ps(zero_length_mask, _mm_mul_ps(xs, reciprocal_lengths)));
+            _mm_storeu_ps(normalized_vectors.Ys.data() + vector_index, _mm_andnot_ps(zero_length_mask, _mm_mul_ps(ys, reciprocal_lengths)));
+            _mm_storeu_ps(normalized_vectors.Zs.data() + vector_index, _mm_andnot_ps(zero_length_mask, _mm_mul_ps(zs, reciprocal_lengths)));
+        }
+#endif
+
+        // NORMALIZE ANY REMAINING VECTORS INDIVIDUALLY.
+        // There's no faster scalar approximation worth using, so these are normalized exactly.
+        for (; vector_index < vector_count; ++vector_index)
+        {
+            Vector3f normalized_vector = Vector3f::Normalize(vectors.Get(vector_index));
+            normalized_vectors.Set(vector_index, normalized_vector);
+        }
+    }
+
+    /// Computes the dot products between corresponding vectors in 2 batches.
+    /// @param[in]  vectors_1 - One set of vectors to use in the dot products.
+    /// @param[in]  vectors_2 - Another set of vectors to use in the dot products.
+    ///     Must have the same number of vectors as the first batch.
+    /// @param[out] dot_products - The dot product for each pair of vectors.
+    void Vector3Batch::DotProduct(const Vector3Batch& vectors_1, const Vector3Batch& vectors_2, std::vector<float>& dot_products)
+    {
+        const std::size_t vector_count = vectors_1.Count();
+        dot_products.resize(vector_count);
+
+        std::size_t vector_index = 0;
+
+#if MATH_SIMD_SSE2
+        // COMPUTE DOT PRODUCTS FOR GROUPS OF 4 VECTORS AT A TIME.
+        constexpr std::size_t VECTORS_PER_GROUP = 4;
+        for (; vector_index + VECTORS_PER_GROUP <= vector_count; vector_index += VECTORS_PER_GROUP)
+        {
+            __m128 x_products = _mm_mul_ps(_mm_loadu_ps(vectors_1.Xs.data() + vector_index), _mm_loadu_ps(vectors_2.Xs.data() + vector_index));
+            __m128 y_products = _mm_mul_ps(_mm_loadu_ps(vectors_1.Ys.data() + vector_index), _mm_loadu_ps(vectors_2.Ys.data() + vector_index));
+            __m128 z_products = _mm_mul_ps(_mm_loadu_ps(vectors_1.Zs.data() + vector_index), _mm_loadu_ps(vectors_2.Zs.data() + vector_index));
+            __m128 group_dot_products = _mm_add_ps(_mm_add_ps(x_products, y_products), z_products);
+            _mm_storeu_ps(dot_products.data() + vector_index, group_dot_products);
+        }
+#endif
+
+        // COMPUTE DOT PRODUCTS FOR ANY REMAINING VECTORS INDIVIDUALLY.
+        for (; vector_index < vector_count; ++vector_index)
+        {
+            dot_products[vector_index] = Vector3f::DotProduct(vectors_1.Get(vector_index), vectors_2.Get(vector_index));
+        }
+    }
+
+    /// Computes the cross products between corresponding vectors in 2 batches.
+    /// @param[in]  lhs - The vectors on the left-hand side of the cross product operations.
+    /// @param[in]  rhs - The vectors on the right-hand side of the cross product operations.
+    ///     Must have the same number of vectors as the left-hand side.
+    /// @param[out] cross_products - The cross product for each pair of vectors.
+    void Vector3Batch::CrossProduct(const Vector3Batch& lhs, const Vector3Batch& rhs, Vector3Batch& cross_products)
+    {
+        const std::size_t vector_count = lhs.Count();
+        cross_products.Resize(vector_count);
+
+        std::size_t vector_index = 0;
+
+#if MATH_SIMD_SSE2
+        // COMPUTE CROSS PRODUCTS FOR GROUPS OF 4 VECTORS AT A TIME.
+        constexpr std::size_t VECTORS_PER_GROUP = 4;
+        for (; vector_index + VECTORS_PER_GROUP <= vector_count; vector_index += VECTORS_PER_GROUP)
+        {
+            // LOAD ALL COMPONENTS BEFORE STORING ANY.
+            // This allows the output to be the same as either input.
+            __m128 lhs_xs = _mm_loadu_ps(lhs.Xs.data() + vector_index);
+            __m128 lhs_ys = _mm_loadu_ps(lhs.Ys.data() + vector_index);
+            __m128 lhs_zs = _mm_loadu_ps(lhs.Zs.data() + vector_index);
+            __m128 rhs_xs = _mm_loadu_ps(rhs.Xs.data() + vector_index);
+            __m128 rhs_ys = _mm_loadu_ps(rhs.Ys.data() + vector_index);
+            __m128 rhs_zs = _mm_loadu_ps(rhs.Zs.data() + vector_index);
+
+            // COMPUTE THE CROSS PRODUCTS.
+            __m128 cross_product_xs = _mm_sub_ps(_mm_mul_ps(lhs_ys, rhs_zs), _mm_mul_ps(lhs_zs, rhs_ys));
+            __m128 cross_product_ys = _mm_sub_ps(_mm_mul_ps(lhs_zs, rhs_xs), _mm_mul_ps(lhs_xs, rhs_zs));
+            __m128 cross_product_zs = _mm_sub_ps(_mm_mul_ps(lhs_xs, rhs_ys), _mm_mul_ps(lhs_ys, rhs_xs));
+            _mm_storeu_ps(cross_products.Xs.data() + vector_index, cross_product_xs);
+            _mm_storeu_ps(cross_products.Ys.data() + vector_index, cross_product_ys);
+            _mm_storeu_ps(cross_products.Zs.data() + vector_index, cross_product_zs);
+        }
+#endif
+
+        // COMPUTE CROSS PRODUCTS FOR ANY REMAINING VECTORS INDIVIDUALLY.
+        for (; vector_index < vector_count; ++vector_index)
+        {
+            Vector3f cross_product = Vector3f::CrossProduct(lhs.Get(vector_index), rhs.Get(vector_index));
+            cross_products.Set(vector_index, cross_product);
+        }
+    }
+
+    /// Transforms all vectors by a matrix, like multiplying a Vector4f by the matrix.
+    /// Only the x, y, and z components of the results are kept, so this is intended
+    /// for affine transforms (no perspective projection).
+    /// @param[in]  transform - The matrix to transform vectors by.
+    /// @param[in]  vectors - The vectors to transform.
+    /// @param[in]  homogeneous_w - The w component to use for each vector.  This should be
+    ///     1 to transform positions (including translation) or 0 to transform directions.
+    /// @param[out] transformed_vectors - The transformed vectors.
+    void Vector3Batch::Transform(
+        const Matrix4x4f& transform,
+        const Vector3Batch& vectors,
+        const float homogeneous_w,
+        Vector3Batch& transformed_vectors)
+    {
+        const std::size_t vector_count = vectors.Count();
+        transformed_vectors.Resize(vector_count);
+
+        std::size_t vector_index = 0;
+
+#if MATH_SIMD_SSE2
+        // BROADCAST EACH MATRIX ELEMENT THAT AFFECTS THE TRANSFORMED COMPONENTS.
+        // The w contribution is constant for all vectors, so it's folded into the last column.
+        constexpr unsigned int TRANSFORMED_ROW_COUNT = 3;
+        __m128 broadcast_elements[TRANSFORMED_ROW_COUNT][Matrix4x4f::COLUMN_COUNT];
+        for (unsigned int row_index = 0; row_index < TRANSFORMED_ROW_COUNT; ++row_index)
+        {
+            broadcast_elements[row_index][0] = _mm_set1_ps(transform.Elements(0, row_index));
+            broadcast_elements[row_index][1] = _mm_set1_ps(transform.Elements(1, row_index));
+            broadcast_elements[row_index][2] = _mm_set1_ps(transform.Elements(2, row_index));
+            broadcast_elements[row_index][3] = _mm_set1_ps(transform.Elements(3, row_index) * homogeneous_w);
+        }
+
+        // TRANSFORM GROUPS OF 4 VECTORS AT A TIME.
+        // Terms are added in the same order as matrix-vector multiplication for identical results.
+        constexpr std::size_t VECTORS_PER_GROUP = 4;
+        for (; vector_index + VECTORS_PER_GROUP <= vector_count; vector_index += VECTORS_PER_GROUP)
+        {
+            __m128 xs = _mm_loadu_ps(vectors.Xs.data() + vector_index);
+            __m128 ys = _mm_loadu_ps(vectors.Ys.data() + vector_index);
+            __m128 zs = _mm_loadu_ps(vectors.Zs.data() + vector_index);
+
+            __m128 transformed_components[TRANSFORMED_ROW_COUNT];
+            for (unsigned int row_index = 0; row_index < TRANSFORMED_ROW_COUNT; ++row_index)
+            {
+                __m128 row_sum = _mm_mul_ps(broadcast_elements[row_index][0], xs);
+                row_sum = _mm_add_ps(row_sum, _mm_mul_ps(broadcast_elements[row_index][1], ys));
+                row_sum = _mm_add_ps(row_sum, _mm_mul_ps(broadcast_elements[row_index][2], zs));
+                row_sum = _mm_add_ps(row_sum, broadcast_elements[row_index][3]);
+                transformed_components[row_index] = row_sum;
+            }
+
+            _mm_storeu_ps(transformed_vectors.Xs.data() + vector_index, transformed_components[0]);
+            _mm_storeu_ps(transformed_vectors.Ys.data() + vector_index, transformed_components[1]);
+            _mm_storeu_ps(transformed_vectors.Zs.data() + vector_index, transformed_components[2]);
+        }
+#endif
+
+        // TRANSFORM ANY REMAINING VECTORS INDIVIDUALLY.
+        for (; vector_index < vector_count; ++vector_index)
+        {
+            Vector4f homogeneous_vector(vectors.Xs[vector_index], vectors.Ys[vector_index], vectors.Zs[vector_index], homogeneous_w);
+            Vector4f transformed_vector = transform * homogeneous_vector;
+            transformed_vectors.Set(vector_index, Vector3f(transformed_vector.X, transformed_vector.Y, transformed_vector.Z));
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+
+namespace MATH
+{
+    /// Many 3D float vectors stored as separate arrays of components
+    /// (a "structure of arrays"), along with operations on all vectors at once.
+    /// Operating on individual Vector3f objects one at a time is simple but leaves
+    /// most of the processor's SIMD capabilities unused.  Storing each component
+    /// contiguously allows these operations to process several vectors per
+    /// instruction (via SSE2) when possible.
+    ///
+    /// Unless otherwise noted, results are identical to the equivalent Vector3f
+    /// operations on each vector individually.  Output batches are resized as needed
+    /// and may be the same as input batches to perform operations in-place.
+    class Vector3Batch
+    {
+    public:
+        // CONSTRUCTION.
+        static Vector3Batch FromVectors(const std::vector<Vector3f>& vectors);
+        explicit Vector3Batch(const std::size_t vector_count = 0);
+
+        // VECTOR ACCESS.
+        std::size_t Count() const;
+        void Resize(const std::size_t vector_count);
+        Vector3f Get(const std::size_t vector_index) const;
+        void Set(const std::size_t vector_index, const Vector3f& vector);
+
+        // BATCH OPERATIONS.
+        static void Normalize(const Vector3Batch& vectors, Vector3Batch& normalized_vectors);
+        static void FastNormalize(const Vector3Batch& vectors, Vector3Batch& normalized_vectors);
+        static void DotProduct(const Vector3Batch& vectors_1, const Vector3Batch& vectors_2, std::vector<float>& dot_products);
+        static void CrossProduct(const Vector3Batch& lhs, const Vector3Batch& rhs, Vector3Batch& cross_products);
+        static void Transform(
+            const Matrix4x4f& transform,
+            const Vector3Batch& vectors,
+            const float homogeneous_w,
+            Vector3Batch& transformed_vectors);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The x components of all vectors.
+        std::vector<float> Xs = {};
+        /// The y components of all vectors.
+        std::vector<float> Ys = {};
+        /// The z components of all vectors.
+        std::vector<float> Zs = {};
+    };
+}
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include "Benchmarking/Profiler.h"
+#include "Threading/ThreadPool.h"
+
+namespace THREADING
+{
+    /// Constructor that starts all worker threads.
+    /// @param[in]  thread_count - The number of worker threads.
+    ///     0 uses the number of hardware threads available.
+    ThreadPool::ThreadPool(unsigned int thread_count)
+    {
+        if (0 == thread_count)
+        {
+            thread_count = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        Workers.reserve(thread_count);
+        for (unsigned int thread_index = 0; thread_index < thread_count; ++thread_index)
+        {
+            Workers.emplace_back([this]() { RunWorker(); });
+        }
+    }
+
+    /// Destructor that waits for all submitted tasks to finish before stopping all worker threads.
+    ThreadPool::~ThreadPool()
+    {
+        // SIGNAL ALL WORKERS TO STOP ONCE ALL TASKS ARE DONE.
+        {
+            std::lock_guard<std::mutex> lock(TaskMutex);
+            Stopping = true;
+        }
+        TaskAdded.notify_all();
+
+        // WAIT FOR ALL WORKERS TO FINISH.
+        for (std::thread& worker : Workers)
+        {
+            worker.join();
+        }
+    }
+
+    /// Gets the number of worker threads.
+    /// @return The number of worker threads.
+    std::size_t ThreadPool::ThreadCount() const
+    {
+        return Workers.size();
+    }
+
+    /// Adds a task to be run by a worker thread.
+    /// @param[in]  task - The task to add.
+    void ThreadPool::Enqueue(std::function<void()>&& task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(TaskMutex);
+            PendingTasks.push_back(std::move(task));
+        }
+        TaskAdded.notify_one();
+    }
+
+    /// Runs tasks on a worker thread until the pool is stopped and no tasks remain.
+    void ThreadPool::RunWorker()
+    {
+        while (true)
+        {
+            // WAIT FOR A TASK.
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(TaskMutex);
+                TaskAdded.wait(lock, [this]() { return Stopping || !PendingTasks.empty(); });
+
+                bool all_tasks_finished = PendingTasks.empty();
+                if (all_tasks_finished)
+                {
+                    return;
+                }
+
+                task = std::move(PendingTasks.front());
+                PendingTasks.pop_front();
+            }
+
+            // RUN THE TASK.
+            // Time between tasks on worker threads shows up in traces as idle time.
+            PROFILE_ZONE("Thread pool task");
+            task();
+        }
+    }
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Holds code related to running work on multiple threads.
+namespace THREADING
+{
+    /// A handle to a task submitted to a thread pool, for waiting on its result.
+    /// Handles are cheap to copy, and all copies refer to the same task.
+    ///
+    /// Each task is run exactly once, by whichever thread gets to it first: either a worker
+    /// thread or a thread waiting on the task.  Waiting threads only ever run the specific task
+    /// they're waiting on (never unrelated queued tasks), so a task waiting on another task can
+    /// never end up underneath something that's waiting on it.  Tasks can therefore wait on
+    /// other tasks without deadlocking the pool, as long as no task (indirectly) waits on itself.
+    /// @tparam Result - The type of result of the task.
+    template <typename Result>
+    class TaskHandle
+    {
+    public:
+        // CONSTRUCTION.
+        explicit TaskHandle() = default;
+        explicit TaskHandle(std::packaged_task<Result()>&& task);
+
+        // STATUS.
+        bool IsValid() const;
+        bool IsReady() const;
+
+        // RUNNING.
+        bool TryRun() const;
+        void Wait() const;
+        decltype(auto) Get() const;
+
+    private:
+        /// The state shared between all copies of a handle.
+        struct SharedState
+        {
+            /// True once a thread has started running the task.
+            std::atomic<bool> Started = false;
+            /// The task to run.
+            std::packaged_task<Result()> Task = {};
+            /// The future for the result of the task.
+            std::shared_future<Result> Future = {};
+        };
+
+        // MEMBER VARIABLES.
+        /// The state of the task, if the handle refers to a task.
+        std::shared_ptr<SharedState> State = nullptr;
+    };
+
+    /// A fixed set of worker threads that run submitted tasks in the order submitted.
+    /// Starting a thread per task is relatively expensive, so long-lived workers
+    /// are reused for many small tasks.
+    ///
+    /// Tasks may submit and wait on other tasks via the returned TaskHandles.
+    /// A task that no worker has started yet is run by the first thread waiting on it,
+    /// so waiting never requires a free worker.
+    ///
+    /// Destroying the pool waits for all submitted tasks to finish.
+    class ThreadPool
+    {
+    public:
+        // CONSTRUCTION/DESTRUCTION.
+        explicit ThreadPool(unsigned int thread_count = 0);
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // THREAD ACCESS.
+        std::size_t ThreadCount() const;
+
+        // TASK SUBMISSION.
+        template <typename Function>
+        TaskHandle<std::invoke_result_t<Function>> Submit(Function&& function);
+
+    private:
+        // HELPER METHODS.
+        void Enqueue(std::function<void()>&& task);
+        void RunWorker();
+
+        // MEMBER VARIABLES.
+        /// Protects access to the pending tasks and stopping flag.
+        std::mutex TaskMutex = {};
+        /// Signaled when tasks are added or the pool is stopping.
+        std::condition_variable TaskAdded = {};
+        /// Tasks that haven't yet started, in the order submitted.
+        std::deque<std::function<void()>> PendingTasks = {};
+        /// True once the pool is being destroyed and no more tasks will be submitted.
+        bool Stopping = false;
+        /// The worker threads.
+        std::vector<std::thread> Workers = {};
+    };
+
+    /// Constructor.
+    /// @param[in]  task - The task to run.
+    template <typename Result>
+    TaskHandle<Result>::TaskHandle(std::packaged_task<Result()>&& task) :
+        State(std::make_shared<SharedState>())
+    {
+        State->Future = task.get_future().share();
+        State->Task = std::move(task);
+    }
+
+    /// Determines if the handle refers to a task (rather than being default-constructed).
+    /// @return True if the handle refers to a task; false otherwise.
+    template <typename Result>
+    bool TaskHandle<Result>::IsValid() const
+    {
+        return static_cast<bool>(State);
+    }
+
+    /// Determines if the task has finished, without blocking.
+    /// @return True if the task has finished; false otherwise.
+    template <typename Result>
+    bool TaskHandle<Result>::IsReady() const
+    {
+        bool is_ready = IsValid() && (std::future_status::ready == State->Future.wait_for(std::chrono::seconds(0)));
+        return is_ready;
+    }
+
+    /// Runs the task on the calling thread, unless another thread has already started it.
+    /// @return True if the task was run by this call; false otherwise.
+    template <typename Result>
+    bool TaskHandle<Result>::TryRun() const
+    {
+        if (!IsValid())
+        {
+            return false;
+        }
+
+        bool already_started = State->Started.exchange(true);
+        if (already_started)
+        {
+            return false;
+        }
+
+        State->Task();
+        return true;
+    }
+
+    /// Waits for the task to finish, running it on the calling thread if no other thread has started it.
+    /// This is safe to call from within other tasks.
+    template <typename Result>
+    void TaskHandle<Result>::Wait() const
+    {
+        if (!IsValid())
+        {
+            return;
+        }
+
+        // If another thread is running the task, that thread will finish it without
+        // needing anything from this thread, so this thread can simply block.
+        TryRun();
+        State->Future.wait();
+    }
+
+    /// Gets the result of the task, waiting for the task to finish if needed.
+    /// The handle must be valid.
+    /// @return The result of the task.
+    template <typename Result>
+    decltype(auto) TaskHandle<Result>::Get() const
+    {
+        Wait();
+        return State->Future.get();
+    }
+
+    /// Submits a task to be run on a worker thread (or any thread waiting on it first).
+    /// @tparam Function - The type of function to run.
+    /// @param[in]  function - The function to run, which must not take any parameters.
+    /// @return A handle to the task.
+    template <typename Function>
+    TaskHandle<std::invoke_result_t<Function>> ThreadPool::Submit(Function&& function)
+    {
+        using Result = std::invoke_result_t<Function>;
+        TaskHandle<Result> task(std::packaged_task<Result()>(std::forward<Function>(function)));
+
+        // QUEUE THE TASK.
+        // If a waiting thread has already run the task by the time a worker gets to it, the worker skips it.
+        Enqueue([task]() { task.TryRun(); });
+        return task;
+    }
+}
@@ -0,0 +1,83 @@
+#include <array>
+#include <memory>
+#include <vector>
+#include "Benchmarking/AllocationTracker.h"
+#include "Benchmarking/Profiler.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Data aligned more strictly than the default, to verify aligned allocations are counted.
+struct alignas(64) OverAlignedAllocationTestData
+{
+    /// Values filling the aligned data.
+    std::array<float, 16> Values = {};
+};
+
+TEST_CASE("Allocation counts can be subtracted to get allocations during a span.", "[AllocationTracker]")
+{
+    BENCHMARKING::AllocationCounts earlier_counts = { .AllocationCount = 3, .AllocatedByteCount = 100 };
+    BENCHMARKING::AllocationCounts later_counts = { .AllocationCount = 5, .AllocatedByteCount = 164 };
+
+    BENCHMARKING::AllocationCounts difference = later_counts - earlier_counts;
+
+    REQUIRE(2 == difference.AllocationCount);
+    REQUIRE(64 == difference.AllocatedByteCount);
+}
+
+TEST_CASE("Allocations are counted only if tracking is enabled.", "[AllocationTracker]")
+{
+    // ALLOCATE MEMORY.
+    BENCHMARKING::AllocationCounts thread_counts_before = BENCHMARKING::AllocationTracker::GetCurrentThreadCounts();
+    BENCHMARKING::AllocationCounts process_counts_before = BENCHMARKING::AllocationTracker::GetProcessCounts();
+    auto memory = std::make_unique<std::array<char, 100>>();
+    auto aligned_memory = std::make_unique<OverAlignedAllocationTestData>();
+    BENCHMARKING::AllocationCounts thread_allocations = BENCHMARKING::AllocationTracker::GetCurrentThreadCounts() - thread_counts_before;
+    BENCHMARKING::AllocationCounts process_allocations = BENCHMARKING::AllocationTracker::GetProcessCounts() - process_counts_before;
+
+    // VERIFY THE ALLOCATIONS WERE COUNTED IF EXPECTED.
+    if (BENCHMARKING::AllocationTracker::IsEnabled())
+    {
+        REQUIRE(2 == thread_allocations.AllocationCount);
+        REQUIRE(100 + sizeof(OverAlignedAllocationTestData) == thread_allocations.AllocatedByteCount);
+        // Other threads may also allocate.
+        REQUIRE(process_allocations.AllocationCount >= 2);
+    }
+    else
+    {
+        REQUIRE(0 == thread_allocations.AllocationCount);
+        REQUIRE(0 == process_allocations.AllocationCount);
+    }
+}
+
+TEST_CASE("Allocations are attributed to profiled zones.", "[AllocationTracker]")
+{
+    // ALLOCATE IN A ZONE OVER MULTIPLE FRAMES.
+    // The zone is entered before measuring so that the profiler's own allocations aren't counted.
+    BENCHMARKING::Profiler profiler;
+    {
+        BENCHMARKING::ProfileZone zone("Allocating", profiler);
+    }
+    profiler.Clear();
+    for (std::size_t frame_index = 0; frame_index < 2; ++frame_index)
+    {
+        {
+            BENCHMARKING::ProfileZone zone("Allocating", profiler);
+            std::vector<int> values(frame_index + 1);
+        }
+        profiler.EndFrame();
+    }
+
+    // VERIFY THE ALLOCATIONS WERE COUNTED IF EXPECTED.
+    std::vector<BENCHMARKING::ZoneStatistics> zone_statistics = profiler.GetStatistics();
+    REQUIRE(1 == zone_statistics.size());
+    if (BENCHMARKING::AllocationTracker::IsEnabled())
+    {
+        REQUIRE(1.0 == zone_statistics[0].MeanAllocationCountPerFrame);
+        REQUIRE(1.5 * sizeof(int) == zone_statistics[0].MeanAllocatedBytesPerFrame);
+        REQUIRE(1 == zone_statistics[0].MaximumAllocationCountPerFrame);
+    }
+    else
+    {
+        REQUIRE(0.0 == zone_statistics[0].MeanAllocationCountPerFrame);
+        REQUIRE(0 == zone_statistics[0].MaximumAllocationCountPerFrame);
+    }
+}
@@ -0,0 +1,55 @@
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "Benchmarking/Benchmark.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Statistics can be computed for run times.", "[Benchmark]")
+{
+    SECTION("No runs.")
+    {
+        BENCHMARKING::TimingStatistics statistics = BENCHMARKING::Benchmark::ComputeStatistics({});
+        REQUIRE(0 == statistics.RunCount);
+        REQUIRE(0.0 == statistics.MedianTimeInNanoseconds);
+    }
+
+    SECTION("An odd number of runs.")
+    {
+        BENCHMARKING::TimingStatistics statistics = BENCHMARKING::Benchmark::ComputeStatistics({ 5.0, 1.0, 3.0 });
+        REQUIRE(3 == statistics.RunCount);
+        REQUIRE(1.0 == statistics.MinimumTimeInNanoseconds);
+        REQUIRE(3.0 == statistics.MedianTimeInNanoseconds);
+        REQUIRE(3.0 == statistics.MeanTimeInNanoseconds);
+        REQUIRE(2.0 == statistics.StandardDeviationInNanoseconds);
+        REQUIRE(5.0 == statistics.MaximumTimeInNanoseconds);
+    }
+
+    SECTION("An even number of runs.")
+    {
+        BENCHMARKING::TimingStatistics statistics = BENCHMARKING::Benchmark::ComputeStatistics({ 4.0, 1.0, 2.0, 100.0 });
+        REQUIRE(4 == statistics.RunCount);
+        REQUIRE(3.0 == statistics.MedianTimeInNanoseconds);
+        REQUIRE(26.75 == statistics.MeanTimeInNanoseconds);
+    }
+}
+
+TEST_CASE("Benchmarks only measure runs after warming up.", "[Benchmark]")
+{
+    // RUN A BENCHMARK THAT COUNTS CALLS.
+    std::size_t run_count = 0;
+    std::size_t preparation_count = 0;
+    constexpr std::size_t WARM_UP_RUN_COUNT = 2;
+    constexpr std::size_t MEASURED_RUN_COUNT = 5;
+    BENCHMARKING::TimingStatistics statistics = BENCHMARKING::Benchmark::Run(
+        WARM_UP_RUN_COUNT,
+        MEASURED_RUN_COUNT,
+        [&run_count]() { ++run_count; },
+        [&preparation_count]() { ++preparation_count; });
+
+    // VERIFY ALL RUNS HAPPENED BUT ONLY MEASURED RUNS WERE INCLUDED IN STATISTICS.
+    REQUIRE(WARM_UP_RUN_COUNT + MEASURED_RUN_COUNT == run_count);
+    REQUIRE(WARM_UP_RUN_COUNT + MEASURED_RUN_COUNT == preparation_count);
+    REQUIRE(MEASURED_RUN_COUNT == statistics.RunCount);
+    REQUIRE(statistics.MinimumTimeInNanoseconds <= statistics.MedianTimeInNanoseconds);
+    REQUIRE(statistics.MedianTimeInNanoseconds <= statistics.MaximumTimeInNanoseconds);
+}
@@ -0,0 +1,76 @@
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include "Benchmarking/Benchmark.h"
+#include "Benchmarking/HardwareCounters.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Hardware counter values can be divided and give instructions per cycle.", "[HardwareCounters]")
+{
+    BENCHMARKING::HardwareCounterValues totals;
+    totals.CycleCount = 400.0;
+    totals.InstructionCount = 800.0;
+    totals.BranchMispredictionCount = 20.0;
+
+    BENCHMARKING::HardwareCounterValues values_per_run = totals.DividedBy(4.0);
+
+    REQUIRE(100.0 == values_per_run.CycleCount);
+    REQUIRE(200.0 == values_per_run.InstructionCount);
+    REQUIRE(5.0 == values_per_run.BranchMispredictionCount);
+    REQUIRE_FALSE(values_per_run.L1DataCacheMissCount);
+    REQUIRE_FALSE(values_per_run.LastLevelCacheMissCount);
+    REQUIRE(2.0 == values_per_run.InstructionsPerCycle());
+
+    // Instructions per cycle are unavailable without both counters.
+    values_per_run.CycleCount = std::nullopt;
+    REQUIRE_FALSE(values_per_run.InstructionsPerCycle());
+
+    // Unavailable counters are empty in CSV output.
+    std::ostringstream csv_output;
+    BENCHMARKING::HardwareCounters::WriteCsvColumns(values_per_run, csv_output);
+    REQUIRE(",,200,,,,5" == csv_output.str());
+}
+
+TEST_CASE("Hardware counters measure benchmark runs when available.", "[HardwareCounters]")
+{
+    // MEASURE SOME WORK.
+    // Counters are commonly unavailable (like in containers), so this can't require them.
+    BENCHMARKING::HardwareCounters hardware_counters;
+    volatile uint64_t sum = 0;
+    constexpr std::size_t RUN_COUNT = 3;
+    BENCHMARKING::Benchmark::Run(
+        0,
+        RUN_COUNT,
+        [&sum]()
+        {
+            for (uint64_t value = 0; value < 100000; ++value)
+            {
+                sum = sum + value;
+            }
+        },
+        nullptr,
+        &hardware_counters);
+
+    // VERIFY THE COUNTS ARE REASONABLE IF AVAILABLE.
+    BENCHMARKING::HardwareCounterValues totals = hardware_counters.GetTotals();
+    if (!hardware_counters.IsAvailable())
+    {
+        REQUIRE_FALSE(totals.CycleCount);
+        REQUIRE_FALSE(totals.InstructionCount);
+        REQUIRE_FALSE(totals.InstructionsPerCycle());
+        return;
+    }
+    if (totals.InstructionCount)
+    {
+        REQUIRE(*totals.InstructionCount > 100000.0);
+    }
+
+    // VERIFY RESETTING CLEARS TOTALS.
+    hardware_counters.Reset();
+    BENCHMARKING::HardwareCounterValues reset_totals = hardware_counters.GetTotals();
+    if (reset_totals.InstructionCount)
+    {
+        REQUIRE(0.0 == *reset_totals.InstructionCount);
+    }
+}
@@ -0,0 +1,171 @@
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmarking/Profiler.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Nested zones are measured hierarchically.", "[Profiler]")
+{
+    // MEASURE NESTED ZONES OVER MULTIPLE FRAMES.
+    // The inner zone is entered multiple times per frame to verify times are summed per frame.
+    constexpr std::size_t FRAME_COUNT = 3;
+    BENCHMARKING::Profiler profiler;
+    for (std::size_t frame_index = 0; frame_index < FRAME_COUNT; ++frame_index)
+    {
+        BENCHMARKING::ProfileZone outer_zone("Outer", profiler);
+        for (std::size_t inner_zone_index = 0; inner_zone_index < 2; ++inner_zone_index)
+        {
+            BENCHMARKING::ProfileZone inner_zone("Inner", profiler);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        BENCHMARKING::ProfileZone sibling_zone("Another inner", profiler);
+    }
+    // Frames are ended outside of zones here so that the zones are closed.
+    for (std::size_t frame_index = 0; frame_index < FRAME_COUNT; ++frame_index)
+    {
+        profiler.EndFrame();
+    }
+
+    // VERIFY THE ZONES ARE REPORTED DEPTH-FIRST.
+    std::vector<BENCHMARKING::ZoneStatistics> zone_statistics = profiler.GetStatistics();
+    REQUIRE(3 == zone_statistics.size());
+    REQUIRE("Outer" == zone_statistics[0].Path);
+    REQUIRE(0 == zone_statistics[0].Depth);
+    REQUIRE("Outer/Another inner" == zone_statistics[1].Path);
+    REQUIRE(1 == zone_statistics[1].Depth);
+    REQUIRE("Outer/Inner" == zone_statistics[2].Path);
+    REQUIRE(1 == zone_statistics[2].Depth);
+
+    // VERIFY THE STATISTICS COVER ALL FRAMES.
+    // All zones were measured in the first frame, so the remaining frames have no time.
+    const BENCHMARKING::ZoneStatistics& inner_zone_statistics = zone_statistics[2];
+    REQUIRE(FRAME_COUNT == inner_zone_statistics.FrameCount);
+    REQUIRE(2.0 == inner_zone_statistics.MeanCallCountPerFrame);
+    REQUIRE(inner_zone_statistics.MaximumTimeInNanoseconds >= 200'000.0);
+    REQUIRE(0.0 == inner_zone_statistics.Percentile50TimeInNanoseconds);
+    REQUIRE(inner_zone_statistics.MaximumTimeInNanoseconds == inner_zone_statistics.Percentile99TimeInNanoseconds);
+    REQUIRE(zone_statistics[0].MaximumTimeInNanoseconds >= inner_zone_statistics.MaximumTimeInNanoseconds);
+}
+
+TEST_CASE("Profiling statistics only cover recent frames.", "[Profiler]")
+{
+    // MEASURE MORE FRAMES THAN THE WINDOW HOLDS.
+    constexpr std::size_t FRAME_WINDOW_SIZE = 4;
+    BENCHMARKING::Profiler profiler(FRAME_WINDOW_SIZE);
+    for (std::size_t frame_index = 0; frame_index < 10; ++frame_index)
+    {
+        {
+            BENCHMARKING::ProfileZone zone("Zone", profiler);
+        }
+        profiler.EndFrame();
+    }
+
+    // VERIFY ONLY THE MOST RECENT FRAMES ARE INCLUDED.
+    std::vector<BENCHMARKING::ZoneStatistics> zone_statistics = profiler.GetStatistics();
+    REQUIRE(1 == zone_statistics.size());
+    REQUIRE(FRAME_WINDOW_SIZE == zone_statistics[0].FrameCount);
+    REQUIRE(1.0 == zone_statistics[0].MeanCallCountPerFrame);
+
+    // VERIFY CLEARING REMOVES ALL FRAMES.
+    profiler.Clear();
+    zone_statistics = profiler.GetStatistics();
+    REQUIRE(1 == zone_statistics.size());
+    REQUIRE(0 == zone_statistics[0].FrameCount);
+}
+
+TEST_CASE("Repeated stages are measured as zones nested within the current zone.", "[Profiler]")
+{
+    // MEASURE STAGES REPEATED WITHIN A ZONE.
+    // Enough repetitions are made for multiple to be timed, and the second stage is skipped
+    // on some repetitions to verify only ended stages are counted.
+    constexpr std::size_t REPETITION_COUNT = 2 * BENCHMARKING::ProfileStages::SAMPLING_INTERVAL;
+    BENCHMARKING::Profiler profiler;
+    {
+        BENCHMARKING::ProfileZone zone("Zone", profiler);
+        BENCHMARKING::ProfileStages stages({ "First stage", "Second stage" }, profiler);
+        for (std::size_t repetition_index = 0; repetition_index < REPETITION_COUNT; ++repetition_index)
+        {
+            stages.Start();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            stages.EndStage(0);
+
+            bool even_repetition = (0 == repetition_index % 2);
+            if (even_repetition)
+            {
+                stages.EndStage(1);
+            }
+        }
+    }
+    profiler.EndFrame();
+
+    // VERIFY THE STAGES ARE REPORTED AS NESTED ZONES.
+    std::vector<BENCHMARKING::ZoneStatistics> zone_statistics = profiler.GetStatistics();
+    REQUIRE(3 == zone_statistics.size());
+    REQUIRE("Zone" == zone_statistics[0].Path);
+    REQUIRE("Zone/First stage" == zone_statistics[1].Path);
+    REQUIRE(1 == zone_statistics[1].Depth);
+    REQUIRE(static_cast<double>(REPETITION_COUNT) == zone_statistics[1].MeanCallCountPerFrame);
+    REQUIRE(zone_statistics[1].MeanTimeInNanoseconds >= REPETITION_COUNT * 100'000.0);
+    // Stage times are estimated from sampled repetitions, so they may slightly exceed the enclosing zone's time.
+    REQUIRE(zone_statistics[0].MeanTimeInNanoseconds >= 0.9 * zone_statistics[1].MeanTimeInNanoseconds);
+    REQUIRE("Zone/Second stage" == zone_statistics[2].Path);
+    REQUIRE(static_cast<double>(REPETITION_COUNT / 2) == zone_statistics[2].MeanCallCountPerFrame);
+}
+
+TEST_CASE("Zones can be measured on multiple threads at once.", "[Profiler]")
+{
+    // MEASURE THE SAME ZONE ON MULTIPLE THREADS.
+    // Each thread is also nested in an enclosing zone on the main thread, which shouldn't affect the worker threads.
+    constexpr std::size_t THREAD_COUNT = 8;
+    constexpr std::size_t ZONES_PER_THREAD = 1000;
+    BENCHMARKING::Profiler profiler;
+    {
+        BENCHMARKING::ProfileZone main_thread_zone("Main", profiler);
+        std::vector<std::jthread> threads;
+        for (std::size_t thread_index = 0; thread_index < THREAD_COUNT; ++thread_index)
+        {
+            threads.emplace_back([&profiler]()
+            {
+                for (std::size_t zone_index = 0; zone_index < ZONES_PER_THREAD; ++zone_index)
+                {
+                    BENCHMARKING::ProfileZone worker_zone("Worker", profiler);
+                }
+            });
+        }
+    }
+    profiler.EndFrame();
+
+    // VERIFY ALL THREADS WERE COUNTED FOR THE ZONE.
+    // Times from threads that have already exited should still be included.
+    std::vector<BENCHMARKING::ZoneStatistics> zone_statistics = profiler.GetStatistics();
+    REQUIRE(2 == zone_statistics.size());
+    REQUIRE("Main" == zone_statistics[0].Path);
+    REQUIRE("Worker" == zone_statistics[1].Path);
+    REQUIRE(static_cast<double>(THREAD_COUNT * ZONES_PER_THREAD) == zone_statistics[1].MeanCallCountPerFrame);
+}
+
+TEST_CASE("Profiling statistics can be written as CSV.", "[Profiler]")
+{
+    BENCHMARKING::Profiler profiler;
+    {
+        BENCHMARKING::ProfileZone outer_zone("Outer", profiler);
+        BENCHMARKING::ProfileZone inner_zone("Inner", profiler);
+    }
+    profiler.EndFrame();
+
+    std::ostringstream csv_output;
+    profiler.WriteCsv(csv_output);
+
+    std::istringstream csv_lines(csv_output.str());
+    std::string csv_line;
+    REQUIRE(std::getline(csv_lines, csv_line));
+    REQUIRE("zone,depth,frames,calls_per_frame,mean_ns,p50_ns,p95_ns,p99_ns,max_ns,allocations_per_frame,allocated_bytes_per_frame,max_allocations_per_frame" == csv_line);
+    REQUIRE(std::getline(csv_lines, csv_line));
+    REQUIRE(csv_line.starts_with("Outer,0,1,1,"));
+    REQUIRE(std::getline(csv_lines, csv_line));
+    REQUIRE(csv_line.starts_with("Outer/Inner,1,1,1,"));
+    REQUIRE_FALSE(std::getline(csv_lines, csv_line));
+}
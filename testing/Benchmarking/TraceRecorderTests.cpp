@@ -0,0 +1,142 @@
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmarking/TraceRecorder.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Counts occurrences of text within a trace.
+/// @param[in]  trace_json - The trace to search.
+/// @param[in]  text - The text to count.
+/// @return The number of occurrences.
+static std::size_t CountTraceText(const std::string& trace_json, const std::string& text)
+{
+    std::size_t occurrence_count = 0;
+    for (std::size_t text_index = trace_json.find(text); std::string::npos != text_index; text_index = trace_json.find(text, text_index + text.size()))
+    {
+        ++occurrence_count;
+    }
+    return occurrence_count;
+}
+
+TEST_CASE("Events are only recorded while recording.", "[TraceRecorder]")
+{
+    BENCHMARKING::TraceRecorder trace_recorder;
+    {
+        BENCHMARKING::TraceZone zone_before_recording("Before", trace_recorder);
+    }
+    REQUIRE_FALSE(trace_recorder.IsRecording());
+    REQUIRE(0 == trace_recorder.GetEventCount());
+
+    trace_recorder.Start();
+    REQUIRE(trace_recorder.IsRecording());
+    {
+        BENCHMARKING::TraceZone zone_while_recording("During", trace_recorder);
+    }
+    trace_recorder.RecordInstantEvent("Frame end");
+    trace_recorder.Stop();
+    {
+        BENCHMARKING::TraceZone zone_after_recording("After", trace_recorder);
+    }
+    REQUIRE(3 == trace_recorder.GetEventCount());
+
+    // VERIFY STARTING AGAIN DISCARDS PREVIOUS EVENTS.
+    trace_recorder.Start();
+    REQUIRE(0 == trace_recorder.GetEventCount());
+}
+
+TEST_CASE("Zones that began while recording are completed after recording stops.", "[TraceRecorder]")
+{
+    BENCHMARKING::TraceRecorder trace_recorder;
+    trace_recorder.Start();
+    {
+        BENCHMARKING::TraceZone zone("Zone", trace_recorder);
+        trace_recorder.Stop();
+    }
+    REQUIRE(2 == trace_recorder.GetEventCount());
+}
+
+TEST_CASE("Events from multiple threads can be written as Chrome trace JSON.", "[TraceRecorder]")
+{
+    // RECORD MANY NESTED EVENTS ON MULTIPLE THREADS.
+    // Enough events are recorded to require multiple chunks per thread.
+    constexpr std::size_t THREAD_COUNT = 4;
+    constexpr std::size_t ZONES_PER_THREAD = 5000;
+    BENCHMARKING::TraceRecorder trace_recorder;
+    trace_recorder.Start();
+    {
+        BENCHMARKING::TraceZone main_thread_zone("Main \"thread\"", trace_recorder);
+        std::vector<std::jthread> threads;
+        for (std::size_t thread_index = 0; thread_index < THREAD_COUNT; ++thread_index)
+        {
+            threads.emplace_back([&trace_recorder]()
+            {
+                for (std::size_t zone_index = 0; zone_index < ZONES_PER_THREAD; ++zone_index)
+                {
+                    BENCHMARKING::TraceZone outer_zone("Outer", trace_recorder);
+                    BENCHMARKING::TraceZone inner_zone("Inner", trace_recorder);
+                }
+            });
+        }
+    }
+    trace_recorder.RecordInstantEvent("Frame end");
+    trace_recorder.Stop();
+
+    // VERIFY ALL EVENTS WERE RECORDED.
+    constexpr std::size_t MAIN_THREAD_EVENT_COUNT = 3;
+    constexpr std::size_t EVENTS_PER_ZONE = 2;
+    constexpr std::size_t WORKER_THREAD_EVENT_COUNT = THREAD_COUNT * ZONES_PER_THREAD * 2 * EVENTS_PER_ZONE;
+    REQUIRE(MAIN_THREAD_EVENT_COUNT + WORKER_THREAD_EVENT_COUNT == trace_recorder.GetEventCount());
+
+    // WRITE THE TRACE.
+    std::ostringstream trace_output;
+    trace_recorder.WriteChromeTraceJson(trace_output);
+    std::string trace_json = trace_output.str();
+
+    // VERIFY THE TRACE HAS THE EXPECTED EVENTS.
+    REQUIRE(trace_json.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    REQUIRE(trace_json.ends_with("],\"otherData\":{\"dropped_event_count\":0}}\n"));
+    REQUIRE(1 + THREAD_COUNT == CountTraceText(trace_json, "\"ph\":\"M\""));
+    REQUIRE(1 + THREAD_COUNT * ZONES_PER_THREAD * 2 == CountTraceText(trace_json, "\"ph\":\"B\""));
+    REQUIRE(1 + THREAD_COUNT * ZONES_PER_THREAD * 2 == CountTraceText(trace_json, "\"ph\":\"E\""));
+    REQUIRE(1 == CountTraceText(trace_json, "{\"name\":\"Frame end\",\"ph\":\"i\",\"pid\":1,\"tid\":0,"));
+    REQUIRE(2 == CountTraceText(trace_json, "{\"name\":\"Main \\\"thread\\\"\""));
+    for (std::size_t thread_number = 0; thread_number <= THREAD_COUNT; ++thread_number)
+    {
+        std::string thread_name_event = "\"tid\":" + std::to_string(thread_number) + ",\"args\":{\"name\":\"Thread " + std::to_string(thread_number) + "\"}";
+        REQUIRE(1 == CountTraceText(trace_json, thread_name_event));
+    }
+}
+
+TEST_CASE("Events beyond the per-thread limit are dropped without unbalancing spans.", "[TraceRecorder]")
+{
+    // RECORD MORE NESTED EVENTS THAN THE LIMIT ALLOWS.
+    // The limit leaves room for the first two outer zones, and for an inner zone only in the first.
+    constexpr std::size_t MAX_EVENTS_PER_THREAD = 7;
+    constexpr std::size_t OUTER_ZONE_COUNT = 5;
+    BENCHMARKING::TraceRecorder trace_recorder;
+    trace_recorder.Start(MAX_EVENTS_PER_THREAD);
+    for (std::size_t zone_index = 0; zone_index < OUTER_ZONE_COUNT; ++zone_index)
+    {
+        BENCHMARKING::TraceZone outer_zone("Outer", trace_recorder);
+        BENCHMARKING::TraceZone inner_zone("Inner", trace_recorder);
+    }
+    trace_recorder.RecordInstantEvent("Frame end");
+    trace_recorder.Stop();
+
+    // VERIFY EVENTS WERE DROPPED ONCE THE LIMIT WAS REACHED.
+    constexpr std::size_t RECORDED_EVENT_COUNT = 7;
+    constexpr std::size_t TOTAL_EVENT_COUNT = OUTER_ZONE_COUNT * 4 + 1;
+    REQUIRE(RECORDED_EVENT_COUNT == trace_recorder.GetEventCount());
+    REQUIRE(TOTAL_EVENT_COUNT - RECORDED_EVENT_COUNT == trace_recorder.GetDroppedEventCount());
+
+    // VERIFY THE TRACE HAS BALANCED SPANS AND REPORTS THE DROPPED EVENTS.
+    std::ostringstream trace_output;
+    trace_recorder.WriteChromeTraceJson(trace_output);
+    std::string trace_json = trace_output.str();
+    REQUIRE(3 == CountTraceText(trace_json, "\"ph\":\"B\""));
+    REQUIRE(3 == CountTraceText(trace_json, "\"ph\":\"E\""));
+    REQUIRE(1 == CountTraceText(trace_json, "\"ph\":\"i\""));
+    REQUIRE(trace_json.ends_with("\"otherData\":{\"dropped_event_count\":14}}\n"));
+}
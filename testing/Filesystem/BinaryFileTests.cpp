@@ -0,0 +1,95 @@
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include "Filesystem/BinaryFile.h"
+#include "Filesystem/MemoryMappedFile.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Section offsets are aligned up to the section alignment.", "[BinaryFile]")
+{
+    REQUIRE(0 == FILESYSTEM::BinaryFile::AlignSectionOffset(0));
+    REQUIRE(16 == FILESYSTEM::BinaryFile::AlignSectionOffset(1));
+    REQUIRE(16 == FILESYSTEM::BinaryFile::AlignSectionOffset(16));
+    REQUIRE(32 == FILESYSTEM::BinaryFile::AlignSectionOffset(17));
+}
+
+TEST_CASE("Sections are written at their offsets and only read back if valid.", "[BinaryFile]")
+{
+    // WRITE A FILE WITH PADDING BETWEEN SECTIONS.
+    std::filesystem::path filepath = std::filesystem::temp_directory_path() / "BinaryFileTests.bin";
+    const uint32_t FIRST_SECTION[] = { 1, 2, 3 };
+    const uint32_t SECOND_SECTION[] = { 4, 5 };
+    uint64_t second_section_offset_in_bytes = FILESYSTEM::BinaryFile::AlignSectionOffset(sizeof(FIRST_SECTION));
+    uint64_t empty_section_offset_in_bytes = FILESYSTEM::BinaryFile::AlignSectionOffset(second_section_offset_in_bytes + sizeof(SECOND_SECTION));
+    bool file_written = FILESYSTEM::BinaryFile::Write(
+        filepath,
+        {
+            { .OffsetInBytes = 0, .Data = FIRST_SECTION, .SizeInBytes = sizeof(FIRST_SECTION) },
+            { .OffsetInBytes = second_section_offset_in_bytes, .Data = SECOND_SECTION, .SizeInBytes = sizeof(SECOND_SECTION) },
+            { .OffsetInBytes = empty_section_offset_in_bytes, .Data = nullptr, .SizeInBytes = 0 },
+        });
+    REQUIRE(file_written);
+    REQUIRE_FALSE(std::filesystem::exists(filepath.string() + ".tmp"));
+    REQUIRE(empty_section_offset_in_bytes == std::filesystem::file_size(filepath));
+
+    std::unique_ptr<FILESYSTEM::MemoryMappedFile> mapped_file = FILESYSTEM::MemoryMappedFile::Open(filepath);
+    REQUIRE(mapped_file);
+
+    SECTION("Valid sections.")
+    {
+        std::optional<std::span<const uint32_t>> first_section = FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, 0, 3);
+        REQUIRE(first_section);
+        REQUIRE(3 == first_section->size());
+        REQUIRE(3 == (*first_section)[2]);
+        REQUIRE(0 == FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, 0, 4)->back());
+
+        std::optional<std::span<const uint32_t>> second_section = FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, second_section_offset_in_bytes, 2);
+        REQUIRE(second_section);
+        REQUIRE(4 == (*second_section)[0]);
+        REQUIRE(5 == (*second_section)[1]);
+
+        std::optional<std::span<const uint32_t>> empty_section_at_end = FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, empty_section_offset_in_bytes, 0);
+        REQUIRE(empty_section_at_end);
+        REQUIRE(empty_section_at_end->empty());
+    }
+
+    SECTION("Invalid sections.")
+    {
+        REQUIRE_FALSE(FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, 4, 1));
+        REQUIRE_FALSE(FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, second_section_offset_in_bytes, 5));
+        REQUIRE_FALSE(FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, 64, 0));
+        REQUIRE_FALSE(FILESYSTEM::BinaryFile::GetSection<uint32_t>(*mapped_file, 0, UINT64_MAX));
+    }
+
+    mapped_file.reset();
+    std::filesystem::remove(filepath);
+}
+
+TEST_CASE("Integers and strings appended to a section are read back in order.", "[BinaryFile]")
+{
+    // APPEND VALUES TO A SECTION.
+    std::string section;
+    FILESYSTEM::BinaryFile::AppendUInt32(7, section);
+    FILESYSTEM::BinaryFile::AppendString(u8"material.mtl", section);
+    FILESYSTEM::BinaryFile::AppendString(u8"", section);
+
+    // READ THE VALUES BACK.
+    std::span<const std::byte> remaining_section(reinterpret_cast<const std::byte*>(section.data()), section.size());
+    uint32_t value = 0;
+    REQUIRE(FILESYSTEM::BinaryFile::ReadUInt32(remaining_section, value));
+    REQUIRE(7 == value);
+    std::u8string text;
+    REQUIRE(FILESYSTEM::BinaryFile::ReadString(remaining_section, text));
+    REQUIRE(u8"material.mtl" == text);
+    REQUIRE(FILESYSTEM::BinaryFile::ReadString(remaining_section, text));
+    REQUIRE(text.empty());
+    REQUIRE(remaining_section.empty());
+
+    // READING PAST THE END SHOULD FAIL.
+    REQUIRE_FALSE(FILESYSTEM::BinaryFile::ReadUInt32(remaining_section, value));
+    std::span<const std::byte> truncated_string(reinterpret_cast<const std::byte*>(section.data()) + sizeof(uint32_t), section.size() - sizeof(uint32_t) - 5);
+    REQUIRE_FALSE(FILESYSTEM::BinaryFile::ReadString(truncated_string, text));
+}
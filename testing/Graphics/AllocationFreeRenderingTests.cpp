@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Benchmarking/AllocationTracker.h"
+#include "Graphics/Bitmap.h"
+#include "Graphics/Camera.h"
+#include "Graphics/Cube.h"
+#include "Graphics/DepthBuffer.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/Scene.h"
+#include "Graphics/SoftwareRasterizationAlgorithm.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+// These tests only detect allocations if the library is built with ALLOCATION_TRACKING_ENABLED
+// (see build_allocation_tests.sh), since allocation counts otherwise always remain zero.
+
+/// The number of frames rendered before measuring, which may allocate memory that later frames reuse.
+constexpr std::size_t ALLOCATION_TEST_WARM_UP_FRAME_COUNT = 2;
+/// The number of frames measured after warming up.
+constexpr std::size_t ALLOCATION_TEST_MEASURED_FRAME_COUNT = 3;
+
+/// Creates a scene for verifying rendering doesn't allocate memory.
+/// Multiple lights and a reflective material are used so that all per-light and per-reflection work is done.
+/// @return The scene.
+static GRAPHICS::Scene CreateAllocationTestScene()
+{
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->Shading = GRAPHICS::ShadingType::MATERIAL;
+    material->AmbientColor = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+    material->DiffuseColor = GRAPHICS::Color::RED;
+    material->SpecularColor = GRAPHICS::Color::WHITE;
+    material->SpecularPower = 20.0f;
+    material->ReflectivityProportion = 0.5f;
+    material->VertexColors = { GRAPHICS::Color::RED, GRAPHICS::Color::GREEN, GRAPHICS::Color::BLUE };
+
+    GRAPHICS::Scene scene;
+    scene.Objects.push_back(GRAPHICS::Cube::Create(material));
+    scene.PointLights = std::vector<GRAPHICS::Light>();
+    for (float light_x : { -3.0f, 3.0f })
+    {
+        GRAPHICS::Light light;
+        light.Type = GRAPHICS::LightType::POINT;
+        light.Color = GRAPHICS::Color::WHITE;
+        light.PointLightWorldPosition = MATH::Vector3f(light_x, 4.0f, 3.0f);
+        scene.PointLights->push_back(light);
+    }
+    return scene;
+}
+
+TEST_CASE("Rasterizing frames after warming up doesn't allocate memory.", "[AllocationTracker][SoftwareRasterizationAlgorithm]")
+{
+    // CREATE THE SCENE AND RENDER TARGETS.
+    GRAPHICS::Scene scene = CreateAllocationTestScene();
+    GRAPHICS::Camera camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 2.0f, 4.0f));
+    constexpr unsigned int WIDTH_IN_PIXELS = 64;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 48;
+    GRAPHICS::Bitmap render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::DepthBuffer depth_buffer(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS);
+
+    // WARM UP.
+    constexpr bool CULL_BACKFACES = true;
+    for (std::size_t frame_index = 0; frame_index < ALLOCATION_TEST_WARM_UP_FRAME_COUNT; ++frame_index)
+    {
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(scene, camera, CULL_BACKFACES, render_target, &depth_buffer);
+    }
+
+    // RENDER FRAMES WHILE MEASURING ALLOCATIONS.
+    BENCHMARKING::AllocationCounts counts_before_frames = BENCHMARKING::AllocationTracker::GetCurrentThreadCounts();
+    for (std::size_t frame_index = 0; frame_index < ALLOCATION_TEST_MEASURED_FRAME_COUNT; ++frame_index)
+    {
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(scene, camera, CULL_BACKFACES, render_target, &depth_buffer);
+    }
+    BENCHMARKING::AllocationCounts frame_allocations = BENCHMARKING::AllocationTracker::GetCurrentThreadCounts() - counts_before_frames;
+
+    // VERIFY NO MEMORY WAS ALLOCATED.
+    REQUIRE(0 == frame_allocations.AllocationCount);
+    REQUIRE(0 == frame_allocations.AllocatedByteCount);
+}
+
+TEST_CASE("Ray tracing frames after warming up doesn't allocate memory.", "[AllocationTracker][RayTracingAlgorithm]")
+{
+    // CREATE THE SCENE AND RENDER TARGET.
+    GRAPHICS::Scene scene = CreateAllocationTestScene();
+    GRAPHICS::Camera camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 2.0f, 4.0f));
+    constexpr unsigned int WIDTH_IN_PIXELS = 32;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 24;
+    GRAPHICS::Bitmap render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+
+    // MEASURE FRAMES BOTH WITH AND WITHOUT COUNTING INTERSECTION TESTS.
+    for (bool count_intersection_tests_per_pixel : { false, true })
+    {
+        // WARM UP.
+        GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+        ray_tracer.CountIntersectionTestsPerPixel = count_intersection_tests_per_pixel;
+        for (std::size_t frame_index = 0; frame_index < ALLOCATION_TEST_WARM_UP_FRAME_COUNT; ++frame_index)
+        {
+            ray_tracer.Render(scene, camera, render_target);
+        }
+
+        // RENDER FRAMES WHILE MEASURING ALLOCATIONS.
+        BENCHMARKING::AllocationCounts counts_before_frames = BENCHMARKING::AllocationTracker::GetCurrentThreadCounts();
+        for (std::size_t frame_index = 0; frame_index < ALLOCATION_TEST_MEASURED_FRAME_COUNT; ++frame_index)
+        {
+            ray_tracer.Render(scene, camera, render_target);
+        }
+        BENCHMARKING::AllocationCounts frame_allocations = BENCHMARKING::AllocationTracker::GetCurrentThreadCounts() - counts_before_frames;
+
+        // VERIFY NO MEMORY WAS ALLOCATED.
+        REQUIRE(0 == frame_allocations.AllocationCount);
+        REQUIRE(0 == frame_allocations.AllocatedByteCount);
+        REQUIRE(ray_tracer.LastRenderRayCounts.ShadowRayCount > 0);
+        REQUIRE(ray_tracer.LastRenderRayCounts.ReflectionRayCount > 0);
+    }
+}
@@ -0,0 +1,176 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Graphics/AssetManager.h"
+#include "Graphics/Modeling/WavefrontObjectModel.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Writes text to a file.
+/// @param[in]  filepath - The path of the file to write.
+/// @param[in]  text - The text to write.
+static void WriteTextFile(const std::filesystem::path& filepath, const std::string& text)
+{
+    std::ofstream file(filepath, std::ios::binary);
+    file << text;
+}
+
+/// Saves a 1x1 .bmp file.
+/// @param[in]  filepath - The path of the file to write.
+/// @param[in]  blue - The blue component of the single pixel.
+/// @param[in]  green - The green component of the single pixel.
+/// @param[in]  red - The red component of the single pixel.
+static void SaveSinglePixelTexture(const std::filesystem::path& filepath, const uint8_t blue, const uint8_t green, const uint8_t red)
+{
+    GRAPHICS::Bitmap texture(1, 1, GRAPHICS::ColorFormat::RGBA);
+    texture.FillPixels(GRAPHICS::Color(red, green, blue, uint8_t(0xFF)));
+    REQUIRE(texture.Save(filepath));
+}
+
+TEST_CASE("Models are loaded with all materials and textures.", "[AssetManager]")
+{
+    // CREATE A MODEL WITH TWO MATERIALS FROM DIFFERENT LIBRARIES, ONE OF WHICH IS TEXTURED.
+    std::filesystem::path asset_folder = std::filesystem::temp_directory_path() / "AssetManagerTests";
+    std::filesystem::create_directories(asset_folder);
+    SaveSinglePixelTexture(asset_folder / "texture.bmp", 0x10, 0x20, 0x30);
+    WriteTextFile(asset_folder / "textured.mtl", "newmtl textured\nKd 1 1 1\nmap_Kd texture.bmp\n");
+    WriteTextFile(asset_folder / "plain.mtl", "newmtl plain\nKd 0 1 0\n");
+    WriteTextFile(
+        asset_folder / "model.obj",
+        "mtllib textured.mtl\nmtllib plain.mtl\n"
+        "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+        "usemtl textured\nf 1 2 3\n"
+        "usemtl plain\nf 3 2 1\n");
+
+    // LOAD THE MODEL.
+    std::shared_ptr<GRAPHICS::Object3D> model;
+    {
+        GRAPHICS::AssetManager asset_manager(2);
+        GRAPHICS::AssetHandle<GRAPHICS::Object3D> model_handle = asset_manager.LoadModel(asset_folder / "model.obj");
+        REQUIRE(model_handle.IsValid());
+        model = model_handle.Get();
+        REQUIRE(model_handle.IsReady());
+    }
+
+    // VERIFY THE MATERIALS AND TEXTURES WERE ASSIGNED.
+    REQUIRE(model);
+    REQUIRE(2 == model->Triangles.size());
+    const std::shared_ptr<GRAPHICS::Material>& textured_material = model->Triangles[0].Material;
+    REQUIRE(textured_material);
+    REQUIRE(textured_material->Texture);
+    REQUIRE(1 == textured_material->Texture->GetWidthInPixels());
+    REQUIRE(1 == textured_material->Texture->GetHeightInPixels());
+    REQUIRE(0x302010FF == textured_material->Texture->GetRawData()[0]);
+    const std::shared_ptr<GRAPHICS::Material>& plain_material = model->Triangles[1].Material;
+    REQUIRE(plain_material);
+    REQUIRE_FALSE(plain_material->Texture);
+    REQUIRE(GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f) == plain_material->DiffuseColor);
+
+    std::filesystem::remove_all(asset_folder);
+}
+
+TEST_CASE("Models sharing a textured material library load on a single thread.", "[AssetManager]")
+{
+    // CREATE TWO MODELS THAT SHARE A TEXTURED MATERIAL LIBRARY.
+    std::filesystem::path asset_folder = std::filesystem::temp_directory_path() / "AssetManagerSharedLibraryTests";
+    std::filesystem::create_directories(asset_folder);
+    SaveSinglePixelTexture(asset_folder / "texture.bmp", 0x10, 0x20, 0x30);
+    WriteTextFile(asset_folder / "shared.mtl", "newmtl textured\nKd 1 1 1\nmap_Kd texture.bmp\n");
+    const std::string MODEL_TEXT = "mtllib shared.mtl\nv 0 0 0\nv 1 0 0\nv 0 1 0\nusemtl textured\nf 1 2 3\n";
+    WriteTextFile(asset_folder / "first.obj", MODEL_TEXT);
+    WriteTextFile(asset_folder / "second.obj", MODEL_TEXT);
+
+    // LOAD THE LIBRARY AND BOTH MODELS ON A SINGLE THREAD.
+    // The library load is queued first, so the models are queued while it waits on its texture.
+    // Both models then wait on the library, which must not leave the library unable to finish.
+    std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> materials;
+    std::shared_ptr<GRAPHICS::Object3D> first_model;
+    std::shared_ptr<GRAPHICS::Object3D> second_model;
+    {
+        GRAPHICS::AssetManager asset_manager(1);
+        GRAPHICS::AssetHandle<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> materials_handle = asset_manager.LoadMaterialLibrary(asset_folder / "shared.mtl");
+        GRAPHICS::AssetHandle<GRAPHICS::Object3D> first_model_handle = asset_manager.LoadModel(asset_folder / "first.obj");
+        GRAPHICS::AssetHandle<GRAPHICS::Object3D> second_model_handle = asset_manager.LoadModel(asset_folder / "second.obj");
+        materials = materials_handle.Get();
+        first_model = first_model_handle.Get();
+        second_model = second_model_handle.Get();
+    }
+
+    // VERIFY BOTH MODELS WERE TEXTURED.
+    REQUIRE(materials);
+    REQUIRE(1 == materials->size());
+    REQUIRE(first_model);
+    REQUIRE(1 == first_model->Triangles.size());
+    REQUIRE(first_model->Triangles[0].Material->Texture);
+    REQUIRE(second_model);
+    REQUIRE(1 == second_model->Triangles.size());
+    REQUIRE(second_model->Triangles[0].Material->Texture);
+
+    std::filesystem::remove_all(asset_folder);
+}
+
+TEST_CASE("Assets that fail to load are null.", "[AssetManager]")
+{
+    GRAPHICS::AssetManager asset_manager(1);
+    std::filesystem::path missing_filepath = std::filesystem::temp_directory_path() / "AssetManagerTests.missing.obj";
+    std::filesystem::remove(missing_filepath);
+
+    GRAPHICS::AssetHandle<GRAPHICS::Object3D> model_handle = asset_manager.LoadModel(missing_filepath);
+
+    REQUIRE_FALSE(model_handle.Get());
+}
+
+TEST_CASE("Placeholders are used for assets that aren't loaded.", "[AssetManager]")
+{
+    auto placeholder = std::make_shared<GRAPHICS::Bitmap>(1, 1, GRAPHICS::ColorFormat::RGBA);
+
+    SECTION("Invalid handle.")
+    {
+        GRAPHICS::AssetHandle<GRAPHICS::Bitmap> handle;
+        REQUIRE_FALSE(handle.IsValid());
+        REQUIRE_FALSE(handle.IsReady());
+        REQUIRE(placeholder == handle.GetOr(placeholder));
+    }
+
+    SECTION("Failed load.")
+    {
+        GRAPHICS::AssetManager asset_manager(1);
+        std::filesystem::path missing_filepath = std::filesystem::temp_directory_path() / "AssetManagerTests.missing.bmp";
+        std::filesystem::remove(missing_filepath);
+        GRAPHICS::AssetHandle<GRAPHICS::Bitmap> handle = asset_manager.LoadTexture(missing_filepath);
+        handle.Get();
+        REQUIRE(placeholder == handle.GetOr(placeholder));
+    }
+}
+
+TEST_CASE("Models share materials and textures with models loaded without the manager.", "[AssetManager]")
+{
+    // CREATE A MODEL WITH A TEXTURED MATERIAL.
+    std::filesystem::path asset_folder = std::filesystem::temp_directory_path() / "AssetManagerSharedCacheTests";
+    std::filesystem::create_directories(asset_folder);
+    SaveSinglePixelTexture(asset_folder / "texture.bmp", 0x10, 0x20, 0x30);
+    WriteTextFile(asset_folder / "textured.mtl", "newmtl textured\nKd 1 1 1\nmap_Kd texture.bmp\n");
+    WriteTextFile(asset_folder / "model.obj", "mtllib textured.mtl\nv 0 0 0\nv 1 0 0\nv 0 1 0\nusemtl textured\nf 1 2 3\n");
+
+    // LOAD THE MODEL BOTH DIRECTLY AND VIA THE MANAGER.
+    std::optional<GRAPHICS::Object3D> directly_loaded_model = GRAPHICS::MODELING::WavefrontObjectModel::Load(asset_folder / "model.obj");
+    std::shared_ptr<GRAPHICS::Object3D> managed_model;
+    std::shared_ptr<GRAPHICS::Bitmap> managed_texture;
+    {
+        GRAPHICS::AssetManager asset_manager(1);
+        managed_model = asset_manager.LoadModel(asset_folder / "model.obj").Get();
+        managed_texture = asset_manager.LoadTexture(asset_folder / "texture.bmp").Get();
+    }
+    std::filesystem::remove_all(asset_folder);
+
+    // VERIFY THE MATERIAL AND TEXTURE WERE ONLY LOADED ONCE.
+    REQUIRE(directly_loaded_model);
+    REQUIRE(managed_model);
+    REQUIRE(directly_loaded_model->Triangles[0].Material);
+    REQUIRE(directly_loaded_model->Triangles[0].Material == managed_model->Triangles[0].Material);
+    REQUIRE(managed_texture);
+    REQUIRE(managed_texture == managed_model->Triangles[0].Material->Texture);
+}
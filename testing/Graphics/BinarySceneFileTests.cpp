@@ -0,0 +1,187 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include "Graphics/BinarySceneFile.h"
+#include "Graphics/TransformNode.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Scenes can be written to and loaded from binary scene files.", "[BinarySceneFile]")
+{
+    // CREATE A FOLDER FOR THE SCENE AND ITS ASSETS.
+    std::filesystem::path scene_folder = std::filesystem::temp_directory_path() / "BinarySceneFileTests";
+    std::filesystem::create_directories(scene_folder);
+    {
+        std::ofstream mesh_file(scene_folder / "mesh.obj", std::ios::binary);
+        mesh_file << "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\nf 1 2 3\nf 2 4 3\n";
+    }
+    GRAPHICS::Bitmap referenced_texture(1, 1, GRAPHICS::ColorFormat::RGBA);
+    referenced_texture.WritePixel(0, 0, uint32_t(0x102030FF));
+    REQUIRE(referenced_texture.Save(scene_folder / "texture.bmp"));
+
+    // CREATE A SCENE WITH EMBEDDED AND REFERENCED ASSETS.
+    GRAPHICS::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.1f, 0.2f, 0.3f, 1.0f);
+
+    auto embedded_texture = std::make_shared<GRAPHICS::Bitmap>(2, 1, GRAPHICS::ColorFormat::ARGB);
+    embedded_texture->WritePixel(0, 0, uint32_t(0xFF112233));
+    embedded_texture->WritePixel(1, 0, uint32_t(0x80445566));
+    auto textured_material = std::make_shared<GRAPHICS::Material>();
+    textured_material->Shading = GRAPHICS::ShadingType::TEXTURED;
+    textured_material->Texture = embedded_texture;
+    textured_material->VertexColors = { GRAPHICS::Color::WHITE, GRAPHICS::Color::BLACK, GRAPHICS::Color(0.5f, 0.25f, 0.125f, 1.0f) };
+    textured_material->VertexTextureCoordinates = { MATH::Vector2f(0.0f, 0.0f), MATH::Vector2f(1.0f, 0.0f), MATH::Vector2f(0.0f, 1.0f) };
+    textured_material->DiffuseColor = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f);
+    textured_material->SpecularPower = 20.0f;
+    auto referenced_texture_material = std::make_shared<GRAPHICS::Material>();
+    referenced_texture_material->Shading = GRAPHICS::ShadingType::TEXTURED;
+    referenced_texture_material->Texture = std::make_shared<GRAPHICS::Bitmap>(referenced_texture);
+
+    auto root_node = std::make_shared<GRAPHICS::TransformNode>();
+    root_node->SetLocalPosition(MATH::Vector3f(10.0f, 0.0f, 0.0f));
+    auto child_node = std::make_shared<GRAPHICS::TransformNode>();
+    REQUIRE(child_node->SetParent(root_node.get()));
+    child_node->SetLocalScale(MATH::Vector3f(2.0f, 2.0f, 2.0f));
+
+    constexpr std::size_t OBJECT_COUNT = 2;
+    scene.Objects.reserve(OBJECT_COUNT);
+    GRAPHICS::Object3D& embedded_object = scene.Objects.emplace_back();
+    embedded_object.Triangles.push_back(GRAPHICS::Triangle(
+        textured_material,
+        { MATH::Vector3f(1.0f, 2.0f, 3.0f), MATH::Vector3f(4.0f, 5.0f, 6.0f), MATH::Vector3f(7.0f, 8.0f, 9.0f) }));
+    embedded_object.Triangles.push_back(GRAPHICS::Triangle(
+        textured_material,
+        { MATH::Vector3f(-1.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f) }));
+    embedded_object.Triangles.push_back(GRAPHICS::Triangle(
+        referenced_texture_material,
+        { MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 1.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f) }));
+    embedded_object.WorldPosition = MATH::Vector3f(1.0f, 2.0f, 3.0f);
+    embedded_object.RotationInRadians.Y = MATH::Angle<float>::Radians(0.5f);
+    embedded_object.Parent = child_node;
+
+    GRAPHICS::Object3D& referenced_object = scene.Objects.emplace_back();
+    referenced_object.Scale = MATH::Vector3f(3.0f, 3.0f, 3.0f);
+
+    GRAPHICS::Light point_light;
+    point_light.Type = GRAPHICS::LightType::POINT;
+    point_light.Color = GRAPHICS::Color::WHITE;
+    point_light.PointLightWorldPosition = MATH::Vector3f(0.0f, 5.0f, 0.0f);
+    scene.PointLights = std::vector<GRAPHICS::Light>{ point_light };
+
+    // WRITE THE SCENE.
+    GRAPHICS::BinarySceneFile::AssetReferences asset_references;
+    asset_references.ObjectMeshFilepaths = { "", "mesh.obj" };
+    asset_references.TextureFilepaths[referenced_texture_material->Texture.get()] = "texture.bmp";
+    std::filesystem::path scene_filepath = scene_folder / "scene.bin";
+    REQUIRE(GRAPHICS::BinarySceneFile::Write(scene, scene_filepath, asset_references));
+
+    // LOAD THE SCENE.
+    GRAPHICS::TextureCache texture_cache;
+    std::optional<GRAPHICS::Scene> loaded_scene = GRAPHICS::BinarySceneFile::Load(scene_filepath, &texture_cache);
+
+    // VERIFY THE SCENE WAS LOADED.
+    REQUIRE(loaded_scene);
+    REQUIRE(scene.BackgroundColor == loaded_scene->BackgroundColor);
+    REQUIRE(2 == loaded_scene->Objects.size());
+
+    // VERIFY THE EMBEDDED OBJECT.
+    const GRAPHICS::Object3D& loaded_embedded_object = loaded_scene->Objects[0];
+    REQUIRE(3 == loaded_embedded_object.Triangles.size());
+    for (std::size_t triangle_index = 0; triangle_index < embedded_object.Triangles.size(); ++triangle_index)
+    {
+        REQUIRE(embedded_object.Triangles[triangle_index].Vertices == loaded_embedded_object.Triangles[triangle_index].Vertices);
+    }
+    REQUIRE(loaded_embedded_object.WorldTransform() == embedded_object.WorldTransform());
+
+    // VERIFY MATERIALS ARE SHARED LIKE IN THE ORIGINAL SCENE.
+    const std::shared_ptr<GRAPHICS::Material>& loaded_textured_material = loaded_embedded_object.Triangles[0].Material;
+    REQUIRE(loaded_textured_material);
+    REQUIRE(loaded_textured_material == loaded_embedded_object.Triangles[1].Material);
+    REQUIRE(GRAPHICS::ShadingType::TEXTURED == loaded_textured_material->Shading);
+    REQUIRE(textured_material->VertexColors == loaded_textured_material->VertexColors);
+    REQUIRE(textured_material->VertexTextureCoordinates == loaded_textured_material->VertexTextureCoordinates);
+    REQUIRE(textured_material->DiffuseColor == loaded_textured_material->DiffuseColor);
+    REQUIRE(20.0f == loaded_textured_material->SpecularPower);
+
+    // VERIFY THE TEXTURES.
+    REQUIRE(loaded_textured_material->Texture);
+    REQUIRE(GRAPHICS::ColorFormat::ARGB == loaded_textured_material->Texture->GetColorFormat());
+    REQUIRE(2 == loaded_textured_material->Texture->GetWidthInPixels());
+    REQUIRE(0x80445566 == loaded_textured_material->Texture->GetRawData()[1]);
+    const std::shared_ptr<GRAPHICS::Bitmap>& loaded_referenced_texture = loaded_embedded_object.Triangles[2].Material->Texture;
+    REQUIRE(loaded_referenced_texture);
+    REQUIRE(0x102030FF == loaded_referenced_texture->GetRawData()[0]);
+    REQUIRE(1 == texture_cache.GetStatistics().ResidentTextureCount);
+
+    // VERIFY THE REFERENCED OBJECT.
+    const GRAPHICS::Object3D& loaded_referenced_object = loaded_scene->Objects[1];
+    REQUIRE(2 == loaded_referenced_object.Triangles.size());
+    REQUIRE(MATH::Vector3f(3.0f, 3.0f, 3.0f) == loaded_referenced_object.Scale);
+    REQUIRE_FALSE(loaded_referenced_object.Parent);
+
+    // VERIFY THE LIGHTS.
+    REQUIRE(loaded_scene->PointLights);
+    REQUIRE(1 == loaded_scene->PointLights->size());
+    REQUIRE(GRAPHICS::LightType::POINT == loaded_scene->PointLights->at(0).Type);
+    REQUIRE(point_light.PointLightWorldPosition == loaded_scene->PointLights->at(0).PointLightWorldPosition);
+
+    std::filesystem::remove_all(scene_folder);
+}
+
+TEST_CASE("Scenes without lighting remain without lighting when reloaded.", "[BinarySceneFile]")
+{
+    // WRITE AND RELOAD AN EMPTY SCENE.
+    std::filesystem::path scene_filepath = std::filesystem::temp_directory_path() / "BinarySceneFileTests.empty.bin";
+    GRAPHICS::Scene scene;
+    REQUIRE(GRAPHICS::BinarySceneFile::Write(scene, scene_filepath, {}));
+    std::optional<GRAPHICS::Scene> loaded_scene = GRAPHICS::BinarySceneFile::Load(scene_filepath);
+    std::filesystem::remove(scene_filepath);
+
+    // VERIFY THE SCENE IS STILL EMPTY.
+    REQUIRE(loaded_scene);
+    REQUIRE(loaded_scene->Objects.empty());
+    REQUIRE_FALSE(loaded_scene->PointLights);
+}
+
+TEST_CASE("Invalid binary scene files fail to be loaded.", "[BinarySceneFile]")
+{
+    // WRITE A VALID SCENE FILE.
+    std::filesystem::path scene_filepath = std::filesystem::temp_directory_path() / "BinarySceneFileTests.invalid.bin";
+    GRAPHICS::Scene scene;
+    GRAPHICS::Object3D& object_3D = scene.Objects.emplace_back();
+    object_3D.Triangles.push_back(GRAPHICS::Triangle::CreateEquilateral(std::make_shared<GRAPHICS::Material>()));
+    REQUIRE(GRAPHICS::BinarySceneFile::Write(scene, scene_filepath, {}));
+    std::uintmax_t file_size_in_bytes = std::filesystem::file_size(scene_filepath);
+
+    SECTION("Missing file.")
+    {
+        std::filesystem::remove(scene_filepath);
+        REQUIRE_FALSE(GRAPHICS::BinarySceneFile::Load(scene_filepath));
+    }
+
+    SECTION("Wrong magic number.")
+    {
+        {
+            std::fstream file(scene_filepath, std::ios::binary | std::ios::in | std::ios::out);
+            file.write("XXXX", 4);
+        }
+        REQUIRE_FALSE(GRAPHICS::BinarySceneFile::Load(scene_filepath));
+    }
+
+    SECTION("Truncated file.")
+    {
+        std::filesystem::resize_file(scene_filepath, file_size_in_bytes - 1);
+        REQUIRE_FALSE(GRAPHICS::BinarySceneFile::Load(scene_filepath));
+    }
+
+    SECTION("Missing referenced mesh.")
+    {
+        GRAPHICS::BinarySceneFile::AssetReferences asset_references;
+        asset_references.ObjectMeshFilepaths = { "BinarySceneFileTests.missing.obj" };
+        REQUIRE(GRAPHICS::BinarySceneFile::Write(scene, scene_filepath, asset_references));
+        REQUIRE_FALSE(GRAPHICS::BinarySceneFile::Load(scene_filepath));
+    }
+
+    std::filesystem::remove(scene_filepath);
+}
@@ -0,0 +1,195 @@
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include "Graphics/Bitmap.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates the bytes of a .bmp file.
+/// @param[in]  width - The width of the image in pixels.
+/// @param[in]  height - The height of the image in pixels (negative for top-down images).
+/// @param[in]  bits_per_pixel - The number of bits per pixel.
+/// @param[in]  compression_type - The compression type in the info header.
+/// @param[in]  extra_header_bytes - Any bytes to write after the basic info header (like color masks).
+/// @param[in]  pixel_data - The pixel data, including any row padding.
+/// @return The bytes of the .bmp file.
+static std::vector<uint8_t> CreateBmpFile(
+    const int32_t width,
+    const int32_t height,
+    const uint16_t bits_per_pixel,
+    const uint32_t compression_type,
+    const std::vector<uint8_t>& extra_header_bytes,
+    const std::vector<uint8_t>& pixel_data)
+{
+    std::vector<uint8_t> file_bytes;
+    auto append = [&file_bytes](const auto& field)
+    {
+        const uint8_t* field_bytes = reinterpret_cast<const uint8_t*>(&field);
+        file_bytes.insert(file_bytes.end(), field_bytes, field_bytes + sizeof(field));
+    };
+
+    // WRITE THE FILE HEADER.
+    constexpr uint32_t HEADERS_SIZE_IN_BYTES = 14 + 40;
+    uint32_t pixel_data_offset = HEADERS_SIZE_IN_BYTES + static_cast<uint32_t>(extra_header_bytes.size());
+    append(uint16_t(0x4D42));
+    append(uint32_t(pixel_data_offset + pixel_data.size()));
+    append(uint32_t(0));
+    append(pixel_data_offset);
+
+    // WRITE THE INFO HEADER.
+    append(uint32_t(40));
+    append(width);
+    append(height);
+    append(uint16_t(1));
+    append(bits_per_pixel);
+    append(compression_type);
+    append(uint32_t(pixel_data.size()));
+    append(int32_t(2835));
+    append(int32_t(2835));
+    append(uint32_t(0));
+    append(uint32_t(0));
+    file_bytes.insert(file_bytes.end(), extra_header_bytes.cbegin(), extra_header_bytes.cend());
+
+    // WRITE THE PIXEL DATA.
+    file_bytes.insert(file_bytes.end(), pixel_data.cbegin(), pixel_data.cend());
+    return file_bytes;
+}
+
+/// Loads a bitmap from bytes of a .bmp file.
+/// @param[in]  file_bytes - The bytes of the .bmp file.
+/// @param[in]  color_format - The color format to load the bitmap in.
+/// @return The loaded bitmap, if successfully loaded; null otherwise.
+static std::shared_ptr<GRAPHICS::Bitmap> LoadBmpFile(const std::vector<uint8_t>& file_bytes, const GRAPHICS::ColorFormat color_format)
+{
+    std::filesystem::path bitmap_filepath = std::filesystem::temp_directory_path() / "BitmapTests.bmp";
+    {
+        std::ofstream bitmap_file(bitmap_filepath, std::ios::binary);
+        bitmap_file.write(reinterpret_cast<const char*>(file_bytes.data()), static_cast<std::streamsize>(file_bytes.size()));
+    }
+    std::shared_ptr<GRAPHICS::Bitmap> bitmap = GRAPHICS::Bitmap::Load(bitmap_filepath, color_format);
+    std::filesystem::remove(bitmap_filepath);
+    return bitmap;
+}
+
+TEST_CASE("Bottom-up 24-bit bitmaps with row padding can be loaded.", "[Bitmap][Load]")
+{
+    // CREATE A 3x2 IMAGE.
+    // Each row is 9 bytes of pixels followed by 3 bytes of padding.
+    // The bottom row is stored first.
+    const std::vector<uint8_t> PIXEL_DATA =
+    {
+        0x00, 0x00, 0xFF,   0x00, 0xFF, 0x00,   0xFF, 0x00, 0x00,   0xEE, 0xEE, 0xEE,
+        0x10, 0x20, 0x30,   0x40, 0x50, 0x60,   0x70, 0x80, 0x90,   0xEE, 0xEE, 0xEE,
+    };
+    std::vector<uint8_t> file_bytes = CreateBmpFile(3, 2, 24, 0, {}, PIXEL_DATA);
+
+    // LOAD THE BITMAP.
+    std::shared_ptr<GRAPHICS::Bitmap> bitmap = LoadBmpFile(file_bytes, GRAPHICS::ColorFormat::RGBA);
+
+    // VERIFY THE PIXELS.
+    REQUIRE(bitmap);
+    REQUIRE(3 == bitmap->GetWidthInPixels());
+    REQUIRE(2 == bitmap->GetHeightInPixels());
+    const uint32_t* pixels = bitmap->GetRawData();
+    REQUIRE(0x302010FF == pixels[0]);
+    REQUIRE(0x605040FF == pixels[1]);
+    REQUIRE(0x908070FF == pixels[2]);
+    REQUIRE(0xFF0000FF == pixels[3]);
+    REQUIRE(0x00FF00FF == pixels[4]);
+    REQUIRE(0x0000FFFF == pixels[5]);
+}
+
+TEST_CASE("Top-down 32-bit bitmaps can be loaded.", "[Bitmap][Load]")
+{
+    // CREATE A 1x2 IMAGE.
+    // The top row is stored first since the height is negative.
+    const std::vector<uint8_t> PIXEL_DATA =
+    {
+        0x01, 0x02, 0x03, 0x40,
+        0x05, 0x06, 0x07, 0x80,
+    };
+
+    SECTION("Without alpha.")
+    {
+        std::vector<uint8_t> file_bytes = CreateBmpFile(1, -2, 32, 0, {}, PIXEL_DATA);
+        std::shared_ptr<GRAPHICS::Bitmap> bitmap = LoadBmpFile(file_bytes, GRAPHICS::ColorFormat::ARGB);
+        REQUIRE(bitmap);
+        REQUIRE(0xFF030201 == bitmap->GetRawData()[0]);
+        REQUIRE(0xFF070605 == bitmap->GetRawData()[1]);
+    }
+
+    SECTION("With alpha.")
+    {
+        const std::vector<uint8_t> COLOR_MASKS =
+        {
+            0x00, 0x00, 0xFF, 0x00,
+            0x00, 0xFF, 0x00, 0x00,
+            0xFF, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0xFF,
+        };
+        constexpr uint32_t ALPHA_BIT_FIELDS = 6;
+        std::vector<uint8_t> file_bytes = CreateBmpFile(1, -2, 32, ALPHA_BIT_FIELDS, COLOR_MASKS, PIXEL_DATA);
+        std::shared_ptr<GRAPHICS::Bitmap> bitmap = LoadBmpFile(file_bytes, GRAPHICS::ColorFormat::RGBA);
+        REQUIRE(bitmap);
+        REQUIRE(0x03020140 == bitmap->GetRawData()[0]);
+        REQUIRE(0x07060580 == bitmap->GetRawData()[1]);
+    }
+}
+
+TEST_CASE("Invalid bitmaps fail to be loaded.", "[Bitmap][Load]")
+{
+    const std::vector<uint8_t> PIXEL_DATA = { 0x01, 0x02, 0x03, 0x00 };
+
+    SECTION("Unsupported bits per pixel.")
+    {
+        std::vector<uint8_t> file_bytes = CreateBmpFile(1, 1, 16, 0, {}, PIXEL_DATA);
+        REQUIRE_FALSE(LoadBmpFile(file_bytes, GRAPHICS::ColorFormat::RGBA));
+    }
+
+    SECTION("Compressed pixels.")
+    {
+        constexpr uint32_t RUN_LENGTH_ENCODING_8 = 1;
+        std::vector<uint8_t> file_bytes = CreateBmpFile(1, 1, 24, RUN_LENGTH_ENCODING_8, {}, PIXEL_DATA);
+        REQUIRE_FALSE(LoadBmpFile(file_bytes, GRAPHICS::ColorFormat::RGBA));
+    }
+
+    SECTION("Truncated pixels.")
+    {
+        std::vector<uint8_t> file_bytes = CreateBmpFile(2, 1, 24, 0, {}, PIXEL_DATA);
+        REQUIRE_FALSE(LoadBmpFile(file_bytes, GRAPHICS::ColorFormat::RGBA));
+    }
+
+    SECTION("Wrong file type.")
+    {
+        std::vector<uint8_t> file_bytes = CreateBmpFile(1, 1, 24, 0, {}, PIXEL_DATA);
+        file_bytes[0] = 'X';
+        REQUIRE_FALSE(LoadBmpFile(file_bytes, GRAPHICS::ColorFormat::RGBA));
+    }
+}
+
+TEST_CASE("Saved bitmaps can be loaded with the same pixels.", "[Bitmap][Save]")
+{
+    // CREATE A 2x2 IMAGE.
+    GRAPHICS::Bitmap bitmap(2, 2, GRAPHICS::ColorFormat::RGBA);
+    bitmap.WritePixel(0, 0, uint32_t(0x102030FF));
+    bitmap.WritePixel(1, 0, uint32_t(0x405060FF));
+    bitmap.WritePixel(0, 1, uint32_t(0x708090FF));
+    bitmap.WritePixel(1, 1, uint32_t(0xA0B0C0FF));
+
+    // SAVE AND RELOAD THE BITMAP.
+    std::filesystem::path bitmap_filepath = std::filesystem::temp_directory_path() / "BitmapSaveTests.bmp";
+    REQUIRE(bitmap.Save(bitmap_filepath));
+    std::shared_ptr<GRAPHICS::Bitmap> loaded_bitmap = GRAPHICS::Bitmap::Load(bitmap_filepath, GRAPHICS::ColorFormat::RGBA);
+    std::filesystem::remove(bitmap_filepath);
+
+    // VERIFY THE PIXELS.
+    REQUIRE(loaded_bitmap);
+    REQUIRE(2 == loaded_bitmap->GetWidthInPixels());
+    REQUIRE(2 == loaded_bitmap->GetHeightInPixels());
+    const uint32_t* pixels = loaded_bitmap->GetRawData();
+    REQUIRE(0x102030FF == pixels[0]);
+    REQUIRE(0x405060FF == pixels[1]);
+    REQUIRE(0x708090FF == pixels[2]);
+    REQUIRE(0xA0B0C0FF == pixels[3]);
+}
@@ -0,0 +1,205 @@
+#include <cstdint>
+#include <vector>
+#include "Graphics/ColorConversion.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Batch packing matches packing individual colors.", "[ColorConversion][Pack]")
+{
+    // CREATE COLORS COVERING ALL INTEGRAL COMPONENT VALUES.
+    // An odd number of colors is used to cover both batched and leftover colors.
+    constexpr std::size_t COLOR_COUNT = 259;
+    std::vector<GRAPHICS::Color> colors;
+    for (std::size_t color_index = 0; color_index < COLOR_COUNT; ++color_index)
+    {
+        uint8_t component = static_cast<uint8_t>(color_index);
+        uint8_t reversed_component = static_cast<uint8_t>(255 - component);
+        colors.emplace_back(component, reversed_component, static_cast<uint8_t>(component / 2), reversed_component);
+    }
+
+    for (GRAPHICS::ColorFormat color_format : { GRAPHICS::ColorFormat::RGBA, GRAPHICS::ColorFormat::ARGB })
+    {
+        // PACK THE COLORS IN A BATCH.
+        std::vector<uint32_t> batch_packed_colors(COLOR_COUNT);
+        GRAPHICS::ColorConversion::Pack(colors.data(), COLOR_COUNT, color_format, batch_packed_colors.data());
+
+        // VERIFY THE COLORS WERE PACKED THE SAME AS INDIVIDUALLY.
+        for (std::size_t color_index = 0; color_index < COLOR_COUNT; ++color_index)
+        {
+            uint32_t expected_packed_color = colors[color_index].Pack(color_format);
+            REQUIRE(expected_packed_color == batch_packed_colors[color_index]);
+        }
+    }
+}
+
+TEST_CASE("Batch packing clamps out-of-range components.", "[ColorConversion][Pack]")
+{
+    // PACK COLORS WITH OUT-OF-RANGE COMPONENTS.
+    const float REDS[] = { 2.0f, -1.0f, 0.5f, 1.5f, -0.5f };
+    const float GREENS[] = { -1.0f, 2.0f, 0.5f, 1.5f, -0.5f };
+    const float BLUES[] = { 0.0f, 1.0f, 2.0f, -3.0f, 1.0f };
+    const float ALPHAS[] = { 1.0f, 1.0f, -1.0f, 9.0f, 0.0f };
+    constexpr std::size_t COLOR_COUNT = 5;
+    uint32_t packed_colors[COLOR_COUNT] = {};
+    GRAPHICS::ColorConversion::Pack(REDS, GREENS, BLUES, ALPHAS, COLOR_COUNT, GRAPHICS::ColorFormat::RGBA, packed_colors);
+
+    // VERIFY THE COMPONENTS WERE CLAMPED.
+    REQUIRE(0xFF0000FF == packed_colors[0]);
+    REQUIRE(0x00FFFFFF == packed_colors[1]);
+    REQUIRE(0x7F7FFF00 == packed_colors[2]);
+    REQUIRE(0xFFFF00FF == packed_colors[3]);
+    REQUIRE(0x0000FF00 == packed_colors[4]);
+}
+
+TEST_CASE("Batch unpacking matches unpacking individual colors.", "[ColorConversion][Unpack]")
+{
+    // CREATE PACKED COLORS WITH VARIED COMPONENTS.
+    constexpr std::size_t COLOR_COUNT = 258;
+    std::vector<uint32_t> packed_colors;
+    for (uint32_t color_index = 0; color_index < COLOR_COUNT; ++color_index)
+    {
+        uint32_t packed_color = (color_index * 0x01030507u) ^ 0xA5C3E10Fu;
+        packed_colors.push_back(packed_color);
+    }
+
+    for (GRAPHICS::ColorFormat color_format : { GRAPHICS::ColorFormat::RGBA, GRAPHICS::ColorFormat::ARGB })
+    {
+        // UNPACK THE COLORS IN A BATCH.
+        std::vector<GRAPHICS::Color> batch_unpacked_colors(COLOR_COUNT, GRAPHICS::Color::BLACK);
+        GRAPHICS::ColorConversion::Unpack(packed_colors.data(), COLOR_COUNT, color_format, batch_unpacked_colors.data());
+
+        // VERIFY THE COLORS WERE UNPACKED EXACTLY THE SAME AS INDIVIDUALLY.
+        for (std::size_t color_index = 0; color_index < COLOR_COUNT; ++color_index)
+        {
+            GRAPHICS::Color expected_color = GRAPHICS::Color::Unpack(packed_colors[color_index], color_format);
+            const GRAPHICS::Color& actual_color = batch_unpacked_colors[color_index];
+            REQUIRE(expected_color.Red == actual_color.Red);
+            REQUIRE(expected_color.Green == actual_color.Green);
+            REQUIRE(expected_color.Blue == actual_color.Blue);
+            REQUIRE(expected_color.Alpha == actual_color.Alpha);
+        }
+    }
+}
+
+TEST_CASE("Packed colors can be reformatted between RGBA and ARGB.", "[ColorConversion][Reformat]")
+{
+    // CONVERT RGBA COLORS TO ARGB.
+    std::vector<uint32_t> rgba_colors = { 0x11223344, 0xFF000080, 0x00FF0001, 0x0000FFFF, 0xAABBCCDD };
+    std::vector<uint32_t> argb_colors(rgba_colors.size());
+    GRAPHICS::ColorConversion::Reformat(
+        rgba_colors.data(),
+        rgba_colors.size(),
+        GRAPHICS::ColorFormat::RGBA,
+        GRAPHICS::ColorFormat::ARGB,
+        argb_colors.data());
+
+    // VERIFY THE ARGB COLORS.
+    const std::vector<uint32_t> EXPECTED_ARGB_COLORS = { 0x44112233, 0x80FF0000, 0x0100FF00, 0xFF0000FF, 0xDDAABBCC };
+    REQUIRE(EXPECTED_ARGB_COLORS == argb_colors);
+
+    // CONVERT THE COLORS BACK TO RGBA IN-PLACE.
+    GRAPHICS::ColorConversion::Reformat(
+        argb_colors.data(),
+        argb_colors.size(),
+        GRAPHICS::ColorFormat::ARGB,
+        GRAPHICS::ColorFormat::RGBA,
+        argb_colors.data());
+
+    // VERIFY THE ORIGINAL COLORS WERE RESTORED.
+    REQUIRE(rgba_colors == argb_colors);
+}
+
+TEST_CASE("BGR and BGRA bytes can be converted to packed colors.", "[ColorConversion][Reformat]")
+{
+    // CREATE BYTES FOR ENOUGH COLORS TO COVER BOTH BATCHED AND LEFTOVER COLORS.
+    constexpr std::size_t COLOR_COUNT = 70;
+    std::vector<uint8_t> bgra_bytes;
+    std::vector<uint8_t> bgr_bytes;
+    for (std::size_t color_index = 0; color_index < COLOR_COUNT; ++color_index)
+    {
+        uint8_t blue = static_cast<uint8_t>(color_index);
+        uint8_t green = static_cast<uint8_t>(color_index * 3);
+        uint8_t red = static_cast<uint8_t>(255 - color_index);
+        uint8_t alpha = static_cast<uint8_t>(color_index * 7);
+        bgra_bytes.insert(bgra_bytes.end(), { blue, green, red, alpha });
+        bgr_bytes.insert(bgr_bytes.end(), { blue, green, red });
+    }
+
+    for (GRAPHICS::ColorFormat color_format : { GRAPHICS::ColorFormat::RGBA, GRAPHICS::ColorFormat::ARGB })
+    {
+        // CONVERT THE BYTES.
+        std::vector<uint32_t> bgr_colors(COLOR_COUNT);
+        GRAPHICS::ColorConversion::ReformatBgr(bgr_bytes.data(), COLOR_COUNT, color_format, bgr_colors.data());
+        std::vector<uint32_t> opaque_bgra_colors(COLOR_COUNT);
+        GRAPHICS::ColorConversion::ReformatBgra(bgra_bytes.data(), COLOR_COUNT, false, color_format, opaque_bgra_colors.data());
+        std::vector<uint32_t> bgra_colors(COLOR_COUNT);
+        GRAPHICS::ColorConversion::ReformatBgra(bgra_bytes.data(), COLOR_COUNT, true, color_format, bgra_colors.data());
+
+        // VERIFY THE COLORS MATCH PACKING INDIVIDUAL COLORS.
+        for (std::size_t color_index = 0; color_index < COLOR_COUNT; ++color_index)
+        {
+            const uint8_t* bgra = bgra_bytes.data() + color_index * 4;
+            GRAPHICS::Color opaque_color(bgra[2], bgra[1], bgra[0], static_cast<uint8_t>(255));
+            GRAPHICS::Color color(bgra[2], bgra[1], bgra[0], bgra[3]);
+            REQUIRE(opaque_color.Pack(color_format) == bgr_colors[color_index]);
+            REQUIRE(opaque_color.Pack(color_format) == opaque_bgra_colors[color_index]);
+            REQUIRE(color.Pack(color_format) == bgra_colors[color_index]);
+        }
+    }
+}
+
+TEST_CASE("Packed colors can be converted to YUV.", "[ColorConversion][Yuv]")
+{
+    // CONVERT PRIMARY COLORS AND SHADES OF GRAY.
+    // An odd number of colors is used to cover both batched and leftover colors.
+    const std::vector<uint32_t> RGBA_COLORS = { 0x000000FF, 0xFFFFFFFF, 0xFF0000FF, 0x00FF00FF, 0x0000FFFF, 0x80808080, 0x808080FF };
+    std::vector<uint8_t> lumas(RGBA_COLORS.size());
+    std::vector<uint8_t> blue_chromas(RGBA_COLORS.size());
+    std::vector<uint8_t> red_chromas(RGBA_COLORS.size());
+    GRAPHICS::ColorConversion::ConvertToYuv(
+        RGBA_COLORS.data(),
+        RGBA_COLORS.size(),
+        GRAPHICS::ColorFormat::RGBA,
+        lumas.data(),
+        blue_chromas.data(),
+        red_chromas.data());
+
+    // VERIFY THE COMPONENTS ARE WITHIN THE EXPECTED RANGES.
+    const std::vector<uint8_t> EXPECTED_LUMAS = { 16, 235, 82, 144, 41, 126, 126 };
+    const std::vector<uint8_t> EXPECTED_BLUE_CHROMAS = { 128, 128, 90, 54, 240, 128, 128 };
+    const std::vector<uint8_t> EXPECTED_RED_CHROMAS = { 128, 128, 240, 34, 110, 128, 128 };
+    REQUIRE(EXPECTED_LUMAS == lumas);
+    REQUIRE(EXPECTED_BLUE_CHROMAS == blue_chromas);
+    REQUIRE(EXPECTED_RED_CHROMAS == red_chromas);
+}
+
+TEST_CASE("Batch YUV conversion matches converting individual colors.", "[ColorConversion][Yuv]")
+{
+    // CREATE PACKED COLORS WITH VARIED COMPONENTS.
+    constexpr std::size_t COLOR_COUNT = 259;
+    std::vector<uint32_t> packed_colors;
+    for (uint32_t color_index = 0; color_index < COLOR_COUNT; ++color_index)
+    {
+        packed_colors.push_back((color_index * 0x01030507u) ^ 0xA5C3E10Fu);
+    }
+
+    for (GRAPHICS::ColorFormat color_format : { GRAPHICS::ColorFormat::RGBA, GRAPHICS::ColorFormat::ARGB })
+    {
+        // CONVERT THE COLORS IN A BATCH.
+        std::vector<uint8_t> lumas(COLOR_COUNT);
+        std::vector<uint8_t> blue_chromas(COLOR_COUNT);
+        std::vector<uint8_t> red_chromas(COLOR_COUNT);
+        GRAPHICS::ColorConversion::ConvertToYuv(packed_colors.data(), COLOR_COUNT, color_format, lumas.data(), blue_chromas.data(), red_chromas.data());
+
+        // VERIFY EACH COLOR MATCHES CONVERTING IT INDIVIDUALLY.
+        for (std::size_t color_index = 0; color_index < COLOR_COUNT; ++color_index)
+        {
+            uint8_t luma = 0;
+            uint8_t blue_chroma = 0;
+            uint8_t red_chroma = 0;
+            GRAPHICS::ColorConversion::ConvertToYuv(&packed_colors[color_index], 1, color_format, &luma, &blue_chroma, &red_chroma);
+            REQUIRE(luma == lumas[color_index]);
+            REQUIRE(blue_chroma == blue_chromas[color_index]);
+            REQUIRE(red_chroma == red_chromas[color_index]);
+        }
+    }
+}
@@ -0,0 +1,160 @@
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Graphics/FrameStreaming/FrameSink.h"
+#include "Graphics/FrameStreaming/PpmFrameEncoder.h"
+#include "Graphics/FrameStreaming/RawRgbaFrameEncoder.h"
+#include "Graphics/FrameStreaming/Y4mFrameEncoder.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// An encoder that blocks until allowed to continue, to simulate a slow stream consumer.
+class BlockingFrameEncoder : public GRAPHICS::FRAME_STREAMING::IFrameEncoder
+{
+public:
+    /// Waits until encoding is allowed and then encodes a single byte per frame.
+    /// @param[in]  frame - The frame to encode (unused).
+    /// @param[in,out]  encoded_bytes - The bytes to write for the frame.
+    /// @return True.
+    bool Encode(const GRAPHICS::Bitmap&, std::vector<uint8_t>& encoded_bytes) override
+    {
+        std::unique_lock<std::mutex> lock(Mutex);
+        EncodingAllowedChanged.wait(lock, [this]() { return EncodingAllowed; });
+        encoded_bytes.push_back(0);
+        return true;
+    }
+
+    /// Allows all frames to be encoded.
+    void AllowEncoding()
+    {
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            EncodingAllowed = true;
+        }
+        EncodingAllowedChanged.notify_all();
+    }
+
+private:
+    /// Protects access to whether encoding is allowed.
+    std::mutex Mutex = {};
+    /// Signaled when encoding is allowed.
+    std::condition_variable EncodingAllowedChanged = {};
+    /// True if frames may be encoded.
+    bool EncodingAllowed = false;
+};
+
+/// Creates a 2x2 frame with distinct pixels.
+/// @param[in]  color_format - The color format of the frame.
+/// @return The frame.
+static GRAPHICS::Bitmap CreateTestFrame(const GRAPHICS::ColorFormat color_format)
+{
+    GRAPHICS::Bitmap frame(2, 2, color_format);
+    frame.WritePixel(0, 0, GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f));
+    frame.WritePixel(1, 0, GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f));
+    frame.WritePixel(0, 1, GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f));
+    frame.WritePixel(1, 1, GRAPHICS::Color(1.0f, 1.0f, 1.0f, 0.0f));
+    return frame;
+}
+
+TEST_CASE("Frames can be streamed as raw RGBA bytes.", "[FrameSink][RawRgba]")
+{
+    for (GRAPHICS::ColorFormat color_format : { GRAPHICS::ColorFormat::RGBA, GRAPHICS::ColorFormat::ARGB })
+    {
+        // STREAM TWO FRAMES.
+        std::ostringstream output_stream;
+        GRAPHICS::FRAME_STREAMING::FrameSink frame_sink(std::make_unique<GRAPHICS::FRAME_STREAMING::RawRgbaFrameEncoder>(), output_stream);
+        GRAPHICS::Bitmap frame = CreateTestFrame(color_format);
+        REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::QUEUED == frame_sink.Submit(frame, true));
+        REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::QUEUED == frame_sink.Submit(frame, true));
+        REQUIRE(frame_sink.Finish());
+
+        // VERIFY THE BYTES OF BOTH FRAMES.
+        const std::string EXPECTED_FRAME_BYTES(
+            "\xFF\x00\x00\xFF" "\x00\xFF\x00\xFF"
+            "\x00\x00\xFF\xFF" "\xFF\xFF\xFF\x00",
+            16);
+        REQUIRE(EXPECTED_FRAME_BYTES + EXPECTED_FRAME_BYTES == output_stream.str());
+        GRAPHICS::FRAME_STREAMING::FrameSink::Statistics statistics = frame_sink.GetStatistics();
+        REQUIRE(2 == statistics.SubmittedFrameCount);
+        REQUIRE(2 == statistics.WrittenFrameCount);
+        REQUIRE(32 == statistics.WrittenSizeInBytes);
+    }
+}
+
+TEST_CASE("Frames can be streamed as PPM images.", "[FrameSink][Ppm]")
+{
+    // STREAM A FRAME.
+    std::ostringstream output_stream;
+    {
+        GRAPHICS::FRAME_STREAMING::FrameSink frame_sink(std::make_unique<GRAPHICS::FRAME_STREAMING::PpmFrameEncoder>(), output_stream);
+        GRAPHICS::Bitmap frame = CreateTestFrame(GRAPHICS::ColorFormat::ARGB);
+        REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::QUEUED == frame_sink.Submit(frame, true));
+    }
+
+    // VERIFY THE IMAGE WAS WRITTEN WITHOUT ALPHA.
+    const std::string EXPECTED_IMAGE_BYTES(
+        "P6\n2 2\n255\n"
+        "\xFF\x00\x00" "\x00\xFF\x00"
+        "\x00\x00\xFF" "\xFF\xFF\xFF",
+        23);
+    REQUIRE(EXPECTED_IMAGE_BYTES == output_stream.str());
+}
+
+TEST_CASE("Frames can be streamed as Y4M video.", "[FrameSink][Y4m]")
+{
+    // STREAM A 3x1 WHITE FRAME.
+    // The odd width covers chroma for pixels on the edge.
+    std::ostringstream output_stream;
+    GRAPHICS::FRAME_STREAMING::FrameSink frame_sink(std::make_unique<GRAPHICS::FRAME_STREAMING::Y4mFrameEncoder>(24), output_stream);
+    GRAPHICS::Bitmap frame(3, 1, GRAPHICS::ColorFormat::RGBA);
+    frame.FillPixels(GRAPHICS::Color::WHITE);
+    REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::QUEUED == frame_sink.Submit(frame, true));
+    REQUIRE(frame_sink.Finish());
+
+    // VERIFY THE HEADERS AND PLANES.
+    const std::string EXPECTED_STREAM_BYTES =
+        "YUV4MPEG2 W3 H1 F24:1 Ip A1:1 C420jpeg\n"
+        "FRAME\n"
+        "\xEB\xEB\xEB"
+        "\x80\x80"
+        "\x80\x80";
+    REQUIRE(EXPECTED_STREAM_BYTES == output_stream.str());
+
+    SECTION("Frames with different dimensions fail to be streamed.")
+    {
+        GRAPHICS::Bitmap larger_frame(4, 1, GRAPHICS::ColorFormat::RGBA);
+        REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::QUEUED == frame_sink.Submit(larger_frame, true));
+        REQUIRE_FALSE(frame_sink.Finish());
+        REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::FAILED == frame_sink.Submit(frame, true));
+        REQUIRE(1 == frame_sink.GetStatistics().WrittenFrameCount);
+    }
+}
+
+TEST_CASE("Back-pressure is reported when the consumer falls behind.", "[FrameSink][BackPressure]")
+{
+    // FILL ALL BUFFERS WHILE THE CONSUMER IS BLOCKED.
+    std::ostringstream output_stream;
+    auto blocking_encoder = std::make_unique<BlockingFrameEncoder>();
+    BlockingFrameEncoder* encoder = blocking_encoder.get();
+    constexpr std::size_t BUFFER_COUNT = 2;
+    GRAPHICS::FRAME_STREAMING::FrameSink frame_sink(std::move(blocking_encoder), output_stream, BUFFER_COUNT);
+    GRAPHICS::Bitmap frame = CreateTestFrame(GRAPHICS::ColorFormat::RGBA);
+    REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::QUEUED == frame_sink.Submit(frame));
+    REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::QUEUED == frame_sink.Submit(frame));
+
+    // VERIFY ADDITIONAL FRAMES AREN'T QUEUED.
+    REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::BACK_PRESSURE == frame_sink.Submit(frame));
+    REQUIRE(1 == frame_sink.GetStatistics().BackPressureCount);
+
+    // VERIFY FRAMES ARE QUEUED ONCE THE CONSUMER CATCHES UP.
+    encoder->AllowEncoding();
+    REQUIRE(GRAPHICS::FRAME_STREAMING::FrameSubmissionResult::QUEUED == frame_sink.Submit(frame, true));
+    REQUIRE(frame_sink.Finish());
+    GRAPHICS::FRAME_STREAMING::FrameSink::Statistics statistics = frame_sink.GetStatistics();
+    REQUIRE(3 == statistics.SubmittedFrameCount);
+    REQUIRE(3 == statistics.WrittenFrameCount);
+    REQUIRE(3 == output_stream.str().size());
+}
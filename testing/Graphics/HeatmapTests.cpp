@@ -0,0 +1,25 @@
+#include "Containers/Array2D.h"
+#include "Graphics/Heatmap.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Heatmap colors range from blue to red with zero counts black.", "[Heatmap]")
+{
+    constexpr uint32_t MAX_COUNT = 5;
+    REQUIRE(GRAPHICS::Color::BLACK == GRAPHICS::Heatmap::FalseColor(0, MAX_COUNT));
+    REQUIRE(GRAPHICS::Color::BLUE == GRAPHICS::Heatmap::FalseColor(1, MAX_COUNT));
+    REQUIRE(GRAPHICS::Color::GREEN == GRAPHICS::Heatmap::FalseColor(3, MAX_COUNT));
+    REQUIRE(GRAPHICS::Color::RED == GRAPHICS::Heatmap::FalseColor(MAX_COUNT, MAX_COUNT));
+    // Counts beyond the maximum are clamped.
+    REQUIRE(GRAPHICS::Color::RED == GRAPHICS::Heatmap::FalseColor(MAX_COUNT + 10, MAX_COUNT));
+}
+
+TEST_CASE("Heatmaps are scaled to the largest count by default.", "[Heatmap]")
+{
+    CONTAINERS::Array2D<uint32_t> counts(3, 1, { 0, 2, 8 });
+    GRAPHICS::Bitmap heatmap = GRAPHICS::Heatmap::Create(counts);
+
+    REQUIRE(3 == heatmap.GetWidthInPixels());
+    REQUIRE(1 == heatmap.GetHeightInPixels());
+    REQUIRE(GRAPHICS::Color::BLACK == heatmap.GetPixel(0, 0));
+    REQUIRE(GRAPHICS::Color::RED == heatmap.GetPixel(2, 0));
+}
@@ -0,0 +1,60 @@
+#include <cmath>
+#include <optional>
+#include "Graphics/ImageComparison.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Identical images match with an infinite PSNR.", "[ImageComparison]")
+{
+    GRAPHICS::Bitmap image(4, 3, GRAPHICS::ColorFormat::RGBA);
+    image.FillPixels(GRAPHICS::Color(0.25f, 0.5f, 0.75f, 1.0f));
+
+    GRAPHICS::ImageComparisonResult result = GRAPHICS::ImageComparison::Compare(image, image, GRAPHICS::ImageComparisonTolerance());
+
+    REQUIRE(result.DimensionsMatch);
+    REQUIRE(result.Matches);
+    REQUIRE(0 == result.MismatchedPixelCount);
+    REQUIRE(0 == result.MaxChannelDifference);
+    REQUIRE(std::isinf(result.PeakSignalToNoiseRatioInDecibels));
+}
+
+TEST_CASE("Images only match if few enough pixels differ beyond the tolerance.", "[ImageComparison]")
+{
+    // CREATE IMAGES DIFFERING IN A SINGLE PIXEL.
+    GRAPHICS::Bitmap expected_image(10, 10, GRAPHICS::ColorFormat::RGBA);
+    expected_image.FillPixels(GRAPHICS::Color::BLACK);
+    GRAPHICS::Bitmap actual_image = expected_image;
+    actual_image.WritePixel(5, 5, GRAPHICS::Color(0.0f, 0.0f, 10.0f / GRAPHICS::Color::MAX_INTEGRAL_COLOR_COMPONENT, 1.0f));
+
+    // VERIFY THE DIFFERENCE IS ONLY TOLERATED IF ALLOWED.
+    GRAPHICS::ImageComparisonTolerance strict_tolerance = { .MaxChannelDifference = 2, .MaxMismatchedPixelProportion = 0.0 };
+    GRAPHICS::ImageComparisonResult strict_result = GRAPHICS::ImageComparison::Compare(expected_image, actual_image, strict_tolerance);
+    REQUIRE(strict_result.DimensionsMatch);
+    REQUIRE_FALSE(strict_result.Matches);
+    REQUIRE(1 == strict_result.MismatchedPixelCount);
+    REQUIRE(10 == strict_result.MaxChannelDifference);
+    REQUIRE(std::isfinite(strict_result.PeakSignalToNoiseRatioInDecibels));
+
+    GRAPHICS::ImageComparisonTolerance lenient_channel_tolerance = { .MaxChannelDifference = 10, .MaxMismatchedPixelProportion = 0.0 };
+    REQUIRE(GRAPHICS::ImageComparison::Compare(expected_image, actual_image, lenient_channel_tolerance).Matches);
+
+    GRAPHICS::ImageComparisonTolerance lenient_pixel_tolerance = { .MaxChannelDifference = 2, .MaxMismatchedPixelProportion = 0.01 };
+    REQUIRE(GRAPHICS::ImageComparison::Compare(expected_image, actual_image, lenient_pixel_tolerance).Matches);
+
+    // VERIFY THE DIFFERENCE IMAGE HIGHLIGHTS THE MISMATCHED PIXEL.
+    std::optional<GRAPHICS::Bitmap> difference_image = GRAPHICS::ImageComparison::CreateDifferenceImage(expected_image, actual_image, strict_tolerance);
+    REQUIRE(difference_image);
+    REQUIRE(difference_image->GetPixel(5, 5).Red > 0.0f);
+    REQUIRE(GRAPHICS::Color::BLACK == difference_image->GetPixel(0, 0));
+}
+
+TEST_CASE("Images with different dimensions don't match.", "[ImageComparison]")
+{
+    GRAPHICS::Bitmap expected_image(4, 3, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::Bitmap actual_image(3, 4, GRAPHICS::ColorFormat::RGBA);
+
+    GRAPHICS::ImageComparisonResult result = GRAPHICS::ImageComparison::Compare(expected_image, actual_image, GRAPHICS::ImageComparisonTolerance());
+
+    REQUIRE_FALSE(result.DimensionsMatch);
+    REQUIRE_FALSE(result.Matches);
+    REQUIRE_FALSE(GRAPHICS::ImageComparison::CreateDifferenceImage(expected_image, actual_image, GRAPHICS::ImageComparisonTolerance()));
+}
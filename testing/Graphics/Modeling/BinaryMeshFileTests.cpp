@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include "Graphics/Modeling/BinaryMeshFile.h"
+#include "Graphics/Modeling/WavefrontObjectModel.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Mesh data can be written to and read from binary mesh files.", "[BinaryMeshFile]")
+{
+    // WRITE MESH DATA.
+    GRAPHICS::MODELING::IndexedMesh mesh;
+    mesh.MaterialFilenames = { "first.mtl", "second material.mtl" };
+    mesh.Vertices =
+    {
+        { MATH::Vector3f(1.0f, 2.0f, 3.0f), MATH::Vector2f(0.0f, 1.0f), MATH::Vector3f(0.0f, 0.0f, 1.0f) },
+        { MATH::Vector3f(-4.0f, 5.5f, 0.0f), MATH::Vector2f(0.5f, 0.25f), MATH::Vector3f(0.0f, 1.0f, 0.0f) },
+        { MATH::Vector3f(7.0f, 8.0f, -9.0f), MATH::Vector2f(1.0f, 0.0f), MATH::Vector3f(1.0f, 0.0f, 0.0f) },
+    };
+    mesh.Indices = { 0, 1, 2, 2, 1, 0 };
+    mesh.MaterialRanges = { { "", 0, 3 }, { "some material", 3, 3 } };
+    std::filesystem::path mesh_filepath = std::filesystem::temp_directory_path() / "BinaryMeshFileTests.mesh";
+    REQUIRE(GRAPHICS::MODELING::BinaryMeshFile::Write(mesh, mesh_filepath));
+
+    // READ THE MESH DATA.
+    std::unique_ptr<GRAPHICS::MODELING::BinaryMeshFile> mesh_file = GRAPHICS::MODELING::BinaryMeshFile::Open(mesh_filepath);
+
+    // VERIFY THE MESH DATA WAS READ CORRECTLY.
+    REQUIRE(mesh_file);
+    REQUIRE(mesh.MaterialFilenames == mesh_file->MaterialFilenames());
+    REQUIRE(std::ranges::equal(mesh.Vertices, mesh_file->Vertices()));
+    REQUIRE(std::ranges::equal(mesh.Indices, mesh_file->Indices()));
+    REQUIRE(mesh.MaterialRanges == mesh_file->MaterialRanges());
+
+    mesh_file.reset();
+    std::filesystem::remove(mesh_filepath);
+}
+
+TEST_CASE("Invalid binary mesh files fail to be opened.", "[BinaryMeshFile]")
+{
+    std::filesystem::path mesh_filepath = std::filesystem::temp_directory_path() / "BinaryMeshFileTests.invalid.mesh";
+
+    SECTION("Missing file.")
+    {
+        std::filesystem::remove(mesh_filepath);
+        REQUIRE_FALSE(GRAPHICS::MODELING::BinaryMeshFile::Open(mesh_filepath));
+    }
+
+    SECTION("Wrong file type.")
+    {
+        {
+            std::ofstream mesh_file(mesh_filepath, std::ios::binary);
+            mesh_file << "v 1 2 3\nv 4 5 6\nv 7 8 9\nf 1 2 3\n# Padding to be at least as large as a header.\n";
+        }
+        REQUIRE_FALSE(GRAPHICS::MODELING::BinaryMeshFile::Open(mesh_filepath));
+    }
+
+    SECTION("Material range outside of indices.")
+    {
+        GRAPHICS::MODELING::IndexedMesh mesh;
+        mesh.Vertices = std::vector<GRAPHICS::MODELING::IndexedMesh::Vertex>(3);
+        mesh.Indices = { 0, 1, 2 };
+        mesh.MaterialRanges = { { "material", 0, 6 } };
+        REQUIRE(GRAPHICS::MODELING::BinaryMeshFile::Write(mesh, mesh_filepath));
+        REQUIRE_FALSE(GRAPHICS::MODELING::BinaryMeshFile::Open(mesh_filepath));
+    }
+
+    SECTION("Truncated file.")
+    {
+        GRAPHICS::MODELING::IndexedMesh mesh;
+        mesh.Vertices = std::vector<GRAPHICS::MODELING::IndexedMesh::Vertex>(100);
+        REQUIRE(GRAPHICS::MODELING::BinaryMeshFile::Write(mesh, mesh_filepath));
+        std::filesystem::resize_file(mesh_filepath, std::filesystem::file_size(mesh_filepath) - 1);
+        REQUIRE_FALSE(GRAPHICS::MODELING::BinaryMeshFile::Open(mesh_filepath));
+    }
+
+    std::filesystem::remove(mesh_filepath);
+}
+
+TEST_CASE("Loading .obj files uses binary mesh caches only when up-to-date.", "[BinaryMeshFile][WavefrontObjectModel]")
+{
+    // WRITE A SIMPLE .OBJ FILE.
+    std::filesystem::path obj_filepath = std::filesystem::temp_directory_path() / "BinaryMeshFileTests.obj";
+    std::filesystem::path cache_folder_path = std::filesystem::temp_directory_path() / "BinaryMeshFileTests.cache";
+    std::filesystem::path cache_filepath = GRAPHICS::MODELING::WavefrontObjectModel::BinaryMeshCacheFilepath(obj_filepath, cache_folder_path);
+    std::filesystem::remove_all(cache_folder_path);
+    {
+        std::ofstream obj_file(obj_filepath, std::ios::binary);
+        obj_file << "v 0 1 0\nv -1 -1 0\nv 1 -1 0\nf 1 2 3\n";
+    }
+
+    // LOAD THE MODEL TO CREATE THE CACHE.
+    bool cache_write_failed = true;
+    std::optional<GRAPHICS::Object3D> object_3D = GRAPHICS::MODELING::WavefrontObjectModel::Load(
+        obj_filepath,
+        GRAPHICS::MODELING::WavefrontObjectModel::LoadMaterialLibraries,
+        cache_folder_path,
+        &cache_write_failed);
+    REQUIRE(object_3D);
+    REQUIRE_FALSE(cache_write_failed);
+    REQUIRE(std::filesystem::exists(cache_filepath));
+
+    // REPLACE THE CACHE WITH DIFFERENT GEOMETRY TO DETECT WHEN IT'S USED.
+    GRAPHICS::MODELING::IndexedMesh cached_mesh;
+    cached_mesh.Vertices = { { MATH::Vector3f(5.0f, 5.0f, 5.0f) }, { MATH::Vector3f(6.0f, 6.0f, 6.0f) }, { MATH::Vector3f(7.0f, 7.0f, 7.0f) } };
+    cached_mesh.Indices = { 0, 1, 2 };
+    REQUIRE(GRAPHICS::MODELING::BinaryMeshFile::Write(cached_mesh, cache_filepath));
+    std::filesystem::file_time_type obj_file_last_write_time = std::filesystem::last_write_time(obj_filepath);
+
+    SECTION("Newer caches are used.")
+    {
+        std::filesystem::last_write_time(cache_filepath, obj_file_last_write_time + std::chrono::seconds(1));
+        object_3D = GRAPHICS::MODELING::WavefrontObjectModel::Load(obj_filepath, GRAPHICS::MODELING::WavefrontObjectModel::LoadMaterialLibraries, cache_folder_path);
+        REQUIRE(object_3D);
+        REQUIRE(MATH::Vector3f(5.0f, 5.0f, 5.0f) == object_3D->Triangles[0].Vertices[0]);
+    }
+
+    SECTION("Older caches are replaced.")
+    {
+        std::filesystem::last_write_time(cache_filepath, obj_file_last_write_time - std::chrono::seconds(1));
+        object_3D = GRAPHICS::MODELING::WavefrontObjectModel::Load(obj_filepath, GRAPHICS::MODELING::WavefrontObjectModel::LoadMaterialLibraries, cache_folder_path);
+        REQUIRE(object_3D);
+        REQUIRE(MATH::Vector3f(0.0f, 1.0f, 0.0f) == object_3D->Triangles[0].Vertices[0]);
+
+        std::unique_ptr<GRAPHICS::MODELING::BinaryMeshFile> updated_cache = GRAPHICS::MODELING::BinaryMeshFile::Open(cache_filepath);
+        REQUIRE(updated_cache);
+        REQUIRE(MATH::Vector3f(0.0f, 1.0f, 0.0f) == updated_cache->Vertices()[0].Position);
+    }
+
+    SECTION("Caches aren't used without a cache folder.")
+    {
+        std::filesystem::last_write_time(cache_filepath, obj_file_last_write_time + std::chrono::seconds(1));
+        object_3D = GRAPHICS::MODELING::WavefrontObjectModel::Load(obj_filepath);
+        REQUIRE(object_3D);
+        REQUIRE(MATH::Vector3f(0.0f, 1.0f, 0.0f) == object_3D->Triangles[0].Vertices[0]);
+    }
+
+    std::filesystem::remove(obj_filepath);
+    std::filesystem::remove_all(cache_folder_path);
+}
+
+TEST_CASE("Loading .obj files only writes binary mesh caches when a cache folder is given.", "[BinaryMeshFile][WavefrontObjectModel]")
+{
+    // WRITE A SIMPLE .OBJ FILE IN ITS OWN FOLDER.
+    std::filesystem::path model_folder_path = std::filesystem::temp_directory_path() / "BinaryMeshFileTests.model";
+    std::filesystem::create_directories(model_folder_path);
+    std::filesystem::path obj_filepath = model_folder_path / "model.obj";
+    {
+        std::ofstream obj_file(obj_filepath, std::ios::binary);
+        obj_file << "v 0 1 0\nv -1 -1 0\nv 1 -1 0\nf 1 2 3\n";
+    }
+
+    SECTION("No cache folder.")
+    {
+        std::optional<GRAPHICS::Object3D> object_3D = GRAPHICS::MODELING::WavefrontObjectModel::Load(obj_filepath);
+        REQUIRE(object_3D);
+        REQUIRE(1 == std::distance(std::filesystem::directory_iterator(model_folder_path), std::filesystem::directory_iterator()));
+    }
+
+    SECTION("Unwritable cache folder.")
+    {
+        // A file where the cache folder should be prevents the folder from being created.
+        std::filesystem::path cache_folder_path = model_folder_path / "not_a_folder";
+        std::ofstream(cache_folder_path) << "";
+        bool cache_write_failed = false;
+        std::optional<GRAPHICS::Object3D> object_3D = GRAPHICS::MODELING::WavefrontObjectModel::Load(
+            obj_filepath,
+            GRAPHICS::MODELING::WavefrontObjectModel::LoadMaterialLibraries,
+            cache_folder_path,
+            &cache_write_failed);
+        REQUIRE(object_3D);
+        REQUIRE(cache_write_failed);
+    }
+
+    std::filesystem::remove_all(model_folder_path);
+}
@@ -0,0 +1,94 @@
+#include "Graphics/Modeling/IndexedMesh.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Duplicate face vertices are merged when forming indexed meshes.", "[IndexedMesh][FromObjectData]")
+{
+    // DEFINE A QUAD WITH 2 TRIANGLES SHARING 2 VERTICES.
+    // The last vertex has different texture coordinates, so it shouldn't be merged.
+    using GRAPHICS::MODELING::WavefrontFaceVertex;
+    GRAPHICS::MODELING::WavefrontObjectData data;
+    data.VertexPositions = { MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 1.0f, 0.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f) };
+    data.VertexTextureCoordinates = { MATH::Vector2f(0.0f, 0.0f), MATH::Vector2f(1.0f, 1.0f) };
+    data.VertexNormals = { MATH::Vector3f(0.0f, 0.0f, 2.0f) };
+    data.Faces =
+    {
+        { WavefrontFaceVertex{ 0, 0, 0 }, WavefrontFaceVertex{ 1, 0, 0 }, WavefrontFaceVertex{ 2, 0, 0 } },
+        { WavefrontFaceVertex{ 0, 0, 0 }, WavefrontFaceVertex{ 2, 0, 0 }, WavefrontFaceVertex{ 3, 1, 0 } },
+    };
+
+    // FORM THE INDEXED MESH.
+    std::optional<GRAPHICS::MODELING::IndexedMesh> mesh = GRAPHICS::MODELING::IndexedMesh::FromObjectData(data);
+
+    // VERIFY DUPLICATE VERTICES WERE MERGED.
+    REQUIRE(mesh);
+    REQUIRE(4 == mesh->Vertices.size());
+    REQUIRE(std::vector<uint32_t>{ 0, 1, 2, 0, 2, 3 } == mesh->Indices);
+    REQUIRE(MATH::Vector3f(0.0f, 1.0f, 0.0f) == mesh->Vertices[3].Position);
+    REQUIRE(MATH::Vector2f(1.0f, 1.0f) == mesh->Vertices[3].TextureCoordinates);
+    REQUIRE(MATH::Vector3f(0.0f, 0.0f, 1.0f) == mesh->Vertices[3].Normal);
+
+    // VERIFY ALL TRIANGLES ARE IN A SINGLE RANGE WITHOUT A MATERIAL.
+    REQUIRE(1 == mesh->MaterialRanges.size());
+    REQUIRE(GRAPHICS::MODELING::IndexedMesh::MaterialRange{ "", 0, 6 } == mesh->MaterialRanges[0]);
+}
+
+TEST_CASE("Normals are computed for vertices without explicit normals.", "[IndexedMesh][FromObjectData]")
+{
+    // DEFINE 2 TRIANGLES ON DIFFERENT PLANES SHARING AN EDGE.
+    using GRAPHICS::MODELING::WavefrontFaceVertex;
+    GRAPHICS::MODELING::WavefrontObjectData data;
+    data.VertexPositions = { MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 1.0f) };
+    data.Faces =
+    {
+        { WavefrontFaceVertex{ 0 }, WavefrontFaceVertex{ 1 }, WavefrontFaceVertex{ 2 } },
+        { WavefrontFaceVertex{ 0 }, WavefrontFaceVertex{ 3 }, WavefrontFaceVertex{ 1 } },
+    };
+
+    // FORM THE INDEXED MESH.
+    std::optional<GRAPHICS::MODELING::IndexedMesh> mesh = GRAPHICS::MODELING::IndexedMesh::FromObjectData(data);
+
+    // VERIFY NORMALS ARE AVERAGED ACROSS SHARED VERTICES.
+    REQUIRE(mesh);
+    REQUIRE(4 == mesh->Vertices.size());
+    REQUIRE(MATH::Vector3f(0.0f, 0.0f, 1.0f) == mesh->Vertices[2].Normal);
+    REQUIRE(MATH::Vector3f(0.0f, 1.0f, 0.0f) == mesh->Vertices[3].Normal);
+    const float HALF_SQRT_2 = std::sqrt(0.5f);
+    REQUIRE(HALF_SQRT_2 == Approx(mesh->Vertices[0].Normal.Z));
+    REQUIRE(HALF_SQRT_2 == Approx(mesh->Vertices[0].Normal.Y));
+    REQUIRE(0.0f == mesh->Vertices[0].Normal.X);
+}
+
+TEST_CASE("Material uses form ranges of indices.", "[IndexedMesh][FromObjectData]")
+{
+    // DEFINE FACES WITH DIFFERENT MATERIALS.
+    using GRAPHICS::MODELING::WavefrontFaceVertex;
+    GRAPHICS::MODELING::WavefrontObjectData data;
+    data.VertexPositions = { MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f) };
+    std::array<WavefrontFaceVertex, 3> face = { WavefrontFaceVertex{ 0 }, WavefrontFaceVertex{ 1 }, WavefrontFaceVertex{ 2 } };
+    data.Faces = { face, face, face, face };
+    data.MaterialUses = { { "unused", 1 }, { "first", 1 }, { "second", 3 } };
+
+    // FORM THE INDEXED MESH.
+    std::optional<GRAPHICS::MODELING::IndexedMesh> mesh = GRAPHICS::MODELING::IndexedMesh::FromObjectData(data);
+
+    // VERIFY THE MATERIAL RANGES.
+    REQUIRE(mesh);
+    REQUIRE(3 == mesh->Vertices.size());
+    REQUIRE(std::vector<GRAPHICS::MODELING::IndexedMesh::MaterialRange>{ { "", 0, 3 }, { "first", 3, 6 }, { "second", 9, 3 } } == mesh->MaterialRanges);
+}
+
+TEST_CASE("Faces referencing missing data fail to form indexed meshes.", "[IndexedMesh][FromObjectData]")
+{
+    using GRAPHICS::MODELING::WavefrontFaceVertex;
+    GRAPHICS::MODELING::WavefrontObjectData data;
+    data.VertexPositions = { MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f) };
+
+    data.Faces = { { WavefrontFaceVertex{ 0 }, WavefrontFaceVertex{ 1 }, WavefrontFaceVertex{ 3 } } };
+    REQUIRE_FALSE(GRAPHICS::MODELING::IndexedMesh::FromObjectData(data));
+
+    data.Faces = { { WavefrontFaceVertex{ 0, 0 }, WavefrontFaceVertex{ 1 }, WavefrontFaceVertex{ 2 } } };
+    REQUIRE_FALSE(GRAPHICS::MODELING::IndexedMesh::FromObjectData(data));
+
+    data.Faces = { { WavefrontFaceVertex{ 0 }, WavefrontFaceVertex{ 1, WavefrontFaceVertex::NO_INDEX, 0 }, WavefrontFaceVertex{ 2 } } };
+    REQUIRE_FALSE(GRAPHICS::MODELING::IndexedMesh::FromObjectData(data));
+}
@@ -0,0 +1,258 @@
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Graphics/Modeling/MaterialLibraryCache.h"
+#include "Graphics/Modeling/WavefrontObjectModel.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Material libraries are only loaded once.", "[MaterialLibraryCache]")
+{
+    // WRITE A MATERIAL LIBRARY WITH A TEXTURE.
+    std::filesystem::path library_folder = std::filesystem::temp_directory_path() / "MaterialLibraryCacheSharingTests";
+    std::filesystem::create_directories(library_folder);
+    GRAPHICS::Bitmap texture(1, 1, GRAPHICS::ColorFormat::RGBA);
+    REQUIRE(texture.Save(library_folder / "texture.bmp"));
+    {
+        std::ofstream mtl_file(library_folder / "library.mtl", std::ios::binary);
+        mtl_file << "newmtl textured\nKd 1 0 0\nmap_Kd texture.bmp\nnewmtl plain\nKd 0 1 0\n";
+    }
+
+    // LOAD THE LIBRARY MULTIPLE TIMES.
+    // Different ways of referring to the same file should share the library.
+    GRAPHICS::MODELING::MaterialLibraryCache material_library_cache;
+    std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> first_library = material_library_cache.Get(library_folder / "library.mtl");
+    std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> second_library = material_library_cache.Get(library_folder / "." / "library.mtl");
+
+    // VERIFY THE LIBRARY WAS ONLY LOADED ONCE.
+    REQUIRE(first_library);
+    REQUIRE(2 == first_library->size());
+    REQUIRE(first_library == second_library);
+    REQUIRE(first_library->at(0).Material->Texture);
+    REQUIRE(1 == material_library_cache.Textures().GetStatistics().ResidentTextureCount);
+    GRAPHICS::MODELING::MaterialLibraryCache::Statistics statistics = material_library_cache.GetStatistics();
+    REQUIRE(1 == statistics.HitCount);
+    REQUIRE(1 == statistics.MissCount);
+    REQUIRE(1 == statistics.CachedLibraryCount);
+
+    // VERIFY CLEARING THE CACHE CAUSES THE LIBRARY TO BE LOADED AGAIN.
+    // Textures should still be shared.
+    material_library_cache.Clear();
+    REQUIRE(0 == material_library_cache.GetStatistics().CachedLibraryCount);
+    std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> reloaded_library = material_library_cache.Get(library_folder / "library.mtl");
+    REQUIRE(reloaded_library);
+    REQUIRE(first_library != reloaded_library);
+    REQUIRE(first_library->at(0).Material->Texture == reloaded_library->at(0).Material->Texture);
+    REQUIRE(2 == material_library_cache.GetStatistics().MissCount);
+
+    std::filesystem::remove_all(library_folder);
+}
+
+TEST_CASE("Modified material libraries are reloaded.", "[MaterialLibraryCache]")
+{
+    // LOAD AN INITIAL MATERIAL LIBRARY.
+    std::filesystem::path mtl_filepath = std::filesystem::temp_directory_path() / "MaterialLibraryCacheTests.modified.mtl";
+    {
+        std::ofstream mtl_file(mtl_filepath, std::ios::binary);
+        mtl_file << "newmtl red\nKd 1 0 0\n";
+    }
+    GRAPHICS::MODELING::MaterialLibraryCache material_library_cache;
+    std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> original_library = material_library_cache.Get(mtl_filepath);
+    REQUIRE(original_library);
+
+    // MODIFY THE LIBRARY.
+    // The modification time is explicitly changed in case the file system has a coarse time resolution.
+    std::filesystem::file_time_type original_last_write_time = std::filesystem::last_write_time(mtl_filepath);
+    {
+        std::ofstream mtl_file(mtl_filepath, std::ios::binary);
+        mtl_file << "newmtl blue\nKd 0 0 1\n";
+    }
+    std::filesystem::last_write_time(mtl_filepath, original_last_write_time + std::chrono::seconds(1));
+    std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> modified_library = material_library_cache.Get(mtl_filepath);
+    std::filesystem::remove(mtl_filepath);
+
+    // VERIFY THE MODIFIED LIBRARY WAS LOADED.
+    // The original library should remain valid for anything still using it.
+    REQUIRE(modified_library);
+    REQUIRE("blue" == modified_library->at(0).Name);
+    REQUIRE("red" == original_library->at(0).Name);
+    REQUIRE(2 == material_library_cache.GetStatistics().MissCount);
+    REQUIRE(1 == material_library_cache.GetStatistics().CachedLibraryCount);
+}
+
+TEST_CASE("Missing material libraries aren't cached.", "[MaterialLibraryCache]")
+{
+    GRAPHICS::MODELING::MaterialLibraryCache material_library_cache;
+    std::filesystem::path mtl_filepath = std::filesystem::temp_directory_path() / "MaterialLibraryCacheTests.missing.mtl";
+    REQUIRE_FALSE(material_library_cache.Get(mtl_filepath));
+    REQUIRE(0 == material_library_cache.GetStatistics().CachedLibraryCount);
+}
+
+TEST_CASE("Material library caches have a finite texture memory budget by default.", "[MaterialLibraryCache]")
+{
+    constexpr std::size_t DEFAULT_BUDGET = GRAPHICS::MODELING::MaterialLibraryCache::DEFAULT_TEXTURE_MEMORY_BUDGET_IN_BYTES;
+    GRAPHICS::MODELING::MaterialLibraryCache material_library_cache;
+    REQUIRE(DEFAULT_BUDGET == material_library_cache.Textures().GetStatistics().MemoryBudgetInBytes);
+    REQUIRE(DEFAULT_BUDGET == GRAPHICS::MODELING::MaterialLibraryCache::Shared().Textures().GetStatistics().MemoryBudgetInBytes);
+}
+
+TEST_CASE("Unused material libraries are released when textures exceed their memory budget.", "[MaterialLibraryCache]")
+{
+    // WRITE TWO MATERIAL LIBRARIES WITH DIFFERENT TEXTURES.
+    std::filesystem::path library_folder = std::filesystem::temp_directory_path() / "MaterialLibraryCacheEvictionTests";
+    std::filesystem::create_directories(library_folder);
+    GRAPHICS::Bitmap texture(1, 1, GRAPHICS::ColorFormat::RGBA);
+    REQUIRE(texture.Save(library_folder / "a.bmp"));
+    REQUIRE(texture.Save(library_folder / "b.bmp"));
+    {
+        std::ofstream mtl_file(library_folder / "a.mtl", std::ios::binary);
+        mtl_file << "newmtl a\nKd 1 0 0\nmap_Kd a.bmp\n";
+    }
+    {
+        std::ofstream mtl_file(library_folder / "b.mtl", std::ios::binary);
+        mtl_file << "newmtl b\nKd 0 1 0\nmap_Kd b.bmp\n";
+    }
+
+    // LOAD BOTH LIBRARIES WITH A BUDGET FOR ONLY ONE TEXTURE.
+    constexpr std::size_t TEXTURE_SIZE_IN_BYTES = sizeof(uint32_t);
+    GRAPHICS::MODELING::MaterialLibraryCache material_library_cache(TEXTURE_SIZE_IN_BYTES);
+    std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> a_library = material_library_cache.Get(library_folder / "a.mtl");
+    REQUIRE(a_library);
+
+    SECTION("Unreferenced libraries.")
+    {
+        a_library.reset();
+        std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> b_library = material_library_cache.Get(library_folder / "b.mtl");
+        REQUIRE(b_library);
+
+        // VERIFY THE UNUSED LIBRARY AND ITS TEXTURE WERE RELEASED.
+        GRAPHICS::MODELING::MaterialLibraryCache::Statistics statistics = material_library_cache.GetStatistics();
+        REQUIRE(1 == statistics.EvictionCount);
+        REQUIRE(1 == statistics.CachedLibraryCount);
+        REQUIRE(1 == material_library_cache.Textures().GetStatistics().ResidentTextureCount);
+    }
+
+    SECTION("Referenced libraries.")
+    {
+        std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>> b_library = material_library_cache.Get(library_folder / "b.mtl");
+        REQUIRE(b_library);
+
+        // VERIFY LIBRARIES IN USE ARE KEPT DESPITE EXCEEDING THE BUDGET.
+        GRAPHICS::MODELING::MaterialLibraryCache::Statistics statistics = material_library_cache.GetStatistics();
+        REQUIRE(0 == statistics.EvictionCount);
+        REQUIRE(2 == statistics.CachedLibraryCount);
+        REQUIRE(2 == material_library_cache.Textures().GetStatistics().ResidentTextureCount);
+    }
+
+    std::filesystem::remove_all(library_folder);
+}
+
+TEST_CASE("Material libraries requested concurrently are only loaded once.", "[MaterialLibraryCache]")
+{
+    // WRITE A MATERIAL LIBRARY.
+    std::filesystem::path mtl_filepath = std::filesystem::temp_directory_path() / "MaterialLibraryCacheTests.concurrent.mtl";
+    {
+        std::ofstream mtl_file(mtl_filepath, std::ios::binary);
+        mtl_file << "newmtl red\nKd 1 0 0\n";
+    }
+
+    // LOAD THE LIBRARY ON MULTIPLE THREADS AT ONCE.
+    constexpr std::size_t THREAD_COUNT = 8;
+    GRAPHICS::MODELING::MaterialLibraryCache material_library_cache;
+    std::vector<std::shared_ptr<const std::vector<GRAPHICS::MODELING::WavefrontMaterial>>> libraries(THREAD_COUNT);
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t thread_index = 0; thread_index < THREAD_COUNT; ++thread_index)
+        {
+            threads.emplace_back([&material_library_cache, &libraries, &mtl_filepath, thread_index]()
+            {
+                libraries[thread_index] = material_library_cache.Get(mtl_filepath);
+            });
+        }
+    }
+    std::filesystem::remove(mtl_filepath);
+
+    // VERIFY ALL THREADS SHARE A SINGLE LOAD.
+    REQUIRE(libraries[0]);
+    for (const auto& library : libraries)
+    {
+        REQUIRE(libraries[0] == library);
+    }
+    GRAPHICS::MODELING::MaterialLibraryCache::Statistics statistics = material_library_cache.GetStatistics();
+    REQUIRE(1 == statistics.MissCount);
+    REQUIRE(THREAD_COUNT - 1 == statistics.HitCount);
+}
+
+TEST_CASE("Models sharing a material library share materials.", "[MaterialLibraryCache][WavefrontObjectModel]")
+{
+    // WRITE TWO MODELS USING THE SAME MATERIAL LIBRARY.
+    std::filesystem::path model_folder = std::filesystem::temp_directory_path() / "MaterialLibraryCacheModelTests";
+    std::filesystem::create_directories(model_folder);
+    for (const char* obj_filename : { "first.obj", "second.obj" })
+    {
+        std::ofstream obj_file(model_folder / obj_filename, std::ios::binary);
+        obj_file << "mtllib shared.mtl\nv 0 1 0\nv -1 -1 0\nv 1 -1 0\nusemtl red\nf 1 2 3\n";
+    }
+    {
+        std::ofstream mtl_file(model_folder / "shared.mtl", std::ios::binary);
+        mtl_file << "newmtl red\nKd 1 0 0\n";
+    }
+
+    // LOAD BOTH MODELS.
+    std::optional<GRAPHICS::Object3D> first_model = GRAPHICS::MODELING::WavefrontObjectModel::Load(model_folder / "first.obj");
+    std::optional<GRAPHICS::Object3D> second_model = GRAPHICS::MODELING::WavefrontObjectModel::Load(model_folder / "second.obj");
+    std::filesystem::remove_all(model_folder);
+
+    // VERIFY THE MODELS SHARE THE SAME MATERIAL.
+    REQUIRE(first_model);
+    REQUIRE(second_model);
+    REQUIRE(first_model->Triangles[0].Material);
+    REQUIRE(first_model->Triangles[0].Material == second_model->Triangles[0].Material);
+}
+
+TEST_CASE("Models sharing a material library share materials while textures exceed their memory budget.", "[MaterialLibraryCache][WavefrontObjectModel]")
+{
+    // WRITE MODELS USING TWO DIFFERENT TEXTURED MATERIAL LIBRARIES.
+    std::filesystem::path model_folder = std::filesystem::temp_directory_path() / "MaterialLibraryCacheOverBudgetModelTests";
+    std::filesystem::create_directories(model_folder);
+    GRAPHICS::Bitmap texture(1, 1, GRAPHICS::ColorFormat::RGBA);
+    REQUIRE(texture.Save(model_folder / "shared.bmp"));
+    REQUIRE(texture.Save(model_folder / "other.bmp"));
+    for (const char* library_name : { "shared", "other" })
+    {
+        std::ofstream mtl_file(model_folder / (std::string(library_name) + ".mtl"), std::ios::binary);
+        mtl_file << "newmtl " << library_name << "\nKd 1 0 0\nmap_Kd " << library_name << ".bmp\n";
+    }
+    for (const char* obj_filename : { "first.obj", "second.obj", "other.obj" })
+    {
+        const char* library_name = (std::string("other.obj") == obj_filename) ? "other" : "shared";
+        std::ofstream obj_file(model_folder / obj_filename, std::ios::binary);
+        obj_file << "mtllib " << library_name << ".mtl\nv 0 1 0\nv -1 -1 0\nv 1 -1 0\nusemtl " << library_name << "\nf 1 2 3\n";
+    }
+
+    // LOAD THE MODELS WITH NO BUDGET FOR TEXTURES.
+    // Loading a model using a different library in between checks the budget while
+    // the first model only references materials rather than the shared library itself.
+    GRAPHICS::TextureCache& shared_textures = GRAPHICS::MODELING::MaterialLibraryCache::Shared().Textures();
+    std::size_t original_texture_memory_budget_in_bytes = shared_textures.GetStatistics().MemoryBudgetInBytes;
+    shared_textures.SetMemoryBudget(0);
+    std::optional<GRAPHICS::Object3D> first_model = GRAPHICS::MODELING::WavefrontObjectModel::Load(model_folder / "first.obj");
+    std::optional<GRAPHICS::Object3D> other_model = GRAPHICS::MODELING::WavefrontObjectModel::Load(model_folder / "other.obj");
+    std::optional<GRAPHICS::Object3D> second_model = GRAPHICS::MODELING::WavefrontObjectModel::Load(model_folder / "second.obj");
+    shared_textures.SetMemoryBudget(original_texture_memory_budget_in_bytes);
+    std::filesystem::remove_all(model_folder);
+
+    // VERIFY THE MODELS USING THE SAME LIBRARY SHARE THE SAME MATERIAL.
+    REQUIRE(first_model);
+    REQUIRE(other_model);
+    REQUIRE(second_model);
+    REQUIRE(first_model->Triangles[0].Material);
+    REQUIRE(first_model->Triangles[0].Material->Texture);
+    REQUIRE(first_model->Triangles[0].Material == second_model->Triangles[0].Material);
+    REQUIRE(first_model->Triangles[0].Material != other_model->Triangles[0].Material);
+}
@@ -0,0 +1,200 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "Graphics/Modeling/WavefrontObjectModel.h"
+#include "Graphics/Modeling/WavefrontObjectParser.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Vertex positions and faces can be parsed from .obj text.", "[WavefrontObjectParser][Parse]")
+{
+    // DEFINE .OBJ TEXT WITH VARIOUS FORMATTING.
+    constexpr std::string_view OBJ_TEXT =
+        "# A comment\n"
+        "mtllib test material.mtl\r\n"
+        "o Triangle\n"
+        "\n"
+        "v 1.0 -2.5 +3\n"
+        "  v\t0.5 1e2 -0.0  \r\n"
+        "v 4 5 6\n"
+        "vt 0.5 0.5\n"
+        "vn 0 0 1\n"
+        "s off\n"
+        "f 1/1/1 2/1/1 3/1/1\n"
+        "f 3 1 2";
+
+    // PARSE THE TEXT.
+    std::optional<GRAPHICS::MODELING::WavefrontObjectData> data = GRAPHICS::MODELING::WavefrontObjectParser::Parse(OBJ_TEXT);
+
+    // VERIFY THE PARSED DATA.
+    REQUIRE(data);
+    REQUIRE(std::vector<std::filesystem::path>{ "test material.mtl" } == data->MaterialFilenames);
+
+    REQUIRE(3 == data->VertexPositions.size());
+    REQUIRE(MATH::Vector3f(1.0f, -2.5f, 3.0f) == data->VertexPositions[0]);
+    REQUIRE(MATH::Vector3f(0.5f, 100.0f, -0.0f) == data->VertexPositions[1]);
+    REQUIRE(MATH::Vector3f(4.0f, 5.0f, 6.0f) == data->VertexPositions[2]);
+
+    REQUIRE(1 == data->VertexTextureCoordinates.size());
+    REQUIRE(MATH::Vector2f(0.5f, 0.5f) == data->VertexTextureCoordinates[0]);
+    REQUIRE(1 == data->VertexNormals.size());
+    REQUIRE(MATH::Vector3f(0.0f, 0.0f, 1.0f) == data->VertexNormals[0]);
+
+    using GRAPHICS::MODELING::WavefrontFaceVertex;
+    constexpr uint32_t NO_INDEX = WavefrontFaceVertex::NO_INDEX;
+    REQUIRE(2 == data->Faces.size());
+    REQUIRE(std::array<WavefrontFaceVertex, 3>{ WavefrontFaceVertex{ 0, 0, 0 }, WavefrontFaceVertex{ 1, 0, 0 }, WavefrontFaceVertex{ 2, 0, 0 } } == data->Faces[0]);
+    REQUIRE(std::array<WavefrontFaceVertex, 3>{ WavefrontFaceVertex{ 2, NO_INDEX, NO_INDEX }, WavefrontFaceVertex{ 0, NO_INDEX, NO_INDEX }, WavefrontFaceVertex{ 1, NO_INDEX, NO_INDEX } } == data->Faces[1]);
+}
+
+TEST_CASE("All .obj face vertex formats can be parsed.", "[WavefrontObjectParser][Parse]")
+{
+    // DEFINE .OBJ TEXT WITH ALL FACE VERTEX FORMATS.
+    constexpr std::string_view OBJ_TEXT =
+        "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+        "vt 0 0\nvt 1 0 0\nvt 1 1\n"
+        "vn 0 0 1\nvn 0 0 -1\n"
+        "f 1/1 2/2 3/3\n"
+        "usemtl First Material\n"
+        "f 1//1 2//1 3//2\n"
+        "f 1/1/1 2/2/1 3/3/2\n"
+        "usemtl second\n"
+        "f -4/-3/-2 -3/-2/-2 -2/-1/-1 -1/-1/-1\n";
+
+    // PARSE THE TEXT.
+    std::optional<GRAPHICS::MODELING::WavefrontObjectData> data = GRAPHICS::MODELING::WavefrontObjectParser::Parse(OBJ_TEXT);
+
+    // VERIFY THE FACES WERE PARSED.
+    using GRAPHICS::MODELING::WavefrontFaceVertex;
+    constexpr uint32_t NO_INDEX = WavefrontFaceVertex::NO_INDEX;
+    REQUIRE(data);
+    REQUIRE(3 == data->VertexTextureCoordinates.size());
+    REQUIRE(5 == data->Faces.size());
+    REQUIRE(std::array<WavefrontFaceVertex, 3>{ WavefrontFaceVertex{ 0, 0, NO_INDEX }, WavefrontFaceVertex{ 1, 1, NO_INDEX }, WavefrontFaceVertex{ 2, 2, NO_INDEX } } == data->Faces[0]);
+    REQUIRE(std::array<WavefrontFaceVertex, 3>{ WavefrontFaceVertex{ 0, NO_INDEX, 0 }, WavefrontFaceVertex{ 1, NO_INDEX, 0 }, WavefrontFaceVertex{ 2, NO_INDEX, 1 } } == data->Faces[1]);
+    REQUIRE(std::array<WavefrontFaceVertex, 3>{ WavefrontFaceVertex{ 0, 0, 0 }, WavefrontFaceVertex{ 1, 1, 0 }, WavefrontFaceVertex{ 2, 2, 1 } } == data->Faces[2]);
+
+    // The quad should be split into 2 triangles with negative indices resolved.
+    REQUIRE(std::array<WavefrontFaceVertex, 3>{ WavefrontFaceVertex{ 0, 0, 0 }, WavefrontFaceVertex{ 1, 1, 0 }, WavefrontFaceVertex{ 2, 2, 1 } } == data->Faces[3]);
+    REQUIRE(std::array<WavefrontFaceVertex, 3>{ WavefrontFaceVertex{ 0, 0, 0 }, WavefrontFaceVertex{ 2, 2, 1 }, WavefrontFaceVertex{ 3, 2, 1 } } == data->Faces[4]);
+
+    // VERIFY THE MATERIAL USES WERE PARSED.
+    REQUIRE(2 == data->MaterialUses.size());
+    REQUIRE(GRAPHICS::MODELING::WavefrontMaterialUse{ "First Material", 1 } == data->MaterialUses[0]);
+    REQUIRE(GRAPHICS::MODELING::WavefrontMaterialUse{ "second", 3 } == data->MaterialUses[1]);
+}
+
+TEST_CASE("Invalid .obj text fails to be parsed.", "[WavefrontObjectParser][Parse]")
+{
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("v 1 2\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("v 1 2 three\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("f 1 2\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("f 0 1 2\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("f 1 2 99999999999\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("f 1/ 2 3\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("f 1/1/1/1 2 3\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("f 1x 2 3\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("v 1 2 3\nf -1 -2 -3\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("vt\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("vn 1 2\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("mtllib\n"));
+    REQUIRE_FALSE(GRAPHICS::MODELING::WavefrontObjectParser::Parse("usemtl \n"));
+}
+
+TEST_CASE("Large .obj text is parsed the same in parallel as on a single thread.", "[WavefrontObjectParser][Parse]")
+{
+    // CREATE TEXT LARGE ENOUGH TO BE SPLIT INTO MULTIPLE CHUNKS.
+    std::string obj_text;
+    std::size_t vertex_count = 0;
+    while (obj_text.size() < 4 * GRAPHICS::MODELING::WavefrontObjectParser::MIN_CHUNK_SIZE_IN_CHARACTERS)
+    {
+        obj_text += "v " + std::to_string(vertex_count) + " 0.25 -1.5\n";
+        ++vertex_count;
+        if (vertex_count >= 3)
+        {
+            // Negative indices are used for some faces since they may reference earlier chunks.
+            if (vertex_count % 2)
+            {
+                obj_text += "f -3 -2 -1\n";
+            }
+            else
+            {
+                obj_text += "f " + std::to_string(vertex_count - 2) + " " + std::to_string(vertex_count - 1) + " " + std::to_string(vertex_count) + "\n";
+            }
+        }
+        if (0 == vertex_count % 1000)
+        {
+            obj_text += "usemtl material" + std::to_string(vertex_count) + "\n";
+        }
+    }
+
+    // PARSE THE TEXT WITH DIFFERENT NUMBERS OF THREADS.
+    std::optional<GRAPHICS::MODELING::WavefrontObjectData> single_threaded_data = GRAPHICS::MODELING::WavefrontObjectParser::Parse(obj_text, 1);
+    std::optional<GRAPHICS::MODELING::WavefrontObjectData> multi_threaded_data = GRAPHICS::MODELING::WavefrontObjectParser::Parse(obj_text, 4);
+
+    // VERIFY THE DATA IS THE SAME.
+    REQUIRE(single_threaded_data);
+    REQUIRE(multi_threaded_data);
+    REQUIRE(vertex_count == single_threaded_data->VertexPositions.size());
+    REQUIRE(single_threaded_data->VertexPositions == multi_threaded_data->VertexPositions);
+    REQUIRE(single_threaded_data->Faces == multi_threaded_data->Faces);
+    REQUIRE(single_threaded_data->MaterialUses == multi_threaded_data->MaterialUses);
+    REQUIRE(GRAPHICS::MODELING::WavefrontFaceVertex{ static_cast<uint32_t>(vertex_count - 3) } == multi_threaded_data->Faces.back()[0]);
+    REQUIRE(static_cast<float>(vertex_count - 1) == multi_threaded_data->VertexPositions.back().X);
+}
+
+TEST_CASE("Models can be loaded from .obj files.", "[WavefrontObjectModel][Load]")
+{
+    // WRITE A SIMPLE .OBJ FILE.
+    std::filesystem::path obj_filepath = std::filesystem::temp_directory_path() / "WavefrontObjectParserTests.obj";
+    {
+        std::ofstream obj_file(obj_filepath, std::ios::binary);
+        obj_file << "v 0 1 0\nv -1 -1 0\nv 1 -1 0\nf 1 2 3\n";
+    }
+
+    // LOAD THE MODEL.
+    std::optional<GRAPHICS::Object3D> object_3D = GRAPHICS::MODELING::WavefrontObjectModel::Load(obj_filepath);
+    std::filesystem::remove(obj_filepath);
+
+    // VERIFY THE MODEL WAS LOADED.
+    REQUIRE(object_3D);
+    REQUIRE(1 == object_3D->Triangles.size());
+    REQUIRE(MATH::Vector3f(0.0f, 1.0f, 0.0f) == object_3D->Triangles[0].Vertices[0]);
+    REQUIRE(MATH::Vector3f(-1.0f, -1.0f, 0.0f) == object_3D->Triangles[0].Vertices[1]);
+    REQUIRE(MATH::Vector3f(1.0f, -1.0f, 0.0f) == object_3D->Triangles[0].Vertices[2]);
+}
+
+TEST_CASE("Models with multiple materials can be loaded from .obj files.", "[WavefrontObjectModel][Load]")
+{
+    // WRITE A .OBJ FILE WITH A MATERIAL LIBRARY.
+    std::filesystem::path obj_filepath = std::filesystem::temp_directory_path() / "WavefrontObjectParserTests.materials.obj";
+    std::filesystem::path mtl_filepath = std::filesystem::temp_directory_path() / "WavefrontObjectParserTests.materials.mtl";
+    {
+        std::ofstream obj_file(obj_filepath, std::ios::binary);
+        obj_file <<
+            "mtllib WavefrontObjectParserTests.materials.mtl\n"
+            "v 0 1 0\nv -1 -1 0\nv 1 -1 0\nv 1 1 0\n"
+            "f 1 2 3\n"
+            "usemtl blue\n"
+            "f 1 2 3 4\n"
+            "usemtl unknown\n"
+            "f 1 2 3\n";
+        std::ofstream mtl_file(mtl_filepath, std::ios::binary);
+        mtl_file << "newmtl red\nKd 1 0 0\nnewmtl blue\nKd 0 0 1\n";
+    }
+
+    // LOAD THE MODEL.
+    std::optional<GRAPHICS::Object3D> object_3D = GRAPHICS::MODELING::WavefrontObjectModel::Load(obj_filepath);
+    std::filesystem::remove(obj_filepath);
+    std::filesystem::remove(mtl_filepath);
+
+    // VERIFY EACH TRIANGLE HAS THE RIGHT MATERIAL.
+    // Triangles without a known material should use the first material.
+    REQUIRE(object_3D);
+    REQUIRE(4 == object_3D->Triangles.size());
+    REQUIRE(object_3D->Triangles[0].Material);
+    REQUIRE(GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f) == object_3D->Triangles[0].Material->DiffuseColor);
+    REQUIRE(object_3D->Triangles[1].Material);
+    REQUIRE(GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f) == object_3D->Triangles[1].Material->DiffuseColor);
+    REQUIRE(object_3D->Triangles[1].Material == object_3D->Triangles[2].Material);
+    REQUIRE(object_3D->Triangles[0].Material == object_3D->Triangles[3].Material);
+}
@@ -0,0 +1,98 @@
+#include <memory>
+#include <vector>
+#include "Graphics/Bitmap.h"
+#include "Graphics/Camera.h"
+#include "Graphics/Cube.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/Scene.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Ray tracing counts the rays traced for a render.", "[RayTracingAlgorithm]")
+{
+    // CREATE A SCENE WITH A REFLECTIVE CUBE AND A LIGHT.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->Shading = GRAPHICS::ShadingType::MATERIAL;
+    material->DiffuseColor = GRAPHICS::Color::RED;
+    material->ReflectivityProportion = 0.5f;
+    GRAPHICS::Scene scene;
+    scene.Objects.push_back(GRAPHICS::Cube::Create(material));
+    GRAPHICS::Light light;
+    light.Type = GRAPHICS::LightType::POINT;
+    light.Color = GRAPHICS::Color::WHITE;
+    light.PointLightWorldPosition = MATH::Vector3f(2.0f, 4.0f, 3.0f);
+    scene.PointLights = std::vector<GRAPHICS::Light>{ light };
+    GRAPHICS::Camera camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 3.0f));
+
+    // RENDER WITH ONLY PRIMARY RAYS.
+    constexpr unsigned int WIDTH_IN_PIXELS = 8;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 6;
+    GRAPHICS::Bitmap render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Shadows = false;
+    ray_tracer.Reflections = false;
+    ray_tracer.Render(scene, camera, render_target);
+
+    // VERIFY ONE PRIMARY RAY WAS TRACED PER PIXEL.
+    REQUIRE(WIDTH_IN_PIXELS * HEIGHT_IN_PIXELS == ray_tracer.LastRenderRayCounts.PrimaryRayCount);
+    REQUIRE(0 == ray_tracer.LastRenderRayCounts.ShadowRayCount);
+    REQUIRE(0 == ray_tracer.LastRenderRayCounts.ReflectionRayCount);
+
+    // VERIFY ENABLING SHADOWS AND REFLECTIONS TRACES ADDITIONAL RAYS.
+    // Counts should be reset for each render rather than accumulated.
+    ray_tracer.Shadows = true;
+    ray_tracer.Reflections = true;
+    ray_tracer.Render(scene, camera, render_target);
+    const GRAPHICS::RAY_TRACING::RayTracingAlgorithm::RayCounts& ray_counts = ray_tracer.LastRenderRayCounts;
+    REQUIRE(WIDTH_IN_PIXELS * HEIGHT_IN_PIXELS == ray_counts.PrimaryRayCount);
+    REQUIRE(ray_counts.ShadowRayCount > 0);
+    REQUIRE(ray_counts.ReflectionRayCount > 0);
+    REQUIRE(ray_counts.PrimaryRayCount + ray_counts.ShadowRayCount + ray_counts.ReflectionRayCount == ray_counts.Total());
+}
+
+TEST_CASE("Ray tracing can count intersection tests per pixel.", "[RayTracingAlgorithm]")
+{
+    // CREATE A SCENE WITH A SINGLE CUBE AND A LIGHT.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->Shading = GRAPHICS::ShadingType::MATERIAL;
+    material->DiffuseColor = GRAPHICS::Color::RED;
+    GRAPHICS::Scene scene;
+    scene.Objects.push_back(GRAPHICS::Cube::Create(material));
+    GRAPHICS::Light light;
+    light.Type = GRAPHICS::LightType::POINT;
+    light.Color = GRAPHICS::Color::WHITE;
+    light.PointLightWorldPosition = MATH::Vector3f(2.0f, 4.0f, 3.0f);
+    scene.PointLights = std::vector<GRAPHICS::Light>{ light };
+    GRAPHICS::Camera camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 3.0f));
+
+    // RENDER WHILE COUNTING INTERSECTION TESTS.
+    constexpr unsigned int WIDTH_IN_PIXELS = 8;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 6;
+    GRAPHICS::Bitmap render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Shadows = false;
+    ray_tracer.Reflections = false;
+    ray_tracer.CountIntersectionTestsPerPixel = true;
+    ray_tracer.Render(scene, camera, render_target);
+
+    // VERIFY EACH PRIMARY RAY WAS TESTED AGAINST EVERY TRIANGLE.
+    // Without shadows or reflections, only primary rays are tested.
+    uint32_t triangle_count = static_cast<uint32_t>(scene.Objects.front().Triangles.size());
+    REQUIRE(WIDTH_IN_PIXELS == ray_tracer.LastRenderIntersectionTestCountsPerPixel.GetWidth());
+    REQUIRE(HEIGHT_IN_PIXELS == ray_tracer.LastRenderIntersectionTestCountsPerPixel.GetHeight());
+    uint64_t total_intersection_test_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t pixel_intersection_test_count = ray_tracer.LastRenderIntersectionTestCountsPerPixel(x, y);
+            REQUIRE(triangle_count == pixel_intersection_test_count);
+            total_intersection_test_count += pixel_intersection_test_count;
+        }
+    }
+    REQUIRE(total_intersection_test_count == ray_tracer.LastRenderIntersectionTestCount);
+
+    // VERIFY INTERSECTION TESTS AREN'T COUNTED UNLESS REQUESTED.
+    ray_tracer.CountIntersectionTestsPerPixel = false;
+    ray_tracer.Render(scene, camera, render_target);
+    REQUIRE(0 == ray_tracer.LastRenderIntersectionTestCount);
+}
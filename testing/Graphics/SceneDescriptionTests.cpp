@@ -0,0 +1,133 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "Graphics/SceneDescription.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Writes a text file for a scene description test.
+/// @param[in]  filepath - The path of the file to write.
+/// @param[in]  text - The text of the file.
+static void WriteSceneTestFile(const std::filesystem::path& filepath, const std::string& text)
+{
+    std::ofstream file(filepath, std::ios::binary);
+    file << text;
+}
+
+TEST_CASE("Scene descriptions can be loaded with models, lights, and a camera.", "[SceneDescription]")
+{
+    // CREATE A SCENE WITH A SINGLE MODEL.
+    std::filesystem::path scene_folder = std::filesystem::temp_directory_path() / "SceneDescriptionTests";
+    std::filesystem::create_directories(scene_folder);
+    WriteSceneTestFile(scene_folder / "triangle.obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+    WriteSceneTestFile(
+        scene_folder / "test.scene",
+        "# A comment.\n"
+        "\n"
+        "background 0.1 0.2 0.3\n"
+        "camera_position 0 0 5\n"
+        "camera_look_at 0 0 0\n"
+        "camera_projection perspective\n"
+        "ambient_light 0.5 0.5 0.5\n"
+        "directional_light 1 1 1 0 0 -2\n"
+        "model triangle.obj\n"
+        "position 1 2 3\n"
+        "rotation 0 90 0\n"
+        "scale 2 2 2\n");
+
+    // LOAD THE SCENE.
+    std::optional<GRAPHICS::SceneDescription> scene_description = GRAPHICS::SceneDescription::Load(scene_folder / "test.scene");
+
+    // VERIFY THE SCENE WAS LOADED.
+    REQUIRE(scene_description);
+    REQUIRE(GRAPHICS::Color(0.1f, 0.2f, 0.3f, 1.0f) == scene_description->Scene.BackgroundColor);
+    REQUIRE(scene_description->Scene.PointLights);
+    REQUIRE(2 == scene_description->Scene.PointLights->size());
+    REQUIRE(GRAPHICS::LightType::AMBIENT == scene_description->Scene.PointLights->at(0).Type);
+    const GRAPHICS::Light& directional_light = scene_description->Scene.PointLights->at(1);
+    REQUIRE(GRAPHICS::LightType::DIRECTIONAL == directional_light.Type);
+    REQUIRE(-1.0f == Approx(directional_light.DirectionalLightDirection.Z));
+
+    REQUIRE(1 == scene_description->Scene.Objects.size());
+    const GRAPHICS::Object3D& model = scene_description->Scene.Objects[0];
+    REQUIRE(1 == model.Triangles.size());
+    REQUIRE(model.Triangles[0].Material);
+    REQUIRE(MATH::Vector3f(1.0f, 2.0f, 3.0f) == model.WorldPosition);
+    REQUIRE(MATH::Vector3f(2.0f, 2.0f, 2.0f) == model.Scale);
+    REQUIRE(1.5707963f == Approx(model.RotationInRadians.Y.Value));
+
+    const GRAPHICS::Camera& camera = scene_description->Camera;
+    REQUIRE(GRAPHICS::ProjectionType::PERSPECTIVE == camera.Projection);
+    REQUIRE(MATH::Vector3f(0.0f, 0.0f, 5.0f) == camera.WorldPosition);
+
+    std::filesystem::remove_all(scene_folder);
+}
+
+TEST_CASE("Models referenced multiple times are loaded for each object.", "[SceneDescription]")
+{
+    // CREATE A SCENE WITH TWO INSTANCES OF ONE MODEL AND ANOTHER MODEL.
+    std::filesystem::path scene_folder = std::filesystem::temp_directory_path() / "SceneDescriptionInstanceTests";
+    std::filesystem::create_directories(scene_folder);
+    WriteSceneTestFile(scene_folder / "triangle.obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+    WriteSceneTestFile(scene_folder / "quad.obj", "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nf 1 2 3 4\n");
+    WriteSceneTestFile(
+        scene_folder / "test.scene",
+        "model triangle.obj\n"
+        "position 1 0 0\n"
+        "model quad.obj\n"
+        "model triangle.obj\n"
+        "position 2 0 0\n");
+
+    // LOAD THE SCENE.
+    std::optional<GRAPHICS::SceneDescription> scene_description = GRAPHICS::SceneDescription::Load(scene_folder / "test.scene");
+    std::filesystem::remove_all(scene_folder);
+
+    // VERIFY EACH OBJECT HAS ITS OWN MODEL AND TRANSFORM.
+    REQUIRE(scene_description);
+    REQUIRE(3 == scene_description->Scene.Objects.size());
+    const GRAPHICS::Object3D& first_triangle = scene_description->Scene.Objects[0];
+    REQUIRE(1 == first_triangle.Triangles.size());
+    REQUIRE(MATH::Vector3f(1.0f, 0.0f, 0.0f) == first_triangle.WorldPosition);
+    const GRAPHICS::Object3D& quad = scene_description->Scene.Objects[1];
+    REQUIRE(2 == quad.Triangles.size());
+    REQUIRE(MATH::Vector3f(0.0f, 0.0f, 0.0f) == quad.WorldPosition);
+    const GRAPHICS::Object3D& second_triangle = scene_description->Scene.Objects[2];
+    REQUIRE(1 == second_triangle.Triangles.size());
+    REQUIRE(MATH::Vector3f(2.0f, 0.0f, 0.0f) == second_triangle.WorldPosition);
+}
+
+TEST_CASE("Invalid scene descriptions fail to be loaded.", "[SceneDescription]")
+{
+    std::filesystem::path scene_filepath = std::filesystem::temp_directory_path() / "SceneDescriptionTests.scene";
+
+    SECTION("Missing file.")
+    {
+        std::filesystem::remove(scene_filepath);
+        REQUIRE_FALSE(GRAPHICS::SceneDescription::Load(scene_filepath));
+    }
+
+    SECTION("Unknown keyword.")
+    {
+        WriteSceneTestFile(scene_filepath, "unknown 1 2 3\n");
+        REQUIRE_FALSE(GRAPHICS::SceneDescription::Load(scene_filepath));
+    }
+
+    SECTION("Missing values.")
+    {
+        WriteSceneTestFile(scene_filepath, "camera_position 1 2\n");
+        REQUIRE_FALSE(GRAPHICS::SceneDescription::Load(scene_filepath));
+    }
+
+    SECTION("Transform without a model.")
+    {
+        WriteSceneTestFile(scene_filepath, "position 1 2 3\n");
+        REQUIRE_FALSE(GRAPHICS::SceneDescription::Load(scene_filepath));
+    }
+
+    SECTION("Missing model.")
+    {
+        WriteSceneTestFile(scene_filepath, "model SceneDescriptionTests.missing.obj\n");
+        REQUIRE_FALSE(GRAPHICS::SceneDescription::Load(scene_filepath));
+    }
+
+    std::filesystem::remove(scene_filepath);
+}
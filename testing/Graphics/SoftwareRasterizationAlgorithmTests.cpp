@@ -0,0 +1,136 @@
+#include <memory>
+#include "Graphics/SoftwareRasterizationAlgorithm.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a triangle covering much of a small bitmap for rasterization tests.
+/// @param[in]  shading_type - The type of shading for the triangle.
+/// @return The screen-space triangle.
+GRAPHICS::ScreenSpaceTriangle CreateTestScreenSpaceTriangle(const GRAPHICS::ShadingType shading_type)
+{
+    GRAPHICS::ScreenSpaceTriangle triangle;
+    triangle.Material = std::make_shared<GRAPHICS::Material>();
+    triangle.Material->Shading = shading_type;
+    triangle.VertexPositions =
+    {
+        MATH::Vector3f(8.0f, 1.0f, 0.0f),
+        MATH::Vector3f(1.0f, 14.0f, 0.0f),
+        MATH::Vector3f(14.0f, 14.0f, 0.0f)
+    };
+    triangle.VertexColors = { GRAPHICS::Color::RED, GRAPHICS::Color::GREEN, GRAPHICS::Color::BLUE };
+    return triangle;
+}
+
+TEST_CASE("Specialized rasterizers produce the same pixels with and without depth testing.", "[SoftwareRasterizationAlgorithm][TriangleRasterizer]")
+{
+    for (GRAPHICS::ShadingType shading_type : { GRAPHICS::ShadingType::WIREFRAME, GRAPHICS::ShadingType::FLAT, GRAPHICS::ShadingType::GOURAUD })
+    {
+        // RENDER A TRIANGLE WITHOUT DEPTH TESTING.
+        constexpr unsigned int BITMAP_DIMENSION_IN_PIXELS = 16;
+        GRAPHICS::ScreenSpaceTriangle triangle = CreateTestScreenSpaceTriangle(shading_type);
+        GRAPHICS::Bitmap bitmap_without_depth_testing(BITMAP_DIMENSION_IN_PIXELS, BITMAP_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(triangle, bitmap_without_depth_testing, nullptr);
+
+        // RENDER THE TRIANGLE WITH DEPTH TESTING.
+        GRAPHICS::Bitmap bitmap_with_depth_testing(BITMAP_DIMENSION_IN_PIXELS, BITMAP_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
+        GRAPHICS::DepthBuffer depth_buffer(BITMAP_DIMENSION_IN_PIXELS, BITMAP_DIMENSION_IN_PIXELS);
+        depth_buffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+        GRAPHICS::SoftwareRasterizationAlgorithm::TriangleRasterizer triangle_rasterizer = GRAPHICS::SoftwareRasterizationAlgorithm::SelectTriangleRasterizer(
+            *triangle.Material,
+            &depth_buffer);
+        triangle_rasterizer(triangle, bitmap_with_depth_testing, &depth_buffer, nullptr);
+
+        // VERIFY THE SAME PIXELS WERE RENDERED.
+        unsigned int rendered_pixel_count = 0;
+        for (unsigned int y = 0; y < BITMAP_DIMENSION_IN_PIXELS; ++y)
+        {
+            for (unsigned int x = 0; x < BITMAP_DIMENSION_IN_PIXELS; ++x)
+            {
+                GRAPHICS::Color expected_color = bitmap_without_depth_testing.GetPixel(x, y);
+                GRAPHICS::Color actual_color = bitmap_with_depth_testing.GetPixel(x, y);
+                REQUIRE(expected_color == actual_color);
+
+                bool pixel_rendered = (0.0f != actual_color.Alpha);
+                if (pixel_rendered)
+                {
+                    ++rendered_pixel_count;
+                }
+            }
+        }
+        REQUIRE(rendered_pixel_count > 0);
+    }
+}
+
+TEST_CASE("Depth testing hides triangles behind closer triangles.", "[SoftwareRasterizationAlgorithm][TriangleRasterizer][DepthTest]")
+{
+    for (GRAPHICS::ShadingType shading_type : { GRAPHICS::ShadingType::FLAT, GRAPHICS::ShadingType::FACE_VERTEX_COLOR_INTERPOLATION })
+    {
+        // CREATE A CLOSER RED TRIANGLE AND A FARTHER BLUE TRIANGLE.
+        // Greater depth values are closer.
+        GRAPHICS::ScreenSpaceTriangle closer_triangle = CreateTestScreenSpaceTriangle(shading_type);
+        closer_triangle.VertexColors = { GRAPHICS::Color::RED, GRAPHICS::Color::RED, GRAPHICS::Color::RED };
+        GRAPHICS::ScreenSpaceTriangle farther_triangle = CreateTestScreenSpaceTriangle(shading_type);
+        farther_triangle.VertexColors = { GRAPHICS::Color::BLUE, GRAPHICS::Color::BLUE, GRAPHICS::Color::BLUE };
+        for (MATH::Vector3f& vertex_position : farther_triangle.VertexPositions)
+        {
+            vertex_position.Z = -1.0f;
+        }
+
+        // RENDER THE CLOSER TRIANGLE FIRST.
+        constexpr unsigned int BITMAP_DIMENSION_IN_PIXELS = 16;
+        GRAPHICS::Bitmap bitmap(BITMAP_DIMENSION_IN_PIXELS, BITMAP_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+        GRAPHICS::DepthBuffer depth_buffer(BITMAP_DIMENSION_IN_PIXELS, BITMAP_DIMENSION_IN_PIXELS);
+        depth_buffer.ClearToDepth(GRAPHICS::DepthBuffer::MAX_DEPTH);
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(closer_triangle, bitmap, &depth_buffer);
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(farther_triangle, bitmap, &depth_buffer);
+
+        // VERIFY THE CLOSER TRIANGLE REMAINS VISIBLE.
+        constexpr unsigned int TRIANGLE_CENTER_X = 8;
+        constexpr unsigned int TRIANGLE_CENTER_Y = 10;
+        GRAPHICS::Color center_color = bitmap.GetPixel(TRIANGLE_CENTER_X, TRIANGLE_CENTER_Y);
+        REQUIRE(GRAPHICS::Color::RED == center_color);
+    }
+}
+
+TEST_CASE("Fragment counters count overdraw and fragments hidden by depth testing.", "[SoftwareRasterizationAlgorithm][TriangleRasterizer][FragmentCounters]")
+{
+    for (GRAPHICS::ShadingType shading_type : { GRAPHICS::ShadingType::FLAT, GRAPHICS::ShadingType::FACE_VERTEX_COLOR_INTERPOLATION })
+    {
+        // RENDER A CLOSER TRIANGLE AND THEN A FARTHER TRIANGLE COVERING THE SAME PIXELS.
+        // Greater depth values are closer.
+        GRAPHICS::ScreenSpaceTriangle closer_triangle = CreateTestScreenSpaceTriangle(shading_type);
+        GRAPHICS::ScreenSpaceTriangle farther_triangle = CreateTestScreenSpaceTriangle(shading_type);
+        for (MATH::Vector3f& vertex_position : farther_triangle.VertexPositions)
+        {
+            vertex_position.Z = -1.0f;
+        }
+        constexpr unsigned int BITMAP_DIMENSION_IN_PIXELS = 16;
+        GRAPHICS::Bitmap bitmap(BITMAP_DIMENSION_IN_PIXELS, BITMAP_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+        GRAPHICS::DepthBuffer depth_buffer(BITMAP_DIMENSION_IN_PIXELS, BITMAP_DIMENSION_IN_PIXELS);
+        GRAPHICS::FragmentCounters fragment_counters(BITMAP_DIMENSION_IN_PIXELS, BITMAP_DIMENSION_IN_PIXELS);
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(closer_triangle, bitmap, &depth_buffer, &fragment_counters);
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(farther_triangle, bitmap, &depth_buffer, &fragment_counters);
+
+        // VERIFY BOTH TRIANGLES WERE TESTED BUT ONLY THE CLOSER ONE WAS SHADED.
+        constexpr unsigned int TRIANGLE_CENTER_X = 8;
+        constexpr unsigned int TRIANGLE_CENTER_Y = 10;
+        REQUIRE(2 == fragment_counters.TestedFragmentCounts(TRIANGLE_CENTER_X, TRIANGLE_CENTER_Y));
+        REQUIRE(1 == fragment_counters.DepthPassedFragmentCounts(TRIANGLE_CENTER_X, TRIANGLE_CENTER_Y));
+        REQUIRE(1 == fragment_counters.ShadedFragmentCounts(TRIANGLE_CENTER_X, TRIANGLE_CENTER_Y));
+        REQUIRE(0 == fragment_counters.TestedFragmentCounts(0, 0));
+
+        GRAPHICS::FragmentCounters::Totals totals = fragment_counters.GetTotals();
+        REQUIRE(totals.ShadedFragmentCount > 0);
+        REQUIRE(totals.DepthPassedFragmentCount == totals.ShadedFragmentCount);
+        REQUIRE(2 * totals.ShadedFragmentCount == totals.TestedFragmentCount);
+        REQUIRE(2 == totals.MaxTestedFragmentCountPerPixel);
+
+        // VERIFY ALL FRAGMENTS ARE SHADED WITHOUT DEPTH TESTING.
+        fragment_counters.Clear();
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(closer_triangle, bitmap, nullptr, &fragment_counters);
+        GRAPHICS::SoftwareRasterizationAlgorithm::Render(farther_triangle, bitmap, nullptr, &fragment_counters);
+        totals = fragment_counters.GetTotals();
+        REQUIRE(totals.TestedFragmentCount == totals.ShadedFragmentCount);
+        REQUIRE(totals.TestedFragmentCount == totals.DepthPassedFragmentCount);
+        REQUIRE(2 == fragment_counters.ShadedFragmentCounts(TRIANGLE_CENTER_X, TRIANGLE_CENTER_Y));
+    }
+}
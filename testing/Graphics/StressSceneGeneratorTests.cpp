@@ -0,0 +1,140 @@
+#include <cstddef>
+#include "Graphics/StressSceneGenerator.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Checks if two generated stress scenes have identical objects and lights.
+/// @param[in]  scene_1 - The first scene to compare.
+/// @param[in]  scene_2 - The second scene to compare.
+/// @return True if the scenes are identical; false otherwise.
+static bool StressScenesIdentical(const GRAPHICS::Scene& scene_1, const GRAPHICS::Scene& scene_2)
+{
+    // COMPARE THE OBJECTS.
+    if (scene_1.Objects.size() != scene_2.Objects.size())
+    {
+        return false;
+    }
+    for (std::size_t object_index = 0; object_index < scene_1.Objects.size(); ++object_index)
+    {
+        const GRAPHICS::Object3D& object_1 = scene_1.Objects[object_index];
+        const GRAPHICS::Object3D& object_2 = scene_2.Objects[object_index];
+        bool objects_identical = (
+            (object_1.WorldTransform() == object_2.WorldTransform()) &&
+            (object_1.Triangles.size() == object_2.Triangles.size()));
+        if (!objects_identical)
+        {
+            return false;
+        }
+        for (std::size_t triangle_index = 0; triangle_index < object_1.Triangles.size(); ++triangle_index)
+        {
+            const GRAPHICS::Triangle& triangle_1 = object_1.Triangles[triangle_index];
+            const GRAPHICS::Triangle& triangle_2 = object_2.Triangles[triangle_index];
+            bool triangles_identical = (
+                (triangle_1.Vertices == triangle_2.Vertices) &&
+                (triangle_1.Material->DiffuseColor == triangle_2.Material->DiffuseColor) &&
+                (triangle_1.Material->ReflectivityProportion == triangle_2.Material->ReflectivityProportion));
+            if (!triangles_identical)
+            {
+                return false;
+            }
+        }
+    }
+
+    // COMPARE THE LIGHTS.
+    if (scene_1.PointLights->size() != scene_2.PointLights->size())
+    {
+        return false;
+    }
+    for (std::size_t light_index = 0; light_index < scene_1.PointLights->size(); ++light_index)
+    {
+        const GRAPHICS::Light& light_1 = scene_1.PointLights->at(light_index);
+        const GRAPHICS::Light& light_2 = scene_2.PointLights->at(light_index);
+        bool lights_identical = (
+            (light_1.Type == light_2.Type) &&
+            (light_1.Color == light_2.Color) &&
+            (light_1.PointLightWorldPosition == light_2.PointLightWorldPosition));
+        if (!lights_identical)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST_CASE("Stress scenes are identical only when generated with the same seed.", "[StressSceneGenerator]")
+{
+    for (std::size_t type_index = 0; type_index < static_cast<std::size_t>(GRAPHICS::StressSceneType::COUNT); ++type_index)
+    {
+        // GENERATE SMALL VERSIONS OF THE SCENE WITH THE SAME AND DIFFERENT SEEDS.
+        GRAPHICS::StressSceneParameters parameters;
+        parameters.Type = static_cast<GRAPHICS::StressSceneType>(type_index);
+        parameters.TriangleCount = 500;
+        parameters.LightCount = 3;
+        parameters.Seed = 7;
+        GRAPHICS::SceneDescription scene_description = GRAPHICS::StressSceneGenerator::Generate(parameters);
+        GRAPHICS::SceneDescription same_seed_scene_description = GRAPHICS::StressSceneGenerator::Generate(parameters);
+        parameters.Seed = 8;
+        GRAPHICS::SceneDescription different_seed_scene_description = GRAPHICS::StressSceneGenerator::Generate(parameters);
+
+        // VERIFY ONLY THE SCENE WITH THE SAME SEED IS IDENTICAL.
+        INFO(GRAPHICS::StressSceneGenerator::TypeName(parameters.Type));
+        REQUIRE(StressScenesIdentical(scene_description.Scene, same_seed_scene_description.Scene));
+        REQUIRE_FALSE(StressScenesIdentical(scene_description.Scene, different_seed_scene_description.Scene));
+    }
+}
+
+TEST_CASE("Stress scenes have about the requested numbers of triangles and lights.", "[StressSceneGenerator]")
+{
+    for (std::size_t type_index = 0; type_index < static_cast<std::size_t>(GRAPHICS::StressSceneType::COUNT); ++type_index)
+    {
+        // GENERATE THE SCENE.
+        GRAPHICS::StressSceneParameters parameters;
+        parameters.Type = static_cast<GRAPHICS::StressSceneType>(type_index);
+        parameters.TriangleCount = 2000;
+        parameters.LightCount = 5;
+        GRAPHICS::SceneDescription scene_description = GRAPHICS::StressSceneGenerator::Generate(parameters);
+
+        // VERIFY THE TRIANGLE COUNT IS WITHIN 10% OF THE REQUESTED COUNT.
+        INFO(GRAPHICS::StressSceneGenerator::TypeName(parameters.Type));
+        std::size_t triangle_count = 0;
+        for (const GRAPHICS::Object3D& object_3D : scene_description.Scene.Objects)
+        {
+            triangle_count += object_3D.Triangles.size();
+        }
+        REQUIRE(static_cast<double>(triangle_count) == Approx(2000.0).epsilon(0.1));
+
+        // VERIFY THE LIGHTS WERE ADDED ALONG WITH AN AMBIENT LIGHT.
+        REQUIRE(scene_description.Scene.PointLights);
+        REQUIRE(6 == scene_description.Scene.PointLights->size());
+        REQUIRE(GRAPHICS::LightType::AMBIENT == scene_description.Scene.PointLights->at(0).Type);
+        REQUIRE(GRAPHICS::LightType::POINT == scene_description.Scene.PointLights->at(5).Type);
+        REQUIRE(GRAPHICS::ProjectionType::PERSPECTIVE == scene_description.Camera.Projection);
+    }
+}
+
+TEST_CASE("Stress scene spheres have the expected number of outward-facing triangles.", "[StressSceneGenerator]")
+{
+    constexpr unsigned int RING_COUNT = 8;
+    GRAPHICS::Object3D sphere = GRAPHICS::StressSceneGenerator::CreateSphere(std::make_shared<GRAPHICS::Material>(), RING_COUNT);
+
+    REQUIRE(4 * RING_COUNT * (RING_COUNT - 1) == sphere.Triangles.size());
+    for (const GRAPHICS::Triangle& triangle : sphere.Triangles)
+    {
+        // The sphere is centered at the origin, so the center of each triangle points outward.
+        MATH::Vector3f triangle_center = MATH::Vector3f::Scale(1.0f / 3.0f, triangle.Vertices[0] + triangle.Vertices[1] + triangle.Vertices[2]);
+        REQUIRE(MATH::Vector3f::DotProduct(triangle.SurfaceNormal(), triangle_center) > 0.0f);
+    }
+}
+
+TEST_CASE("Stress scene types can be found by name.", "[StressSceneGenerator]")
+{
+    for (std::size_t type_index = 0; type_index < static_cast<std::size_t>(GRAPHICS::StressSceneType::COUNT); ++type_index)
+    {
+        GRAPHICS::StressSceneType type = static_cast<GRAPHICS::StressSceneType>(type_index);
+        std::optional<GRAPHICS::StressSceneType> type_from_name = GRAPHICS::StressSceneGenerator::TypeFromName(GRAPHICS::StressSceneGenerator::TypeName(type));
+        REQUIRE(type_from_name);
+        REQUIRE(type == *type_from_name);
+    }
+
+    REQUIRE_FALSE(GRAPHICS::StressSceneGenerator::TypeFromName("not_a_scene"));
+}
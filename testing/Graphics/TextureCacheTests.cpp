@@ -0,0 +1,174 @@
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include "Graphics/TextureCache.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Saves a .bmp file with a single row of pixels that all have the same color.
+/// @param[in]  filepath - The path of the file to write.
+/// @param[in]  width - The width of the image in pixels.
+/// @param[in]  red - The red component of all pixels.
+static void SaveSingleRowTexture(const std::filesystem::path& filepath, const unsigned int width, const uint8_t red)
+{
+    GRAPHICS::Bitmap texture(width, 1, GRAPHICS::ColorFormat::RGBA);
+    texture.FillPixels(GRAPHICS::Color(red, uint8_t(0), uint8_t(0), uint8_t(0xFF)));
+    REQUIRE(texture.Save(filepath));
+}
+
+TEST_CASE("Textures are only loaded once per color format.", "[TextureCache]")
+{
+    std::filesystem::path texture_folder = std::filesystem::temp_directory_path() / "TextureCacheSharingTests";
+    std::filesystem::create_directories(texture_folder);
+    SaveSingleRowTexture(texture_folder / "texture.bmp", 2, 0x80);
+    GRAPHICS::TextureCache texture_cache;
+
+    std::shared_ptr<GRAPHICS::Bitmap> first_texture = texture_cache.Get(texture_folder / "texture.bmp");
+    std::shared_ptr<GRAPHICS::Bitmap> second_texture = texture_cache.Get(texture_folder / "." / "texture.bmp");
+    std::shared_ptr<GRAPHICS::Bitmap> other_format_texture = texture_cache.Get(texture_folder / "texture.bmp", GRAPHICS::ColorFormat::ARGB);
+
+    REQUIRE(first_texture);
+    REQUIRE(first_texture == second_texture);
+    REQUIRE(other_format_texture);
+    REQUIRE(first_texture != other_format_texture);
+    REQUIRE(GRAPHICS::ColorFormat::ARGB == other_format_texture->GetColorFormat());
+    GRAPHICS::TextureCache::Statistics statistics = texture_cache.GetStatistics();
+    REQUIRE(1 == statistics.HitCount);
+    REQUIRE(2 == statistics.MissCount);
+    REQUIRE(2 == statistics.ResidentTextureCount);
+    REQUIRE(2 * 2 * sizeof(uint32_t) == statistics.ResidentSizeInBytes);
+
+    std::filesystem::remove_all(texture_folder);
+}
+
+TEST_CASE("Missing textures are not cached.", "[TextureCache]")
+{
+    GRAPHICS::TextureCache texture_cache;
+    std::filesystem::path missing_filepath = std::filesystem::temp_directory_path() / "TextureCacheTests.missing.bmp";
+    std::filesystem::remove(missing_filepath);
+
+    REQUIRE_FALSE(texture_cache.Get(missing_filepath));
+
+    GRAPHICS::TextureCache::Statistics statistics = texture_cache.GetStatistics();
+    REQUIRE(1 == statistics.MissCount);
+    REQUIRE(0 == statistics.ResidentTextureCount);
+}
+
+TEST_CASE("Least recently used unreferenced textures are evicted to stay within the memory budget.", "[TextureCache]")
+{
+    // CREATE TEXTURES THAT EACH TAKE 4 BYTES.
+    std::filesystem::path texture_folder = std::filesystem::temp_directory_path() / "TextureCacheEvictionTests";
+    std::filesystem::create_directories(texture_folder);
+    SaveSingleRowTexture(texture_folder / "a.bmp", 1, 0xA0);
+    SaveSingleRowTexture(texture_folder / "b.bmp", 1, 0xB0);
+    SaveSingleRowTexture(texture_folder / "c.bmp", 1, 0xC0);
+    constexpr std::size_t TEXTURE_SIZE_IN_BYTES = sizeof(uint32_t);
+    GRAPHICS::TextureCache texture_cache(2 * TEXTURE_SIZE_IN_BYTES);
+
+    SECTION("Unreferenced textures.")
+    {
+        // LOAD TWO TEXTURES, USING THE FIRST MOST RECENTLY.
+        texture_cache.Get(texture_folder / "a.bmp");
+        texture_cache.Get(texture_folder / "b.bmp");
+        texture_cache.Get(texture_folder / "a.bmp");
+
+        // LOAD A THIRD TEXTURE TO EXCEED THE BUDGET.
+        texture_cache.Get(texture_folder / "c.bmp");
+
+        // VERIFY THE LEAST RECENTLY USED TEXTURE WAS EVICTED.
+        GRAPHICS::TextureCache::Statistics statistics = texture_cache.GetStatistics();
+        REQUIRE(1 == statistics.EvictionCount);
+        REQUIRE(2 == statistics.ResidentTextureCount);
+        REQUIRE(2 * TEXTURE_SIZE_IN_BYTES == statistics.ResidentSizeInBytes);
+        texture_cache.Get(texture_folder / "a.bmp");
+        texture_cache.Get(texture_folder / "c.bmp");
+        REQUIRE(3 == texture_cache.GetStatistics().HitCount);
+        texture_cache.Get(texture_folder / "b.bmp");
+        REQUIRE(4 == texture_cache.GetStatistics().MissCount);
+    }
+
+    SECTION("Referenced textures.")
+    {
+        std::shared_ptr<GRAPHICS::Bitmap> a_texture = texture_cache.Get(texture_folder / "a.bmp");
+        std::shared_ptr<GRAPHICS::Bitmap> b_texture = texture_cache.Get(texture_folder / "b.bmp");
+        std::shared_ptr<GRAPHICS::Bitmap> c_texture = texture_cache.Get(texture_folder / "c.bmp");
+
+        // TEXTURES IN USE ARE KEPT DESPITE EXCEEDING THE BUDGET.
+        GRAPHICS::TextureCache::Statistics statistics = texture_cache.GetStatistics();
+        REQUIRE(0 == statistics.EvictionCount);
+        REQUIRE(3 * TEXTURE_SIZE_IN_BYTES == statistics.ResidentSizeInBytes);
+
+        // TEXTURES NO LONGER IN USE CAN BE EVICTED.
+        a_texture.reset();
+        c_texture.reset();
+        texture_cache.EvictUnreferenced();
+        statistics = texture_cache.GetStatistics();
+        REQUIRE(2 == statistics.EvictionCount);
+        REQUIRE(1 == statistics.ResidentTextureCount);
+        REQUIRE(b_texture == texture_cache.Get(texture_folder / "b.bmp"));
+    }
+
+    SECTION("Released textures.")
+    {
+        std::shared_ptr<GRAPHICS::Bitmap> a_texture = texture_cache.Get(texture_folder / "a.bmp");
+        std::shared_ptr<GRAPHICS::Bitmap> b_texture = texture_cache.Get(texture_folder / "b.bmp");
+        std::shared_ptr<GRAPHICS::Bitmap> c_texture = texture_cache.Get(texture_folder / "c.bmp");
+
+        // RELEASED TEXTURES ARE ONLY EVICTED AS NEEDED FOR THE BUDGET.
+        a_texture.reset();
+        b_texture.reset();
+        texture_cache.EnforceMemoryBudget();
+        GRAPHICS::TextureCache::Statistics statistics = texture_cache.GetStatistics();
+        REQUIRE(1 == statistics.EvictionCount);
+        REQUIRE(2 * TEXTURE_SIZE_IN_BYTES == statistics.ResidentSizeInBytes);
+        texture_cache.Get(texture_folder / "b.bmp");
+        REQUIRE(1 == texture_cache.GetStatistics().HitCount);
+    }
+
+    SECTION("Reduced budget.")
+    {
+        texture_cache.Get(texture_folder / "a.bmp");
+        texture_cache.Get(texture_folder / "b.bmp");
+
+        texture_cache.SetMemoryBudget(TEXTURE_SIZE_IN_BYTES);
+
+        GRAPHICS::TextureCache::Statistics statistics = texture_cache.GetStatistics();
+        REQUIRE(TEXTURE_SIZE_IN_BYTES == statistics.MemoryBudgetInBytes);
+        REQUIRE(1 == statistics.ResidentTextureCount);
+        texture_cache.Get(texture_folder / "b.bmp");
+        REQUIRE(1 == texture_cache.GetStatistics().HitCount);
+    }
+
+    std::filesystem::remove_all(texture_folder);
+}
+
+TEST_CASE("Reloading a texture replaces it without modifying the previous texture.", "[TextureCache]")
+{
+    std::filesystem::path texture_folder = std::filesystem::temp_directory_path() / "TextureCacheReloadTests";
+    std::filesystem::create_directories(texture_folder);
+    std::filesystem::path texture_filepath = texture_folder / "texture.bmp";
+    SaveSingleRowTexture(texture_filepath, 1, 0x10);
+    GRAPHICS::TextureCache texture_cache;
+    std::shared_ptr<GRAPHICS::Bitmap> texture = texture_cache.Get(texture_filepath);
+    REQUIRE(texture);
+    REQUIRE(0x100000FF == texture->GetRawData()[0]);
+
+    // MODIFY THE TEXTURE FILE.
+    SaveSingleRowTexture(texture_filepath, 3, 0x20);
+
+    // RELOAD THE TEXTURE.
+    std::shared_ptr<GRAPHICS::Bitmap> reloaded_texture = texture_cache.Reload(texture_filepath);
+
+    // VERIFY THE RELOADED TEXTURE REPLACED THE PREVIOUS ONE.
+    REQUIRE(reloaded_texture);
+    REQUIRE(texture != reloaded_texture);
+    REQUIRE(3 == reloaded_texture->GetWidthInPixels());
+    REQUIRE(0x200000FF == reloaded_texture->GetRawData()[0]);
+    REQUIRE(reloaded_texture == texture_cache.Get(texture_filepath));
+    REQUIRE(3 * sizeof(uint32_t) == texture_cache.GetStatistics().ResidentSizeInBytes);
+
+    // VERIFY THE PREVIOUS TEXTURE WAS LEFT UNCHANGED FOR ANY EXISTING USERS.
+    REQUIRE(1 == texture->GetWidthInPixels());
+    REQUIRE(0x100000FF == texture->GetRawData()[0]);
+
+    std::filesystem::remove_all(texture_folder);
+}
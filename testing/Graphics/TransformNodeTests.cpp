@@ -0,0 +1,142 @@
+#include <vector>
+#include "Graphics/Object3D.h"
+#include "Graphics/TransformNode.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("World transforms combine local transforms of all ancestors.", "[TransformNode][WorldTransform]")
+{
+    // CREATE A HIERARCHY OF NODES.
+    GRAPHICS::TransformNode root;
+    root.SetLocalPosition(MATH::Vector3f(1.0f, 2.0f, 3.0f));
+    GRAPHICS::TransformNode child;
+    REQUIRE(child.SetParent(&root));
+    child.SetLocalScale(MATH::Vector3f(2.0f, 2.0f, 2.0f));
+    GRAPHICS::TransformNode grandchild;
+    REQUIRE(grandchild.SetParent(&child));
+    grandchild.SetLocalPosition(MATH::Vector3f(1.0f, 0.0f, 0.0f));
+
+    // VERIFY THE WORLD TRANSFORMS.
+    MATH::Matrix4x4f expected_grandchild_world_transform = root.LocalTransform() * child.LocalTransform() * grandchild.LocalTransform();
+    REQUIRE(expected_grandchild_world_transform == grandchild.WorldTransform());
+    MATH::Vector4f grandchild_world_origin = grandchild.WorldTransform() * MATH::Vector4f(0.0f, 0.0f, 0.0f, 1.0f);
+    REQUIRE(3.0f == grandchild_world_origin.X);
+    REQUIRE(2.0f == grandchild_world_origin.Y);
+    REQUIRE(3.0f == grandchild_world_origin.Z);
+
+    // CHANGE AN ANCESTOR.
+    root.SetLocalPosition(MATH::Vector3f(0.0f, 0.0f, 0.0f));
+
+    // VERIFY THE CHANGE PROPAGATED TO DESCENDANTS.
+    grandchild_world_origin = grandchild.WorldTransform() * MATH::Vector4f(0.0f, 0.0f, 0.0f, 1.0f);
+    REQUIRE(2.0f == grandchild_world_origin.X);
+    REQUIRE(0.0f == grandchild_world_origin.Y);
+    REQUIRE(0.0f == grandchild_world_origin.Z);
+}
+
+TEST_CASE("Transform node hierarchies cannot contain cycles.", "[TransformNode][Hierarchy]")
+{
+    // CREATE A HIERARCHY OF NODES.
+    GRAPHICS::TransformNode root;
+    GRAPHICS::TransformNode child;
+    REQUIRE(child.SetParent(&root));
+
+    // VERIFY CYCLES ARE PREVENTED.
+    REQUIRE_FALSE(root.SetParent(&child));
+    REQUIRE_FALSE(root.SetParent(&root));
+    REQUIRE(nullptr == root.GetParent());
+    REQUIRE(&root == child.GetParent());
+    REQUIRE(std::vector<GRAPHICS::TransformNode*>{ &child } == root.GetChildren());
+}
+
+TEST_CASE("Destroyed transform nodes are detached from the hierarchy.", "[TransformNode][Hierarchy]")
+{
+    // CREATE A HIERARCHY WITH A NODE IN THE MIDDLE THAT WILL BE DESTROYED.
+    GRAPHICS::TransformNode root;
+    GRAPHICS::TransformNode grandchild;
+    grandchild.SetLocalPosition(MATH::Vector3f(1.0f, 0.0f, 0.0f));
+    {
+        GRAPHICS::TransformNode child;
+        child.SetLocalPosition(MATH::Vector3f(5.0f, 0.0f, 0.0f));
+        REQUIRE(child.SetParent(&root));
+        REQUIRE(grandchild.SetParent(&child));
+        REQUIRE(6.0f == grandchild.WorldTransform().Elements(3, 0));
+    }
+
+    // VERIFY THE REMAINING NODES WERE DETACHED.
+    REQUIRE(root.GetChildren().empty());
+    REQUIRE(nullptr == grandchild.GetParent());
+    REQUIRE(1.0f == grandchild.WorldTransform().Elements(3, 0));
+}
+
+TEST_CASE("Only changed transform subtrees are invalidated and notified.", "[TransformNode][ChangeNotifications]")
+{
+    // CREATE A HIERARCHY WITH 2 SEPARATE SUBTREES.
+    GRAPHICS::TransformNode root;
+    GRAPHICS::TransformNode changed_child;
+    REQUIRE(changed_child.SetParent(&root));
+    GRAPHICS::TransformNode changed_grandchild;
+    REQUIRE(changed_grandchild.SetParent(&changed_child));
+    GRAPHICS::TransformNode static_child;
+    REQUIRE(static_child.SetParent(&root));
+
+    // BRING ALL WORLD TRANSFORMS UP-TO-DATE.
+    changed_grandchild.WorldTransform();
+    static_child.WorldTransform();
+
+    // SUBSCRIBE TO CHANGES.
+    unsigned int changed_grandchild_notification_count = 0;
+    GRAPHICS::TransformNode::SubscriptionId subscription_id = changed_grandchild.SubscribeToWorldTransformChanges(
+        [&](const GRAPHICS::TransformNode&) { ++changed_grandchild_notification_count; });
+    unsigned int static_child_notification_count = 0;
+    static_child.SubscribeToWorldTransformChanges(
+        [&](const GRAPHICS::TransformNode&) { ++static_child_notification_count; });
+    uint64_t original_static_child_version = static_child.WorldTransformVersion();
+    uint64_t original_changed_grandchild_version = changed_grandchild.WorldTransformVersion();
+
+    // CHANGE ONE SUBTREE MULTIPLE TIMES.
+    changed_child.SetLocalPosition(MATH::Vector3f(1.0f, 0.0f, 0.0f));
+    changed_child.SetLocalPosition(MATH::Vector3f(2.0f, 0.0f, 0.0f));
+
+    // VERIFY ONLY THE CHANGED SUBTREE WAS NOTIFIED, AND ONLY ONCE UNTIL RETRIEVING THE TRANSFORM.
+    REQUIRE(1 == changed_grandchild_notification_count);
+    REQUIRE(0 == static_child_notification_count);
+    REQUIRE(original_changed_grandchild_version != changed_grandchild.WorldTransformVersion());
+    REQUIRE(original_static_child_version == static_child.WorldTransformVersion());
+
+    changed_grandchild.WorldTransform();
+    changed_child.SetLocalPosition(MATH::Vector3f(3.0f, 0.0f, 0.0f));
+    REQUIRE(2 == changed_grandchild_notification_count);
+
+    // VERIFY SETTING AN UNCHANGED VALUE DOESN'T NOTIFY.
+    changed_grandchild.WorldTransform();
+    changed_child.SetLocalPosition(MATH::Vector3f(3.0f, 0.0f, 0.0f));
+    REQUIRE(2 == changed_grandchild_notification_count);
+
+    // VERIFY UNSUBSCRIBED CALLBACKS AREN'T NOTIFIED.
+    changed_grandchild.UnsubscribeFromWorldTransformChanges(subscription_id);
+    changed_child.SetLocalPosition(MATH::Vector3f(4.0f, 0.0f, 0.0f));
+    REQUIRE(2 == changed_grandchild_notification_count);
+}
+
+TEST_CASE("Object world transforms are updated when objects or their parents change.", "[TransformNode][Object3D]")
+{
+    // CREATE AN OBJECT ATTACHED TO A PARENT.
+    auto parent = std::make_shared<GRAPHICS::TransformNode>();
+    parent->SetLocalPosition(MATH::Vector3f(10.0f, 0.0f, 0.0f));
+    GRAPHICS::Object3D object_3D;
+    object_3D.WorldPosition = MATH::Vector3f(1.0f, 0.0f, 0.0f);
+    object_3D.Parent = parent;
+    REQUIRE(11.0f == object_3D.WorldTransform().Elements(3, 0));
+
+    // CHANGE THE OBJECT.
+    object_3D.WorldPosition = MATH::Vector3f(2.0f, 0.0f, 0.0f);
+    REQUIRE(12.0f == object_3D.WorldTransform().Elements(3, 0));
+
+    // CHANGE THE PARENT.
+    parent->SetLocalPosition(MATH::Vector3f(20.0f, 0.0f, 0.0f));
+    REQUIRE(22.0f == object_3D.WorldTransform().Elements(3, 0));
+
+    // DETACH THE OBJECT FROM THE PARENT.
+    object_3D.Parent = nullptr;
+    REQUIRE(2.0f == object_3D.WorldTransform().Elements(3, 0));
+}
@@ -0,0 +1,95 @@
+#include "Math/Matrix4x4.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Default-constructed matrices have all zero elements.", "[Matrix4x4][Construction]")
+{
+    // CREATE A DEFAULT MATRIX.
+    MATH::Matrix4x4f matrix;
+
+    // VERIFY ALL ELEMENTS ARE ZERO.
+    for (unsigned int row_index = 0; row_index < MATH::Matrix4x4f::ROW_COUNT; ++row_index)
+    {
+        for (unsigned int column_index = 0; column_index < MATH::Matrix4x4f::COLUMN_COUNT; ++column_index)
+        {
+            REQUIRE(0.0f == matrix.Elements(column_index, row_index));
+        }
+    }
+}
+
+TEST_CASE("Matrices can be constructed in constant expressions.", "[Matrix4x4][Construction]")
+{
+    // CREATE MATRICES AT COMPILE-TIME.
+    constexpr MATH::Matrix4x4f IDENTITY_MATRIX = MATH::Matrix4x4f::Identity();
+    constexpr MATH::Matrix4x4f SQUARED_IDENTITY_MATRIX = IDENTITY_MATRIX * IDENTITY_MATRIX;
+    static_assert(1.0f == IDENTITY_MATRIX.Elements(0, 0));
+    static_assert(0.0f == IDENTITY_MATRIX.Elements(1, 0));
+    static_assert(IDENTITY_MATRIX == SQUARED_IDENTITY_MATRIX);
+
+    // VERIFY THE SAME MATRICES ARE CREATED AT RUNTIME.
+    MATH::Matrix4x4f runtime_identity_matrix = MATH::Matrix4x4f::Identity();
+    REQUIRE(IDENTITY_MATRIX == runtime_identity_matrix);
+    REQUIRE(SQUARED_IDENTITY_MATRIX == runtime_identity_matrix * runtime_identity_matrix);
+}
+
+TEST_CASE("Matrices can be multiplied by matrices.", "[Matrix4x4][Multiplication]")
+{
+    // CREATE MATRICES TO MULTIPLY.
+    MATH::Matrix4x4f lhs = MATH::Matrix4x4f::FromRowMajorElements(
+        {
+            1.0f, 2.0f, 3.0f, 4.0f,
+            5.0f, 6.0f, 7.0f, 8.0f,
+            9.0f, 10.0f, 11.0f, 12.0f,
+            13.0f, 14.0f, 15.0f, 16.0f
+        });
+    MATH::Matrix4x4f rhs = MATH::Matrix4x4f::FromRowMajorElements(
+        {
+            -1.0f, 0.5f, 2.0f, 0.0f,
+            3.0f, -2.0f, 1.0f, 1.0f,
+            0.0f, 4.0f, -3.0f, 2.0f,
+            1.0f, 1.0f, 0.0f, -1.0f
+        });
+
+    // MULTIPLY THE MATRICES.
+    MATH::Matrix4x4f product = lhs * rhs;
+
+    // VERIFY THE PRODUCT.
+    MATH::Matrix4x4f expected_product = MATH::Matrix4x4f::FromRowMajorElements(
+        {
+            9.0f, 12.5f, -5.0f, 4.0f,
+            21.0f, 26.5f, -5.0f, 12.0f,
+            33.0f, 40.5f, -5.0f, 20.0f,
+            45.0f, 54.5f, -5.0f, 28.0f
+        });
+    REQUIRE(expected_product == product);
+}
+
+TEST_CASE("Matrices can transform vectors.", "[Matrix4x4][Multiplication]")
+{
+    // CREATE A MATRIX THAT BOTH SCALES AND TRANSLATES.
+    MATH::Matrix4x4f translation = MATH::Matrix4x4f::Translation(MATH::Vector3f(1.0f, -2.0f, 3.0f));
+    MATH::Matrix4x4f scale = MATH::Matrix4x4f::Scale(MATH::Vector3f(2.0f, 3.0f, 4.0f));
+    MATH::Matrix4x4f transform = translation * scale;
+
+    // TRANSFORM A VECTOR.
+    MATH::Vector4f position(1.0f, 1.0f, 1.0f, 1.0f);
+    MATH::Vector4f transformed_position = transform * position;
+
+    // VERIFY THE TRANSFORMED VECTOR.
+    REQUIRE(3.0f == transformed_position.X);
+    REQUIRE(1.0f == transformed_position.Y);
+    REQUIRE(7.0f == transformed_position.Z);
+    REQUIRE(1.0f == transformed_position.W);
+}
+
+TEST_CASE("Matrix elements can be retrieved in column-major order.", "[Matrix4x4][ElementRetrieval]")
+{
+    // CREATE A TRANSLATION MATRIX.
+    MATH::Matrix4x4f translation = MATH::Matrix4x4f::Translation(MATH::Vector3f(1.0f, 2.0f, 3.0f));
+
+    // VERIFY THE TRANSLATION IS IN THE LAST COLUMN.
+    auto elements_in_column_major_order = translation.Elements.ValuesInColumnMajorOrder();
+    REQUIRE(1.0f == elements_in_column_major_order[12]);
+    REQUIRE(2.0f == elements_in_column_major_order[13]);
+    REQUIRE(3.0f == elements_in_column_major_order[14]);
+    REQUIRE(1.0f == elements_in_column_major_order[15]);
+}
@@ -0,0 +1,122 @@
+#include <cmath>
+#include <vector>
+#include "Math/Vector3Batch.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates vectors for testing batch operations.  More vectors than fit
+/// in a single SIMD group are created to test any remaining individual vectors.
+/// @param[in]  offset - An offset to add to each component to vary vectors between calls.
+/// @return Vectors for testing (including a zero vector).
+std::vector<MATH::Vector3f> CreateTestVectors(const float offset)
+{
+    std::vector<MATH::Vector3f> vectors =
+    {
+        MATH::Vector3f(1.0f + offset, 2.0f, 3.0f),
+        MATH::Vector3f(-4.0f, 5.5f + offset, 0.25f),
+        MATH::Vector3f(0.0f, 0.0f, 0.0f),
+        MATH::Vector3f(100.0f, -0.001f, 7.0f + offset),
+        MATH::Vector3f(0.3f + offset, 0.3f, -0.3f),
+        MATH::Vector3f(-8.0f, -9.0f + offset, 10.0f),
+        MATH::Vector3f(0.0f, 1.0f, 0.0f + offset),
+    };
+    return vectors;
+}
+
+TEST_CASE("Vectors can be normalized in batches.", "[Vector3Batch][Normalize]")
+{
+    // CREATE THE VECTORS.
+    std::vector<MATH::Vector3f> vectors = CreateTestVectors(0.0f);
+    MATH::Vector3Batch batch = MATH::Vector3Batch::FromVectors(vectors);
+
+    // NORMALIZE THE VECTORS.
+    MATH::Vector3Batch normalized_batch;
+    MATH::Vector3Batch::Normalize(batch, normalized_batch);
+
+    // VERIFY THE VECTORS WERE NORMALIZED THE SAME AS INDIVIDUALLY.
+    REQUIRE(vectors.size() == normalized_batch.Count());
+    for (std::size_t vector_index = 0; vector_index < vectors.size(); ++vector_index)
+    {
+        MATH::Vector3f expected_normalized_vector = MATH::Vector3f::Normalize(vectors[vector_index]);
+        REQUIRE(expected_normalized_vector == normalized_batch.Get(vector_index));
+    }
+}
+
+TEST_CASE("Vectors can be quickly normalized in batches within documented error bounds.", "[Vector3Batch][Normalize]")
+{
+    // CREATE THE VECTORS.
+    std::vector<MATH::Vector3f> vectors = CreateTestVectors(0.0f);
+    MATH::Vector3Batch batch = MATH::Vector3Batch::FromVectors(vectors);
+
+    // NORMALIZE THE VECTORS IN-PLACE.
+    MATH::Vector3Batch::FastNormalize(batch, batch);
+
+    // VERIFY THE VECTORS WERE NORMALIZED WITHIN THE ERROR BOUNDS.
+    const float MAX_RELATIVE_ERROR = 1e-6f;
+    REQUIRE(vectors.size() == batch.Count());
+    for (std::size_t vector_index = 0; vector_index < vectors.size(); ++vector_index)
+    {
+        MATH::Vector3f expected_normalized_vector = MATH::Vector3f::Normalize(vectors[vector_index]);
+        MATH::Vector3f actual_normalized_vector = batch.Get(vector_index);
+        REQUIRE(std::abs(expected_normalized_vector.X - actual_normalized_vector.X) <= MAX_RELATIVE_ERROR * std::abs(expected_normalized_vector.X));
+        REQUIRE(std::abs(expected_normalized_vector.Y - actual_normalized_vector.Y) <= MAX_RELATIVE_ERROR * std::abs(expected_normalized_vector.Y));
+        REQUIRE(std::abs(expected_normalized_vector.Z - actual_normalized_vector.Z) <= MAX_RELATIVE_ERROR * std::abs(expected_normalized_vector.Z));
+    }
+}
+
+TEST_CASE("Dot and cross products can be computed in batches.", "[Vector3Batch][Products]")
+{
+    // CREATE THE VECTORS.
+    std::vector<MATH::Vector3f> vectors_1 = CreateTestVectors(0.0f);
+    std::vector<MATH::Vector3f> vectors_2 = CreateTestVectors(0.5f);
+    MATH::Vector3Batch batch_1 = MATH::Vector3Batch::FromVectors(vectors_1);
+    MATH::Vector3Batch batch_2 = MATH::Vector3Batch::FromVectors(vectors_2);
+
+    // COMPUTE THE PRODUCTS.
+    std::vector<float> dot_products;
+    MATH::Vector3Batch::DotProduct(batch_1, batch_2, dot_products);
+    MATH::Vector3Batch cross_products;
+    MATH::Vector3Batch::CrossProduct(batch_1, batch_2, cross_products);
+
+    // VERIFY THE PRODUCTS MATCH THOSE COMPUTED INDIVIDUALLY.
+    REQUIRE(vectors_1.size() == dot_products.size());
+    REQUIRE(vectors_1.size() == cross_products.Count());
+    for (std::size_t vector_index = 0; vector_index < vectors_1.size(); ++vector_index)
+    {
+        float expected_dot_product = MATH::Vector3f::DotProduct(vectors_1[vector_index], vectors_2[vector_index]);
+        REQUIRE(expected_dot_product == dot_products[vector_index]);
+
+        MATH::Vector3f expected_cross_product = MATH::Vector3f::CrossProduct(vectors_1[vector_index], vectors_2[vector_index]);
+        REQUIRE(expected_cross_product == cross_products.Get(vector_index));
+    }
+}
+
+TEST_CASE("Vectors can be transformed in batches.", "[Vector3Batch][Transform]")
+{
+    // CREATE THE VECTORS AND TRANSFORM.
+    std::vector<MATH::Vector3f> vectors = CreateTestVectors(0.0f);
+    MATH::Vector3Batch batch = MATH::Vector3Batch::FromVectors(vectors);
+    MATH::Matrix4x4f transform = 
+        MATH::Matrix4x4f::Translation(MATH::Vector3f(1.0f, -2.0f, 3.0f)) *
+        MATH::Matrix4x4f::RotateY(MATH::Angle<float>::Radians(0.5f)) *
+        MATH::Matrix4x4f::Scale(MATH::Vector3f(2.0f, 3.0f, 4.0f));
+
+    // TRANSFORM THE VECTORS AS BOTH POSITIONS AND DIRECTIONS.
+    MATH::Vector3Batch transformed_positions;
+    MATH::Vector3Batch::Transform(transform, batch, 1.0f, transformed_positions);
+    MATH::Vector3Batch transformed_directions;
+    MATH::Vector3Batch::Transform(transform, batch, 0.0f, transformed_directions);
+
+    // VERIFY THE VECTORS WERE TRANSFORMED THE SAME AS INDIVIDUALLY.
+    REQUIRE(vectors.size() == transformed_positions.Count());
+    REQUIRE(vectors.size() == transformed_directions.Count());
+    for (std::size_t vector_index = 0; vector_index < vectors.size(); ++vector_index)
+    {
+        const MATH::Vector3f& vector = vectors[vector_index];
+
+        MATH::Vector4f expected_position = transform * MATH::Vector4f(vector.X, vector.Y, vector.Z, 1.0f);
+        REQUIRE(MATH::Vector3f(expected_position.X, expected_position.Y, expected_position.Z) == transformed_positions.Get(vector_index));
+
+        MATH::Vector4f expected_direction = transform * MATH::Vector4f(vector.X, vector.Y, vector.Z, 0.0f);
+        REQUIRE(MATH::Vector3f(expected_direction.X, expected_direction.Y, expected_direction.Z) == transformed_directions.Get(vector_index));
+    }
+}
@@ -0,0 +1,88 @@
+#include <atomic>
+#include <vector>
+#include "Threading/ThreadPool.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Thread pools default to at least one thread.", "[ThreadPool]")
+{
+    THREADING::ThreadPool thread_pool;
+    REQUIRE(thread_pool.ThreadCount() >= 1);
+}
+
+TEST_CASE("Results of tasks are provided via futures.", "[ThreadPool]")
+{
+    THREADING::ThreadPool thread_pool(2);
+
+    THREADING::TaskHandle<int> result = thread_pool.Submit([]() { return 6 * 7; });
+
+    REQUIRE(42 == result.Get());
+}
+
+TEST_CASE("All submitted tasks are run before thread pools are destroyed.", "[ThreadPool]")
+{
+    constexpr int TASK_COUNT = 1000;
+    std::atomic<int> completed_task_count = 0;
+    {
+        THREADING::ThreadPool thread_pool(4);
+        for (int task_index = 0; task_index < TASK_COUNT; ++task_index)
+        {
+            thread_pool.Submit([&completed_task_count]() { ++completed_task_count; });
+        }
+    }
+
+    REQUIRE(TASK_COUNT == completed_task_count);
+}
+
+TEST_CASE("Tasks can wait on other tasks without deadlocking a single thread.", "[ThreadPool]")
+{
+    // The only worker runs the outer task, so the inner task can only run
+    // if waiting runs it on the waiting thread.
+    THREADING::ThreadPool thread_pool(1);
+
+    THREADING::TaskHandle<int> outer_result = thread_pool.Submit([&thread_pool]()
+    {
+        THREADING::TaskHandle<int> inner_result = thread_pool.Submit([]() { return 1; });
+        return inner_result.Get() + 1;
+    });
+
+    REQUIRE(2 == outer_result.Get());
+}
+
+TEST_CASE("Waiting on a task only runs that task on the waiting thread.", "[ThreadPool]")
+{
+    // The only worker runs the outer task, so the unrelated task queued before the inner
+    // task can only have run by the time the inner task finishes if waiting ran it.
+    THREADING::ThreadPool thread_pool(1);
+    std::atomic<bool> unrelated_task_run = false;
+
+    THREADING::TaskHandle<bool> outer_result = thread_pool.Submit([&thread_pool, &unrelated_task_run]()
+    {
+        thread_pool.Submit([&unrelated_task_run]() { unrelated_task_run = true; });
+        THREADING::TaskHandle<int> inner_result = thread_pool.Submit([]() { return 1; });
+        inner_result.Wait();
+        return unrelated_task_run.load();
+    });
+
+    REQUIRE_FALSE(outer_result.Get());
+}
+
+TEST_CASE("Tasks are only run once, even if waited on by multiple threads.", "[ThreadPool]")
+{
+    THREADING::ThreadPool thread_pool(4);
+    std::atomic<int> run_count = 0;
+
+    THREADING::TaskHandle<void> task = thread_pool.Submit([&run_count]() { ++run_count; });
+    std::vector<THREADING::TaskHandle<void>> waiting_tasks;
+    for (int waiting_task_index = 0; waiting_task_index < 8; ++waiting_task_index)
+    {
+        waiting_tasks.push_back(thread_pool.Submit([task]() { task.Wait(); }));
+    }
+    task.Wait();
+    for (const THREADING::TaskHandle<void>& waiting_task : waiting_tasks)
+    {
+        waiting_task.Wait();
+    }
+
+    REQUIRE(task.IsReady());
+    REQUIRE(1 == run_count);
+}